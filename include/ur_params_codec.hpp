@@ -0,0 +1,14551 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions.
+ * See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_params_codec.hpp
+ * @version v0.12-r0
+ *
+ * Binary records of function parameters, which can be printed later in the
+ * same format as ur::extras::printFunctionParams. Kept apart from
+ * ur_print.hpp, so that only users of the records have to parse them.
+ *
+ */
+#ifndef UR_PARAMS_CODEC_HPP
+#define UR_PARAMS_CODEC_HPP 1
+
+#include "ur_print.hpp"
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ur::details {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Writes function parameters into binary records.
+///
+/// Values that can be printed without following a pointer, e.g. scalars,
+/// enumerations and handles, are copied as they are. Strings, and arrays whose
+/// length is given by another parameter, are prefixed with their length and
+/// the pointer that was passed. Anything else is formatted as text right away.
+class ParamWriter {
+public:
+  explicit ParamWriter(std::vector<uint8_t> &out) : out(out) {}
+
+  template <typename T> void value(const T &value) {
+    bytes(&value, sizeof(value));
+  }
+
+  void address(const void *ptr) {
+    value(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr)));
+  }
+
+  void string(const char *str) {
+    address(str);
+    if (str) {
+      auto length = static_cast<uint32_t>(std::strlen(str));
+      value(length);
+      bytes(str, length);
+    }
+  }
+
+  template <typename T> void pointee(const T *ptr) {
+    address(ptr);
+    if (ptr) {
+      value(*ptr);
+    }
+  }
+
+  template <typename T> void range(const T *ptr, size_t count) {
+    address(ptr);
+    if (ptr) {
+      value(static_cast<uint64_t>(count));
+      bytes(ptr, count * sizeof(T));
+    }
+  }
+
+  void text(const std::string &text) {
+    value(static_cast<uint32_t>(text.size()));
+    bytes(text.data(), text.size());
+  }
+
+  void bytes(const void *data, size_t size) {
+    auto begin = static_cast<const uint8_t *>(data);
+    out.insert(out.end(), begin, begin + size);
+  }
+
+private:
+  std::vector<uint8_t> &out;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Reads back binary records of ParamWriter, printing them the way
+/// the parameters they were made of are printed. Reading past the end of a
+/// record yields zeros and marks the record as truncated.
+class ParamReader {
+public:
+  ParamReader(const uint8_t *data, size_t size) : cur(data), end(data + size) {}
+
+  template <typename T> std::remove_cv_t<T> value() {
+    std::remove_cv_t<T> value{};
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  const void *address() {
+    return reinterpret_cast<const void *>(
+        static_cast<uintptr_t>(value<uint64_t>()));
+  }
+
+  void printString(std::ostream &os) {
+    auto ptr = address();
+    if (ptr == nullptr) {
+      os << "nullptr";
+      return;
+    }
+    auto length = value<uint32_t>();
+    auto str = reinterpret_cast<const char *>(cur);
+    os << ptr << " (";
+    os.write(str, take(length));
+    os << ")";
+  }
+
+  template <typename T> void printPointee(std::ostream &os) {
+    auto ptr = address();
+    if (ptr == nullptr) {
+      os << "nullptr";
+      return;
+    }
+    auto pointee = value<T>();
+    os << ptr << " (";
+    if constexpr (std::is_pointer_v<T>) {
+      printPtr(os, pointee);
+    } else {
+      os << pointee;
+    }
+    os << ")";
+  }
+
+  /// Prints the pointer to the elements, returns false if it was null
+  template <typename T> bool beginRange(std::ostream &os, uint64_t &count) {
+    auto ptr = address();
+    printPtr(os, ptr);
+    if (ptr == nullptr) {
+      return false;
+    }
+    count = value<uint64_t>();
+    if (count > static_cast<uint64_t>(end - cur) / sizeof(T)) {
+      count = 0;
+      truncated = true;
+    }
+    return true;
+  }
+
+  void printText(std::ostream &os) {
+    auto length = value<uint32_t>();
+    auto text = reinterpret_cast<const char *>(cur);
+    os.write(text, take(length));
+  }
+
+  bool isTruncated() const { return truncated; }
+
+private:
+  void read(void *dst, size_t size) {
+    auto src = cur;
+    if (take(size) == size) {
+      std::memcpy(dst, src, size);
+    }
+  }
+
+  /// Consumes up to size bytes, returns how many bytes there were
+  size_t take(size_t size) {
+    if (size > static_cast<size_t>(end - cur)) {
+      truncated = true;
+      size = 0;
+    }
+    cur += size;
+    return size;
+  }
+
+  const uint8_t *cur;
+  const uint8_t *end;
+  bool truncated = false;
+};
+
+/// Size of the header of binary records, made of the function and the size
+/// of the parameters that follow
+inline constexpr size_t paramsRecordHeaderSize = 2 * sizeof(uint32_t);
+
+template <typename T>
+inline void decodeParams(std::ostream &os, ParamReader &r);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_loader_config_create_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_loader_config_create_params_t *params) {
+
+  w.pointee(*(params->pphLoaderConfig));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_loader_config_create_params_t type
+template <>
+inline void decodeParams<struct ur_loader_config_create_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".phLoaderConfig = ";
+  r.printPointee<ur_loader_config_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_loader_config_retain_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_loader_config_retain_params_t *params) {
+
+  w.value(*(params->phLoaderConfig));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_loader_config_retain_params_t type
+template <>
+inline void decodeParams<struct ur_loader_config_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hLoaderConfig = ";
+  {
+    auto value = r.value<ur_loader_config_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_loader_config_release_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_loader_config_release_params_t *params) {
+
+  w.value(*(params->phLoaderConfig));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_loader_config_release_params_t type
+template <>
+inline void decodeParams<struct ur_loader_config_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hLoaderConfig = ";
+  {
+    auto value = r.value<ur_loader_config_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_loader_config_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_loader_config_get_info_params_t *params) {
+
+  w.value(*(params->phLoaderConfig));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_loader_config_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_loader_config_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hLoaderConfig = ";
+  {
+    auto value = r.value<ur_loader_config_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_loader_config_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_loader_config_enable_layer_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_loader_config_enable_layer_params_t
+        *params) {
+
+  w.value(*(params->phLoaderConfig));
+
+  w.string(*(params->ppLayerName));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_loader_config_enable_layer_params_t type
+template <>
+inline void decodeParams<struct ur_loader_config_enable_layer_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hLoaderConfig = ";
+  {
+    auto value = r.value<ur_loader_config_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pLayerName = ";
+  r.printString(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_loader_config_set_code_location_callback_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_loader_config_set_code_location_callback_params_t *params) {
+
+  w.value(*(params->phLoaderConfig));
+
+  w.value(*(params->ppfnCodeloc));
+
+  w.value(*(params->ppUserData));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_loader_config_set_code_location_callback_params_t type
+template <>
+inline void
+decodeParams<struct ur_loader_config_set_code_location_callback_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hLoaderConfig = ";
+  {
+    auto value = r.value<ur_loader_config_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pfnCodeloc = ";
+  {
+    auto value = r.value<ur_code_location_callback_t>();
+
+    os << reinterpret_cast<void *>(value);
+  }
+
+  os << ", ";
+  os << ".pUserData = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_loader_config_set_mocking_enabled_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_loader_config_set_mocking_enabled_params_t
+        *params) {
+
+  w.value(*(params->phLoaderConfig));
+
+  w.value(*(params->penable));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_loader_config_set_mocking_enabled_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_loader_config_set_mocking_enabled_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hLoaderConfig = ";
+  {
+    auto value = r.value<ur_loader_config_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".enable = ";
+  {
+    auto value = r.value<ur_bool_t>();
+
+    os << value;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_platform_get_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_platform_get_params_t *params) {
+
+  w.range(*(params->pphAdapters), *(params->pNumAdapters));
+
+  w.value(*(params->pNumAdapters));
+
+  w.value(*(params->pNumEntries));
+
+  w.range(*(params->pphPlatforms), *(params->pNumEntries));
+
+  w.pointee(*(params->ppNumPlatforms));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_platform_get_params_t type
+template <>
+inline void
+decodeParams<struct ur_platform_get_params_t>([[maybe_unused]] std::ostream &os,
+                                              [[maybe_unused]] ParamReader &r) {
+
+  os << ".phAdapters = ";
+  uint64_t phAdaptersCount = 0;
+  if (r.beginRange<ur_adapter_handle_t>(os, phAdaptersCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phAdaptersCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_adapter_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".NumAdapters = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".NumEntries = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phPlatforms = ";
+  uint64_t phPlatformsCount = 0;
+  if (r.beginRange<ur_platform_handle_t>(os, phPlatformsCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phPlatformsCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_platform_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pNumPlatforms = ";
+  r.printPointee<uint32_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_platform_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_platform_get_info_params_t *params) {
+
+  w.value(*(params->phPlatform));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_platform_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_platform_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPlatform = ";
+  {
+    auto value = r.value<ur_platform_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_platform_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_platform_get_native_handle_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_platform_get_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phPlatform));
+
+  w.pointee(*(params->pphNativePlatform));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_platform_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_platform_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPlatform = ";
+  {
+    auto value = r.value<ur_platform_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phNativePlatform = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_platform_create_with_native_handle_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_platform_create_with_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phNativePlatform));
+
+  w.value(*(params->phAdapter));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphPlatform));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_platform_create_with_native_handle_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_platform_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativePlatform = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hAdapter = ";
+  {
+    auto value = r.value<ur_adapter_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phPlatform = ";
+  r.printPointee<ur_platform_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_platform_get_api_version_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_platform_get_api_version_params_t
+                 *params) {
+
+  w.value(*(params->phPlatform));
+
+  w.pointee(*(params->ppVersion));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_platform_get_api_version_params_t type
+template <>
+inline void decodeParams<struct ur_platform_get_api_version_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPlatform = ";
+  {
+    auto value = r.value<ur_platform_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pVersion = ";
+  r.printPointee<ur_api_version_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_platform_get_backend_option_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_platform_get_backend_option_params_t
+        *params) {
+
+  w.value(*(params->phPlatform));
+
+  w.string(*(params->ppFrontendOption));
+
+  {
+    std::ostringstream os;
+
+    os << ".ppPlatformOption = ";
+
+    ur::details::printPtr(os, *(params->pppPlatformOption));
+
+    w.text(os.str());
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_platform_get_backend_option_params_t type
+template <>
+inline void decodeParams<struct ur_platform_get_backend_option_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPlatform = ";
+  {
+    auto value = r.value<ur_platform_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pFrontendOption = ";
+  r.printString(os);
+
+  os << ", ";
+  r.printText(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_context_create_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_context_create_params_t *params) {
+
+  w.value(*(params->pDeviceCount));
+
+  w.range(*(params->pphDevices), *(params->pDeviceCount));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphContext));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_context_create_params_t type
+template <>
+inline void decodeParams<struct ur_context_create_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".DeviceCount = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phDevices = ";
+  uint64_t phDevicesCount = 0;
+  if (r.beginRange<const ur_device_handle_t>(os, phDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phContext = ";
+  r.printPointee<ur_context_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_context_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_context_retain_params_t *params) {
+
+  w.value(*(params->phContext));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_context_retain_params_t type
+template <>
+inline void decodeParams<struct ur_context_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_context_release_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_context_release_params_t *params) {
+
+  w.value(*(params->phContext));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_context_release_params_t type
+template <>
+inline void decodeParams<struct ur_context_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_context_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_context_get_info_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_context_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_context_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_context_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_context_get_native_handle_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_context_get_native_handle_params_t
+                 *params) {
+
+  w.value(*(params->phContext));
+
+  w.pointee(*(params->pphNativeContext));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_context_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_context_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phNativeContext = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_context_create_with_native_handle_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_context_create_with_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phNativeContext));
+
+  w.value(*(params->phAdapter));
+
+  w.value(*(params->pnumDevices));
+
+  w.range(*(params->pphDevices), *(params->pnumDevices));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphContext));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_context_create_with_native_handle_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_context_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeContext = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hAdapter = ";
+  {
+    auto value = r.value<ur_adapter_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numDevices = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phDevices = ";
+  uint64_t phDevicesCount = 0;
+  if (r.beginRange<const ur_device_handle_t>(os, phDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phContext = ";
+  r.printPointee<ur_context_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_context_set_extended_deleter_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_context_set_extended_deleter_params_t
+        *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppfnDeleter));
+
+  w.value(*(params->ppUserData));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_context_set_extended_deleter_params_t type
+template <>
+inline void decodeParams<struct ur_context_set_extended_deleter_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pfnDeleter = ";
+  {
+    auto value = r.value<ur_context_extended_deleter_t>();
+
+    os << reinterpret_cast<void *>(value);
+  }
+
+  os << ", ";
+  os << ".pUserData = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_event_get_info_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_event_get_info_params_t *params) {
+
+  w.value(*(params->phEvent));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_event_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_event_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hEvent = ";
+  {
+    auto value = r.value<ur_event_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_event_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_event_get_profiling_info_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_event_get_profiling_info_params_t
+                 *params) {
+
+  w.value(*(params->phEvent));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_event_get_profiling_info_params_t type
+template <>
+inline void decodeParams<struct ur_event_get_profiling_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hEvent = ";
+  {
+    auto value = r.value<ur_event_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_profiling_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_event_wait_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_event_wait_params_t *params) {
+
+  w.value(*(params->pnumEvents));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEvents));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_event_wait_params_t type
+template <>
+inline void
+decodeParams<struct ur_event_wait_params_t>([[maybe_unused]] std::ostream &os,
+                                            [[maybe_unused]] ParamReader &r) {
+
+  os << ".numEvents = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_event_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_event_retain_params_t *params) {
+
+  w.value(*(params->phEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_event_retain_params_t type
+template <>
+inline void
+decodeParams<struct ur_event_retain_params_t>([[maybe_unused]] std::ostream &os,
+                                              [[maybe_unused]] ParamReader &r) {
+
+  os << ".hEvent = ";
+  {
+    auto value = r.value<ur_event_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_event_release_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_event_release_params_t *params) {
+
+  w.value(*(params->phEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_event_release_params_t type
+template <>
+inline void decodeParams<struct ur_event_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hEvent = ";
+  {
+    auto value = r.value<ur_event_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_event_get_native_handle_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_event_get_native_handle_params_t *params) {
+
+  w.value(*(params->phEvent));
+
+  w.pointee(*(params->pphNativeEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_event_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_event_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hEvent = ";
+  {
+    auto value = r.value<ur_event_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phNativeEvent = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_event_create_with_native_handle_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_event_create_with_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phNativeEvent));
+
+  w.value(*(params->phContext));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_event_create_with_native_handle_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_event_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeEvent = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_event_set_callback_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_event_set_callback_params_t *params) {
+
+  w.value(*(params->phEvent));
+
+  w.value(*(params->pexecStatus));
+
+  w.value(*(params->ppfnNotify));
+
+  w.value(*(params->ppUserData));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_event_set_callback_params_t type
+template <>
+inline void decodeParams<struct ur_event_set_callback_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hEvent = ";
+  {
+    auto value = r.value<ur_event_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".execStatus = ";
+  {
+    auto value = r.value<ur_execution_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pfnNotify = ";
+  {
+    auto value = r.value<ur_event_callback_t>();
+
+    os << reinterpret_cast<void *>(value);
+  }
+
+  os << ", ";
+  os << ".pUserData = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_create_with_il_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_create_with_il_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppIL));
+
+  w.value(*(params->plength));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphProgram));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_create_with_il_params_t type
+template <>
+inline void decodeParams<struct ur_program_create_with_il_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pIL = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".length = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phProgram = ";
+  r.printPointee<ur_program_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_create_with_binary_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_create_with_binary_params_t
+        *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->pnumDevices));
+
+  w.range(*(params->pphDevices), *(params->pnumDevices));
+
+  w.range(*(params->ppLengths), *(params->pnumDevices));
+
+  {
+    std::ostringstream os;
+
+    os << ".ppBinaries = ";
+    ur::details::printPtr(
+        os, reinterpret_cast<const void *>(*(params->pppBinaries)));
+    if (*(params->pppBinaries) != NULL) {
+      os << " {";
+      for (size_t i = 0; i < *params->pnumDevices; ++i) {
+        if (i != 0) {
+          os << ", ";
+        }
+
+        ur::details::printPtr(os, (*(params->pppBinaries))[i]);
+      }
+      os << "}";
+    }
+
+    w.text(os.str());
+  }
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphProgram));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_create_with_binary_params_t type
+template <>
+inline void decodeParams<struct ur_program_create_with_binary_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numDevices = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phDevices = ";
+  uint64_t phDevicesCount = 0;
+  if (r.beginRange<ur_device_handle_t>(os, phDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pLengths = ";
+  uint64_t pLengthsCount = 0;
+  if (r.beginRange<size_t>(os, pLengthsCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < pLengthsCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<size_t>();
+
+      os << value;
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phProgram = ";
+  r.printPointee<ur_program_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_build_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_program_build_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->ppOptions));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_build_params_t type
+template <>
+inline void decodeParams<struct ur_program_build_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pOptions = ";
+  r.printString(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_build_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_build_exp_params_t *params) {
+
+  w.value(*(params->phProgram));
+
+  w.value(*(params->pnumDevices));
+
+  w.range(*(params->pphDevices), *(params->pnumDevices));
+
+  w.string(*(params->ppOptions));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_build_exp_params_t type
+template <>
+inline void decodeParams<struct ur_program_build_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numDevices = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phDevices = ";
+  uint64_t phDevicesCount = 0;
+  if (r.beginRange<ur_device_handle_t>(os, phDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pOptions = ";
+  r.printString(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_compile_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_compile_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->ppOptions));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_compile_params_t type
+template <>
+inline void decodeParams<struct ur_program_compile_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pOptions = ";
+  r.printString(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_compile_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_compile_exp_params_t *params) {
+
+  w.value(*(params->phProgram));
+
+  w.value(*(params->pnumDevices));
+
+  w.range(*(params->pphDevices), *(params->pnumDevices));
+
+  w.string(*(params->ppOptions));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_compile_exp_params_t type
+template <>
+inline void decodeParams<struct ur_program_compile_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numDevices = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phDevices = ";
+  uint64_t phDevicesCount = 0;
+  if (r.beginRange<ur_device_handle_t>(os, phDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pOptions = ";
+  r.printString(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_link_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_program_link_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->pcount));
+
+  w.range(*(params->pphPrograms), *(params->pcount));
+
+  w.string(*(params->ppOptions));
+
+  w.pointee(*(params->pphProgram));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_link_params_t type
+template <>
+inline void
+decodeParams<struct ur_program_link_params_t>([[maybe_unused]] std::ostream &os,
+                                              [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".count = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phPrograms = ";
+  uint64_t phProgramsCount = 0;
+  if (r.beginRange<const ur_program_handle_t>(os, phProgramsCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phProgramsCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_program_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pOptions = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".phProgram = ";
+  r.printPointee<ur_program_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_link_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_link_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->pnumDevices));
+
+  w.range(*(params->pphDevices), *(params->pnumDevices));
+
+  w.value(*(params->pcount));
+
+  w.range(*(params->pphPrograms), *(params->pcount));
+
+  w.string(*(params->ppOptions));
+
+  w.pointee(*(params->pphProgram));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_link_exp_params_t type
+template <>
+inline void decodeParams<struct ur_program_link_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numDevices = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phDevices = ";
+  uint64_t phDevicesCount = 0;
+  if (r.beginRange<ur_device_handle_t>(os, phDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".count = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phPrograms = ";
+  uint64_t phProgramsCount = 0;
+  if (r.beginRange<const ur_program_handle_t>(os, phProgramsCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phProgramsCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_program_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pOptions = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".phProgram = ";
+  r.printPointee<ur_program_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_program_retain_params_t *params) {
+
+  w.value(*(params->phProgram));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_retain_params_t type
+template <>
+inline void decodeParams<struct ur_program_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_release_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_release_params_t *params) {
+
+  w.value(*(params->phProgram));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_release_params_t type
+template <>
+inline void decodeParams<struct ur_program_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_get_function_pointer_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_get_function_pointer_params_t
+        *params) {
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->ppFunctionName));
+
+  w.pointee(*(params->pppFunctionPointer));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_get_function_pointer_params_t type
+template <>
+inline void decodeParams<struct ur_program_get_function_pointer_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pFunctionName = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".ppFunctionPointer = ";
+  r.printPointee<void *>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_program_get_global_variable_pointer_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_program_get_global_variable_pointer_params_t *params) {
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->ppGlobalVariableName));
+
+  w.pointee(*(params->ppGlobalVariableSizeRet));
+
+  w.pointee(*(params->pppGlobalVariablePointerRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_program_get_global_variable_pointer_params_t type
+template <>
+inline void
+decodeParams<struct ur_program_get_global_variable_pointer_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pGlobalVariableName = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".pGlobalVariableSizeRet = ";
+  r.printPointee<size_t>(os);
+
+  os << ", ";
+  os << ".ppGlobalVariablePointerRet = ";
+  r.printPointee<void *>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_get_info_params_t *params) {
+
+  w.value(*(params->phProgram));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_program_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_program_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_get_build_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_get_build_info_params_t *params) {
+
+  w.value(*(params->phProgram));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_get_build_info_params_t type
+template <>
+inline void decodeParams<struct ur_program_get_build_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_program_build_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_program_set_specialization_constants_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_program_set_specialization_constants_params_t *params) {
+
+  w.value(*(params->phProgram));
+
+  w.value(*(params->pcount));
+
+  w.range(*(params->ppSpecConstants), *(params->pcount));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_program_set_specialization_constants_params_t type
+template <>
+inline void
+decodeParams<struct ur_program_set_specialization_constants_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".count = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSpecConstants = ";
+  uint64_t pSpecConstantsCount = 0;
+  if (r.beginRange<const ur_specialization_constant_info_t>(
+          os, pSpecConstantsCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < pSpecConstantsCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_specialization_constant_info_t>();
+
+      os << value;
+    }
+    os << "}";
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_get_native_handle_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_program_get_native_handle_params_t
+                 *params) {
+
+  w.value(*(params->phProgram));
+
+  w.pointee(*(params->pphNativeProgram));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_program_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phNativeProgram = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_program_create_with_native_handle_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_program_create_with_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phNativeProgram));
+
+  w.value(*(params->phContext));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphProgram));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_program_create_with_native_handle_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_program_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeProgram = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phProgram = ";
+  r.printPointee<ur_program_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_create_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_kernel_create_params_t *params) {
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->ppKernelName));
+
+  w.pointee(*(params->pphKernel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_create_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_create_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pKernelName = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".phKernel = ";
+  r.printPointee<ur_kernel_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_get_info_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_kernel_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_get_group_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_get_group_info_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_get_group_info_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_get_group_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_kernel_group_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_get_sub_group_info_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_kernel_get_sub_group_info_params_t
+                 *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_get_sub_group_info_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_get_sub_group_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_kernel_sub_group_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_kernel_retain_params_t *params) {
+
+  w.value(*(params->phKernel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_retain_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_release_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_kernel_release_params_t *params) {
+
+  w.value(*(params->phKernel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_release_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_get_native_handle_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_kernel_get_native_handle_params_t
+                 *params) {
+
+  w.value(*(params->phKernel));
+
+  w.pointee(*(params->pphNativeKernel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phNativeKernel = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_create_with_native_handle_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_create_with_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phNativeKernel));
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phProgram));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphKernel));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_create_with_native_handle_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_kernel_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeKernel = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phKernel = ";
+  r.printPointee<ur_kernel_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_kernel_get_suggested_local_work_size_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_kernel_get_suggested_local_work_size_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->pnumWorkDim));
+
+  w.pointee(*(params->ppGlobalWorkOffset));
+
+  w.pointee(*(params->ppGlobalWorkSize));
+
+  w.pointee(*(params->ppSuggestedLocalWorkSize));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_kernel_get_suggested_local_work_size_params_t type
+template <>
+inline void
+decodeParams<struct ur_kernel_get_suggested_local_work_size_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numWorkDim = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pGlobalWorkOffset = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pGlobalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pSuggestedLocalWorkSize = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_set_arg_value_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_set_arg_value_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pargIndex));
+
+  w.value(*(params->pargSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->ppArgValue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_set_arg_value_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_set_arg_value_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".argIndex = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".argSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pArgValue = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_set_arg_local_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_set_arg_local_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pargIndex));
+
+  w.value(*(params->pargSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_set_arg_local_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_set_arg_local_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".argIndex = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".argSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_set_arg_pointer_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_set_arg_pointer_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pargIndex));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->ppArgValue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_set_arg_pointer_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_set_arg_pointer_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".argIndex = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pArgValue = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_set_exec_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_set_exec_info_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_set_exec_info_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_set_exec_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_kernel_exec_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  r.printText(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_set_arg_sampler_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_set_arg_sampler_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pargIndex));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->phArgValue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_set_arg_sampler_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_set_arg_sampler_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".argIndex = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".hArgValue = ";
+  {
+    auto value = r.value<ur_sampler_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_kernel_set_arg_mem_obj_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_kernel_set_arg_mem_obj_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pargIndex));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->phArgValue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_kernel_set_arg_mem_obj_params_t type
+template <>
+inline void decodeParams<struct ur_kernel_set_arg_mem_obj_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".argIndex = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".hArgValue = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_kernel_set_specialization_constants_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_kernel_set_specialization_constants_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pcount));
+
+  w.pointee(*(params->ppSpecConstants));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_kernel_set_specialization_constants_params_t type
+template <>
+inline void
+decodeParams<struct ur_kernel_set_specialization_constants_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".count = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSpecConstants = ";
+  r.printPointee<const ur_specialization_constant_info_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_kernel_suggest_max_cooperative_group_count_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_kernel_suggest_max_cooperative_group_count_exp_params_t *params) {
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->pworkDim));
+
+  w.pointee(*(params->ppLocalWorkSize));
+
+  w.value(*(params->pdynamicSharedMemorySize));
+
+  w.pointee(*(params->ppGroupCountRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_kernel_suggest_max_cooperative_group_count_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".workDim = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pLocalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".dynamicSharedMemorySize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pGroupCountRet = ";
+  r.printPointee<uint32_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_queue_get_info_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_queue_get_info_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_queue_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_queue_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_queue_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_queue_create_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_queue_create_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphQueue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_queue_create_params_t type
+template <>
+inline void
+decodeParams<struct ur_queue_create_params_t>([[maybe_unused]] std::ostream &os,
+                                              [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phQueue = ";
+  r.printPointee<ur_queue_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_queue_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_queue_retain_params_t *params) {
+
+  w.value(*(params->phQueue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_queue_retain_params_t type
+template <>
+inline void
+decodeParams<struct ur_queue_retain_params_t>([[maybe_unused]] std::ostream &os,
+                                              [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_queue_release_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_queue_release_params_t *params) {
+
+  w.value(*(params->phQueue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_queue_release_params_t type
+template <>
+inline void decodeParams<struct ur_queue_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_queue_get_native_handle_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_queue_get_native_handle_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  {
+    std::ostringstream os;
+
+    os << ".pDesc = ";
+
+    ur::details::printPtr(os, *(params->ppDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphNativeQueue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_queue_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_queue_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phNativeQueue = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_queue_create_with_native_handle_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_queue_create_with_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phNativeQueue));
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphQueue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_queue_create_with_native_handle_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_queue_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeQueue = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phQueue = ";
+  r.printPointee<ur_queue_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_queue_finish_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_queue_finish_params_t *params) {
+
+  w.value(*(params->phQueue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_queue_finish_params_t type
+template <>
+inline void
+decodeParams<struct ur_queue_finish_params_t>([[maybe_unused]] std::ostream &os,
+                                              [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_queue_flush_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_queue_flush_params_t *params) {
+
+  w.value(*(params->phQueue));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_queue_flush_params_t type
+template <>
+inline void
+decodeParams<struct ur_queue_flush_params_t>([[maybe_unused]] std::ostream &os,
+                                             [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_sampler_create_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_sampler_create_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  {
+    std::ostringstream os;
+
+    os << ".pDesc = ";
+
+    ur::details::printPtr(os, *(params->ppDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphSampler));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_sampler_create_params_t type
+template <>
+inline void decodeParams<struct ur_sampler_create_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phSampler = ";
+  r.printPointee<ur_sampler_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_sampler_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_sampler_retain_params_t *params) {
+
+  w.value(*(params->phSampler));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_sampler_retain_params_t type
+template <>
+inline void decodeParams<struct ur_sampler_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hSampler = ";
+  {
+    auto value = r.value<ur_sampler_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_sampler_release_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_sampler_release_params_t *params) {
+
+  w.value(*(params->phSampler));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_sampler_release_params_t type
+template <>
+inline void decodeParams<struct ur_sampler_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hSampler = ";
+  {
+    auto value = r.value<ur_sampler_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_sampler_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_sampler_get_info_params_t *params) {
+
+  w.value(*(params->phSampler));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_sampler_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_sampler_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hSampler = ";
+  {
+    auto value = r.value<ur_sampler_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_sampler_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_sampler_get_native_handle_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_sampler_get_native_handle_params_t
+                 *params) {
+
+  w.value(*(params->phSampler));
+
+  w.pointee(*(params->pphNativeSampler));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_sampler_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_sampler_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hSampler = ";
+  {
+    auto value = r.value<ur_sampler_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phNativeSampler = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_sampler_create_with_native_handle_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_sampler_create_with_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phNativeSampler));
+
+  w.value(*(params->phContext));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphSampler));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_sampler_create_with_native_handle_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_sampler_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeSampler = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phSampler = ";
+  r.printPointee<ur_sampler_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_mem_image_create_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_mem_image_create_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->pflags));
+
+  w.pointee(*(params->ppImageFormat));
+
+  {
+    std::ostringstream os;
+
+    os << ".pImageDesc = ";
+
+    ur::details::printPtr(os, *(params->ppImageDesc));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->ppHost));
+
+  w.pointee(*(params->pphMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_mem_image_create_params_t type
+template <>
+inline void decodeParams<struct ur_mem_image_create_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".flags = ";
+  {
+    auto value = r.value<ur_mem_flags_t>();
+
+    ur::details::printFlag<ur_mem_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".pImageFormat = ";
+  r.printPointee<const ur_image_format_t>(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pHost = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phMem = ";
+  r.printPointee<ur_mem_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_mem_buffer_create_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_mem_buffer_create_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->pflags));
+
+  w.value(*(params->psize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphBuffer));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_mem_buffer_create_params_t type
+template <>
+inline void decodeParams<struct ur_mem_buffer_create_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".flags = ";
+  {
+    auto value = r.value<ur_mem_flags_t>();
+
+    ur::details::printFlag<ur_mem_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phBuffer = ";
+  r.printPointee<ur_mem_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_mem_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_mem_retain_params_t *params) {
+
+  w.value(*(params->phMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_mem_retain_params_t type
+template <>
+inline void
+decodeParams<struct ur_mem_retain_params_t>([[maybe_unused]] std::ostream &os,
+                                            [[maybe_unused]] ParamReader &r) {
+
+  os << ".hMem = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_mem_release_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_mem_release_params_t *params) {
+
+  w.value(*(params->phMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_mem_release_params_t type
+template <>
+inline void
+decodeParams<struct ur_mem_release_params_t>([[maybe_unused]] std::ostream &os,
+                                             [[maybe_unused]] ParamReader &r) {
+
+  os << ".hMem = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_mem_buffer_partition_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_mem_buffer_partition_params_t *params) {
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->pflags));
+
+  w.value(*(params->pbufferCreateType));
+
+  {
+    std::ostringstream os;
+
+    os << ".pRegion = ";
+
+    ur::details::printPtr(os, *(params->ppRegion));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_mem_buffer_partition_params_t type
+template <>
+inline void decodeParams<struct ur_mem_buffer_partition_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".flags = ";
+  {
+    auto value = r.value<ur_mem_flags_t>();
+
+    ur::details::printFlag<ur_mem_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".bufferCreateType = ";
+  {
+    auto value = r.value<ur_buffer_create_type_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phMem = ";
+  r.printPointee<ur_mem_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_mem_get_native_handle_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_mem_get_native_handle_params_t *params) {
+
+  w.value(*(params->phMem));
+
+  w.value(*(params->phDevice));
+
+  w.pointee(*(params->pphNativeMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_mem_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_mem_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hMem = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phNativeMem = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_mem_buffer_create_with_native_handle_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_mem_buffer_create_with_native_handle_params_t *params) {
+
+  w.value(*(params->phNativeMem));
+
+  w.value(*(params->phContext));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_mem_buffer_create_with_native_handle_params_t type
+template <>
+inline void
+decodeParams<struct ur_mem_buffer_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeMem = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phMem = ";
+  r.printPointee<ur_mem_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_mem_image_create_with_native_handle_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_mem_image_create_with_native_handle_params_t *params) {
+
+  w.value(*(params->phNativeMem));
+
+  w.value(*(params->phContext));
+
+  w.pointee(*(params->ppImageFormat));
+
+  {
+    std::ostringstream os;
+
+    os << ".pImageDesc = ";
+
+    ur::details::printPtr(os, *(params->ppImageDesc));
+
+    w.text(os.str());
+  }
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_mem_image_create_with_native_handle_params_t type
+template <>
+inline void
+decodeParams<struct ur_mem_image_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeMem = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pImageFormat = ";
+  r.printPointee<const ur_image_format_t>(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phMem = ";
+  r.printPointee<ur_mem_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_mem_get_info_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_mem_get_info_params_t *params) {
+
+  w.value(*(params->phMemory));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_mem_get_info_params_t type
+template <>
+inline void
+decodeParams<struct ur_mem_get_info_params_t>([[maybe_unused]] std::ostream &os,
+                                              [[maybe_unused]] ParamReader &r) {
+
+  os << ".hMemory = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_mem_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_mem_image_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_mem_image_get_info_params_t *params) {
+
+  w.value(*(params->phMemory));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_mem_image_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_mem_image_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hMemory = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_image_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_physical_mem_create_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_physical_mem_create_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->psize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphPhysicalMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_physical_mem_create_params_t type
+template <>
+inline void decodeParams<struct ur_physical_mem_create_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phPhysicalMem = ";
+  r.printPointee<ur_physical_mem_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_physical_mem_retain_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_physical_mem_retain_params_t *params) {
+
+  w.value(*(params->phPhysicalMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_physical_mem_retain_params_t type
+template <>
+inline void decodeParams<struct ur_physical_mem_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPhysicalMem = ";
+  {
+    auto value = r.value<ur_physical_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_physical_mem_release_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_physical_mem_release_params_t *params) {
+
+  w.value(*(params->phPhysicalMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_physical_mem_release_params_t type
+template <>
+inline void decodeParams<struct ur_physical_mem_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPhysicalMem = ";
+  {
+    auto value = r.value<ur_physical_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_physical_mem_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_physical_mem_get_info_params_t *params) {
+
+  w.value(*(params->phPhysicalMem));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_physical_mem_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_physical_mem_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPhysicalMem = ";
+  {
+    auto value = r.value<ur_physical_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_physical_mem_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_adapter_get_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_adapter_get_params_t *params) {
+
+  w.value(*(params->pNumEntries));
+
+  w.range(*(params->pphAdapters), *(params->pNumEntries));
+
+  w.pointee(*(params->ppNumAdapters));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_adapter_get_params_t type
+template <>
+inline void
+decodeParams<struct ur_adapter_get_params_t>([[maybe_unused]] std::ostream &os,
+                                             [[maybe_unused]] ParamReader &r) {
+
+  os << ".NumEntries = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phAdapters = ";
+  uint64_t phAdaptersCount = 0;
+  if (r.beginRange<ur_adapter_handle_t>(os, phAdaptersCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phAdaptersCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_adapter_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pNumAdapters = ";
+  r.printPointee<uint32_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_adapter_release_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_adapter_release_params_t *params) {
+
+  w.value(*(params->phAdapter));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_adapter_release_params_t type
+template <>
+inline void decodeParams<struct ur_adapter_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hAdapter = ";
+  {
+    auto value = r.value<ur_adapter_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_adapter_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_adapter_retain_params_t *params) {
+
+  w.value(*(params->phAdapter));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_adapter_retain_params_t type
+template <>
+inline void decodeParams<struct ur_adapter_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hAdapter = ";
+  {
+    auto value = r.value<ur_adapter_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_adapter_get_last_error_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_adapter_get_last_error_params_t *params) {
+
+  w.value(*(params->phAdapter));
+
+  {
+    std::ostringstream os;
+
+    os << ".ppMessage = ";
+
+    ur::details::printPtr(os, *(params->pppMessage));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppError));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_adapter_get_last_error_params_t type
+template <>
+inline void decodeParams<struct ur_adapter_get_last_error_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hAdapter = ";
+  {
+    auto value = r.value<ur_adapter_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pError = ";
+  r.printPointee<int32_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_adapter_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_adapter_get_info_params_t *params) {
+
+  w.value(*(params->phAdapter));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_adapter_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_adapter_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hAdapter = ";
+  {
+    auto value = r.value<ur_adapter_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_adapter_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_kernel_launch_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_kernel_launch_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pworkDim));
+
+  w.pointee(*(params->ppGlobalWorkOffset));
+
+  w.pointee(*(params->ppGlobalWorkSize));
+
+  w.pointee(*(params->ppLocalWorkSize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_kernel_launch_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_kernel_launch_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".workDim = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pGlobalWorkOffset = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pGlobalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pLocalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_events_wait_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_events_wait_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_events_wait_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_events_wait_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_events_wait_with_barrier_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_events_wait_with_barrier_params_t
+        *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_events_wait_with_barrier_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_enqueue_events_wait_with_barrier_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_buffer_read_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_buffer_read_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->pblockingRead));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_buffer_read_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_buffer_read_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blockingRead = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_buffer_write_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_enqueue_mem_buffer_write_params_t
+                 *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->pblockingWrite));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_buffer_write_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_buffer_write_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blockingWrite = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_buffer_read_rect_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_buffer_read_rect_params_t
+        *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->pblockingRead));
+
+  w.value(*(params->pbufferOrigin));
+
+  w.value(*(params->phostOrigin));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->pbufferRowPitch));
+
+  w.value(*(params->pbufferSlicePitch));
+
+  w.value(*(params->phostRowPitch));
+
+  w.value(*(params->phostSlicePitch));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_buffer_read_rect_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_buffer_read_rect_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blockingRead = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_buffer_write_rect_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_buffer_write_rect_params_t
+        *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->pblockingWrite));
+
+  w.value(*(params->pbufferOrigin));
+
+  w.value(*(params->phostOrigin));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->pbufferRowPitch));
+
+  w.value(*(params->pbufferSlicePitch));
+
+  w.value(*(params->phostRowPitch));
+
+  w.value(*(params->phostSlicePitch));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_buffer_write_rect_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_buffer_write_rect_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blockingWrite = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_buffer_copy_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_buffer_copy_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phBufferSrc));
+
+  w.value(*(params->phBufferDst));
+
+  w.value(*(params->psrcOffset));
+
+  w.value(*(params->pdstOffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_buffer_copy_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_buffer_copy_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBufferSrc = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBufferDst = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".srcOffset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstOffset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_buffer_copy_rect_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_buffer_copy_rect_params_t
+        *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phBufferSrc));
+
+  w.value(*(params->phBufferDst));
+
+  w.value(*(params->psrcOrigin));
+
+  w.value(*(params->pdstOrigin));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->psrcRowPitch));
+
+  w.value(*(params->psrcSlicePitch));
+
+  w.value(*(params->pdstRowPitch));
+
+  w.value(*(params->pdstSlicePitch));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_buffer_copy_rect_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_buffer_copy_rect_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBufferSrc = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBufferDst = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".srcOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".srcRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".srcSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_buffer_fill_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_buffer_fill_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->ppPattern));
+
+  w.value(*(params->ppatternSize));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_buffer_fill_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_buffer_fill_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pPattern = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".patternSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_image_read_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_image_read_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phImage));
+
+  w.value(*(params->pblockingRead));
+
+  w.value(*(params->porigin));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->prowPitch));
+
+  w.value(*(params->pslicePitch));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_image_read_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_image_read_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImage = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blockingRead = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".origin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".rowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".slicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_image_write_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_image_write_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phImage));
+
+  w.value(*(params->pblockingWrite));
+
+  w.value(*(params->porigin));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->prowPitch));
+
+  w.value(*(params->pslicePitch));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_image_write_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_image_write_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImage = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blockingWrite = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".origin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".rowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".slicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_image_copy_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_image_copy_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phImageSrc));
+
+  w.value(*(params->phImageDst));
+
+  w.value(*(params->psrcOrigin));
+
+  w.value(*(params->pdstOrigin));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_image_copy_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_image_copy_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImageSrc = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImageDst = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".srcOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_buffer_map_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_buffer_map_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->pblockingMap));
+
+  w.value(*(params->pmapFlags));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pppRetMap));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_buffer_map_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_buffer_map_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blockingMap = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".mapFlags = ";
+  {
+    auto value = r.value<ur_map_flags_t>();
+
+    ur::details::printFlag<ur_map_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".ppRetMap = ";
+  r.printPointee<void *>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_mem_unmap_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_mem_unmap_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phMem));
+
+  w.value(*(params->ppMappedPtr));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_mem_unmap_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_mem_unmap_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hMem = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMappedPtr = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_usm_fill_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_usm_fill_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->ppMem));
+
+  w.value(*(params->ppatternSize));
+
+  w.value(*(params->ppPattern));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_usm_fill_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_usm_fill_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMem = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".patternSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pPattern = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_usm_memcpy_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_usm_memcpy_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->pblocking));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_usm_memcpy_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_usm_memcpy_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blocking = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_usm_prefetch_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_usm_prefetch_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->ppMem));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pflags));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_usm_prefetch_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_usm_prefetch_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMem = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".flags = ";
+  {
+    auto value = r.value<ur_usm_migration_flags_t>();
+
+    ur::details::printFlag<ur_usm_migration_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_usm_advise_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_usm_advise_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->ppMem));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->padvice));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_usm_advise_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_usm_advise_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMem = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".advice = ";
+  {
+    auto value = r.value<ur_usm_advice_flags_t>();
+
+    ur::details::printFlag<ur_usm_advice_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_usm_fill_2d_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_usm_fill_2d_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->ppMem));
+
+  w.value(*(params->ppitch));
+
+  w.value(*(params->ppatternSize));
+
+  w.value(*(params->ppPattern));
+
+  w.value(*(params->pwidth));
+
+  w.value(*(params->pheight));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_usm_fill_2d_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_usm_fill_2d_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMem = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".patternSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pPattern = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".width = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".height = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_usm_memcpy_2d_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_usm_memcpy_2d_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->pblocking));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->pdstPitch));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->psrcPitch));
+
+  w.value(*(params->pwidth));
+
+  w.value(*(params->pheight));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_usm_memcpy_2d_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_usm_memcpy_2d_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blocking = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".dstPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".srcPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".width = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".height = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_enqueue_device_global_variable_write_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_enqueue_device_global_variable_write_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->pname));
+
+  w.value(*(params->pblockingWrite));
+
+  w.value(*(params->pcount));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_enqueue_device_global_variable_write_params_t type
+template <>
+inline void
+decodeParams<struct ur_enqueue_device_global_variable_write_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".name = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".blockingWrite = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".count = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_enqueue_device_global_variable_read_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_enqueue_device_global_variable_read_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->pname));
+
+  w.value(*(params->pblockingRead));
+
+  w.value(*(params->pcount));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_enqueue_device_global_variable_read_params_t type
+template <>
+inline void
+decodeParams<struct ur_enqueue_device_global_variable_read_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".name = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".blockingRead = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".count = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_read_host_pipe_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_read_host_pipe_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->ppipe_symbol));
+
+  w.value(*(params->pblocking));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_read_host_pipe_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_read_host_pipe_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pipe_symbol = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".blocking = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_write_host_pipe_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_write_host_pipe_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phProgram));
+
+  w.string(*(params->ppipe_symbol));
+
+  w.value(*(params->pblocking));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_write_host_pipe_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_write_host_pipe_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hProgram = ";
+  {
+    auto value = r.value<ur_program_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pipe_symbol = ";
+  r.printString(os);
+
+  os << ", ";
+  os << ".blocking = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_kernel_launch_custom_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_kernel_launch_custom_exp_params_t
+        *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pworkDim));
+
+  w.pointee(*(params->ppGlobalWorkOffset));
+
+  w.pointee(*(params->ppGlobalWorkSize));
+
+  w.pointee(*(params->ppLocalWorkSize));
+
+  w.value(*(params->pnumPropsInLaunchPropList));
+
+  {
+    std::ostringstream os;
+
+    os << ".launchPropList = ";
+    ur::details::printPtr(
+        os, reinterpret_cast<const void *>(*(params->plaunchPropList)));
+    if (*(params->plaunchPropList) != NULL) {
+      os << " {";
+      for (size_t i = 0; i < *params->pnumPropsInLaunchPropList; ++i) {
+        if (i != 0) {
+          os << ", ";
+        }
+
+        os << (*(params->plaunchPropList))[i];
+      }
+      os << "}";
+    }
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_kernel_launch_custom_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_enqueue_kernel_launch_custom_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".workDim = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pGlobalWorkOffset = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pGlobalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pLocalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".numPropsInLaunchPropList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_enqueue_events_wait_with_barrier_ext_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_enqueue_events_wait_with_barrier_ext_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_enqueue_events_wait_with_barrier_ext_params_t type
+template <>
+inline void
+decodeParams<struct ur_enqueue_events_wait_with_barrier_ext_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_enqueue_cooperative_kernel_launch_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_enqueue_cooperative_kernel_launch_exp_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pworkDim));
+
+  w.pointee(*(params->ppGlobalWorkOffset));
+
+  w.pointee(*(params->ppGlobalWorkSize));
+
+  w.pointee(*(params->ppLocalWorkSize));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_enqueue_cooperative_kernel_launch_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_enqueue_cooperative_kernel_launch_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".workDim = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pGlobalWorkOffset = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pGlobalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pLocalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_timestamp_recording_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_timestamp_recording_exp_params_t
+        *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->pblocking));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_timestamp_recording_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_enqueue_timestamp_recording_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".blocking = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_enqueue_native_command_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_enqueue_native_command_exp_params_t
+        *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->ppfnNativeEnqueue));
+
+  w.value(*(params->pdata));
+
+  w.value(*(params->pnumMemsInMemList));
+
+  w.range(*(params->pphMemList), *(params->pnumMemsInMemList));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_enqueue_native_command_exp_params_t type
+template <>
+inline void decodeParams<struct ur_enqueue_native_command_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pfnNativeEnqueue = ";
+  {
+    auto value = r.value<ur_exp_enqueue_native_command_function_t>();
+
+    os << reinterpret_cast<void *>(value);
+  }
+
+  os << ", ";
+  os << ".data = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numMemsInMemList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phMemList = ";
+  uint64_t phMemListCount = 0;
+  if (r.beginRange<const ur_mem_handle_t>(os, phMemListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phMemListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_mem_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_unsampled_image_handle_destroy_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_bindless_images_unsampled_image_handle_destroy_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phImage));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_unsampled_image_handle_destroy_exp_params_t type
+template <>
+inline void decodeParams<
+    struct ur_bindless_images_unsampled_image_handle_destroy_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImage = ";
+  {
+    auto value = r.value<ur_exp_image_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_sampled_image_handle_destroy_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_bindless_images_sampled_image_handle_destroy_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phImage));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_sampled_image_handle_destroy_exp_params_t type
+template <>
+inline void decodeParams<
+    struct ur_bindless_images_sampled_image_handle_destroy_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImage = ";
+  {
+    auto value = r.value<ur_exp_image_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_bindless_images_image_allocate_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_bindless_images_image_allocate_exp_params_t
+        *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.pointee(*(params->ppImageFormat));
+
+  {
+    std::ostringstream os;
+
+    os << ".pImageDesc = ";
+
+    ur::details::printPtr(os, *(params->ppImageDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphImageMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_bindless_images_image_allocate_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_bindless_images_image_allocate_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pImageFormat = ";
+  r.printPointee<const ur_image_format_t>(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phImageMem = ";
+  r.printPointee<ur_exp_image_mem_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_bindless_images_image_free_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_bindless_images_image_free_exp_params_t
+        *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phImageMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_bindless_images_image_free_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_bindless_images_image_free_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImageMem = ";
+  {
+    auto value = r.value<ur_exp_image_mem_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_unsampled_image_create_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_bindless_images_unsampled_image_create_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phImageMem));
+
+  w.pointee(*(params->ppImageFormat));
+
+  {
+    std::ostringstream os;
+
+    os << ".pImageDesc = ";
+
+    ur::details::printPtr(os, *(params->ppImageDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphImage));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_unsampled_image_create_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_unsampled_image_create_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImageMem = ";
+  {
+    auto value = r.value<ur_exp_image_mem_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".pImageFormat = ";
+  r.printPointee<const ur_image_format_t>(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phImage = ";
+  r.printPointee<ur_exp_image_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_sampled_image_create_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_bindless_images_sampled_image_create_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phImageMem));
+
+  w.pointee(*(params->ppImageFormat));
+
+  {
+    std::ostringstream os;
+
+    os << ".pImageDesc = ";
+
+    ur::details::printPtr(os, *(params->ppImageDesc));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->phSampler));
+
+  w.pointee(*(params->pphImage));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_sampled_image_create_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_sampled_image_create_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImageMem = ";
+  {
+    auto value = r.value<ur_exp_image_mem_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".pImageFormat = ";
+  r.printPointee<const ur_image_format_t>(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".hSampler = ";
+  {
+    auto value = r.value<ur_sampler_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phImage = ";
+  r.printPointee<ur_exp_image_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_bindless_images_image_copy_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_bindless_images_image_copy_exp_params_t
+        *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->ppDst));
+
+  {
+    std::ostringstream os;
+
+    os << ".pSrcImageDesc = ";
+
+    ur::details::printPtr(os, *(params->ppSrcImageDesc));
+
+    w.text(os.str());
+  }
+
+  {
+    std::ostringstream os;
+
+    os << ".pDstImageDesc = ";
+
+    ur::details::printPtr(os, *(params->ppDstImageDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppSrcImageFormat));
+
+  w.pointee(*(params->ppDstImageFormat));
+
+  {
+    std::ostringstream os;
+
+    os << ".pCopyRegion = ";
+
+    ur::details::printPtr(os, *(params->ppCopyRegion));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->pimageCopyFlags));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_bindless_images_image_copy_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_bindless_images_image_copy_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pSrcImageFormat = ";
+  r.printPointee<const ur_image_format_t>(os);
+
+  os << ", ";
+  os << ".pDstImageFormat = ";
+  r.printPointee<const ur_image_format_t>(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".imageCopyFlags = ";
+  {
+    auto value = r.value<ur_exp_image_copy_flags_t>();
+
+    ur::details::printFlag<ur_exp_image_copy_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_bindless_images_image_get_info_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_bindless_images_image_get_info_exp_params_t
+        *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phImageMem));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppPropValue));
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_bindless_images_image_get_info_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_bindless_images_image_get_info_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImageMem = ";
+  {
+    auto value = r.value<ur_exp_image_mem_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_image_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pPropValue = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_mipmap_get_level_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_bindless_images_mipmap_get_level_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phImageMem));
+
+  w.value(*(params->pmipmapLevel));
+
+  w.pointee(*(params->pphImageMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_mipmap_get_level_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_mipmap_get_level_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hImageMem = ";
+  {
+    auto value = r.value<ur_exp_image_mem_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".mipmapLevel = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phImageMem = ";
+  r.printPointee<ur_exp_image_mem_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_bindless_images_mipmap_free_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_bindless_images_mipmap_free_exp_params_t
+        *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_bindless_images_mipmap_free_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_bindless_images_mipmap_free_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hMem = ";
+  {
+    auto value = r.value<ur_exp_image_mem_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_import_external_memory_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_bindless_images_import_external_memory_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pmemHandleType));
+
+  {
+    std::ostringstream os;
+
+    os << ".pExternalMemDesc = ";
+
+    ur::details::printPtr(os, *(params->ppExternalMemDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphExternalMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_import_external_memory_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_import_external_memory_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".memHandleType = ";
+  {
+    auto value = r.value<ur_exp_external_mem_type_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phExternalMem = ";
+  r.printPointee<ur_exp_external_mem_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_map_external_array_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_bindless_images_map_external_array_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.pointee(*(params->ppImageFormat));
+
+  {
+    std::ostringstream os;
+
+    os << ".pImageDesc = ";
+
+    ur::details::printPtr(os, *(params->ppImageDesc));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->phExternalMem));
+
+  w.pointee(*(params->pphImageMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_map_external_array_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_map_external_array_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pImageFormat = ";
+  r.printPointee<const ur_image_format_t>(os);
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".hExternalMem = ";
+  {
+    auto value = r.value<ur_exp_external_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phImageMem = ";
+  r.printPointee<ur_exp_image_mem_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_map_external_linear_memory_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_bindless_images_map_external_linear_memory_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->phExternalMem));
+
+  w.pointee(*(params->pppRetMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_map_external_linear_memory_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_map_external_linear_memory_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<uint64_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<uint64_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hExternalMem = ";
+  {
+    auto value = r.value<ur_exp_external_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".ppRetMem = ";
+  r.printPointee<void *>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_release_external_memory_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_bindless_images_release_external_memory_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phExternalMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_release_external_memory_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_release_external_memory_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hExternalMem = ";
+  {
+    auto value = r.value<ur_exp_external_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_import_external_semaphore_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_bindless_images_import_external_semaphore_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->psemHandleType));
+
+  {
+    std::ostringstream os;
+
+    os << ".pExternalSemaphoreDesc = ";
+
+    ur::details::printPtr(os, *(params->ppExternalSemaphoreDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphExternalSemaphore));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_import_external_semaphore_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_import_external_semaphore_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".semHandleType = ";
+  {
+    auto value = r.value<ur_exp_external_semaphore_type_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phExternalSemaphore = ";
+  r.printPointee<ur_exp_external_semaphore_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_release_external_semaphore_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_bindless_images_release_external_semaphore_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->phExternalSemaphore));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_release_external_semaphore_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_release_external_semaphore_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hExternalSemaphore = ";
+  {
+    auto value = r.value<ur_exp_external_semaphore_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_wait_external_semaphore_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_bindless_images_wait_external_semaphore_exp_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phSemaphore));
+
+  w.value(*(params->phasWaitValue));
+
+  w.value(*(params->pwaitValue));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_wait_external_semaphore_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_wait_external_semaphore_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hSemaphore = ";
+  {
+    auto value = r.value<ur_exp_external_semaphore_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hasWaitValue = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".waitValue = ";
+  {
+    auto value = r.value<uint64_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_bindless_images_signal_external_semaphore_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_bindless_images_signal_external_semaphore_exp_params_t *params) {
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->phSemaphore));
+
+  w.value(*(params->phasSignalValue));
+
+  w.value(*(params->psignalValue));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_bindless_images_signal_external_semaphore_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_bindless_images_signal_external_semaphore_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hSemaphore = ";
+  {
+    auto value = r.value<ur_exp_external_semaphore_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hasSignalValue = ";
+  {
+    auto value = r.value<bool>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".signalValue = ";
+  {
+    auto value = r.value<uint64_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_host_alloc_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_usm_host_alloc_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  {
+    std::ostringstream os;
+
+    os << ".pUSMDesc = ";
+
+    ur::details::printPtr(os, *(params->ppUSMDesc));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->ppool));
+
+  w.value(*(params->psize));
+
+  w.pointee(*(params->pppMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_host_alloc_params_t type
+template <>
+inline void decodeParams<struct ur_usm_host_alloc_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pool = ";
+  {
+    auto value = r.value<ur_usm_pool_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".ppMem = ";
+  r.printPointee<void *>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_device_alloc_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_device_alloc_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  {
+    std::ostringstream os;
+
+    os << ".pUSMDesc = ";
+
+    ur::details::printPtr(os, *(params->ppUSMDesc));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->ppool));
+
+  w.value(*(params->psize));
+
+  w.pointee(*(params->pppMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_device_alloc_params_t type
+template <>
+inline void decodeParams<struct ur_usm_device_alloc_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pool = ";
+  {
+    auto value = r.value<ur_usm_pool_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".ppMem = ";
+  r.printPointee<void *>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_shared_alloc_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_shared_alloc_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  {
+    std::ostringstream os;
+
+    os << ".pUSMDesc = ";
+
+    ur::details::printPtr(os, *(params->ppUSMDesc));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->ppool));
+
+  w.value(*(params->psize));
+
+  w.pointee(*(params->pppMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_shared_alloc_params_t type
+template <>
+inline void decodeParams<struct ur_usm_shared_alloc_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pool = ";
+  {
+    auto value = r.value<ur_usm_pool_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".ppMem = ";
+  r.printPointee<void *>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_free_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_usm_free_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_free_params_t type
+template <>
+inline void
+decodeParams<struct ur_usm_free_params_t>([[maybe_unused]] std::ostream &os,
+                                          [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMem = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_get_mem_alloc_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_get_mem_alloc_info_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppMem));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_get_mem_alloc_info_params_t type
+template <>
+inline void decodeParams<struct ur_usm_get_mem_alloc_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMem = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_usm_alloc_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_pool_create_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_pool_create_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPoolDesc = ";
+
+    ur::details::printPtr(os, *(params->ppPoolDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pppPool));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_pool_create_params_t type
+template <>
+inline void decodeParams<struct ur_usm_pool_create_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".ppPool = ";
+  r.printPointee<ur_usm_pool_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_pool_retain_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_pool_retain_params_t *params) {
+
+  w.value(*(params->ppPool));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_pool_retain_params_t type
+template <>
+inline void decodeParams<struct ur_usm_pool_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".pPool = ";
+  {
+    auto value = r.value<ur_usm_pool_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_pool_release_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_pool_release_params_t *params) {
+
+  w.value(*(params->ppPool));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_pool_release_params_t type
+template <>
+inline void decodeParams<struct ur_usm_pool_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".pPool = ";
+  {
+    auto value = r.value<ur_usm_pool_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_pool_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_pool_get_info_params_t *params) {
+
+  w.value(*(params->phPool));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_pool_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_usm_pool_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPool = ";
+  {
+    auto value = r.value<ur_usm_pool_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_usm_pool_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_pitched_alloc_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_pitched_alloc_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  {
+    std::ostringstream os;
+
+    os << ".pUSMDesc = ";
+
+    ur::details::printPtr(os, *(params->ppUSMDesc));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->ppool));
+
+  w.value(*(params->pwidthInBytes));
+
+  w.value(*(params->pheight));
+
+  w.value(*(params->pelementSizeBytes));
+
+  w.pointee(*(params->pppMem));
+
+  w.pointee(*(params->ppResultPitch));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_pitched_alloc_exp_params_t type
+template <>
+inline void decodeParams<struct ur_usm_pitched_alloc_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pool = ";
+  {
+    auto value = r.value<ur_usm_pool_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".widthInBytes = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".height = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".elementSizeBytes = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".ppMem = ";
+  r.printPointee<void *>(os);
+
+  os << ", ";
+  os << ".pResultPitch = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_import_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_usm_import_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppMem));
+
+  w.value(*(params->psize));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_import_exp_params_t type
+template <>
+inline void decodeParams<struct ur_usm_import_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMem = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_release_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_release_exp_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppMem));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_release_exp_params_t type
+template <>
+inline void decodeParams<struct ur_usm_release_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMem = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_command_buffer_create_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_command_buffer_create_exp_params_t
+                 *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  {
+    std::ostringstream os;
+
+    os << ".pCommandBufferDesc = ";
+
+    ur::details::printPtr(os, *(params->ppCommandBufferDesc));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphCommandBuffer));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_command_buffer_create_exp_params_t type
+template <>
+inline void decodeParams<struct ur_command_buffer_create_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phCommandBuffer = ";
+  r.printPointee<ur_exp_command_buffer_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_command_buffer_retain_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_command_buffer_retain_exp_params_t
+                 *params) {
+
+  w.value(*(params->phCommandBuffer));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_command_buffer_retain_exp_params_t type
+template <>
+inline void decodeParams<struct ur_command_buffer_retain_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_command_buffer_release_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_command_buffer_release_exp_params_t
+        *params) {
+
+  w.value(*(params->phCommandBuffer));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_command_buffer_release_exp_params_t type
+template <>
+inline void decodeParams<struct ur_command_buffer_release_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_command_buffer_finalize_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_command_buffer_finalize_exp_params_t
+        *params) {
+
+  w.value(*(params->phCommandBuffer));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_command_buffer_finalize_exp_params_t type
+template <>
+inline void decodeParams<struct ur_command_buffer_finalize_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_kernel_launch_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_append_kernel_launch_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phKernel));
+
+  w.value(*(params->pworkDim));
+
+  w.pointee(*(params->ppGlobalWorkOffset));
+
+  w.pointee(*(params->ppGlobalWorkSize));
+
+  w.pointee(*(params->ppLocalWorkSize));
+
+  w.value(*(params->pnumKernelAlternatives));
+
+  w.range(*(params->pphKernelAlternatives), *(params->pnumKernelAlternatives));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_kernel_launch_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_kernel_launch_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hKernel = ";
+  {
+    auto value = r.value<ur_kernel_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".workDim = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pGlobalWorkOffset = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pGlobalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".pLocalWorkSize = ";
+  r.printPointee<const size_t>(os);
+
+  os << ", ";
+  os << ".numKernelAlternatives = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phKernelAlternatives = ";
+  uint64_t phKernelAlternativesCount = 0;
+  if (r.beginRange<ur_kernel_handle_t>(os, phKernelAlternativesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phKernelAlternativesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_kernel_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_usm_memcpy_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_append_usm_memcpy_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_usm_memcpy_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_usm_memcpy_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_command_buffer_append_usm_fill_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_command_buffer_append_usm_fill_exp_params_t
+        *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->ppMemory));
+
+  w.value(*(params->ppPattern));
+
+  w.value(*(params->ppatternSize));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_command_buffer_append_usm_fill_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_command_buffer_append_usm_fill_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMemory = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pPattern = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".patternSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_mem_buffer_copy_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_append_mem_buffer_copy_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phSrcMem));
+
+  w.value(*(params->phDstMem));
+
+  w.value(*(params->psrcOffset));
+
+  w.value(*(params->pdstOffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_mem_buffer_copy_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_mem_buffer_copy_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hSrcMem = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDstMem = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".srcOffset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstOffset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_mem_buffer_write_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_append_mem_buffer_write_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_mem_buffer_write_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_mem_buffer_write_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_mem_buffer_read_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_append_mem_buffer_read_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_mem_buffer_read_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_mem_buffer_read_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phSrcMem));
+
+  w.value(*(params->phDstMem));
+
+  w.value(*(params->psrcOrigin));
+
+  w.value(*(params->pdstOrigin));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->psrcRowPitch));
+
+  w.value(*(params->psrcSlicePitch));
+
+  w.value(*(params->pdstRowPitch));
+
+  w.value(*(params->pdstSlicePitch));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hSrcMem = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDstMem = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".srcOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstOrigin = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".srcRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".srcSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".dstSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_mem_buffer_write_rect_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_command_buffer_append_mem_buffer_write_rect_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->pbufferOffset));
+
+  w.value(*(params->phostOffset));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->pbufferRowPitch));
+
+  w.value(*(params->pbufferSlicePitch));
+
+  w.value(*(params->phostRowPitch));
+
+  w.value(*(params->phostSlicePitch));
+
+  w.value(*(params->ppSrc));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_mem_buffer_write_rect_exp_params_t type
+template <>
+inline void decodeParams<
+    struct ur_command_buffer_append_mem_buffer_write_rect_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".bufferOffset = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostOffset = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSrc = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_mem_buffer_read_rect_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+    ur_command_buffer_append_mem_buffer_read_rect_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->pbufferOffset));
+
+  w.value(*(params->phostOffset));
+
+  w.value(*(params->pregion));
+
+  w.value(*(params->pbufferRowPitch));
+
+  w.value(*(params->pbufferSlicePitch));
+
+  w.value(*(params->phostRowPitch));
+
+  w.value(*(params->phostSlicePitch));
+
+  w.value(*(params->ppDst));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_mem_buffer_read_rect_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_mem_buffer_read_rect_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".bufferOffset = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostOffset = ";
+  {
+    auto value = r.value<ur_rect_offset_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".region = ";
+  {
+    auto value = r.value<ur_rect_region_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".bufferSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostRowPitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hostSlicePitch = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pDst = ";
+  {
+    auto value = r.value<void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_mem_buffer_fill_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_append_mem_buffer_fill_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phBuffer));
+
+  w.value(*(params->ppPattern));
+
+  w.value(*(params->ppatternSize));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_mem_buffer_fill_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_mem_buffer_fill_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hBuffer = ";
+  {
+    auto value = r.value<ur_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pPattern = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".patternSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_usm_prefetch_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_append_usm_prefetch_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->ppMemory));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pflags));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_usm_prefetch_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_usm_prefetch_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMemory = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".flags = ";
+  {
+    auto value = r.value<ur_usm_migration_flags_t>();
+
+    ur::details::printFlag<ur_usm_migration_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_append_usm_advise_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_append_usm_advise_exp_params_t *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->ppMemory));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->padvice));
+
+  w.value(*(params->pnumSyncPointsInWaitList));
+
+  w.pointee(*(params->ppSyncPointWaitList));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->ppSyncPoint));
+
+  w.pointee(*(params->pphEvent));
+
+  w.pointee(*(params->pphCommand));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_append_usm_advise_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_append_usm_advise_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pMemory = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".advice = ";
+  {
+    auto value = r.value<ur_usm_advice_flags_t>();
+
+    ur::details::printFlag<ur_usm_advice_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".numSyncPointsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSyncPointWaitList = ";
+  r.printPointee<const ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pSyncPoint = ";
+  r.printPointee<ur_exp_command_buffer_sync_point_t>(os);
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+
+  os << ", ";
+  os << ".phCommand = ";
+  r.printPointee<ur_exp_command_buffer_command_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_command_buffer_enqueue_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_command_buffer_enqueue_exp_params_t
+        *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->phQueue));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+
+  w.pointee(*(params->pphEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_command_buffer_enqueue_exp_params_t type
+template <>
+inline void decodeParams<struct ur_command_buffer_enqueue_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hQueue = ";
+  {
+    auto value = r.value<ur_queue_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".phEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_update_kernel_launch_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_update_kernel_launch_exp_params_t *params) {
+
+  w.value(*(params->phCommand));
+
+  {
+    std::ostringstream os;
+
+    os << ".pUpdateKernelLaunch = ";
+
+    ur::details::printPtr(os, *(params->ppUpdateKernelLaunch));
+
+    w.text(os.str());
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_update_kernel_launch_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_update_kernel_launch_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommand = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_command_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_update_signal_event_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_update_signal_event_exp_params_t *params) {
+
+  w.value(*(params->phCommand));
+
+  w.pointee(*(params->pphSignalEvent));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_update_signal_event_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_update_signal_event_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommand = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_command_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phSignalEvent = ";
+  r.printPointee<ur_event_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the
+/// ur_command_buffer_update_wait_events_exp_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct
+             ur_command_buffer_update_wait_events_exp_params_t *params) {
+
+  w.value(*(params->phCommand));
+
+  w.value(*(params->pnumEventsInWaitList));
+
+  w.range(*(params->pphEventWaitList), *(params->pnumEventsInWaitList));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the
+/// ur_command_buffer_update_wait_events_exp_params_t type
+template <>
+inline void
+decodeParams<struct ur_command_buffer_update_wait_events_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommand = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_command_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".numEventsInWaitList = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phEventWaitList = ";
+  uint64_t phEventWaitListCount = 0;
+  if (r.beginRange<const ur_event_handle_t>(os, phEventWaitListCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phEventWaitListCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<const ur_event_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_command_buffer_get_info_exp_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_command_buffer_get_info_exp_params_t
+        *params) {
+
+  w.value(*(params->phCommandBuffer));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_command_buffer_get_info_exp_params_t type
+template <>
+inline void decodeParams<struct ur_command_buffer_get_info_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hCommandBuffer = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_exp_command_buffer_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_p2p_enable_peer_access_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_p2p_enable_peer_access_exp_params_t
+        *params) {
+
+  w.value(*(params->pcommandDevice));
+
+  w.value(*(params->ppeerDevice));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_p2p_enable_peer_access_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_usm_p2p_enable_peer_access_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".commandDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".peerDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_p2p_disable_peer_access_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_p2p_disable_peer_access_exp_params_t
+        *params) {
+
+  w.value(*(params->pcommandDevice));
+
+  w.value(*(params->ppeerDevice));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_p2p_disable_peer_access_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_usm_p2p_disable_peer_access_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".commandDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".peerDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_usm_p2p_peer_access_get_info_exp_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_usm_p2p_peer_access_get_info_exp_params_t
+        *params) {
+
+  w.value(*(params->pcommandDevice));
+
+  w.value(*(params->ppeerDevice));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_usm_p2p_peer_access_get_info_exp_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_usm_p2p_peer_access_get_info_exp_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".commandDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".peerDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_exp_peer_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_loader_init_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_loader_init_params_t *params) {
+
+  w.value(*(params->pdevice_flags));
+
+  w.value(*(params->phLoaderConfig));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_loader_init_params_t type
+template <>
+inline void
+decodeParams<struct ur_loader_init_params_t>([[maybe_unused]] std::ostream &os,
+                                             [[maybe_unused]] ParamReader &r) {
+
+  os << ".device_flags = ";
+  {
+    auto value = r.value<ur_device_init_flags_t>();
+
+    ur::details::printFlag<ur_device_init_flag_t>(os, value);
+  }
+
+  os << ", ";
+  os << ".hLoaderConfig = ";
+  {
+    auto value = r.value<ur_loader_config_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_loader_tear_down_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_loader_tear_down_params_t *params) {}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_loader_tear_down_params_t type
+template <>
+inline void decodeParams<struct ur_loader_tear_down_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_virtual_mem_granularity_get_info_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_virtual_mem_granularity_get_info_params_t
+        *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_virtual_mem_granularity_get_info_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_virtual_mem_granularity_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_virtual_mem_granularity_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_virtual_mem_reserve_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_virtual_mem_reserve_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppStart));
+
+  w.value(*(params->psize));
+
+  w.pointee(*(params->pppStart));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_virtual_mem_reserve_params_t type
+template <>
+inline void decodeParams<struct ur_virtual_mem_reserve_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pStart = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".ppStart = ";
+  r.printPointee<void *>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_virtual_mem_free_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_virtual_mem_free_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppStart));
+
+  w.value(*(params->psize));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_virtual_mem_free_params_t type
+template <>
+inline void decodeParams<struct ur_virtual_mem_free_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pStart = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_virtual_mem_map_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_virtual_mem_map_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppStart));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->phPhysicalMem));
+
+  w.value(*(params->poffset));
+
+  w.value(*(params->pflags));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_virtual_mem_map_params_t type
+template <>
+inline void decodeParams<struct ur_virtual_mem_map_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pStart = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".hPhysicalMem = ";
+  {
+    auto value = r.value<ur_physical_mem_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".offset = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".flags = ";
+  {
+    auto value = r.value<ur_virtual_mem_access_flags_t>();
+
+    ur::details::printFlag<ur_virtual_mem_access_flag_t>(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_virtual_mem_unmap_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_virtual_mem_unmap_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppStart));
+
+  w.value(*(params->psize));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_virtual_mem_unmap_params_t type
+template <>
+inline void decodeParams<struct ur_virtual_mem_unmap_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pStart = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_virtual_mem_set_access_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_virtual_mem_set_access_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppStart));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->pflags));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_virtual_mem_set_access_params_t type
+template <>
+inline void decodeParams<struct ur_virtual_mem_set_access_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pStart = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".flags = ";
+  {
+    auto value = r.value<ur_virtual_mem_access_flags_t>();
+
+    ur::details::printFlag<ur_virtual_mem_access_flag_t>(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_virtual_mem_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_virtual_mem_get_info_params_t *params) {
+
+  w.value(*(params->phContext));
+
+  w.value(*(params->ppStart));
+
+  w.value(*(params->psize));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_virtual_mem_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_virtual_mem_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hContext = ";
+  {
+    auto value = r.value<ur_context_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pStart = ";
+  {
+    auto value = r.value<const void *>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".size = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_virtual_mem_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_get_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_device_get_params_t *params) {
+
+  w.value(*(params->phPlatform));
+
+  w.value(*(params->pDeviceType));
+
+  w.value(*(params->pNumEntries));
+
+  w.range(*(params->pphDevices), *(params->pNumEntries));
+
+  w.pointee(*(params->ppNumDevices));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_get_params_t type
+template <>
+inline void
+decodeParams<struct ur_device_get_params_t>([[maybe_unused]] std::ostream &os,
+                                            [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPlatform = ";
+  {
+    auto value = r.value<ur_platform_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".DeviceType = ";
+  {
+    auto value = r.value<ur_device_type_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".NumEntries = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phDevices = ";
+  uint64_t phDevicesCount = 0;
+  if (r.beginRange<ur_device_handle_t>(os, phDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pNumDevices = ";
+  r.printPointee<uint32_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_get_selected_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_device_get_selected_params_t *params) {
+
+  w.value(*(params->phPlatform));
+
+  w.value(*(params->pDeviceType));
+
+  w.value(*(params->pNumEntries));
+
+  w.range(*(params->pphDevices), *(params->pNumEntries));
+
+  w.pointee(*(params->ppNumDevices));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_get_selected_params_t type
+template <>
+inline void decodeParams<struct ur_device_get_selected_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hPlatform = ";
+  {
+    auto value = r.value<ur_platform_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".DeviceType = ";
+  {
+    auto value = r.value<ur_device_type_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".NumEntries = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phDevices = ";
+  uint64_t phDevicesCount = 0;
+  if (r.beginRange<ur_device_handle_t>(os, phDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pNumDevices = ";
+  r.printPointee<uint32_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_get_info_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_device_get_info_params_t *params) {
+
+  w.value(*(params->phDevice));
+
+  w.value(*(params->ppropName));
+
+  w.value(*(params->ppropSize));
+
+  {
+    std::ostringstream os;
+
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName),
+                             *(params->ppropSize));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->ppPropSizeRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_get_info_params_t type
+template <>
+inline void decodeParams<struct ur_device_get_info_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".propName = ";
+  {
+    auto value = r.value<ur_device_info_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".propSize = ";
+  {
+    auto value = r.value<size_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".pPropSizeRet = ";
+  r.printPointee<size_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_retain_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_device_retain_params_t *params) {
+
+  w.value(*(params->phDevice));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_retain_params_t type
+template <>
+inline void decodeParams<struct ur_device_retain_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_release_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_device_release_params_t *params) {
+
+  w.value(*(params->phDevice));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_release_params_t type
+template <>
+inline void decodeParams<struct ur_device_release_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_partition_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_device_partition_params_t *params) {
+
+  w.value(*(params->phDevice));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->pNumDevices));
+
+  w.range(*(params->pphSubDevices), *(params->pNumDevices));
+
+  w.pointee(*(params->ppNumDevicesRet));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_partition_params_t type
+template <>
+inline void decodeParams<struct ur_device_partition_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".NumDevices = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".phSubDevices = ";
+  uint64_t phSubDevicesCount = 0;
+  if (r.beginRange<ur_device_handle_t>(os, phSubDevicesCount)) {
+    os << " {";
+    for (uint64_t i = 0; i < phSubDevicesCount; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      auto value = r.value<ur_device_handle_t>();
+
+      ur::details::printPtr(os, value);
+    }
+    os << "}";
+  }
+
+  os << ", ";
+  os << ".pNumDevicesRet = ";
+  r.printPointee<uint32_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_select_binary_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_device_select_binary_params_t *params) {
+
+  w.value(*(params->phDevice));
+
+  {
+    std::ostringstream os;
+
+    os << ".pBinaries = ";
+
+    ur::details::printPtr(os, *(params->ppBinaries));
+
+    w.text(os.str());
+  }
+
+  w.value(*(params->pNumBinaries));
+
+  w.pointee(*(params->ppSelectedBinary));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_select_binary_params_t type
+template <>
+inline void decodeParams<struct ur_device_select_binary_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".NumBinaries = ";
+  {
+    auto value = r.value<uint32_t>();
+
+    os << value;
+  }
+
+  os << ", ";
+  os << ".pSelectedBinary = ";
+  r.printPointee<uint32_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_get_native_handle_params_t type
+inline void
+encodeParams([[maybe_unused]] ParamWriter &w,
+             [[maybe_unused]] const struct ur_device_get_native_handle_params_t
+                 *params) {
+
+  w.value(*(params->phDevice));
+
+  w.pointee(*(params->pphNativeDevice));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_get_native_handle_params_t type
+template <>
+inline void decodeParams<struct ur_device_get_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".phNativeDevice = ";
+  r.printPointee<ur_native_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_create_with_native_handle_params_t
+/// type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_device_create_with_native_handle_params_t
+        *params) {
+
+  w.value(*(params->phNativeDevice));
+
+  w.value(*(params->phAdapter));
+
+  {
+    std::ostringstream os;
+
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os, *(params->ppProperties));
+
+    w.text(os.str());
+  }
+
+  w.pointee(*(params->pphDevice));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_create_with_native_handle_params_t
+/// type
+template <>
+inline void decodeParams<struct ur_device_create_with_native_handle_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hNativeDevice = ";
+  {
+    auto value = r.value<ur_native_handle_t>();
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(value));
+  }
+
+  os << ", ";
+  os << ".hAdapter = ";
+  {
+    auto value = r.value<ur_adapter_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  r.printText(os);
+
+  os << ", ";
+  os << ".phDevice = ";
+  r.printPointee<ur_device_handle_t>(os);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ur_device_get_global_timestamps_params_t type
+inline void encodeParams(
+    [[maybe_unused]] ParamWriter &w,
+    [[maybe_unused]] const struct ur_device_get_global_timestamps_params_t
+        *params) {
+
+  w.value(*(params->phDevice));
+
+  w.pointee(*(params->ppDeviceTimestamp));
+
+  w.pointee(*(params->ppHostTimestamp));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ur_device_get_global_timestamps_params_t type
+template <>
+inline void decodeParams<struct ur_device_get_global_timestamps_params_t>(
+    [[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+
+  os << ".hDevice = ";
+  {
+    auto value = r.value<ur_device_handle_t>();
+
+    ur::details::printPtr(os, value);
+  }
+
+  os << ", ";
+  os << ".pDeviceTimestamp = ";
+  r.printPointee<uint64_t>(os);
+
+  os << ", ";
+  os << ".pHostTimestamp = ";
+  r.printPointee<uint64_t>(os);
+}
+} // namespace ur::details
+
+namespace ur::extras {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Encode function parameters into a binary record appended to out
+///
+/// @details
+///     - Unlike printFunctionParams, no formatting takes place for most
+///       parameters, they are copied as they are.
+///     - The record can be turned into text with decodeFunctionParams later
+///       on, even by another process, as long as it was built from the same
+///       version of the API.
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == params`
+inline ur_result_t UR_APICALL encodeFunctionParams(std::vector<uint8_t> &out,
+                                                   ur_function_t function,
+                                                   const void *params) {
+  if (!params) {
+    return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+  }
+
+  size_t begin = out.size();
+  ur::details::ParamWriter w(out);
+  w.value(static_cast<uint32_t>(function));
+  w.value(static_cast<uint32_t>(0));
+
+  switch (function) {
+  case UR_FUNCTION_LOADER_CONFIG_CREATE: {
+    ur::details::encodeParams(
+        w, (const struct ur_loader_config_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_RETAIN: {
+    ur::details::encodeParams(
+        w, (const struct ur_loader_config_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_loader_config_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_loader_config_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_ENABLE_LAYER: {
+    ur::details::encodeParams(
+        w, (const struct ur_loader_config_enable_layer_params_t *)params);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_SET_CODE_LOCATION_CALLBACK: {
+    ur::details::encodeParams(
+        w, (const struct ur_loader_config_set_code_location_callback_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_SET_MOCKING_ENABLED: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_loader_config_set_mocking_enabled_params_t *)params);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET: {
+    ur::details::encodeParams(w,
+                              (const struct ur_platform_get_params_t *)params);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_platform_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_platform_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_platform_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET_API_VERSION: {
+    ur::details::encodeParams(
+        w, (const struct ur_platform_get_api_version_params_t *)params);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION: {
+    ur::details::encodeParams(
+        w, (const struct ur_platform_get_backend_option_params_t *)params);
+  } break;
+  case UR_FUNCTION_CONTEXT_CREATE: {
+    ur::details::encodeParams(
+        w, (const struct ur_context_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_CONTEXT_RETAIN: {
+    ur::details::encodeParams(
+        w, (const struct ur_context_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_CONTEXT_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_context_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_CONTEXT_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_context_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_context_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_context_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER: {
+    ur::details::encodeParams(
+        w, (const struct ur_context_set_extended_deleter_params_t *)params);
+  } break;
+  case UR_FUNCTION_EVENT_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_event_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_EVENT_GET_PROFILING_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_event_get_profiling_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_EVENT_WAIT: {
+    ur::details::encodeParams(w, (const struct ur_event_wait_params_t *)params);
+  } break;
+  case UR_FUNCTION_EVENT_RETAIN: {
+    ur::details::encodeParams(w,
+                              (const struct ur_event_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_EVENT_RELEASE: {
+    ur::details::encodeParams(w,
+                              (const struct ur_event_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_event_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_event_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_EVENT_SET_CALLBACK: {
+    ur::details::encodeParams(
+        w, (const struct ur_event_set_callback_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_create_with_il_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_create_with_binary_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_BUILD: {
+    ur::details::encodeParams(w,
+                              (const struct ur_program_build_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_BUILD_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_build_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_COMPILE: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_compile_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_COMPILE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_compile_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_LINK: {
+    ur::details::encodeParams(w,
+                              (const struct ur_program_link_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_LINK_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_link_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_RETAIN: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_get_function_pointer_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_program_get_global_variable_pointer_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_BUILD_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_get_build_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_set_specialization_constants_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_program_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_program_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_CREATE: {
+    ur::details::encodeParams(w,
+                              (const struct ur_kernel_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_GROUP_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_get_group_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_get_sub_group_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_RETAIN: {
+    ur::details::encodeParams(w,
+                              (const struct ur_kernel_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_get_suggested_local_work_size_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_set_arg_value_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_set_arg_local_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_set_arg_pointer_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_EXEC_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_set_exec_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_set_arg_sampler_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+    ur::details::encodeParams(
+        w, (const struct ur_kernel_set_arg_mem_obj_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_kernel_set_specialization_constants_params_t *)params);
+  } break;
+  case UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t
+             *)params);
+  } break;
+  case UR_FUNCTION_QUEUE_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_queue_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_QUEUE_CREATE: {
+    ur::details::encodeParams(w,
+                              (const struct ur_queue_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_QUEUE_RETAIN: {
+    ur::details::encodeParams(w,
+                              (const struct ur_queue_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_QUEUE_RELEASE: {
+    ur::details::encodeParams(w,
+                              (const struct ur_queue_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_queue_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_queue_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_QUEUE_FINISH: {
+    ur::details::encodeParams(w,
+                              (const struct ur_queue_finish_params_t *)params);
+  } break;
+  case UR_FUNCTION_QUEUE_FLUSH: {
+    ur::details::encodeParams(w,
+                              (const struct ur_queue_flush_params_t *)params);
+  } break;
+  case UR_FUNCTION_SAMPLER_CREATE: {
+    ur::details::encodeParams(
+        w, (const struct ur_sampler_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_SAMPLER_RETAIN: {
+    ur::details::encodeParams(
+        w, (const struct ur_sampler_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_SAMPLER_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_sampler_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_SAMPLER_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_sampler_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_sampler_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_sampler_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_IMAGE_CREATE: {
+    ur::details::encodeParams(
+        w, (const struct ur_mem_image_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_BUFFER_CREATE: {
+    ur::details::encodeParams(
+        w, (const struct ur_mem_buffer_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_RETAIN: {
+    ur::details::encodeParams(w, (const struct ur_mem_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_RELEASE: {
+    ur::details::encodeParams(w,
+                              (const struct ur_mem_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_BUFFER_PARTITION: {
+    ur::details::encodeParams(
+        w, (const struct ur_mem_buffer_partition_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_mem_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_mem_buffer_create_with_native_handle_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_mem_image_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_GET_INFO: {
+    ur::details::encodeParams(w,
+                              (const struct ur_mem_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_MEM_IMAGE_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_mem_image_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_PHYSICAL_MEM_CREATE: {
+    ur::details::encodeParams(
+        w, (const struct ur_physical_mem_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_PHYSICAL_MEM_RETAIN: {
+    ur::details::encodeParams(
+        w, (const struct ur_physical_mem_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_PHYSICAL_MEM_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_physical_mem_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_PHYSICAL_MEM_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_physical_mem_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_ADAPTER_GET: {
+    ur::details::encodeParams(w,
+                              (const struct ur_adapter_get_params_t *)params);
+  } break;
+  case UR_FUNCTION_ADAPTER_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_adapter_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_ADAPTER_RETAIN: {
+    ur::details::encodeParams(
+        w, (const struct ur_adapter_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_ADAPTER_GET_LAST_ERROR: {
+    ur::details::encodeParams(
+        w, (const struct ur_adapter_get_last_error_params_t *)params);
+  } break;
+  case UR_FUNCTION_ADAPTER_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_adapter_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_kernel_launch_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_EVENTS_WAIT: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_events_wait_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_events_wait_with_barrier_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_buffer_read_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_buffer_write_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_buffer_read_rect_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_buffer_write_rect_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_buffer_copy_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_buffer_copy_rect_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_buffer_fill_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_image_read_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_image_write_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_image_copy_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_buffer_map_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_UNMAP: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_mem_unmap_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_FILL: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_usm_fill_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_usm_memcpy_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_PREFETCH: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_usm_prefetch_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_ADVISE: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_usm_advise_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_FILL_2D: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_usm_fill_2d_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_usm_memcpy_2d_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_device_global_variable_write_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_enqueue_device_global_variable_read_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_READ_HOST_PIPE: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_read_host_pipe_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_write_host_pipe_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_kernel_launch_custom_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER_EXT: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_events_wait_with_barrier_ext_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_cooperative_kernel_launch_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_timestamp_recording_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_enqueue_native_command_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
+    ur::details::encodeParams(
+        w, (const struct
+            ur_bindless_images_unsampled_image_handle_destroy_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct
+         ur_bindless_images_sampled_image_handle_destroy_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_image_allocate_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_bindless_images_image_free_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_unsampled_image_create_exp_params_t *)
+            params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_bindless_images_sampled_image_create_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_bindless_images_image_copy_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_image_get_info_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_bindless_images_mipmap_get_level_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_bindless_images_mipmap_free_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_import_external_memory_exp_params_t *)
+            params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_bindless_images_map_external_array_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_map_external_linear_memory_exp_params_t
+             *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_release_external_memory_exp_params_t *)
+            params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_import_external_semaphore_exp_params_t
+             *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_release_external_semaphore_exp_params_t
+             *)params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_wait_external_semaphore_exp_params_t *)
+            params);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_bindless_images_signal_external_semaphore_exp_params_t
+             *)params);
+  } break;
+  case UR_FUNCTION_USM_HOST_ALLOC: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_host_alloc_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_DEVICE_ALLOC: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_device_alloc_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_SHARED_ALLOC: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_shared_alloc_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_FREE: {
+    ur::details::encodeParams(w, (const struct ur_usm_free_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_get_mem_alloc_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_POOL_CREATE: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_pool_create_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_POOL_RETAIN: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_pool_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_POOL_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_pool_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_POOL_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_pool_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_PITCHED_ALLOC_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_pitched_alloc_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_IMPORT_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_import_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_RELEASE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_release_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_create_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_retain_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_release_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_finalize_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_append_kernel_launch_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_append_usm_memcpy_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_command_buffer_append_usm_fill_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_command_buffer_append_mem_buffer_copy_exp_params_t *)
+            params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_command_buffer_append_mem_buffer_write_exp_params_t *)
+            params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_command_buffer_append_mem_buffer_read_exp_params_t *)
+            params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t
+             *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct
+         ur_command_buffer_append_mem_buffer_write_rect_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_command_buffer_append_mem_buffer_read_rect_exp_params_t
+             *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP: {
+    ur::details::encodeParams(
+        w,
+        (const struct ur_command_buffer_append_mem_buffer_fill_exp_params_t *)
+            params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_append_usm_prefetch_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_append_usm_advise_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_enqueue_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_update_kernel_launch_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_update_signal_event_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_update_wait_events_exp_params_t *)
+               params);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_command_buffer_get_info_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_p2p_enable_peer_access_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_p2p_disable_peer_access_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP: {
+    ur::details::encodeParams(
+        w, (const struct ur_usm_p2p_peer_access_get_info_exp_params_t *)params);
+  } break;
+  case UR_FUNCTION_LOADER_INIT: {
+    ur::details::encodeParams(w,
+                              (const struct ur_loader_init_params_t *)params);
+  } break;
+  case UR_FUNCTION_LOADER_TEAR_DOWN: {
+    ur::details::encodeParams(
+        w, (const struct ur_loader_tear_down_params_t *)params);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_virtual_mem_granularity_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_RESERVE: {
+    ur::details::encodeParams(
+        w, (const struct ur_virtual_mem_reserve_params_t *)params);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_FREE: {
+    ur::details::encodeParams(
+        w, (const struct ur_virtual_mem_free_params_t *)params);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_MAP: {
+    ur::details::encodeParams(
+        w, (const struct ur_virtual_mem_map_params_t *)params);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_UNMAP: {
+    ur::details::encodeParams(
+        w, (const struct ur_virtual_mem_unmap_params_t *)params);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS: {
+    ur::details::encodeParams(
+        w, (const struct ur_virtual_mem_set_access_params_t *)params);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_virtual_mem_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_GET: {
+    ur::details::encodeParams(w, (const struct ur_device_get_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_GET_SELECTED: {
+    ur::details::encodeParams(
+        w, (const struct ur_device_get_selected_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_GET_INFO: {
+    ur::details::encodeParams(
+        w, (const struct ur_device_get_info_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_RETAIN: {
+    ur::details::encodeParams(w,
+                              (const struct ur_device_retain_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_RELEASE: {
+    ur::details::encodeParams(
+        w, (const struct ur_device_release_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_PARTITION: {
+    ur::details::encodeParams(
+        w, (const struct ur_device_partition_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_SELECT_BINARY: {
+    ur::details::encodeParams(
+        w, (const struct ur_device_select_binary_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_device_get_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::encodeParams(
+        w, (const struct ur_device_create_with_native_handle_params_t *)params);
+  } break;
+  case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS: {
+    ur::details::encodeParams(
+        w, (const struct ur_device_get_global_timestamps_params_t *)params);
+  } break;
+  default:
+    out.resize(begin);
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
+
+  auto size = static_cast<uint32_t>(out.size() - begin -
+                                    ur::details::paramsRecordHeaderSize);
+  std::memcpy(out.data() + begin + sizeof(uint32_t), &size, sizeof(size));
+  return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print function parameters of a binary record, in the same format
+///        as printFunctionParams
+///
+/// @details
+///     - Pointed to data that was not part of the record is printed as the
+///       pointer alone.
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == data`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         - the record is larger than size
+inline ur_result_t UR_APICALL decodeFunctionParams(std::ostream &os,
+                                                   const void *data,
+                                                   size_t size,
+                                                   ur_function_t *pFunction,
+                                                   size_t *pRecordSize) {
+  if (!data) {
+    return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+  }
+
+  auto record = static_cast<const uint8_t *>(data);
+  ur::details::ParamReader header(record, size);
+  auto function = static_cast<ur_function_t>(header.value<uint32_t>());
+  size_t paramsSize = header.value<uint32_t>();
+  if (header.isTruncated() ||
+      paramsSize > size - ur::details::paramsRecordHeaderSize) {
+    return UR_RESULT_ERROR_INVALID_SIZE;
+  }
+  if (pFunction) {
+    *pFunction = function;
+  }
+  if (pRecordSize) {
+    *pRecordSize = ur::details::paramsRecordHeaderSize + paramsSize;
+  }
+
+  ur::details::ParamReader r(record + ur::details::paramsRecordHeaderSize,
+                             paramsSize);
+  switch (function) {
+  case UR_FUNCTION_LOADER_CONFIG_CREATE: {
+    ur::details::decodeParams<struct ur_loader_config_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_RETAIN: {
+    ur::details::decodeParams<struct ur_loader_config_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_RELEASE: {
+    ur::details::decodeParams<struct ur_loader_config_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_GET_INFO: {
+    ur::details::decodeParams<struct ur_loader_config_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_ENABLE_LAYER: {
+    ur::details::decodeParams<struct ur_loader_config_enable_layer_params_t>(os,
+                                                                             r);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_SET_CODE_LOCATION_CALLBACK: {
+    ur::details::decodeParams<
+        struct ur_loader_config_set_code_location_callback_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_LOADER_CONFIG_SET_MOCKING_ENABLED: {
+    ur::details::decodeParams<
+        struct ur_loader_config_set_mocking_enabled_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET: {
+    ur::details::decodeParams<struct ur_platform_get_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET_INFO: {
+    ur::details::decodeParams<struct ur_platform_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_platform_get_native_handle_params_t>(os,
+                                                                             r);
+  } break;
+  case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_platform_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET_API_VERSION: {
+    ur::details::decodeParams<struct ur_platform_get_api_version_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION: {
+    ur::details::decodeParams<struct ur_platform_get_backend_option_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_CONTEXT_CREATE: {
+    ur::details::decodeParams<struct ur_context_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_CONTEXT_RETAIN: {
+    ur::details::decodeParams<struct ur_context_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_CONTEXT_RELEASE: {
+    ur::details::decodeParams<struct ur_context_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_CONTEXT_GET_INFO: {
+    ur::details::decodeParams<struct ur_context_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_context_get_native_handle_params_t>(os,
+                                                                            r);
+  } break;
+  case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_context_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER: {
+    ur::details::decodeParams<struct ur_context_set_extended_deleter_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_EVENT_GET_INFO: {
+    ur::details::decodeParams<struct ur_event_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_EVENT_GET_PROFILING_INFO: {
+    ur::details::decodeParams<struct ur_event_get_profiling_info_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_EVENT_WAIT: {
+    ur::details::decodeParams<struct ur_event_wait_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_EVENT_RETAIN: {
+    ur::details::decodeParams<struct ur_event_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_EVENT_RELEASE: {
+    ur::details::decodeParams<struct ur_event_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_event_get_native_handle_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_event_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_EVENT_SET_CALLBACK: {
+    ur::details::decodeParams<struct ur_event_set_callback_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+    ur::details::decodeParams<struct ur_program_create_with_il_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+    ur::details::decodeParams<struct ur_program_create_with_binary_params_t>(os,
+                                                                             r);
+  } break;
+  case UR_FUNCTION_PROGRAM_BUILD: {
+    ur::details::decodeParams<struct ur_program_build_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_BUILD_EXP: {
+    ur::details::decodeParams<struct ur_program_build_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_COMPILE: {
+    ur::details::decodeParams<struct ur_program_compile_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_COMPILE_EXP: {
+    ur::details::decodeParams<struct ur_program_compile_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_LINK: {
+    ur::details::decodeParams<struct ur_program_link_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_LINK_EXP: {
+    ur::details::decodeParams<struct ur_program_link_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_RETAIN: {
+    ur::details::decodeParams<struct ur_program_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_RELEASE: {
+    ur::details::decodeParams<struct ur_program_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER: {
+    ur::details::decodeParams<struct ur_program_get_function_pointer_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER: {
+    ur::details::decodeParams<
+        struct ur_program_get_global_variable_pointer_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_INFO: {
+    ur::details::decodeParams<struct ur_program_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_BUILD_INFO: {
+    ur::details::decodeParams<struct ur_program_get_build_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS: {
+    ur::details::decodeParams<
+        struct ur_program_set_specialization_constants_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_program_get_native_handle_params_t>(os,
+                                                                            r);
+  } break;
+  case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_program_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_CREATE: {
+    ur::details::decodeParams<struct ur_kernel_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_INFO: {
+    ur::details::decodeParams<struct ur_kernel_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_GROUP_INFO: {
+    ur::details::decodeParams<struct ur_kernel_get_group_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO: {
+    ur::details::decodeParams<struct ur_kernel_get_sub_group_info_params_t>(os,
+                                                                            r);
+  } break;
+  case UR_FUNCTION_KERNEL_RETAIN: {
+    ur::details::decodeParams<struct ur_kernel_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_RELEASE: {
+    ur::details::decodeParams<struct ur_kernel_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_kernel_get_native_handle_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_kernel_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE: {
+    ur::details::decodeParams<
+        struct ur_kernel_get_suggested_local_work_size_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+    ur::details::decodeParams<struct ur_kernel_set_arg_value_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+    ur::details::decodeParams<struct ur_kernel_set_arg_local_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+    ur::details::decodeParams<struct ur_kernel_set_arg_pointer_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_EXEC_INFO: {
+    ur::details::decodeParams<struct ur_kernel_set_exec_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER: {
+    ur::details::decodeParams<struct ur_kernel_set_arg_sampler_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+    ur::details::decodeParams<struct ur_kernel_set_arg_mem_obj_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS: {
+    ur::details::decodeParams<
+        struct ur_kernel_set_specialization_constants_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP: {
+    ur::details::decodeParams<
+        struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_QUEUE_GET_INFO: {
+    ur::details::decodeParams<struct ur_queue_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_QUEUE_CREATE: {
+    ur::details::decodeParams<struct ur_queue_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_QUEUE_RETAIN: {
+    ur::details::decodeParams<struct ur_queue_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_QUEUE_RELEASE: {
+    ur::details::decodeParams<struct ur_queue_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_queue_get_native_handle_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_queue_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_QUEUE_FINISH: {
+    ur::details::decodeParams<struct ur_queue_finish_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_QUEUE_FLUSH: {
+    ur::details::decodeParams<struct ur_queue_flush_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_SAMPLER_CREATE: {
+    ur::details::decodeParams<struct ur_sampler_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_SAMPLER_RETAIN: {
+    ur::details::decodeParams<struct ur_sampler_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_SAMPLER_RELEASE: {
+    ur::details::decodeParams<struct ur_sampler_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_SAMPLER_GET_INFO: {
+    ur::details::decodeParams<struct ur_sampler_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_sampler_get_native_handle_params_t>(os,
+                                                                            r);
+  } break;
+  case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_sampler_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_IMAGE_CREATE: {
+    ur::details::decodeParams<struct ur_mem_image_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_BUFFER_CREATE: {
+    ur::details::decodeParams<struct ur_mem_buffer_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_RETAIN: {
+    ur::details::decodeParams<struct ur_mem_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_RELEASE: {
+    ur::details::decodeParams<struct ur_mem_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_BUFFER_PARTITION: {
+    ur::details::decodeParams<struct ur_mem_buffer_partition_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_mem_get_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_mem_buffer_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_mem_image_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_GET_INFO: {
+    ur::details::decodeParams<struct ur_mem_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_MEM_IMAGE_GET_INFO: {
+    ur::details::decodeParams<struct ur_mem_image_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PHYSICAL_MEM_CREATE: {
+    ur::details::decodeParams<struct ur_physical_mem_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PHYSICAL_MEM_RETAIN: {
+    ur::details::decodeParams<struct ur_physical_mem_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PHYSICAL_MEM_RELEASE: {
+    ur::details::decodeParams<struct ur_physical_mem_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_PHYSICAL_MEM_GET_INFO: {
+    ur::details::decodeParams<struct ur_physical_mem_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ADAPTER_GET: {
+    ur::details::decodeParams<struct ur_adapter_get_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ADAPTER_RELEASE: {
+    ur::details::decodeParams<struct ur_adapter_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ADAPTER_RETAIN: {
+    ur::details::decodeParams<struct ur_adapter_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ADAPTER_GET_LAST_ERROR: {
+    ur::details::decodeParams<struct ur_adapter_get_last_error_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ADAPTER_GET_INFO: {
+    ur::details::decodeParams<struct ur_adapter_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+    ur::details::decodeParams<struct ur_enqueue_kernel_launch_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_EVENTS_WAIT: {
+    ur::details::decodeParams<struct ur_enqueue_events_wait_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+    ur::details::decodeParams<
+        struct ur_enqueue_events_wait_with_barrier_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+    ur::details::decodeParams<struct ur_enqueue_mem_buffer_read_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+    ur::details::decodeParams<struct ur_enqueue_mem_buffer_write_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT: {
+    ur::details::decodeParams<struct ur_enqueue_mem_buffer_read_rect_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT: {
+    ur::details::decodeParams<struct ur_enqueue_mem_buffer_write_rect_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+    ur::details::decodeParams<struct ur_enqueue_mem_buffer_copy_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT: {
+    ur::details::decodeParams<struct ur_enqueue_mem_buffer_copy_rect_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+    ur::details::decodeParams<struct ur_enqueue_mem_buffer_fill_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ: {
+    ur::details::decodeParams<struct ur_enqueue_mem_image_read_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE: {
+    ur::details::decodeParams<struct ur_enqueue_mem_image_write_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY: {
+    ur::details::decodeParams<struct ur_enqueue_mem_image_copy_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP: {
+    ur::details::decodeParams<struct ur_enqueue_mem_buffer_map_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_MEM_UNMAP: {
+    ur::details::decodeParams<struct ur_enqueue_mem_unmap_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_FILL: {
+    ur::details::decodeParams<struct ur_enqueue_usm_fill_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+    ur::details::decodeParams<struct ur_enqueue_usm_memcpy_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_PREFETCH: {
+    ur::details::decodeParams<struct ur_enqueue_usm_prefetch_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_ADVISE: {
+    ur::details::decodeParams<struct ur_enqueue_usm_advise_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_FILL_2D: {
+    ur::details::decodeParams<struct ur_enqueue_usm_fill_2d_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D: {
+    ur::details::decodeParams<struct ur_enqueue_usm_memcpy_2d_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE: {
+    ur::details::decodeParams<
+        struct ur_enqueue_device_global_variable_write_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ: {
+    ur::details::decodeParams<
+        struct ur_enqueue_device_global_variable_read_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_READ_HOST_PIPE: {
+    ur::details::decodeParams<struct ur_enqueue_read_host_pipe_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE: {
+    ur::details::decodeParams<struct ur_enqueue_write_host_pipe_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP: {
+    ur::details::decodeParams<
+        struct ur_enqueue_kernel_launch_custom_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER_EXT: {
+    ur::details::decodeParams<
+        struct ur_enqueue_events_wait_with_barrier_ext_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP: {
+    ur::details::decodeParams<
+        struct ur_enqueue_cooperative_kernel_launch_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP: {
+    ur::details::decodeParams<
+        struct ur_enqueue_timestamp_recording_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP: {
+    ur::details::decodeParams<struct ur_enqueue_native_command_exp_params_t>(os,
+                                                                             r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_unsampled_image_handle_destroy_exp_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_sampled_image_handle_destroy_exp_params_t>(os,
+                                                                             r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_image_allocate_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_image_free_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_unsampled_image_create_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_sampled_image_create_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_image_copy_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_image_get_info_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_mipmap_get_level_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_mipmap_free_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_import_external_memory_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_map_external_array_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_map_external_linear_memory_exp_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_release_external_memory_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_import_external_semaphore_exp_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_release_external_semaphore_exp_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_wait_external_semaphore_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP: {
+    ur::details::decodeParams<
+        struct ur_bindless_images_signal_external_semaphore_exp_params_t>(os,
+                                                                          r);
+  } break;
+  case UR_FUNCTION_USM_HOST_ALLOC: {
+    ur::details::decodeParams<struct ur_usm_host_alloc_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_DEVICE_ALLOC: {
+    ur::details::decodeParams<struct ur_usm_device_alloc_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_SHARED_ALLOC: {
+    ur::details::decodeParams<struct ur_usm_shared_alloc_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_FREE: {
+    ur::details::decodeParams<struct ur_usm_free_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO: {
+    ur::details::decodeParams<struct ur_usm_get_mem_alloc_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_POOL_CREATE: {
+    ur::details::decodeParams<struct ur_usm_pool_create_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_POOL_RETAIN: {
+    ur::details::decodeParams<struct ur_usm_pool_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_POOL_RELEASE: {
+    ur::details::decodeParams<struct ur_usm_pool_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_POOL_GET_INFO: {
+    ur::details::decodeParams<struct ur_usm_pool_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_PITCHED_ALLOC_EXP: {
+    ur::details::decodeParams<struct ur_usm_pitched_alloc_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_IMPORT_EXP: {
+    ur::details::decodeParams<struct ur_usm_import_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_RELEASE_EXP: {
+    ur::details::decodeParams<struct ur_usm_release_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP: {
+    ur::details::decodeParams<struct ur_command_buffer_create_exp_params_t>(os,
+                                                                            r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP: {
+    ur::details::decodeParams<struct ur_command_buffer_retain_exp_params_t>(os,
+                                                                            r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP: {
+    ur::details::decodeParams<struct ur_command_buffer_release_exp_params_t>(os,
+                                                                             r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP: {
+    ur::details::decodeParams<struct ur_command_buffer_finalize_exp_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_kernel_launch_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_usm_memcpy_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_usm_fill_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_mem_buffer_copy_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_mem_buffer_write_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_mem_buffer_read_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_mem_buffer_write_rect_exp_params_t>(os,
+                                                                            r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_mem_buffer_read_rect_exp_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_mem_buffer_fill_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_usm_prefetch_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_append_usm_advise_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP: {
+    ur::details::decodeParams<struct ur_command_buffer_enqueue_exp_params_t>(os,
+                                                                             r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_update_kernel_launch_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_update_signal_event_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP: {
+    ur::details::decodeParams<
+        struct ur_command_buffer_update_wait_events_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP: {
+    ur::details::decodeParams<struct ur_command_buffer_get_info_exp_params_t>(
+        os, r);
+  } break;
+  case UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP: {
+    ur::details::decodeParams<
+        struct ur_usm_p2p_enable_peer_access_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP: {
+    ur::details::decodeParams<
+        struct ur_usm_p2p_disable_peer_access_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP: {
+    ur::details::decodeParams<
+        struct ur_usm_p2p_peer_access_get_info_exp_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_LOADER_INIT: {
+    ur::details::decodeParams<struct ur_loader_init_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_LOADER_TEAR_DOWN: {
+    ur::details::decodeParams<struct ur_loader_tear_down_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO: {
+    ur::details::decodeParams<
+        struct ur_virtual_mem_granularity_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_RESERVE: {
+    ur::details::decodeParams<struct ur_virtual_mem_reserve_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_FREE: {
+    ur::details::decodeParams<struct ur_virtual_mem_free_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_MAP: {
+    ur::details::decodeParams<struct ur_virtual_mem_map_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_UNMAP: {
+    ur::details::decodeParams<struct ur_virtual_mem_unmap_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS: {
+    ur::details::decodeParams<struct ur_virtual_mem_set_access_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_VIRTUAL_MEM_GET_INFO: {
+    ur::details::decodeParams<struct ur_virtual_mem_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_GET: {
+    ur::details::decodeParams<struct ur_device_get_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_GET_SELECTED: {
+    ur::details::decodeParams<struct ur_device_get_selected_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_GET_INFO: {
+    ur::details::decodeParams<struct ur_device_get_info_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_RETAIN: {
+    ur::details::decodeParams<struct ur_device_retain_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_RELEASE: {
+    ur::details::decodeParams<struct ur_device_release_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_PARTITION: {
+    ur::details::decodeParams<struct ur_device_partition_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_SELECT_BINARY: {
+    ur::details::decodeParams<struct ur_device_select_binary_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE: {
+    ur::details::decodeParams<struct ur_device_get_native_handle_params_t>(os,
+                                                                           r);
+  } break;
+  case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE: {
+    ur::details::decodeParams<
+        struct ur_device_create_with_native_handle_params_t>(os, r);
+  } break;
+  case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS: {
+    ur::details::decodeParams<struct ur_device_get_global_timestamps_params_t>(
+        os, r);
+  } break;
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
+  return r.isTruncated() ? UR_RESULT_ERROR_INVALID_SIZE : UR_RESULT_SUCCESS;
+}
+} // namespace ur::extras
+
+#endif /* UR_PARAMS_CODEC_HPP */
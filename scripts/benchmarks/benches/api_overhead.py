@@ -0,0 +1,86 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import json
+import os
+from .base import Benchmark, Suite
+from .result import Result
+from utils.utils import run
+from options import options
+
+def isApiOverheadAvailable():
+    return options.ur_api_overhead is not None
+
+class ApiOverheadSuite(Suite):
+    def __init__(self, directory):
+        self.directory = directory
+        if not isApiOverheadAvailable():
+            print("bench-api-overhead not provided. Related benchmarks will not run")
+
+    def name(self) -> str:
+        return "UR API overhead"
+
+    def setup(self):
+        return
+
+    def benchmarks(self) -> list[Benchmark]:
+        if not isApiOverheadAvailable():
+            return []
+
+        return [ApiOverheadBench(self)]
+
+# Runs the Google Benchmark based bench-api-overhead target built with
+# UR_TEST_BENCHMARKS=ON. Its benchmarks are named
+# <adapter>/<layer>/<intercept>/<entry point>, every one of them becomes
+# a separate result grouped by the entry point.
+class ApiOverheadBench(Benchmark):
+    def __init__(self, suite):
+        super().__init__(suite.directory, suite)
+
+    def name(self):
+        return "bench-api-overhead"
+
+    def unit(self):
+        return "ns"
+
+    # these benchmarks are not stable, so set this at a large value
+    def stddev_threshold(self) -> float:
+        return 0.2 # 20%
+
+    def setup(self):
+        if not os.path.isfile(options.ur_api_overhead):
+            raise FileNotFoundError(f"{options.ur_api_overhead} does not exist")
+
+    def run(self, env_vars) -> list[Result]:
+        command = [
+            options.ur_api_overhead,
+            "--benchmark_format=json",
+            "--benchmark_time_unit=ns",
+        ]
+
+        # The benchmark picks the adapters itself, so the loader must not be
+        # forced to load the one selected with --adapter.
+        env_vars = {**env_vars, **options.extra_env_vars}
+        result = run(command, env_vars=env_vars, ld_library=options.extra_ld_libraries).stdout.decode()
+
+        return self.parse_output(result, command, env_vars)
+
+    def parse_output(self, output, command, env_vars):
+        results = []
+        for bench in json.loads(output)["benchmarks"]:
+            # benchmarks that can't run on an adapter report an error
+            if bench.get("error_occurred", False) or bench.get("run_type") != "iteration":
+                continue
+
+            entry_point = bench["name"].rsplit('/', 1)[-1]
+            results.append(Result(label=bench["name"], value=bench["real_time"], command=command, env=env_vars, stdout=output, unit=bench["time_unit"], explicit_group=entry_point))
+
+        if not results:
+            raise ValueError("Benchmark output does not contain data.")
+
+        return results
+
+    def teardown(self):
+        return
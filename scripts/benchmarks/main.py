@@ -10,6 +10,7 @@ from benches.velocity import VelocityBench
 from benches.syclbench import *
 from benches.llamacpp import *
 from benches.umf import *
+from benches.api_overhead import *
 from benches.test import TestSuite
 from options import Compare, options
 from output_markdown import generate_markdown
@@ -131,6 +132,7 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
         SyclBench(directory),
         LlamaCppBench(directory),
         UMFSuite(directory),
+        ApiOverheadSuite(directory),
         #TestSuite()
     ] if not options.dry_run else []
 
@@ -250,6 +252,7 @@ if __name__ == "__main__":
     parser.add_argument('--sycl', type=str, help='Root directory of the SYCL compiler.', default=None)
     parser.add_argument('--ur', type=str, help='UR install prefix path', default=None)
     parser.add_argument('--umf', type=str, help='UMF install prefix path', default=None)
+    parser.add_argument('--ur-api-overhead', type=str, help='Path to the bench-api-overhead binary', default=None)
     parser.add_argument('--adapter', type=str, help='Options to build the Unified Runtime as part of the benchmark', default="level_zero")
     parser.add_argument("--no-rebuild", help='Do not rebuild the benchmarks from scratch.', action="store_true")
     parser.add_argument("--env", type=str, help='Use env variable for a benchmark run.', action="append", default=[])
@@ -291,6 +294,7 @@ if __name__ == "__main__":
     options.output_html = args.output_html
     options.dry_run = args.dry_run
     options.umf = args.umf
+    options.ur_api_overhead = args.ur_api_overhead
     options.iterations_stddev = args.iterations_stddev
     options.build_igc = args.build_igc
     options.current_run_name = args.relative_perf
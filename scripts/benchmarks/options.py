@@ -17,6 +17,7 @@ class Options:
     ur: str = None
     ur_adapter: str = None
     umf: str = None
+    ur_api_overhead: str = None
     rebuild: bool = True
     benchmark_cwd: str = "INVALID"
     timeout: float = 600
@@ -136,6 +136,7 @@ def _generate_api_cpp(incpath, srcpath, namespace, tags, version, revision, spec
     loc += _mako_api_cpp(srcpath, namespace, tags, version, revision, specs, meta)
     loc += _mako_ddi_h(incpath, namespace, tags, version, revision, specs, meta)
     loc += _mako_print_hpp(incpath, namespace, tags, version, revision, specs, meta)
+    loc += _mako_params_codec_hpp(incpath, namespace, tags, version, revision, specs, meta)
     loc += _mako_api_funcs(incpath, namespace, tags, version, revision, specs, meta)
 
     return loc
@@ -330,6 +331,28 @@ def _mako_print_hpp(path, namespace, tags, version, revision, specs, meta):
         specs=specs,
         meta=meta)
 
+"""
+    generates c/c++ files from the specification documents
+"""
+def _mako_params_codec_hpp(path, namespace, tags, version, revision, specs, meta):
+    template = "params_codec.hpp.mako"
+    fin = os.path.join(templates_dir, template)
+
+    name = "%s_params_codec"%(namespace)
+    filename = "%s.hpp"%(name)
+    fout = os.path.join(path, filename)
+
+    print("Generating %s..."%fout)
+    return util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        rev=revision,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta)
+
 """
 Entry-point:
     generates tools code
@@ -7,6 +7,11 @@ from templates import helper as th
 
     x=tags['$x']
     X=x.upper()
+
+    loader_functions = sorted(
+        (obj for s in specs for obj in s['objects']
+         if th.obj_traits.is_function(obj) and n + "Loader" in th.make_func_name(n, tags, obj)),
+        key=lambda obj: th.make_func_name(n, tags, obj))
 %>
 /*
  *
@@ -26,13 +31,23 @@ from templates import helper as th
 
  // Auto-generated file, do not edit.
 
+// Users of the function ids define _${X}_API_WITH_ID(api, id), users of the
+// names alone define _${X}_API(api).
+#ifndef _${X}_API_WITH_ID
+#define _${X}_API_WITH_ID(api, id) _${X}_API(api)
+#define _${X}_API_WITH_ID_DEFAULTED
+#endif
+
 %for tbl in th.get_pfntables(specs, meta, n, tags):
 %for obj in tbl['functions']:
-_UR_API(${th.make_func_name(n, tags, obj)})
+_${X}_API_WITH_ID(${th.make_func_name(n, tags, obj)}, ${th.make_func_etor(n, tags, obj)})
 %endfor
 %endfor
-%for obj in th.get_loader_functions(specs, meta, n, tags):
-%if n + "Loader" in obj:
-_UR_API(${obj})
-%endif
+%for obj in loader_functions:
+_${X}_API_WITH_ID(${th.make_func_name(n, tags, obj)}, ${th.make_func_etor(n, tags, obj)})
 %endfor
+
+#ifdef _${X}_API_WITH_ID_DEFAULTED
+#undef _${X}_API_WITH_ID
+#undef _${X}_API_WITH_ID_DEFAULTED
+#endif
@@ -345,12 +345,16 @@ for printing all parameters of a given UR API function.
 ## by introducing a large amount of not-so-helpful links and detailed descriptions.
 ## 'Extras' functions
     * :ref:`printFunctionParams`
+    * :ref:`encodeFunctionParams`
+    * :ref:`decodeFunctionParams`
 
 ## Generate Print C++ API documentation
 Print C++ Functions
 ------------------------------------------------------------------------------
 ## 'Extras' functions
 ${generate_api_doc('printFunctionParams')}
+${generate_api_doc('encodeFunctionParams')}
+${generate_api_doc('decodeFunctionParams')}
 
 ## Print the list of operators declarations
 Print Operators
@@ -45,8 +45,8 @@ namespace driver
 
         ${th.make_pfncb_param_type(n, tags, obj)} params = { &${",&".join(th.make_param_lines(n, tags, obj, format=["name"]))} };
 
-        auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-                mock::getCallbacks().get_before_callback("${fname}"));
+        auto &callbacks = mock::getCallbacks();
+        auto beforeCallback = callbacks.get_before_callback(${th.make_func_etor(n, tags, obj)});
         if(beforeCallback) {
             result = beforeCallback( &params );
             if(result != UR_RESULT_SUCCESS) {
@@ -54,8 +54,7 @@ namespace driver
             }
         }
 
-        auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-                mock::getCallbacks().get_replace_callback("${fname}"));
+        auto replaceCallback = callbacks.get_replace_callback(${th.make_func_etor(n, tags, obj)});
         if(replaceCallback) {
             result = replaceCallback( &params );
         }
@@ -141,8 +140,7 @@ namespace driver
             return result;
         }
 
-        auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-                mock::getCallbacks().get_after_callback("${fname}"));
+        auto afterCallback = callbacks.get_after_callback(${th.make_func_etor(n, tags, obj)});
         if(afterCallback) {
             return afterCallback( &params );
         }
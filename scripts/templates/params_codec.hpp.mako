@@ -0,0 +1,426 @@
+<%!
+import re
+from templates import helper as th
+%><%namespace name="pr" file="print.hpp.mako"/><%
+    n=namespace
+    N=n.upper()
+
+    x=tags['$x']
+    X=x.upper()
+%>/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions.
+ * See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ${name}.hpp
+ * @version v${ver}-r${rev}
+ *
+ * Binary records of function parameters, which can be printed later in the
+ * same format as ${x}::extras::printFunctionParams. Kept apart from
+ * ${x}_print.hpp, so that only users of the records have to parse them.
+ *
+ */
+#ifndef ${X}_PARAMS_CODEC_HPP
+#define ${X}_PARAMS_CODEC_HPP 1
+
+#include "${x}_print.hpp"
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+## Mako helper functions ######################################################
+<%
+## Types whose values can be printed without following any pointer, so that
+## they can be copied as they are into binary records
+flat_scalar_types = ["bool", "char", "float", "double", "size_t",
+    "int8_t", "uint8_t", "int16_t", "uint16_t",
+    "int32_t", "uint32_t", "int64_t", "uint64_t"]
+
+def isFlatType(_type):
+    _type = re.sub(r"\bconst\b", "", _type).strip()
+    if _type.endswith("*"):
+        return _type[:-1].strip() == "void"
+    if th.type_traits.is_array(_type):
+        return isFlatType(th.type_traits.get_array_element_type(_type))
+    if _type in flat_scalar_types or th.type_traits.is_handle(_type) or th.type_traits.is_flags(_type):
+        return True
+    query = [_o for _s in specs for _o in _s['objects'] if _o['name'] == _type]
+    if len(query) == 0:
+        return False
+    if query[0]['type'] in ["enum", "handle", "fptr_typedef"]:
+        return True
+    if query[0]['type'] == "typedef":
+        return isFlatType(query[0]['value'])
+    if query[0]['type'] == "struct":
+        return all(_m['name'] != "pNext" and isFlatType(_m['type']) for _m in query[0]['members'])
+    return False
+
+## How a function parameter is stored in a binary record, mirroring the
+## branches of line() in print.hpp.mako
+def findParamEncoding(_item):
+    _type = _item['type']
+    if th.param_traits.is_range(_item) and "void*" not in _type:
+        return "range" if isFlatType(_type[:-1]) else "text"
+    if pr.attr.findMemberType(specs, _item) is not None and pr.attr.findMemberType(specs, _item)['type'] == "union":
+        return "text"
+    if th.type_traits.is_array(_type) or th.param_traits.typename(_item) is not None:
+        return "text"
+    if th.type_traits.is_pointer(_type) and not isFlatType(_type):
+        _pointee = re.sub(r"\bconst\b", "", _type[:-1]).strip()
+        if _pointee == "char":
+            return "string"
+        return "pointee" if isFlatType(_pointee) else "text"
+    return "value" if isFlatType(_type) else "text"
+%>
+
+<%def name="encodeParam(item, params_dict)">
+    <%
+        pname = "p" + th._get_param_name(n, tags, item)
+        encoding = findParamEncoding(item)
+    %>
+    %if encoding == "value":
+        w.value(*(params->${pname}));
+    %elif encoding == "string":
+        w.string(*(params->${pname}));
+    %elif encoding == "pointee":
+        w.pointee(*(params->${pname}));
+    %elif encoding == "range":
+        w.range(*(params->${pname}), *(params->p${th.param_traits.range_end(item)}));
+    %else:
+        {
+            std::ostringstream os;
+            ${pr.line(item, 0, True, params_dict)}
+            w.text(os.str());
+        }
+    %endif
+</%def>
+
+<%def name="decodeParam(item, n)">
+    <%
+        iname = th._get_param_name(n, tags, item)
+        itype = th._get_type_name(n, tags, obj, item)
+        encoding = findParamEncoding(item)
+    %>
+    %if n != 0:
+        os << ", ";
+    %endif
+    %if encoding == "text":
+        r.printText(os);
+    %else:
+        os << ".${iname} = ";
+    %endif
+    %if encoding == "value":
+        {
+            auto value = r.value<${itype}>();
+            <%call expr="pr.member(iname, itype, False)">
+                value
+            </%call>
+        }
+    %elif encoding == "string":
+        r.printString(os);
+    %elif encoding == "pointee":
+        r.printPointee<${itype[:-1]}>(os);
+    %elif encoding == "range":
+        uint64_t ${iname}Count = 0;
+        if (r.beginRange<${itype[:-1]}>(os, ${iname}Count)) {
+            os << " {";
+            for (uint64_t i = 0; i < ${iname}Count; ++i) {
+                if (i != 0) {
+                    os << ", ";
+                }
+                auto value = r.value<${itype[:-1]}>();
+                <%call expr="pr.member(iname, itype, True)">
+                    value
+                </%call>
+            }
+            os << "}";
+        }
+    %endif
+</%def>
+
+namespace ${x}::details {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Writes function parameters into binary records.
+///
+/// Values that can be printed without following a pointer, e.g. scalars,
+/// enumerations and handles, are copied as they are. Strings, and arrays whose
+/// length is given by another parameter, are prefixed with their length and
+/// the pointer that was passed. Anything else is formatted as text right away.
+class ParamWriter {
+public:
+    explicit ParamWriter(std::vector<uint8_t> &out) : out(out) {}
+
+    template <typename T> void value(const T &value) {
+        bytes(&value, sizeof(value));
+    }
+
+    void address(const void *ptr) {
+        value(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr)));
+    }
+
+    void string(const char *str) {
+        address(str);
+        if (str) {
+            auto length = static_cast<uint32_t>(std::strlen(str));
+            value(length);
+            bytes(str, length);
+        }
+    }
+
+    template <typename T> void pointee(const T *ptr) {
+        address(ptr);
+        if (ptr) {
+            value(*ptr);
+        }
+    }
+
+    template <typename T> void range(const T *ptr, size_t count) {
+        address(ptr);
+        if (ptr) {
+            value(static_cast<uint64_t>(count));
+            bytes(ptr, count * sizeof(T));
+        }
+    }
+
+    void text(const std::string &text) {
+        value(static_cast<uint32_t>(text.size()));
+        bytes(text.data(), text.size());
+    }
+
+    void bytes(const void *data, size_t size) {
+        auto begin = static_cast<const uint8_t *>(data);
+        out.insert(out.end(), begin, begin + size);
+    }
+
+private:
+    std::vector<uint8_t> &out;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Reads back binary records of ParamWriter, printing them the way
+/// the parameters they were made of are printed. Reading past the end of a
+/// record yields zeros and marks the record as truncated.
+class ParamReader {
+public:
+    ParamReader(const uint8_t *data, size_t size) : cur(data), end(data + size) {}
+
+    template <typename T> std::remove_cv_t<T> value() {
+        std::remove_cv_t<T> value{};
+        read(&value, sizeof(value));
+        return value;
+    }
+
+    const void *address() {
+        return reinterpret_cast<const void *>(static_cast<uintptr_t>(value<uint64_t>()));
+    }
+
+    void printString(std::ostream &os) {
+        auto ptr = address();
+        if (ptr == nullptr) {
+            os << "nullptr";
+            return;
+        }
+        auto length = value<uint32_t>();
+        auto str = reinterpret_cast<const char *>(cur);
+        os << ptr << " (";
+        os.write(str, take(length));
+        os << ")";
+    }
+
+    template <typename T> void printPointee(std::ostream &os) {
+        auto ptr = address();
+        if (ptr == nullptr) {
+            os << "nullptr";
+            return;
+        }
+        auto pointee = value<T>();
+        os << ptr << " (";
+        if constexpr (std::is_pointer_v<T>) {
+            printPtr(os, pointee);
+        } else {
+            os << pointee;
+        }
+        os << ")";
+    }
+
+    /// Prints the pointer to the elements, returns false if it was null
+    template <typename T> bool beginRange(std::ostream &os, uint64_t &count) {
+        auto ptr = address();
+        printPtr(os, ptr);
+        if (ptr == nullptr) {
+            return false;
+        }
+        count = value<uint64_t>();
+        if (count > static_cast<uint64_t>(end - cur) / sizeof(T)) {
+            count = 0;
+            truncated = true;
+        }
+        return true;
+    }
+
+    void printText(std::ostream &os) {
+        auto length = value<uint32_t>();
+        auto text = reinterpret_cast<const char *>(cur);
+        os.write(text, take(length));
+    }
+
+    bool isTruncated() const { return truncated; }
+
+private:
+    void read(void *dst, size_t size) {
+        auto src = cur;
+        if (take(size) == size) {
+            std::memcpy(dst, src, size);
+        }
+    }
+
+    /// Consumes up to size bytes, returns how many bytes there were
+    size_t take(size_t size) {
+        if (size > static_cast<size_t>(end - cur)) {
+            truncated = true;
+            size = 0;
+        }
+        cur += size;
+        return size;
+    }
+
+    const uint8_t *cur;
+    const uint8_t *end;
+    bool truncated = false;
+};
+
+/// Size of the header of binary records, made of the function and the size
+/// of the parameters that follow
+inline constexpr size_t paramsRecordHeaderSize = 2 * sizeof(uint32_t);
+
+template <typename T> inline void decodeParams(std::ostream &os, ParamReader &r);
+
+%for tbl in th.get_pfncbtables(specs, meta, n, tags):
+%for obj in tbl['functions']:
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary encoder for the ${th.make_pfncb_param_type(n, tags, obj)} type
+inline void encodeParams([[maybe_unused]] ParamWriter &w, [[maybe_unused]] const struct ${th.make_pfncb_param_type(n, tags, obj)} *params) {
+    <%
+        params_dict = dict()
+        for item in obj['params']:
+            iname = th._get_param_name(n, tags, item)
+            itype = th._get_type_name(n, tags, obj, item)
+            params_dict[iname] = itype
+    %>
+    %for item in obj['params']:
+        ${encodeParam(item, params_dict)}
+    %endfor
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Binary decoder for the ${th.make_pfncb_param_type(n, tags, obj)} type
+template <>
+inline void decodeParams<struct ${th.make_pfncb_param_type(n, tags, obj)}>([[maybe_unused]] std::ostream &os, [[maybe_unused]] ParamReader &r) {
+    %for n, item in enumerate(obj['params']):
+        ${decodeParam(item, n)}
+    %endfor
+}
+%endfor
+%endfor
+} // namespace ${x}::details
+
+
+namespace ${x}::extras {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Encode function parameters into a binary record appended to out
+///
+/// @details
+///     - Unlike printFunctionParams, no formatting takes place for most
+///       parameters, they are copied as they are.
+///     - The record can be turned into text with decodeFunctionParams later
+///       on, even by another process, as long as it was built from the same
+///       version of the API.
+/// @returns
+///     - ::${X}_RESULT_SUCCESS
+///     - ::${X}_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == params`
+inline ${x}_result_t ${X}_APICALL encodeFunctionParams(std::vector<uint8_t> &out, ur_function_t function, const void *params) {
+    if (!params) {
+        return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    size_t begin = out.size();
+    ${x}::details::ParamWriter w(out);
+    w.value(static_cast<uint32_t>(function));
+    w.value(static_cast<uint32_t>(0));
+
+    switch(function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}: {
+            ${x}::details::encodeParams(w, (const struct ${th.make_pfncb_param_type(n, tags, obj)} *)params);
+        } break;
+    %endfor
+    %endfor
+        default:
+            out.resize(begin);
+            return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+
+    auto size = static_cast<uint32_t>(out.size() - begin - ${x}::details::paramsRecordHeaderSize);
+    std::memcpy(out.data() + begin + sizeof(uint32_t), &size, sizeof(size));
+    return ${X}_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print function parameters of a binary record, in the same format
+///        as printFunctionParams
+///
+/// @details
+///     - Pointed to data that was not part of the record is printed as the
+///       pointer alone.
+/// @returns
+///     - ::${X}_RESULT_SUCCESS
+///     - ::${X}_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == data`
+///     - ::${X}_RESULT_ERROR_INVALID_SIZE
+///         - the record is larger than size
+inline ${x}_result_t ${X}_APICALL decodeFunctionParams(std::ostream &os, const void *data, size_t size, ur_function_t *pFunction, size_t *pRecordSize) {
+    if (!data) {
+        return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto record = static_cast<const uint8_t *>(data);
+    ${x}::details::ParamReader header(record, size);
+    auto function = static_cast<ur_function_t>(header.value<uint32_t>());
+    size_t paramsSize = header.value<uint32_t>();
+    if (header.isTruncated() || paramsSize > size - ${x}::details::paramsRecordHeaderSize) {
+        return ${X}_RESULT_ERROR_INVALID_SIZE;
+    }
+    if (pFunction) {
+        *pFunction = function;
+    }
+    if (pRecordSize) {
+        *pRecordSize = ${x}::details::paramsRecordHeaderSize + paramsSize;
+    }
+
+    ${x}::details::ParamReader r(record + ${x}::details::paramsRecordHeaderSize, paramsSize);
+    switch(function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}: {
+            ${x}::details::decodeParams<struct ${th.make_pfncb_param_type(n, tags, obj)}>(os, r);
+        } break;
+    %endfor
+    %endfor
+        default: return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return r.isTruncated() ? ${X}_RESULT_ERROR_INVALID_SIZE : ${X}_RESULT_SUCCESS;
+}
+} // namespace ${x}::extras
+
+#endif /* ${X}_PARAMS_CODEC_HPP */
@@ -1,6 +1,10 @@
 <%!
 import re
 from templates import helper as th
+
+def findMemberType(specs, _item):
+    query = [_o for _s in specs for _o in _s['objects'] if _o['name'] == _item['type']]
+    return query[0] if len(query) > 0 else None
 %><%
     n=namespace
     N=n.upper()
@@ -29,7 +33,9 @@ from templates import helper as th
 #include <bitset>
 
 ## Mako helper functions ######################################################
+## Also called from other templates, so only names from the context are used
 <%def name="member(iname, itype, loop)">
+    <% x = tags['$x'] %>
     %if iname == "pNext":
         ${x}::details::printStruct(os, ${caller.body()});
     %elif th.type_traits.is_flags(itype):
@@ -56,14 +62,11 @@ from templates import helper as th
 def findUnionTag(_union):
     tag = [_obj for _s in specs for _obj in _s['objects'] if _obj['name'] == _union['tag']]
     return tag[0] if len(tag) > 0 else None
-
-def findMemberType(_item):
-    query = [_o for _s in specs for _o in _s['objects'] if _o['name'] == _item['type']]
-    return query[0] if len(query) > 0 else None
 %>
 
 <%def name="line(item, n, params, params_dict)">
     <%
+        x = tags['$x']
         iname = th._get_param_name(n, tags, item)
         prefix = "p" if params else ""
         pname = prefix + iname
@@ -94,7 +97,7 @@ def findMemberType(_item):
         }
         os << "}";
         }
-    %elif findMemberType(item) is not None and findMemberType(item)['type'] == "union":
+    %elif findMemberType(specs, item) is not None and findMemberType(specs, item)['type'] == "union":
         os << ".${iname} = ";
         ${x}::details::printUnion(os, ${deref}(params${access}${item['name']}), params${access}${th.param_traits.tagged_member(item)});
     %elif th.type_traits.is_array(item['type']):
@@ -27,6 +27,9 @@ from templates import helper as th
 namespace ur_tracing_layer
 {
     %for obj in th.get_adapter_functions(specs):
+    <%
+        handle_params = [p['name'] for p in obj['params'] if th.type_traits.is_handle(p['type']) and not th.type_traits.is_pointer(p['type']) and not th.type_traits.is_native_handle(p['type'])]
+    %>
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
     %if 'condition' in obj:
@@ -46,6 +49,9 @@ namespace ur_tracing_layer
 
         ${th.make_pfncb_param_type(n, tags, obj)} params = { &${",&".join(th.make_param_lines(n, tags, obj, format=["name"]))} };
         uint64_t instance = getContext()->notify_begin(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params);
+        %if handle_params:
+        getContext()->notify_handles({${", ".join(handle_params)}});
+        %endif
 
         auto &logger = getContext()->logger;
         logger.info("   ---> ${th.make_func_name(n, tags, obj)}\n");
@@ -126,6 +132,8 @@ namespace ur_tracing_layer
         // Recreate the logger in case env variables have been modified between
         // program launch and the call to `urLoaderInit`
         logger = logger::create_logger("tracing", true, true);
+        init_binary_trace();
+        init_latency_tracker();
 
         ur_tracing_layer::getContext()->codelocData = codelocData;
 
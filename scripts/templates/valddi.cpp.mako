@@ -23,6 +23,7 @@ from templates import helper as th
  *
  */
 #include "${x}_leak_check.hpp"
+#include "${x}_usm_tracker.hpp"
 #include "${x}_validation_layer.hpp"
 
 namespace ur_validation_layer
@@ -36,6 +37,10 @@ namespace ur_validation_layer
         sorted_param_checks = sorted(param_checks, key=lambda pair: False if pair[0] in first_errors else True)
 
         tracked_params = list(filter(lambda p: any(th.subt(n, tags, p['type']) in [hf['handle'], hf['handle'] + "*"] for hf in handle_create_get_retain_release_funcs), obj['params']))
+
+        usm_alloc_funcs = [n + "USMHostAlloc", n + "USMDeviceAlloc", n + "USMSharedAlloc"]
+        queue_create_funcs = [n + "QueueCreate", n + "QueueCreateWithNativeHandle"]
+        context_create_funcs = [n + "ContextCreate", n + "ContextCreateWithNativeHandle"]
     %>
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for ${th.make_func_name(n, tags, obj)}
@@ -109,6 +114,25 @@ namespace ur_validation_layer
         %endif
         %endfor
 
+        %if func_name == n + "USMFree":
+        if( getContext()->enableBoundsChecking )
+        {
+            getContext()->usmAllocTracker->eraseAlloc(hContext, pMem);
+        }
+
+        %elif func_name == n + "QueueRelease":
+        if( getContext()->enableBoundsChecking )
+        {
+            getContext()->usmAllocTracker->eraseQueue(hQueue);
+        }
+
+        %elif func_name == n + "ContextRelease":
+        if( getContext()->enableBoundsChecking )
+        {
+            getContext()->usmAllocTracker->releaseContext(hContext);
+        }
+
+        %endif
         ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
 
         %for tp in tracked_params:
@@ -136,6 +160,31 @@ namespace ur_validation_layer
         %endif
         %endfor
 
+        %if func_name in usm_alloc_funcs:
+        if( getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS )
+        {
+            getContext()->usmAllocTracker->insertAlloc(hContext, *ppMem, size);
+        }
+
+        %elif func_name in queue_create_funcs:
+        if( getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS )
+        {
+            getContext()->usmAllocTracker->insertQueue(*phQueue, hContext);
+        }
+
+        %elif func_name in context_create_funcs:
+        if( getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS )
+        {
+            getContext()->usmAllocTracker->retainContext(*phContext);
+        }
+
+        %elif func_name == n + "ContextRetain":
+        if( getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS )
+        {
+            getContext()->usmAllocTracker->retainContext(hContext);
+        }
+
+        %endif
         return result;
     }
     %if 'condition' in obj:
@@ -13,7 +13,7 @@ import configparser
 import glob
 import json
 import yaml
-from mako.template import Template
+from mako.lookup import TemplateLookup
 from mako import exceptions
 try:
     from yaml import CLoader as Loader, CDumper as Dumper
@@ -151,7 +151,9 @@ makoFileList = []
 makoErrorList = []
 def makoWrite(inpath, outpath, **args):
     try:
-        template = Template(filename=inpath)
+        # Templates may use the defs of other templates next to them
+        lookup = TemplateLookup(directories=[os.path.dirname(inpath)])
+        template = lookup.get_template(os.path.basename(inpath))
         rendered = template.render(**args)
         rendered = re.sub(r"\r\n", r"\n", rendered)
 
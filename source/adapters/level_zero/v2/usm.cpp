@@ -224,9 +224,15 @@ ur_result_t ur_usm_pool_handle_t_::allocate(
 
   auto deviceFlags = getDeviceFlags(pUSMDesc);
 
-  auto umfPool = getPool(usm::pool_descriptor{
-      this, hContext, hDevice, type,
-      bool(deviceFlags & UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY)});
+  usm::pool_descriptor desc{};
+  desc.poolHandle = this;
+  desc.hContext = hContext;
+  desc.hDevice = hDevice;
+  desc.type = type;
+  desc.deviceReadOnly =
+      bool(deviceFlags & UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY);
+
+  auto umfPool = getPool(desc);
   if (!umfPool) {
     return UR_RESULT_ERROR_INVALID_ARGUMENT;
   }
@@ -34,8 +34,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
 
   ur_adapter_get_params_t params = {&NumEntries, &phAdapters, &pNumAdapters};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urAdapterGet"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_ADAPTER_GET);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -43,8 +43,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urAdapterGet"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_GET);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -62,8 +62,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urAdapterGet"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_ADAPTER_GET);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -82,8 +81,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
 
   ur_adapter_release_params_t params = {&hAdapter};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urAdapterRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ADAPTER_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -91,8 +91,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urAdapterRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -104,8 +104,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urAdapterRelease"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ADAPTER_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -124,8 +124,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
 
   ur_adapter_retain_params_t params = {&hAdapter};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urAdapterRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ADAPTER_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -133,8 +134,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urAdapterRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -146,8 +147,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urAdapterRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_ADAPTER_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -172,8 +172,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
 
   ur_adapter_get_last_error_params_t params = {&hAdapter, &ppMessage, &pError};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urAdapterGetLastError"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ADAPTER_GET_LAST_ERROR);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -181,8 +182,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urAdapterGetLastError"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_GET_LAST_ERROR);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -194,8 +195,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urAdapterGetLastError"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ADAPTER_GET_LAST_ERROR);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -228,8 +229,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
   ur_adapter_get_info_params_t params = {&hAdapter, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urAdapterGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ADAPTER_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -237,8 +239,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urAdapterGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -250,8 +252,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urAdapterGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ADAPTER_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -284,8 +286,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
   ur_platform_get_params_t params = {&phAdapters, &NumAdapters, &NumEntries,
                                      &phPlatforms, &pNumPlatforms};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPlatformGet"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -293,8 +295,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPlatformGet"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -312,8 +314,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPlatformGet"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -346,8 +347,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
   ur_platform_get_info_params_t params = {&hPlatform, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPlatformGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -355,8 +357,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPlatformGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -368,8 +370,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPlatformGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -390,8 +392,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
 
   ur_platform_get_api_version_params_t params = {&hPlatform, &pVersion};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPlatformGetApiVersion"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET_API_VERSION);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -399,8 +402,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPlatformGetApiVersion"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET_API_VERSION);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -412,8 +415,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPlatformGetApiVersion"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET_API_VERSION);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -435,8 +438,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
   ur_platform_get_native_handle_params_t params = {&hPlatform,
                                                    &phNativePlatform};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPlatformGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -444,8 +448,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPlatformGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -458,8 +462,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPlatformGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -485,9 +489,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
   ur_platform_create_with_native_handle_params_t params = {
       &hNativePlatform, &hAdapter, &pProperties, &phPlatform};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urPlatformCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -495,9 +499,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urPlatformCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -511,9 +514,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urPlatformCreateWithNativeHandle"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -538,8 +540,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
   ur_platform_get_backend_option_params_t params = {
       &hPlatform, &pFrontendOption, &ppPlatformOption};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPlatformGetBackendOption"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -547,8 +550,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPlatformGetBackendOption"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -560,8 +563,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPlatformGetBackendOption"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -595,8 +598,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
   ur_device_get_params_t params = {&hPlatform, &DeviceType, &NumEntries,
                                    &phDevices, &pNumDevices};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urDeviceGet"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_DEVICE_GET);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -604,8 +607,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urDeviceGet"));
+  auto replaceCallback = callbacks.get_replace_callback(UR_FUNCTION_DEVICE_GET);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -623,8 +625,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urDeviceGet"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_DEVICE_GET);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -658,8 +659,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
   ur_device_get_info_params_t params = {&hDevice, &propName, &propSize,
                                         &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urDeviceGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_DEVICE_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -667,8 +669,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urDeviceGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_DEVICE_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -680,8 +682,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urDeviceGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_DEVICE_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -700,8 +702,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
 
   ur_device_retain_params_t params = {&hDevice};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urDeviceRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_DEVICE_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -709,8 +712,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urDeviceRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_DEVICE_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -722,8 +725,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urDeviceRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_DEVICE_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -742,8 +744,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
 
   ur_device_release_params_t params = {&hDevice};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urDeviceRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_DEVICE_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -751,8 +754,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urDeviceRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_DEVICE_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -764,8 +767,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urDeviceRelease"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_DEVICE_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -796,8 +798,9 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
   ur_device_partition_params_t params = {&hDevice, &pProperties, &NumDevices,
                                          &phSubDevices, &pNumDevicesRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urDevicePartition"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_DEVICE_PARTITION);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -805,8 +808,8 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urDevicePartition"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_DEVICE_PARTITION);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -818,8 +821,8 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urDevicePartition"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_DEVICE_PARTITION);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -849,8 +852,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
   ur_device_select_binary_params_t params = {&hDevice, &pBinaries, &NumBinaries,
                                              &pSelectedBinary};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urDeviceSelectBinary"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_DEVICE_SELECT_BINARY);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -858,8 +862,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urDeviceSelectBinary"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_DEVICE_SELECT_BINARY);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -871,8 +875,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urDeviceSelectBinary"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_DEVICE_SELECT_BINARY);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -893,8 +897,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
 
   ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urDeviceGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -902,8 +907,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urDeviceGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -916,8 +921,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urDeviceGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -943,9 +948,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
   ur_device_create_with_native_handle_params_t params = {
       &hNativeDevice, &hAdapter, &pProperties, &phDevice};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urDeviceCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -953,9 +958,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urDeviceCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -969,9 +973,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urDeviceCreateWithNativeHandle"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -997,8 +1000,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
   ur_device_get_global_timestamps_params_t params = {
       &hDevice, &pDeviceTimestamp, &pHostTimestamp};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urDeviceGetGlobalTimestamps"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1006,8 +1010,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urDeviceGetGlobalTimestamps"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1019,8 +1023,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urDeviceGetGlobalTimestamps"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1046,8 +1050,9 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
   ur_context_create_params_t params = {&DeviceCount, &phDevices, &pProperties,
                                        &phContext};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urContextCreate"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_CONTEXT_CREATE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1055,8 +1060,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urContextCreate"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_CREATE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1069,8 +1074,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urContextCreate"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_CONTEXT_CREATE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1089,8 +1093,9 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
 
   ur_context_retain_params_t params = {&hContext};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urContextRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_CONTEXT_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1098,8 +1103,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urContextRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1112,8 +1117,7 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urContextRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_CONTEXT_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1132,8 +1136,9 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
 
   ur_context_release_params_t params = {&hContext};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urContextRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_CONTEXT_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1141,8 +1146,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urContextRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1155,8 +1160,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urContextRelease"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_CONTEXT_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1190,8 +1195,9 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
   ur_context_get_info_params_t params = {&hContext, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urContextGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_CONTEXT_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1199,8 +1205,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urContextGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1212,8 +1218,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urContextGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_CONTEXT_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1234,8 +1240,9 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
 
   ur_context_get_native_handle_params_t params = {&hContext, &phNativeContext};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urContextGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1243,8 +1250,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urContextGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1257,8 +1264,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urContextGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1290,9 +1297,9 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
       &hNativeContext, &hAdapter,    &numDevices,
       &phDevices,      &pProperties, &phContext};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urContextCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1300,9 +1307,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urContextCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1316,9 +1322,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urContextCreateWithNativeHandle"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1342,8 +1347,9 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
   ur_context_set_extended_deleter_params_t params = {&hContext, &pfnDeleter,
                                                      &pUserData};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urContextSetExtendedDeleter"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1351,8 +1357,8 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urContextSetExtendedDeleter"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1364,8 +1370,8 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urContextSetExtendedDeleter"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1395,8 +1401,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
   ur_mem_image_create_params_t params = {&hContext,   &flags, &pImageFormat,
                                          &pImageDesc, &pHost, &phMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urMemImageCreate"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_MEM_IMAGE_CREATE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1404,8 +1411,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urMemImageCreate"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_MEM_IMAGE_CREATE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1418,8 +1425,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urMemImageCreate"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_MEM_IMAGE_CREATE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1447,8 +1454,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
   ur_mem_buffer_create_params_t params = {&hContext, &flags, &size,
                                           &pProperties, &phBuffer};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urMemBufferCreate"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_MEM_BUFFER_CREATE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1456,8 +1464,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urMemBufferCreate"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_MEM_BUFFER_CREATE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1476,8 +1484,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urMemBufferCreate"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_MEM_BUFFER_CREATE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1496,8 +1504,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
 
   ur_mem_retain_params_t params = {&hMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urMemRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_MEM_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1505,8 +1513,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urMemRetain"));
+  auto replaceCallback = callbacks.get_replace_callback(UR_FUNCTION_MEM_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1519,8 +1526,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urMemRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_MEM_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1539,8 +1545,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
 
   ur_mem_release_params_t params = {&hMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urMemRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_MEM_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1548,8 +1554,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urMemRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_MEM_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1562,8 +1568,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urMemRelease"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_MEM_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1591,8 +1596,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
   ur_mem_buffer_partition_params_t params = {
       &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urMemBufferPartition"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_MEM_BUFFER_PARTITION);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1600,8 +1606,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urMemBufferPartition"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_MEM_BUFFER_PARTITION);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1614,8 +1620,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urMemBufferPartition"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_MEM_BUFFER_PARTITION);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1639,8 +1645,9 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
 
   ur_mem_get_native_handle_params_t params = {&hMem, &hDevice, &phNativeMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urMemGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_MEM_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1648,8 +1655,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urMemGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_MEM_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1662,8 +1669,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urMemGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_MEM_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1689,9 +1696,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
   ur_mem_buffer_create_with_native_handle_params_t params = {
       &hNativeMem, &hContext, &pProperties, &phMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urMemBufferCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1699,9 +1706,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urMemBufferCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1715,9 +1721,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urMemBufferCreateWithNativeHandle"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1747,9 +1752,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
   ur_mem_image_create_with_native_handle_params_t params = {
       &hNativeMem, &hContext, &pImageFormat, &pImageDesc, &pProperties, &phMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urMemImageCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1757,9 +1762,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urMemImageCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1773,9 +1777,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urMemImageCreateWithNativeHandle"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1808,8 +1811,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
   ur_mem_get_info_params_t params = {&hMemory, &propName, &propSize,
                                      &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urMemGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_MEM_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1817,8 +1820,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urMemGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_MEM_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1830,8 +1833,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urMemGetInfo"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_MEM_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1864,8 +1866,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
   ur_mem_image_get_info_params_t params = {&hMemory, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urMemImageGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_MEM_IMAGE_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1873,8 +1876,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urMemImageGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_MEM_IMAGE_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1886,8 +1889,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urMemImageGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_MEM_IMAGE_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1910,8 +1913,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
 
   ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urSamplerCreate"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_SAMPLER_CREATE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1919,8 +1923,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urSamplerCreate"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_CREATE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1933,8 +1937,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urSamplerCreate"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_SAMPLER_CREATE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1953,8 +1956,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
 
   ur_sampler_retain_params_t params = {&hSampler};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urSamplerRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_SAMPLER_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -1962,8 +1966,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urSamplerRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -1976,8 +1980,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urSamplerRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_SAMPLER_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -1996,8 +1999,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
 
   ur_sampler_release_params_t params = {&hSampler};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urSamplerRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_SAMPLER_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2005,8 +2009,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urSamplerRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2019,8 +2023,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urSamplerRelease"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_SAMPLER_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2049,8 +2053,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
   ur_sampler_get_info_params_t params = {&hSampler, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urSamplerGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_SAMPLER_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2058,8 +2063,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urSamplerGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2071,8 +2076,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urSamplerGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_SAMPLER_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2093,8 +2098,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
 
   ur_sampler_get_native_handle_params_t params = {&hSampler, &phNativeSampler};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urSamplerGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2102,8 +2108,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urSamplerGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2116,8 +2122,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urSamplerGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2143,9 +2149,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
   ur_sampler_create_with_native_handle_params_t params = {
       &hNativeSampler, &hContext, &pProperties, &phSampler};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urSamplerCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2153,9 +2159,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urSamplerCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2169,9 +2174,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urSamplerCreateWithNativeHandle"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2199,8 +2203,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
   ur_usm_host_alloc_params_t params = {&hContext, &pUSMDesc, &pool, &size,
                                        &ppMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMHostAlloc"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_HOST_ALLOC);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2208,8 +2213,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMHostAlloc"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_HOST_ALLOC);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2222,8 +2227,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMHostAlloc"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_USM_HOST_ALLOC);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2253,8 +2257,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
   ur_usm_device_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                          &pool,     &size,    &ppMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMDeviceAlloc"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_DEVICE_ALLOC);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2262,8 +2267,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMDeviceAlloc"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_DEVICE_ALLOC);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2276,8 +2281,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMDeviceAlloc"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_DEVICE_ALLOC);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2307,8 +2312,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
   ur_usm_shared_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                          &pool,     &size,    &ppMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMSharedAlloc"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_SHARED_ALLOC);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2316,8 +2322,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMSharedAlloc"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_SHARED_ALLOC);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2330,8 +2336,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMSharedAlloc"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_SHARED_ALLOC);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2352,8 +2358,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
 
   ur_usm_free_params_t params = {&hContext, &pMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMFree"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_USM_FREE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2361,8 +2367,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMFree"));
+  auto replaceCallback = callbacks.get_replace_callback(UR_FUNCTION_USM_FREE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2375,8 +2380,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMFree"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_USM_FREE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2407,8 +2411,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
   ur_usm_get_mem_alloc_info_params_t params = {
       &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMGetMemAllocInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2416,8 +2421,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMGetMemAllocInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2429,8 +2434,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMGetMemAllocInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2454,8 +2459,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
 
   ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMPoolCreate"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_POOL_CREATE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2463,8 +2469,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMPoolCreate"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_CREATE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2477,8 +2483,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMPoolCreate"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_POOL_CREATE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2497,8 +2503,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
 
   ur_usm_pool_retain_params_t params = {&pPool};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMPoolRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_POOL_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2506,8 +2513,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMPoolRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2520,8 +2527,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMPoolRetain"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_POOL_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2540,8 +2547,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
 
   ur_usm_pool_release_params_t params = {&pPool};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMPoolRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_POOL_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2549,8 +2557,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMPoolRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2563,8 +2571,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMPoolRelease"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_POOL_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2593,8 +2601,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
   ur_usm_pool_get_info_params_t params = {&hPool, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMPoolGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_POOL_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2602,8 +2611,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMPoolGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2615,8 +2624,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMPoolGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_POOL_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2652,9 +2661,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
   ur_virtual_mem_granularity_get_info_params_t params = {
       &hContext, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urVirtualMemGranularityGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2662,9 +2671,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urVirtualMemGranularityGetInfo"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2676,9 +2684,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urVirtualMemGranularityGetInfo"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2707,8 +2714,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
   ur_virtual_mem_reserve_params_t params = {&hContext, &pStart, &size,
                                             &ppStart};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urVirtualMemReserve"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_RESERVE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2716,8 +2724,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urVirtualMemReserve"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_RESERVE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2729,8 +2737,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urVirtualMemReserve"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_RESERVE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2753,8 +2761,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
 
   ur_virtual_mem_free_params_t params = {&hContext, &pStart, &size};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urVirtualMemFree"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_FREE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2762,8 +2771,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urVirtualMemFree"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_FREE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2775,8 +2784,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urVirtualMemFree"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_FREE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2806,8 +2815,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
   ur_virtual_mem_map_params_t params = {&hContext,     &pStart, &size,
                                         &hPhysicalMem, &offset, &flags};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urVirtualMemMap"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_MAP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2815,8 +2825,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urVirtualMemMap"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_MAP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2828,8 +2838,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urVirtualMemMap"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_MAP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2852,8 +2862,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
 
   ur_virtual_mem_unmap_params_t params = {&hContext, &pStart, &size};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urVirtualMemUnmap"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_UNMAP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2861,8 +2872,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urVirtualMemUnmap"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_UNMAP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2874,8 +2885,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urVirtualMemUnmap"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_UNMAP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2901,8 +2912,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
   ur_virtual_mem_set_access_params_t params = {&hContext, &pStart, &size,
                                                &flags};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urVirtualMemSetAccess"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2910,8 +2922,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urVirtualMemSetAccess"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2923,8 +2935,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urVirtualMemSetAccess"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -2961,8 +2973,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
       &hContext, &pStart,     &size,        &propName,
       &propSize, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urVirtualMemGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -2970,8 +2983,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urVirtualMemGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -2983,8 +2996,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urVirtualMemGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3013,8 +3026,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
   ur_physical_mem_create_params_t params = {&hContext, &hDevice, &size,
                                             &pProperties, &phPhysicalMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPhysicalMemCreate"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PHYSICAL_MEM_CREATE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3022,8 +3036,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPhysicalMemCreate"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PHYSICAL_MEM_CREATE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3036,8 +3050,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPhysicalMemCreate"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PHYSICAL_MEM_CREATE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3056,8 +3070,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
 
   ur_physical_mem_retain_params_t params = {&hPhysicalMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPhysicalMemRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PHYSICAL_MEM_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3065,8 +3080,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPhysicalMemRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PHYSICAL_MEM_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3079,8 +3094,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPhysicalMemRetain"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PHYSICAL_MEM_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3099,8 +3114,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
 
   ur_physical_mem_release_params_t params = {&hPhysicalMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPhysicalMemRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PHYSICAL_MEM_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3108,8 +3124,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPhysicalMemRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PHYSICAL_MEM_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3122,8 +3138,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPhysicalMemRelease"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PHYSICAL_MEM_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3155,8 +3171,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemGetInfo(
   ur_physical_mem_get_info_params_t params = {
       &hPhysicalMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urPhysicalMemGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PHYSICAL_MEM_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3164,8 +3181,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urPhysicalMemGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PHYSICAL_MEM_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3177,8 +3194,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urPhysicalMemGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PHYSICAL_MEM_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3206,8 +3223,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
   ur_program_create_with_il_params_t params = {&hContext, &pIL, &length,
                                                &pProperties, &phProgram};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramCreateWithIL"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_IL);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3215,8 +3233,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramCreateWithIL"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_IL);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3229,8 +3247,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramCreateWithIL"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_IL);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3266,8 +3284,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
       &hContext,   &numDevices,  &phDevices, &pLengths,
       &ppBinaries, &pProperties, &phProgram};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramCreateWithBinary"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3275,8 +3294,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramCreateWithBinary"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3289,8 +3308,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramCreateWithBinary"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3313,8 +3332,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
 
   ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramBuild"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_BUILD);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3322,8 +3342,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramBuild"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_BUILD);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3335,8 +3355,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramBuild"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_PROGRAM_BUILD);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3359,8 +3378,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
 
   ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramCompile"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_COMPILE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3368,8 +3388,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramCompile"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_COMPILE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3381,8 +3401,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramCompile"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_COMPILE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3413,8 +3433,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
   ur_program_link_params_t params = {&hContext, &count, &phPrograms, &pOptions,
                                      &phProgram};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramLink"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_PROGRAM_LINK);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3422,8 +3442,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramLink"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_LINK);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3436,8 +3456,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramLink"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_PROGRAM_LINK);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3456,8 +3475,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
 
   ur_program_retain_params_t params = {&hProgram};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3465,8 +3485,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3479,8 +3499,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_PROGRAM_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3499,8 +3518,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
 
   ur_program_release_params_t params = {&hProgram};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3508,8 +3528,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3522,8 +3542,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramRelease"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3551,8 +3571,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
   ur_program_get_function_pointer_params_t params = {
       &hDevice, &hProgram, &pFunctionName, &ppFunctionPointer};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramGetFunctionPointer"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3560,8 +3581,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramGetFunctionPointer"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3573,8 +3594,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramGetFunctionPointer"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3605,9 +3626,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
       &hDevice, &hProgram, &pGlobalVariableName, &pGlobalVariableSizeRet,
       &ppGlobalVariablePointerRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urProgramGetGlobalVariablePointer"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3615,9 +3636,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urProgramGetGlobalVariablePointer"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3629,9 +3649,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urProgramGetGlobalVariablePointer"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3665,8 +3684,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
   ur_program_get_info_params_t params = {&hProgram, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3674,8 +3694,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3687,8 +3707,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3723,8 +3743,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
   ur_program_get_build_info_params_t params = {
       &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramGetBuildInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_GET_BUILD_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3732,8 +3753,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramGetBuildInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_GET_BUILD_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3745,8 +3766,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramGetBuildInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_GET_BUILD_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3771,9 +3792,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
   ur_program_set_specialization_constants_params_t params = {&hProgram, &count,
                                                              &pSpecConstants};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urProgramSetSpecializationConstants"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3781,9 +3802,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urProgramSetSpecializationConstants"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3795,9 +3815,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urProgramSetSpecializationConstants"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3818,8 +3837,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
 
   ur_program_get_native_handle_params_t params = {&hProgram, &phNativeProgram};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3827,8 +3847,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3841,8 +3861,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3868,9 +3888,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
   ur_program_create_with_native_handle_params_t params = {
       &hNativeProgram, &hContext, &pProperties, &phProgram};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urProgramCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3878,9 +3898,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urProgramCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3894,9 +3913,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urProgramCreateWithNativeHandle"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3919,8 +3937,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
 
   ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelCreate"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_CREATE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3928,8 +3947,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelCreate"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_CREATE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3942,8 +3961,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelCreate"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_KERNEL_CREATE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -3973,8 +3991,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
   ur_kernel_set_arg_value_params_t params = {&hKernel, &argIndex, &argSize,
                                              &pProperties, &pArgValue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelSetArgValue"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_VALUE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -3982,8 +4001,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelSetArgValue"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_VALUE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -3995,8 +4014,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelSetArgValue"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_VALUE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4022,8 +4041,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
   ur_kernel_set_arg_local_params_t params = {&hKernel, &argIndex, &argSize,
                                              &pProperties};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelSetArgLocal"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_LOCAL);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4031,8 +4051,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelSetArgLocal"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_LOCAL);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4044,8 +4064,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelSetArgLocal"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_LOCAL);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4079,8 +4099,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
   ur_kernel_get_info_params_t params = {&hKernel, &propName, &propSize,
                                         &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4088,8 +4109,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4101,8 +4122,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelGetInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4134,8 +4155,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
   ur_kernel_get_group_info_params_t params = {
       &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelGetGroupInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_GET_GROUP_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4143,8 +4165,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelGetGroupInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_GET_GROUP_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4156,8 +4178,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelGetGroupInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_GET_GROUP_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4189,8 +4211,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
   ur_kernel_get_sub_group_info_params_t params = {
       &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelGetSubGroupInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4198,8 +4221,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelGetSubGroupInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4211,8 +4234,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelGetSubGroupInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4231,8 +4254,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
 
   ur_kernel_retain_params_t params = {&hKernel};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4240,8 +4264,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4254,8 +4278,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_KERNEL_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4274,8 +4297,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
 
   ur_kernel_release_params_t params = {&hKernel};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4283,8 +4307,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4297,8 +4321,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelRelease"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_KERNEL_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4325,8 +4348,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
   ur_kernel_set_arg_pointer_params_t params = {&hKernel, &argIndex,
                                                &pProperties, &pArgValue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelSetArgPointer"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_POINTER);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4334,8 +4358,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelSetArgPointer"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_POINTER);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4347,8 +4371,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelSetArgPointer"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_POINTER);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4377,8 +4401,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
   ur_kernel_set_exec_info_params_t params = {&hKernel, &propName, &propSize,
                                              &pProperties, &pPropValue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelSetExecInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_EXEC_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4386,8 +4411,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelSetExecInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_EXEC_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4399,8 +4424,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelSetExecInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_EXEC_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4426,8 +4451,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
   ur_kernel_set_arg_sampler_params_t params = {&hKernel, &argIndex,
                                                &pProperties, &hArgValue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelSetArgSampler"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4435,8 +4461,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelSetArgSampler"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4448,8 +4474,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelSetArgSampler"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4475,8 +4501,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
   ur_kernel_set_arg_mem_obj_params_t params = {&hKernel, &argIndex,
                                                &pProperties, &hArgValue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelSetArgMemObj"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4484,8 +4511,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelSetArgMemObj"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4497,8 +4524,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelSetArgMemObj"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4522,9 +4549,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
   ur_kernel_set_specialization_constants_params_t params = {&hKernel, &count,
                                                             &pSpecConstants};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urKernelSetSpecializationConstants"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4532,9 +4559,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urKernelSetSpecializationConstants"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4546,9 +4572,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urKernelSetSpecializationConstants"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4569,8 +4594,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
 
   ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urKernelGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4578,8 +4604,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urKernelGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4592,8 +4618,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urKernelGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4621,9 +4647,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
   ur_kernel_create_with_native_handle_params_t params = {
       &hNativeKernel, &hContext, &hProgram, &pProperties, &phKernel};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urKernelCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4631,9 +4657,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urKernelCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4647,9 +4672,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urKernelCreateWithNativeHandle"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4685,9 +4709,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
       &hKernel,           &hQueue,          &numWorkDim,
       &pGlobalWorkOffset, &pGlobalWorkSize, &pSuggestedLocalWorkSize};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urKernelGetSuggestedLocalWorkSize"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4695,9 +4719,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urKernelGetSuggestedLocalWorkSize"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4709,9 +4732,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urKernelGetSuggestedLocalWorkSize"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4740,8 +4762,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
   ur_queue_get_info_params_t params = {&hQueue, &propName, &propSize,
                                        &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urQueueGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_QUEUE_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4749,8 +4772,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urQueueGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_QUEUE_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4762,8 +4785,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urQueueGetInfo"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4789,8 +4811,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
   ur_queue_create_params_t params = {&hContext, &hDevice, &pProperties,
                                      &phQueue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urQueueCreate"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_QUEUE_CREATE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4798,8 +4820,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urQueueCreate"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_QUEUE_CREATE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4812,8 +4834,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urQueueCreate"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_CREATE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4832,8 +4853,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
 
   ur_queue_retain_params_t params = {&hQueue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urQueueRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_QUEUE_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4841,8 +4862,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urQueueRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_QUEUE_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4855,8 +4876,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urQueueRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4875,8 +4895,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
 
   ur_queue_release_params_t params = {&hQueue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urQueueRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_QUEUE_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4884,8 +4905,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urQueueRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_QUEUE_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4898,8 +4919,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urQueueRelease"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4923,8 +4943,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
   ur_queue_get_native_handle_params_t params = {&hQueue, &pDesc,
                                                 &phNativeQueue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urQueueGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4932,8 +4953,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urQueueGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -4946,8 +4967,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urQueueGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -4975,9 +4996,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
   ur_queue_create_with_native_handle_params_t params = {
       &hNativeQueue, &hContext, &hDevice, &pProperties, &phQueue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urQueueCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -4985,9 +5006,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urQueueCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5001,8 +5021,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urQueueCreateWithNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5021,8 +5041,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
 
   ur_queue_finish_params_t params = {&hQueue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urQueueFinish"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_QUEUE_FINISH);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5030,8 +5050,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urQueueFinish"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_QUEUE_FINISH);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5043,8 +5063,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urQueueFinish"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_FINISH);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5063,8 +5082,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
 
   ur_queue_flush_params_t params = {&hQueue};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urQueueFlush"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_QUEUE_FLUSH);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5072,8 +5091,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urQueueFlush"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_QUEUE_FLUSH);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5085,8 +5104,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urQueueFlush"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_FLUSH);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5115,8 +5133,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
   ur_event_get_info_params_t params = {&hEvent, &propName, &propSize,
                                        &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEventGetInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_EVENT_GET_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5124,8 +5143,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEventGetInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_EVENT_GET_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5137,8 +5156,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEventGetInfo"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_EVENT_GET_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5168,8 +5186,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
   ur_event_get_profiling_info_params_t params = {&hEvent, &propName, &propSize,
                                                  &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEventGetProfilingInfo"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_EVENT_GET_PROFILING_INFO);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5177,8 +5196,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEventGetProfilingInfo"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_EVENT_GET_PROFILING_INFO);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5190,8 +5209,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEventGetProfilingInfo"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_EVENT_GET_PROFILING_INFO);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5213,8 +5232,8 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
 
   ur_event_wait_params_t params = {&numEvents, &phEventWaitList};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEventWait"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_EVENT_WAIT);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5222,8 +5241,7 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEventWait"));
+  auto replaceCallback = callbacks.get_replace_callback(UR_FUNCTION_EVENT_WAIT);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5235,8 +5253,7 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEventWait"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_EVENT_WAIT);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5255,8 +5272,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
 
   ur_event_retain_params_t params = {&hEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEventRetain"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_EVENT_RETAIN);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5264,8 +5281,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEventRetain"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_EVENT_RETAIN);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5278,8 +5295,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEventRetain"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_EVENT_RETAIN);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5298,8 +5314,9 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
 
   ur_event_release_params_t params = {&hEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEventRelease"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_EVENT_RELEASE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5307,8 +5324,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEventRelease"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_EVENT_RELEASE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5321,8 +5338,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEventRelease"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_EVENT_RELEASE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5343,8 +5359,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
 
   ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEventGetNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5352,8 +5369,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEventGetNativeHandle"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5366,8 +5383,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEventGetNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5393,9 +5410,9 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
   ur_event_create_with_native_handle_params_t params = {
       &hNativeEvent, &hContext, &pProperties, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urEventCreateWithNativeHandle"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5403,9 +5420,8 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urEventCreateWithNativeHandle"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5419,8 +5435,8 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEventCreateWithNativeHandle"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5446,8 +5462,9 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
   ur_event_set_callback_params_t params = {&hEvent, &execStatus, &pfnNotify,
                                            &pUserData};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEventSetCallback"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_EVENT_SET_CALLBACK);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5455,8 +5472,8 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEventSetCallback"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_EVENT_SET_CALLBACK);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5468,8 +5485,8 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEventSetCallback"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_EVENT_SET_CALLBACK);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5525,8 +5542,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                                               &phEventWaitList,
                                               &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueKernelLaunch"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5534,8 +5552,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueKernelLaunch"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5551,8 +5569,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueKernelLaunch"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5584,8 +5602,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
   ur_enqueue_events_wait_params_t params = {&hQueue, &numEventsInWaitList,
                                             &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueEventsWait"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_EVENTS_WAIT);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5593,8 +5612,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueEventsWait"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_EVENTS_WAIT);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5610,8 +5629,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueEventsWait"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_EVENTS_WAIT);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5643,9 +5662,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
   ur_enqueue_events_wait_with_barrier_params_t params = {
       &hQueue, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urEnqueueEventsWaitWithBarrier"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5653,9 +5672,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urEnqueueEventsWaitWithBarrier"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5671,9 +5689,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urEnqueueEventsWaitWithBarrier"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5716,8 +5733,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
       &size,   &pDst,    &numEventsInWaitList, &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemBufferRead"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5725,8 +5743,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemBufferRead"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5742,8 +5760,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemBufferRead"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5786,8 +5804,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
       &size,   &pSrc,    &numEventsInWaitList, &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemBufferWrite"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5795,8 +5814,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemBufferWrite"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5812,8 +5831,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemBufferWrite"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5869,8 +5888,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
       &hostRowPitch,    &hostSlicePitch, &pDst,           &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemBufferReadRect"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5878,8 +5898,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemBufferReadRect"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5895,8 +5915,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemBufferReadRect"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -5953,8 +5973,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
       &hostRowPitch,    &hostSlicePitch, &pSrc,           &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemBufferWriteRect"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -5962,8 +5983,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemBufferWriteRect"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -5979,8 +6000,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemBufferWriteRect"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6022,8 +6043,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
       &hQueue, &hBufferSrc,          &hBufferDst,      &srcOffset, &dstOffset,
       &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemBufferCopy"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6031,8 +6053,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemBufferCopy"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6048,8 +6070,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemBufferCopy"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6101,8 +6123,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
       &dstRowPitch, &dstSlicePitch, &numEventsInWaitList, &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemBufferCopyRect"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6110,8 +6133,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemBufferCopyRect"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6127,8 +6150,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemBufferCopyRect"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6176,8 +6199,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                                                 &phEventWaitList,
                                                 &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemBufferFill"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6185,8 +6209,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemBufferFill"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6202,8 +6226,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemBufferFill"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6252,8 +6276,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
       &slicePitch,      &pDst,   &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemImageRead"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6261,8 +6286,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemImageRead"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6278,8 +6303,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemImageRead"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6328,8 +6353,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
       &slicePitch,      &pSrc,   &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemImageWrite"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6337,8 +6363,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemImageWrite"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6354,8 +6380,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemImageWrite"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6400,8 +6426,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
       &hQueue, &hImageSrc,           &hImageDst,       &srcOrigin, &dstOrigin,
       &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemImageCopy"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6409,8 +6436,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemImageCopy"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6426,8 +6453,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemImageCopy"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6473,8 +6500,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
       &offset,  &size,    &numEventsInWaitList, &phEventWaitList,
       &phEvent, &ppRetMap};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemBufferMap"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6482,8 +6510,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemBufferMap"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6501,8 +6529,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemBufferMap"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6538,8 +6566,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
       &hQueue,          &hMem,   &pMappedPtr, &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueMemUnmap"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_UNMAP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6547,8 +6576,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueMemUnmap"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_UNMAP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6564,8 +6593,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueMemUnmap"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_UNMAP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6607,8 +6636,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
       &pPattern,        &size,   &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueUSMFill"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_FILL);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6616,8 +6646,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueUSMFill"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_FILL);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6633,8 +6663,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueUSMFill"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_FILL);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6674,8 +6704,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
       &hQueue,          &blocking, &pDst, &pSrc, &size, &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueUSMMemcpy"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6683,8 +6714,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueUSMMemcpy"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6700,8 +6731,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueUSMMemcpy"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6739,8 +6770,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
       &hQueue,          &pMem,   &size, &flags, &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueUSMPrefetch"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_PREFETCH);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6748,8 +6780,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueUSMPrefetch"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_PREFETCH);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6765,8 +6797,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueUSMPrefetch"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_PREFETCH);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6795,8 +6827,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
   ur_enqueue_usm_advise_params_t params = {&hQueue, &pMem, &size, &advice,
                                            &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueUSMAdvise"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_ADVISE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6804,8 +6837,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueUSMAdvise"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_ADVISE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6821,8 +6854,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueUSMAdvise"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_ADVISE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6870,8 +6903,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
       &pPattern,        &width,  &height, &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueUSMFill2D"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_FILL_2D);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6879,8 +6913,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueUSMFill2D"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_FILL_2D);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6896,8 +6930,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueUSMFill2D"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_FILL_2D);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -6947,8 +6981,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
       &width,           &height,   &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueUSMMemcpy2D"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -6956,8 +6991,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueUSMMemcpy2D"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -6973,8 +7008,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueUSMMemcpy2D"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7020,9 +7055,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
       &count,           &offset,   &pSrc, &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urEnqueueDeviceGlobalVariableWrite"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7030,9 +7065,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urEnqueueDeviceGlobalVariableWrite"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7048,9 +7082,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urEnqueueDeviceGlobalVariableWrite"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7096,9 +7129,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
       &count,           &offset,   &pDst, &numEventsInWaitList,
       &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urEnqueueDeviceGlobalVariableRead"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7106,9 +7139,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urEnqueueDeviceGlobalVariableRead"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7124,9 +7156,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urEnqueueDeviceGlobalVariableRead"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7174,8 +7205,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
       &pDst,   &size,     &numEventsInWaitList, &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueReadHostPipe"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7183,8 +7215,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueReadHostPipe"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7200,8 +7232,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueReadHostPipe"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7250,8 +7282,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
       &pSrc,   &size,     &numEventsInWaitList, &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueWriteHostPipe"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7259,8 +7292,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueWriteHostPipe"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7276,8 +7309,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueWriteHostPipe"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7314,8 +7347,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
       &hContext, &hDevice,          &pUSMDesc, &pool,        &widthInBytes,
       &height,   &elementSizeBytes, &ppMem,    &pResultPitch};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMPitchedAllocExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_PITCHED_ALLOC_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7323,8 +7357,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMPitchedAllocExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_PITCHED_ALLOC_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7337,8 +7371,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMPitchedAllocExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_PITCHED_ALLOC_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7363,9 +7397,9 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
   ur_bindless_images_unsampled_image_handle_destroy_exp_params_t params = {
       &hContext, &hDevice, &hImage};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesUnsampledImageHandleDestroyExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7373,9 +7407,8 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesUnsampledImageHandleDestroyExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7388,9 +7421,8 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesUnsampledImageHandleDestroyExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7415,9 +7447,9 @@ urBindlessImagesSampledImageHandleDestroyExp(
   ur_bindless_images_sampled_image_handle_destroy_exp_params_t params = {
       &hContext, &hDevice, &hImage};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesSampledImageHandleDestroyExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7425,9 +7457,8 @@ urBindlessImagesSampledImageHandleDestroyExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesSampledImageHandleDestroyExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7440,9 +7471,8 @@ urBindlessImagesSampledImageHandleDestroyExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesSampledImageHandleDestroyExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7470,9 +7500,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
   ur_bindless_images_image_allocate_exp_params_t params = {
       &hContext, &hDevice, &pImageFormat, &pImageDesc, &phImageMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesImageAllocateExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7480,9 +7510,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesImageAllocateExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7495,9 +7524,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesImageAllocateExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7521,8 +7549,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
   ur_bindless_images_image_free_exp_params_t params = {&hContext, &hDevice,
                                                        &hImageMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urBindlessImagesImageFreeExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7530,9 +7559,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesImageFreeExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7545,8 +7573,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urBindlessImagesImageFreeExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7576,9 +7604,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
   ur_bindless_images_unsampled_image_create_exp_params_t params = {
       &hContext, &hDevice, &hImageMem, &pImageFormat, &pImageDesc, &phImage};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesUnsampledImageCreateExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7586,9 +7614,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesUnsampledImageCreateExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7601,9 +7628,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesUnsampledImageCreateExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7636,9 +7662,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
       &hContext,   &hDevice,  &hImageMem, &pImageFormat,
       &pImageDesc, &hSampler, &phImage};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesSampledImageCreateExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7646,9 +7672,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesSampledImageCreateExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7661,9 +7686,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesSampledImageCreateExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7722,8 +7746,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                                                        &phEventWaitList,
                                                        &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urBindlessImagesImageCopyExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7731,9 +7756,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesImageCopyExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7749,8 +7773,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urBindlessImagesImageCopyExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7778,9 +7802,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
   ur_bindless_images_image_get_info_exp_params_t params = {
       &hContext, &hImageMem, &propName, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesImageGetInfoExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7788,9 +7812,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesImageGetInfoExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7802,9 +7825,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesImageGetInfoExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7832,9 +7854,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
   ur_bindless_images_mipmap_get_level_exp_params_t params = {
       &hContext, &hDevice, &hImageMem, &mipmapLevel, &phImageMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesMipmapGetLevelExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7842,9 +7864,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesMipmapGetLevelExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7857,9 +7878,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesMipmapGetLevelExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7883,9 +7903,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
   ur_bindless_images_mipmap_free_exp_params_t params = {&hContext, &hDevice,
                                                         &hMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesMipmapFreeExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7893,9 +7913,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesMipmapFreeExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7908,8 +7927,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urBindlessImagesMipmapFreeExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7940,9 +7959,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
       &hContext,      &hDevice,          &size,
       &memHandleType, &pExternalMemDesc, &phExternalMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesImportExternalMemoryExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -7950,9 +7969,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesImportExternalMemoryExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -7965,9 +7983,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesImportExternalMemoryExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -7998,9 +8015,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
       &hContext,   &hDevice,      &pImageFormat,
       &pImageDesc, &hExternalMem, &phImageMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesMapExternalArrayExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8008,9 +8025,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesMapExternalArrayExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8023,9 +8039,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesMapExternalArrayExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8055,9 +8070,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
   ur_bindless_images_map_external_linear_memory_exp_params_t params = {
       &hContext, &hDevice, &offset, &size, &hExternalMem, &ppRetMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesMapExternalLinearMemoryExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8065,9 +8080,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesMapExternalLinearMemoryExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8079,9 +8093,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesMapExternalLinearMemoryExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8105,9 +8118,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
   ur_bindless_images_release_external_memory_exp_params_t params = {
       &hContext, &hDevice, &hExternalMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesReleaseExternalMemoryExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8115,9 +8128,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesReleaseExternalMemoryExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8130,9 +8142,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesReleaseExternalMemoryExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8161,9 +8172,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
       &hContext, &hDevice, &semHandleType, &pExternalSemaphoreDesc,
       &phExternalSemaphore};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesImportExternalSemaphoreExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8171,9 +8182,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesImportExternalSemaphoreExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8187,9 +8197,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesImportExternalSemaphoreExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8213,9 +8222,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
   ur_bindless_images_release_external_semaphore_exp_params_t params = {
       &hContext, &hDevice, &hExternalSemaphore};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesReleaseExternalSemaphoreExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8223,9 +8232,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesReleaseExternalSemaphoreExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8238,9 +8246,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesReleaseExternalSemaphoreExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8283,9 +8290,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
       &waitValue, &numEventsInWaitList, &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesWaitExternalSemaphoreExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8293,9 +8300,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesWaitExternalSemaphoreExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8311,9 +8317,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesWaitExternalSemaphoreExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8356,9 +8361,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
       &signalValue, &numEventsInWaitList, &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urBindlessImagesSignalExternalSemaphoreExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8366,9 +8371,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urBindlessImagesSignalExternalSemaphoreExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8384,9 +8388,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urBindlessImagesSignalExternalSemaphoreExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8412,8 +8415,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
   ur_command_buffer_create_exp_params_t params = {
       &hContext, &hDevice, &pCommandBufferDesc, &phCommandBuffer};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urCommandBufferCreateExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8421,8 +8425,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urCommandBufferCreateExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8436,8 +8440,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urCommandBufferCreateExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8456,8 +8460,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
 
   ur_command_buffer_retain_exp_params_t params = {&hCommandBuffer};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urCommandBufferRetainExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8465,8 +8470,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urCommandBufferRetainExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8479,8 +8484,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urCommandBufferRetainExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8499,8 +8504,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
 
   ur_command_buffer_release_exp_params_t params = {&hCommandBuffer};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urCommandBufferReleaseExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8508,8 +8514,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urCommandBufferReleaseExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8522,8 +8528,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urCommandBufferReleaseExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8542,8 +8548,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
 
   ur_command_buffer_finalize_exp_params_t params = {&hCommandBuffer};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urCommandBufferFinalizeExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8551,8 +8558,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urCommandBufferFinalizeExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8564,8 +8571,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urCommandBufferFinalizeExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8640,9 +8647,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendKernelLaunchExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8650,9 +8657,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendKernelLaunchExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8673,9 +8679,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendKernelLaunchExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8730,9 +8735,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendUSMMemcpyExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8740,9 +8745,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendUSMMemcpyExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8763,9 +8767,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendUSMMemcpyExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8823,9 +8826,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendUSMFillExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8833,9 +8836,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendUSMFillExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8856,9 +8858,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendUSMFillExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -8919,9 +8920,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendMemBufferCopyExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -8929,9 +8930,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendMemBufferCopyExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -8952,9 +8952,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendMemBufferCopyExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9012,9 +9011,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendMemBufferWriteExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9022,9 +9021,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendMemBufferWriteExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9045,9 +9043,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendMemBufferWriteExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9105,9 +9102,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendMemBufferReadExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9115,9 +9112,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendMemBufferReadExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9138,9 +9134,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendMemBufferReadExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9213,9 +9208,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendMemBufferCopyRectExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9223,9 +9218,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendMemBufferCopyRectExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9246,9 +9240,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendMemBufferCopyRectExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9324,9 +9317,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendMemBufferWriteRectExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9334,9 +9327,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendMemBufferWriteRectExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9357,9 +9349,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendMemBufferWriteRectExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9434,9 +9425,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendMemBufferReadRectExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9444,9 +9435,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendMemBufferReadRectExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9467,9 +9457,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendMemBufferReadRectExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9530,9 +9519,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendMemBufferFillExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9540,9 +9529,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendMemBufferFillExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9563,9 +9551,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendMemBufferFillExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9620,9 +9607,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendUSMPrefetchExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9630,9 +9617,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendUSMPrefetchExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9653,9 +9639,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendUSMPrefetchExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9710,9 +9695,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
       &phEvent,
       &phCommand};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferAppendUSMAdviseExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9720,9 +9705,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferAppendUSMAdviseExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9743,9 +9727,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferAppendUSMAdviseExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9780,8 +9763,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
                                                    &numEventsInWaitList,
                                                    &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urCommandBufferEnqueueExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9789,8 +9773,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urCommandBufferEnqueueExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9806,8 +9790,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urCommandBufferEnqueueExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9830,9 +9814,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   ur_command_buffer_update_kernel_launch_exp_params_t params = {
       &hCommand, &pUpdateKernelLaunch};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferUpdateKernelLaunchExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9840,9 +9824,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferUpdateKernelLaunchExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9854,9 +9837,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferUpdateKernelLaunchExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9878,9 +9860,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
   ur_command_buffer_update_signal_event_exp_params_t params = {&hCommand,
                                                                &phSignalEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferUpdateSignalEventExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9888,9 +9870,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferUpdateSignalEventExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9903,9 +9884,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferUpdateSignalEventExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9931,9 +9911,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
   ur_command_buffer_update_wait_events_exp_params_t params = {
       &hCommand, &numEventsInWaitList, &phEventWaitList};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urCommandBufferUpdateWaitEventsExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9941,9 +9921,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urCommandBufferUpdateWaitEventsExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -9955,9 +9934,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urCommandBufferUpdateWaitEventsExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -9986,8 +9964,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
   ur_command_buffer_get_info_exp_params_t params = {
       &hCommandBuffer, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urCommandBufferGetInfoExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -9995,8 +9974,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urCommandBufferGetInfoExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10008,8 +9987,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urCommandBufferGetInfoExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10066,9 +10045,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
       &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urEnqueueCooperativeKernelLaunchExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10076,9 +10055,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urEnqueueCooperativeKernelLaunchExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10094,9 +10072,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urEnqueueCooperativeKernelLaunchExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10135,9 +10112,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
       &dynamicSharedMemorySize,
       &pGroupCountRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urKernelSuggestMaxCooperativeGroupCountExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10145,9 +10122,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urKernelSuggestMaxCooperativeGroupCountExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10159,9 +10135,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urKernelSuggestMaxCooperativeGroupCountExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10203,9 +10178,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
   ur_enqueue_timestamp_recording_exp_params_t params = {
       &hQueue, &blocking, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urEnqueueTimestampRecordingExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10213,9 +10188,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urEnqueueTimestampRecordingExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10228,9 +10202,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urEnqueueTimestampRecordingExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10293,9 +10266,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
       &phEventWaitList,
       &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urEnqueueKernelLaunchCustomExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10303,9 +10276,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urEnqueueKernelLaunchCustomExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10321,9 +10293,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urEnqueueKernelLaunchCustomExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10349,8 +10320,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
   ur_program_build_exp_params_t params = {&hProgram, &numDevices, &phDevices,
                                           &pOptions};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramBuildExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_BUILD_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10358,8 +10330,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramBuildExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_BUILD_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10371,8 +10343,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramBuildExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_BUILD_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10398,8 +10370,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
   ur_program_compile_exp_params_t params = {&hProgram, &numDevices, &phDevices,
                                             &pOptions};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramCompileExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_COMPILE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10407,8 +10380,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramCompileExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_COMPILE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10420,8 +10393,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramCompileExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_COMPILE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10457,8 +10430,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
                                          &count,    &phPrograms, &pOptions,
                                          &phProgram};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urProgramLinkExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_PROGRAM_LINK_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10466,8 +10440,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urProgramLinkExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_LINK_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10480,8 +10454,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urProgramLinkExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_PROGRAM_LINK_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10504,8 +10478,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
 
   ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMImportExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_IMPORT_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10513,8 +10488,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMImportExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_IMPORT_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10526,8 +10501,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMImportExp"));
+  auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_USM_IMPORT_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10548,8 +10522,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
 
   ur_usm_release_exp_params_t params = {&hContext, &pMem};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUSMReleaseExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_RELEASE_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10557,8 +10532,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUSMReleaseExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_USM_RELEASE_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10570,8 +10545,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUSMReleaseExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_RELEASE_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10593,8 +10568,9 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
   ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
                                                        &peerDevice};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUsmP2PEnablePeerAccessExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10602,8 +10578,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urUsmP2PEnablePeerAccessExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10615,8 +10591,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUsmP2PEnablePeerAccessExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10638,8 +10614,9 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
   ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
                                                         &peerDevice};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUsmP2PDisablePeerAccessExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10647,9 +10624,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urUsmP2PDisablePeerAccessExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10661,8 +10637,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUsmP2PDisablePeerAccessExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10699,8 +10675,9 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
       &commandDevice, &peerDevice, &propName,
       &propSize,      &pPropValue, &pPropSizeRet};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urUsmP2PPeerAccessGetInfoExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10708,9 +10685,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urUsmP2PPeerAccessGetInfoExp"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10722,8 +10698,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urUsmP2PPeerAccessGetInfoExp"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10757,9 +10733,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrierExt(
   ur_enqueue_events_wait_with_barrier_ext_params_t params = {
       &hQueue, &pProperties, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback(
-          "urEnqueueEventsWaitWithBarrierExt"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback = callbacks.get_before_callback(
+      UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER_EXT);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10767,9 +10743,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrierExt(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback(
-          "urEnqueueEventsWaitWithBarrierExt"));
+  auto replaceCallback = callbacks.get_replace_callback(
+      UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER_EXT);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10785,9 +10760,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrierExt(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback(
-          "urEnqueueEventsWaitWithBarrierExt"));
+  auto afterCallback = callbacks.get_after_callback(
+      UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER_EXT);
   if (afterCallback) {
     return afterCallback(&params);
   }
@@ -10841,8 +10815,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
                                                    &phEventWaitList,
                                                    &phEvent};
 
-  auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_before_callback("urEnqueueNativeCommandExp"));
+  auto &callbacks = mock::getCallbacks();
+  auto beforeCallback =
+      callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP);
   if (beforeCallback) {
     result = beforeCallback(&params);
     if (result != UR_RESULT_SUCCESS) {
@@ -10850,8 +10825,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     }
   }
 
-  auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_replace_callback("urEnqueueNativeCommandExp"));
+  auto replaceCallback =
+      callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP);
   if (replaceCallback) {
     result = replaceCallback(&params);
   } else {
@@ -10867,8 +10842,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     return result;
   }
 
-  auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-      mock::getCallbacks().get_after_callback("urEnqueueNativeCommandExp"));
+  auto afterCallback =
+      callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP);
   if (afterCallback) {
     return afterCallback(&params);
   }
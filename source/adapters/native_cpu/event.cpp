@@ -45,13 +45,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
     void *pPropValue, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
   switch (propName) {
+  case UR_PROFILING_INFO_COMMAND_QUEUED:
+  case UR_PROFILING_INFO_COMMAND_SUBMIT:
+    return ReturnValue(hEvent->get_queued_timestamp());
   case UR_PROFILING_INFO_COMMAND_START:
     return ReturnValue(hEvent->get_start_timestamp());
   case UR_PROFILING_INFO_COMMAND_END:
-    return ReturnValue(hEvent->get_end_timestamp());
-  case UR_PROFILING_INFO_COMMAND_QUEUED:
-  case UR_PROFILING_INFO_COMMAND_SUBMIT:
   case UR_PROFILING_INFO_COMMAND_COMPLETE:
+    return ReturnValue(hEvent->get_end_timestamp());
   default:
     break;
   }
@@ -125,6 +126,9 @@ ur_event_handle_t_::ur_event_handle_t_(ur_queue_handle_t queue,
     : queue(queue), context(queue->getContext()), command_type(command_type),
       done(false) {
   this->queue->addEvent(this);
+  if (this->queue->isProfiling()) {
+    timestamp_queued = get_timestamp();
+  }
 }
 
 ur_event_handle_t_::~ur_event_handle_t_() {
@@ -49,6 +49,9 @@ struct ur_event_handle_t_ : RefCounted {
 
   void tick_end();
 
+  // Commands are submitted as soon as they are enqueued
+  uint64_t get_queued_timestamp() const { return timestamp_queued; }
+
   uint64_t get_start_timestamp() const { return timestamp_start; }
 
   uint64_t get_end_timestamp() const { return timestamp_end; }
@@ -61,6 +64,7 @@ private:
   std::mutex mutex;
   std::vector<std::future<void>> futures;
   std::function<void()> callback;
+  uint64_t timestamp_queued = 0;
   uint64_t timestamp_start = 0;
   uint64_t timestamp_end = 0;
 };
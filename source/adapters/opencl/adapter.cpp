@@ -10,6 +10,7 @@
 
 #include "adapter.hpp"
 #include "common.hpp"
+#include "device.hpp"
 #include "ur/ur.hpp"
 
 #ifdef _MSC_VER
@@ -44,6 +45,12 @@ ur_adapter_handle_t_::ur_adapter_handle_t_() {
 #endif // _MSC_VER
 }
 
+ur_adapter_handle_t_::~ur_adapter_handle_t_() {
+  // OpenCL may already be torn down at this point, so the devices still
+  // around are freed without releasing their OpenCL objects.
+  Devices.clear([](ur_device_handle_t Device) { delete Device; });
+}
+
 static ur_adapter_handle_t adapter = nullptr;
 
 ur_adapter_handle_t ur::cl::getAdapter() {
@@ -54,10 +61,6 @@ ur_adapter_handle_t ur::cl::getAdapter() {
 }
 
 static void globalAdapterShutdown() {
-  if (cl_ext::ExtFuncPtrCache) {
-    delete cl_ext::ExtFuncPtrCache;
-    cl_ext::ExtFuncPtrCache = nullptr;
-  }
   if (adapter) {
     delete adapter;
     adapter = nullptr;
@@ -75,11 +78,7 @@ urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
       atexit(globalAdapterShutdown);
     }
 
-    std::lock_guard<std::mutex> Lock{adapter->Mutex};
-    if (adapter->RefCount++ == 0) {
-      cl_ext::ExtFuncPtrCache = new cl_ext::ExtFuncPtrCacheT();
-    }
-
+    ++adapter->RefCount;
     *phAdapters = adapter;
   }
 
@@ -98,13 +97,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterRetain(ur_adapter_handle_t) {
 UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
   // Check first if the adapter is valid pointer
   if (adapter) {
-    std::lock_guard<std::mutex> Lock{adapter->Mutex};
-    if (--adapter->RefCount == 0) {
-      if (cl_ext::ExtFuncPtrCache) {
-        delete cl_ext::ExtFuncPtrCache;
-        cl_ext::ExtFuncPtrCache = nullptr;
-      }
-    }
+    --adapter->RefCount;
   }
   return UR_RESULT_SUCCESS;
 }
@@ -8,11 +8,70 @@
 //
 //===----------------------------------------------------------------------===//
 
+#pragma once
+
 #include "CL/cl.h"
 #include "logger/ur_logger.hpp"
 
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+/// Maps OpenCL objects to the UR handles wrapping them, for the entry points
+/// which get an OpenCL object back from OpenCL and have to return the UR
+/// handle for it.
+template <typename CLType, typename URType> class HandleMap {
+public:
+  /// Returns the handle registered for \p CLHandle, or nullptr.
+  URType find(CLType CLHandle) {
+    std::lock_guard<std::mutex> Lock{Mutex};
+    auto It = Map.find(CLHandle);
+    return It == Map.end() ? nullptr : It->second;
+  }
+
+  /// Registers \p Handle for \p CLHandle unless another handle already is,
+  /// and returns the handle that ends up registered.
+  URType insert(CLType CLHandle, URType Handle) {
+    std::lock_guard<std::mutex> Lock{Mutex};
+    return Map.try_emplace(CLHandle, Handle).first->second;
+  }
+
+  /// Registers \p Handle for \p CLHandle, which OpenCL has just created, and
+  /// returns the handle registered for an object that had the same address
+  /// before, or nullptr.
+  URType replace(CLType CLHandle, URType Handle) {
+    std::lock_guard<std::mutex> Lock{Mutex};
+    URType &Registered = Map[CLHandle];
+    return std::exchange(Registered, Handle);
+  }
+
+  /// Unregisters \p Handle, unless \p CLHandle has been reused since and is
+  /// registered for another handle.
+  void erase(CLType CLHandle, URType Handle) {
+    std::lock_guard<std::mutex> Lock{Mutex};
+    auto It = Map.find(CLHandle);
+    if (It != Map.end() && It->second == Handle) {
+      Map.erase(It);
+    }
+  }
+
+  /// Unregisters all handles, calling \p F on each of them.
+  template <typename Func> void clear(Func &&F) {
+    std::lock_guard<std::mutex> Lock{Mutex};
+    for (auto &[CLHandle, Handle] : Map) {
+      F(Handle);
+    }
+    Map.clear();
+  }
+
+private:
+  std::mutex Mutex;
+  std::unordered_map<CLType, URType> Map;
+};
+
 struct ur_adapter_handle_t_ {
   ur_adapter_handle_t_();
+  ~ur_adapter_handle_t_();
 
   std::atomic<uint32_t> RefCount = 0;
   std::mutex Mutex;
@@ -24,6 +83,14 @@ struct ur_adapter_handle_t_ {
 #define CL_CORE_FUNCTION(FUNC) decltype(::FUNC) *FUNC = nullptr;
 #include "core_functions.def"
 #undef CL_CORE_FUNCTION
+
+  /// Handles of the devices, contexts and queues alive, by OpenCL object.
+  /// Root devices are created on first use and live as long as the adapter.
+  /// Contexts and queues stay registered past their last release for as long
+  /// as OpenCL holds their objects.
+  HandleMap<cl_device_id, ur_device_handle_t> Devices;
+  HandleMap<cl_context, ur_context_handle_t> Contexts;
+  HandleMap<cl_command_queue, ur_queue_handle_t> Queues;
 };
 
 namespace ur {
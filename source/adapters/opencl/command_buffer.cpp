@@ -10,22 +10,20 @@
 
 #include "command_buffer.hpp"
 #include "common.hpp"
+#include "context.hpp"
+#include "kernel.hpp"
+#include "queue.hpp"
 
 /// The ur_exp_command_buffer_handle_t_ destructor calls CL release
 /// command-buffer to free the underlying object.
 ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
-  urQueueRelease(hInternalQueue);
-
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
-  cl_ext::clReleaseCommandBufferKHR_fn clReleaseCommandBufferKHR = nullptr;
-  cl_int Res =
-      cl_ext::getExtFuncFromContext<decltype(clReleaseCommandBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clReleaseCommandBufferKHRCache,
-          cl_ext::ReleaseCommandBufferName, &clReleaseCommandBufferKHR);
-  assert(Res == CL_SUCCESS);
-  (void)Res;
-
+  // The internal queue holds the context, so release the command-buffer
+  // before it.
+  auto clReleaseCommandBufferKHR = hContext->ExtFuncs.clReleaseCommandBufferKHR;
+  assert(clReleaseCommandBufferKHR);
   clReleaseCommandBufferKHR(CLCommandBuffer);
+
+  urQueueRelease(hInternalQueue);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
@@ -36,20 +34,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
   ur_queue_handle_t Queue = nullptr;
   UR_RETURN_ON_FAILURE(urQueueCreate(hContext, hDevice, nullptr, &Queue));
 
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
-  cl_ext::clCreateCommandBufferKHR_fn clCreateCommandBufferKHR = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<decltype(clCreateCommandBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCreateCommandBufferKHRCache,
-          cl_ext::CreateCommandBufferName, &clCreateCommandBufferKHR));
+  auto clCreateCommandBufferKHR = hContext->ExtFuncs.clCreateCommandBufferKHR;
+  UR_ASSERT(clCreateCommandBufferKHR, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   const bool IsUpdatable =
       pCommandBufferDesc ? pCommandBufferDesc->isUpdatable : false;
 
   ur_device_command_buffer_update_capability_flags_t UpdateCapabilities;
-  cl_device_id CLDevice = cl_adapter::cast<cl_device_id>(hDevice);
-  CL_RETURN_ON_FAILURE(
-      getDeviceCommandBufferUpdateCapabilities(CLDevice, UpdateCapabilities));
+  UR_RETURN_ON_FAILURE(
+      getDeviceCommandBufferUpdateCapabilities(hDevice, UpdateCapabilities));
   bool DeviceSupportsUpdate = UpdateCapabilities > 0;
 
   if (IsUpdatable && !DeviceSupportsUpdate) {
@@ -61,8 +54,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
       IsUpdatable ? CL_COMMAND_BUFFER_MUTABLE_KHR : 0u, 0};
 
   cl_int Res = CL_SUCCESS;
-  auto CLCommandBuffer = clCreateCommandBufferKHR(
-      1, cl_adapter::cast<cl_command_queue *>(&Queue), Properties, &Res);
+  auto CLCommandBuffer =
+      clCreateCommandBufferKHR(1, &Queue->CLQueue, Properties, &Res);
   CL_RETURN_ON_FAILURE_AND_SET_NULL(Res, phCommandBuffer);
 
   try {
@@ -95,12 +88,9 @@ urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
 UR_APIEXPORT ur_result_t UR_APICALL
 urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   UR_ASSERT(!hCommandBuffer->IsFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
-  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
-  cl_ext::clFinalizeCommandBufferKHR_fn clFinalizeCommandBufferKHR = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<decltype(clFinalizeCommandBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clFinalizeCommandBufferKHRCache,
-          cl_ext::FinalizeCommandBufferName, &clFinalizeCommandBufferKHR));
+  auto clFinalizeCommandBufferKHR =
+      hCommandBuffer->hContext->ExtFuncs.clFinalizeCommandBufferKHR;
+  UR_ASSERT(clFinalizeCommandBufferKHR, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   CL_RETURN_ON_FAILURE(
       clFinalizeCommandBufferKHR(hCommandBuffer->CLCommandBuffer));
@@ -127,12 +117,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
   UR_ASSERT(!(phCommandHandle && !hCommandBuffer->IsUpdatable),
             UR_RESULT_ERROR_INVALID_OPERATION);
 
-  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
-  cl_ext::clCommandNDRangeKernelKHR_fn clCommandNDRangeKernelKHR = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<decltype(clCommandNDRangeKernelKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCommandNDRangeKernelKHRCache,
-          cl_ext::CommandNRRangeKernelName, &clCommandNDRangeKernelKHR));
+  auto clCommandNDRangeKernelKHR =
+      hCommandBuffer->hContext->ExtFuncs.clCommandNDRangeKernelKHR;
+  UR_ASSERT(clCommandNDRangeKernelKHR, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   cl_mutable_command_khr CommandHandle = nullptr;
   cl_mutable_command_khr *OutCommandHandle =
@@ -149,10 +136,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
   cl_command_properties_khr *Properties =
       hCommandBuffer->IsUpdatable ? UpdateProperties : nullptr;
   CL_RETURN_ON_FAILURE(clCommandNDRangeKernelKHR(
-      hCommandBuffer->CLCommandBuffer, nullptr, Properties,
-      cl_adapter::cast<cl_kernel>(hKernel), workDim, pGlobalWorkOffset,
-      pGlobalWorkSize, pLocalWorkSize, numSyncPointsInWaitList,
-      pSyncPointWaitList, pSyncPoint, OutCommandHandle));
+      hCommandBuffer->CLCommandBuffer, nullptr, Properties, hKernel->CLKernel,
+      workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint,
+      OutCommandHandle));
 
   try {
     auto Handle = std::make_unique<ur_exp_command_buffer_command_handle_t_>(
@@ -212,12 +199,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
   (void)phEventWaitList;
   (void)phEvent;
   (void)phCommand;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
-  cl_ext::clCommandCopyBufferKHR_fn clCommandCopyBufferKHR = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<decltype(clCommandCopyBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCommandCopyBufferKHRCache,
-          cl_ext::CommandCopyBufferName, &clCommandCopyBufferKHR));
+  auto clCommandCopyBufferKHR =
+      hCommandBuffer->hContext->ExtFuncs.clCommandCopyBufferKHR;
+  UR_ASSERT(clCommandCopyBufferKHR, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   CL_RETURN_ON_FAILURE(clCommandCopyBufferKHR(
       hCommandBuffer->CLCommandBuffer, nullptr, nullptr,
@@ -250,12 +234,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
   size_t OpenCLDstRect[3]{dstOrigin.x, dstOrigin.y, dstOrigin.z};
   size_t OpenCLRegion[3]{region.width, region.height, region.depth};
 
-  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
-  cl_ext::clCommandCopyBufferRectKHR_fn clCommandCopyBufferRectKHR = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<decltype(clCommandCopyBufferRectKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCommandCopyBufferRectKHRCache,
-          cl_ext::CommandCopyBufferRectName, &clCommandCopyBufferRectKHR));
+  auto clCommandCopyBufferRectKHR =
+      hCommandBuffer->hContext->ExtFuncs.clCommandCopyBufferRectKHR;
+  UR_ASSERT(clCommandCopyBufferRectKHR, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   CL_RETURN_ON_FAILURE(clCommandCopyBufferRectKHR(
       hCommandBuffer->CLCommandBuffer, nullptr, nullptr,
@@ -354,12 +335,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
     [[maybe_unused]] ur_event_handle_t *phEvent,
     [[maybe_unused]] ur_exp_command_buffer_command_handle_t *phCommand) {
 
-  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
-  cl_ext::clCommandFillBufferKHR_fn clCommandFillBufferKHR = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<decltype(clCommandFillBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCommandFillBufferKHRCache,
-          cl_ext::CommandFillBufferName, &clCommandFillBufferKHR));
+  auto clCommandFillBufferKHR =
+      hCommandBuffer->hContext->ExtFuncs.clCommandFillBufferKHR;
+  UR_ASSERT(clCommandFillBufferKHR, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   CL_RETURN_ON_FAILURE(clCommandFillBufferKHR(
       hCommandBuffer->CLCommandBuffer, nullptr, nullptr,
@@ -420,19 +398,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
 
-  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
-  cl_ext::clEnqueueCommandBufferKHR_fn clEnqueueCommandBufferKHR = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<decltype(clEnqueueCommandBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clEnqueueCommandBufferKHRCache,
-          cl_ext::EnqueueCommandBufferName, &clEnqueueCommandBufferKHR));
+  auto clEnqueueCommandBufferKHR =
+      hCommandBuffer->hContext->ExtFuncs.clEnqueueCommandBufferKHR;
+  UR_ASSERT(clEnqueueCommandBufferKHR, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   const uint32_t NumberOfQueues = 1;
 
   CL_RETURN_ON_FAILURE(clEnqueueCommandBufferKHR(
-      NumberOfQueues, cl_adapter::cast<cl_command_queue *>(&hQueue),
-      hCommandBuffer->CLCommandBuffer, numEventsInWaitList,
-      cl_adapter::cast<const cl_event *>(phEventWaitList),
+      NumberOfQueues, &hQueue->CLQueue, hCommandBuffer->CLCommandBuffer,
+      numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
   return UR_RESULT_SUCCESS;
@@ -513,11 +487,10 @@ ur_result_t validateCommandDesc(
   // Verify that the device supports updating the aspects of the kernel that
   // the user is requesting.
   ur_device_handle_t URDevice = Command->hCommandBuffer->hDevice;
-  cl_device_id CLDevice = cl_adapter::cast<cl_device_id>(URDevice);
 
   ur_device_command_buffer_update_capability_flags_t UpdateCapabilities = 0;
-  CL_RETURN_ON_FAILURE(
-      getDeviceCommandBufferUpdateCapabilities(CLDevice, UpdateCapabilities));
+  UR_RETURN_ON_FAILURE(
+      getDeviceCommandBufferUpdateCapabilities(URDevice, UpdateCapabilities));
 
   size_t *NewGlobalWorkOffset = UpdateDesc->pNewGlobalWorkOffset;
   UR_ASSERT(
@@ -564,13 +537,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   UR_RETURN_ON_FAILURE(validateCommandDesc(hCommand, pUpdateKernelLaunch));
 
   ur_exp_command_buffer_handle_t hCommandBuffer = hCommand->hCommandBuffer;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
-
-  cl_ext::clUpdateMutableCommandsKHR_fn clUpdateMutableCommandsKHR = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<decltype(clUpdateMutableCommandsKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clUpdateMutableCommandsKHRCache,
-          cl_ext::UpdateMutableCommandsName, &clUpdateMutableCommandsKHR));
+  auto clUpdateMutableCommandsKHR =
+      hCommandBuffer->hContext->ExtFuncs.clUpdateMutableCommandsKHR;
+  UR_ASSERT(clUpdateMutableCommandsKHR, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   if (!hCommandBuffer->IsFinalized || !hCommandBuffer->IsUpdatable)
     return UR_RESULT_ERROR_INVALID_OPERATION;
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "device.hpp"
 #include "logger/ur_logger.hpp"
 namespace cl_adapter {
 
@@ -121,33 +122,23 @@ ur_result_t getNativeHandle(void *URObj, ur_native_handle_t *NativeHandle) {
   return UR_RESULT_SUCCESS;
 }
 
-cl_int getDeviceCommandBufferUpdateCapabilities(
-    cl_device_id Dev,
+ur_result_t getDeviceCommandBufferUpdateCapabilities(
+    ur_device_handle_t hDevice,
     ur_device_command_buffer_update_capability_flags_t &UpdateCapabilities) {
 
   UpdateCapabilities = 0;
 
-  size_t ExtSize = 0;
-  CL_RETURN_ON_FAILURE(
-      clGetDeviceInfo(Dev, CL_DEVICE_EXTENSIONS, 0, nullptr, &ExtSize));
-
-  std::string ExtStr(ExtSize, '\0');
-  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, CL_DEVICE_EXTENSIONS, ExtSize,
-                                       ExtStr.data(), nullptr));
-
-  std::string SupportedExtensions(ExtStr.c_str());
-  if (ExtStr.find("cl_khr_command_buffer_mutable_dispatch") ==
-      std::string::npos) {
-    return CL_SUCCESS;
+  if (!hDevice->hasExtension(
+          cl_adapter::DeviceExtension::KhrCommandBufferMutableDispatch)) {
+    return UR_RESULT_SUCCESS;
   }
 
   cl_mutable_dispatch_fields_khr MutableCapabilities;
-  CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-      Dev, CL_DEVICE_MUTABLE_DISPATCH_CAPABILITIES_KHR,
-      sizeof(MutableCapabilities), &MutableCapabilities, nullptr));
+  UR_RETURN_ON_FAILURE(hDevice->getInfo(
+      CL_DEVICE_MUTABLE_DISPATCH_CAPABILITIES_KHR, MutableCapabilities));
 
   if (!(MutableCapabilities & CL_MUTABLE_DISPATCH_EXEC_INFO_KHR)) {
-    return CL_SUCCESS;
+    return UR_RESULT_SUCCESS;
   }
 
   if (MutableCapabilities & CL_MUTABLE_DISPATCH_ARGUMENTS_KHR) {
@@ -167,5 +158,5 @@ cl_int getDeviceCommandBufferUpdateCapabilities(
         UR_DEVICE_COMMAND_BUFFER_UPDATE_CAPABILITY_FLAG_GLOBAL_WORK_OFFSET;
   }
 
-  return CL_SUCCESS;
+  return UR_RESULT_SUCCESS;
 }
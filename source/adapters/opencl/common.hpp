@@ -10,7 +10,6 @@
 #include <CL/cl.h>
 #include <CL/cl_ext.h>
 #include <climits>
-#include <map>
 #include <mutex>
 #include <ur/ur.hpp>
 
@@ -175,68 +174,22 @@ template <class To, class From> To cast(From Value) {
 } // namespace cl_adapter
 
 namespace cl_ext {
-// Older versions of GCC don't like "const" here
-#if defined(__GNUC__) && (__GNUC__ < 7 || (__GNU__C == 7 && __GNUC_MINOR__ < 2))
-#define CONSTFIX constexpr
-#else
-#define CONSTFIX const
-#endif
-
-// Names of USM functions that are queried from OpenCL
-CONSTFIX char HostMemAllocName[] = "clHostMemAllocINTEL";
-CONSTFIX char DeviceMemAllocName[] = "clDeviceMemAllocINTEL";
-CONSTFIX char SharedMemAllocName[] = "clSharedMemAllocINTEL";
-CONSTFIX char MemBlockingFreeName[] = "clMemBlockingFreeINTEL";
-CONSTFIX char CreateBufferWithPropertiesName[] =
-    "clCreateBufferWithPropertiesINTEL";
-CONSTFIX char SetKernelArgMemPointerName[] = "clSetKernelArgMemPointerINTEL";
-CONSTFIX char EnqueueMemFillName[] = "clEnqueueMemFillINTEL";
-CONSTFIX char EnqueueMemcpyName[] = "clEnqueueMemcpyINTEL";
-CONSTFIX char GetMemAllocInfoName[] = "clGetMemAllocInfoINTEL";
-CONSTFIX char SetProgramSpecializationConstantName[] =
-    "clSetProgramSpecializationConstant";
-CONSTFIX char GetDeviceFunctionPointerName[] =
-    "clGetDeviceFunctionPointerINTEL";
-CONSTFIX char GetDeviceGlobalVariablePointerName[] =
-    "clGetDeviceGlobalVariablePointerINTEL";
-CONSTFIX char EnqueueWriteGlobalVariableName[] =
-    "clEnqueueWriteGlobalVariableINTEL";
-CONSTFIX char EnqueueReadGlobalVariableName[] =
-    "clEnqueueReadGlobalVariableINTEL";
-// Names of host pipe functions queried from OpenCL
-CONSTFIX char EnqueueReadHostPipeName[] = "clEnqueueReadHostPipeINTEL";
-CONSTFIX char EnqueueWriteHostPipeName[] = "clEnqueueWriteHostPipeINTEL";
-// Names of command-buffer functions queried from OpenCL
-CONSTFIX char CreateCommandBufferName[] = "clCreateCommandBufferKHR";
-CONSTFIX char RetainCommandBufferName[] = "clRetainCommandBufferKHR";
-CONSTFIX char ReleaseCommandBufferName[] = "clReleaseCommandBufferKHR";
-CONSTFIX char FinalizeCommandBufferName[] = "clFinalizeCommandBufferKHR";
-CONSTFIX char CommandNRRangeKernelName[] = "clCommandNDRangeKernelKHR";
-CONSTFIX char CommandCopyBufferName[] = "clCommandCopyBufferKHR";
-CONSTFIX char CommandCopyBufferRectName[] = "clCommandCopyBufferRectKHR";
-CONSTFIX char CommandFillBufferName[] = "clCommandFillBufferKHR";
-CONSTFIX char EnqueueCommandBufferName[] = "clEnqueueCommandBufferKHR";
-CONSTFIX char GetCommandBufferInfoName[] = "clGetCommandBufferInfoKHR";
-CONSTFIX char UpdateMutableCommandsName[] = "clUpdateMutableCommandsKHR";
-CONSTFIX char CreateProgramWithILName[] = "clCreateProgramWithILKHR";
-CONSTFIX char GetKernelSubGroupInfoName[] = "clGetKernelSubGroupInfoKHR";
-
-#undef CONSTFIX
-
-using clGetDeviceFunctionPointer_fn = CL_API_ENTRY
+using clGetDeviceFunctionPointerINTEL_fn = CL_API_ENTRY
 cl_int(CL_API_CALL *)(cl_device_id device, cl_program program,
                       const char *FuncName, cl_ulong *ret_ptr);
 
-using clGetDeviceGlobalVariablePointer_fn = CL_API_ENTRY cl_int(CL_API_CALL *)(
-    cl_device_id device, cl_program program, const char *globalVariableName,
-    size_t *globalVariableSizeRet, void **globalVariablePointerRet);
+using clGetDeviceGlobalVariablePointerINTEL_fn = CL_API_ENTRY
+cl_int(CL_API_CALL *)(cl_device_id device, cl_program program,
+                      const char *globalVariableName,
+                      size_t *globalVariableSizeRet,
+                      void **globalVariablePointerRet);
 
-using clEnqueueWriteGlobalVariable_fn = CL_API_ENTRY
+using clEnqueueWriteGlobalVariableINTEL_fn = CL_API_ENTRY
 cl_int(CL_API_CALL *)(cl_command_queue, cl_program, const char *, cl_bool,
                       size_t, size_t, const void *, cl_uint, const cl_event *,
                       cl_event *);
 
-using clEnqueueReadGlobalVariable_fn = CL_API_ENTRY
+using clEnqueueReadGlobalVariableINTEL_fn = CL_API_ENTRY
 cl_int(CL_API_CALL *)(cl_command_queue, cl_program, const char *, cl_bool,
                       size_t, size_t, void *, cl_uint, const cl_event *,
                       cl_event *);
@@ -325,107 +278,32 @@ using clGetKernelSubGroupInfoKHR_fn = CL_API_ENTRY
 cl_int(CL_API_CALL *)(cl_kernel, cl_device_id, cl_kernel_sub_group_info, size_t,
                       const void *, size_t, void *, size_t *);
 
-template <typename T> struct FuncPtrCache {
-  std::map<cl_context, T> Map;
-  std::mutex Mutex;
-
-  void clear(cl_context context) {
-    std::lock_guard<std::mutex> CacheLock{Mutex};
-    Map.erase(context);
-  }
-};
-
-struct ExtFuncPtrCacheT {
-#define CL_EXTENSION_FUNC(func) FuncPtrCache<func##_fn> func##Cache;
+/// Extension functions of the platform a context was created on, resolved
+/// once when the context is created. Functions the platform doesn't provide
+/// are left null.
+struct ExtFuncPtrTableT {
+#define CL_EXTENSION_FUNC(func) func##_fn func = nullptr;
 
 #include "extension_functions.def"
 
 #undef CL_EXTENSION_FUNC
 
-  // If a context stored in the current caching mechanism is destroyed by the
-  // CL driver all of its function pointers are invalidated. This can lead to a
-  // pathological case where a subsequently created context gets returned with
-  // a coincidentally identical handle to the destroyed one and ends up being
-  // used to retrieve bad function pointers. To avoid this we clear the cache
-  // when contexts are released.
-  void clearCache(cl_context context) {
-#define CL_EXTENSION_FUNC(func) func##Cache.clear(context);
+  void init(cl_platform_id Platform) {
+#define CL_EXTENSION_FUNC(func)                                                \
+  func = reinterpret_cast<func##_fn>(                                          \
+      clGetExtensionFunctionAddressForPlatform(Platform, #func));
 
 #include "extension_functions.def"
 
 #undef CL_EXTENSION_FUNC
   }
 };
-// A raw pointer is used here since the lifetime of this map has to be tied to
-// piTeardown to avoid issues with static destruction order (a user application
-// might have static objects that indirectly access this cache in their
-// destructor).
-inline ExtFuncPtrCacheT *ExtFuncPtrCache;
-
-// USM helper function to get an extension function pointer
-template <typename T>
-static ur_result_t getExtFuncFromContext(cl_context Context,
-                                         FuncPtrCache<T> &FPtrCache,
-                                         const char *FuncName, T *Fptr) {
-  // TODO
-  // Potentially redo caching as UR interface changes.
-  // if cached, return cached FuncPtr
-  std::lock_guard<std::mutex> CacheLock{FPtrCache.Mutex};
-  std::map<cl_context, T> &FPtrMap = FPtrCache.Map;
-  auto It = FPtrMap.find(Context);
-  if (It != FPtrMap.end()) {
-    auto F = It->second;
-    // if cached that extension is not available return nullptr and
-    // UR_RESULT_ERROR_UNSUPPORTED_FEATURE
-    *Fptr = F;
-    return F ? UR_RESULT_SUCCESS : UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
-  }
-
-  cl_uint DeviceCount;
-  cl_int RetErr = clGetContextInfo(Context, CL_CONTEXT_NUM_DEVICES,
-                                   sizeof(cl_uint), &DeviceCount, nullptr);
-
-  if (RetErr != CL_SUCCESS || DeviceCount < 1) {
-    return UR_RESULT_ERROR_INVALID_CONTEXT;
-  }
-
-  std::vector<cl_device_id> DevicesInCtx(DeviceCount);
-  RetErr = clGetContextInfo(Context, CL_CONTEXT_DEVICES,
-                            DeviceCount * sizeof(cl_device_id),
-                            DevicesInCtx.data(), nullptr);
-
-  if (RetErr != CL_SUCCESS) {
-    return UR_RESULT_ERROR_INVALID_CONTEXT;
-  }
-
-  cl_platform_id CurPlatform;
-  RetErr = clGetDeviceInfo(DevicesInCtx[0], CL_DEVICE_PLATFORM,
-                           sizeof(cl_platform_id), &CurPlatform, nullptr);
-
-  if (RetErr != CL_SUCCESS) {
-    return UR_RESULT_ERROR_INVALID_CONTEXT;
-  }
-
-  T FuncPtr = reinterpret_cast<T>(
-      clGetExtensionFunctionAddressForPlatform(CurPlatform, FuncName));
-
-  if (!FuncPtr) {
-    // Cache that the extension is not available
-    FPtrMap[Context] = nullptr;
-    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
-  }
-
-  *Fptr = FuncPtr;
-  FPtrMap[Context] = FuncPtr;
-
-  return UR_RESULT_SUCCESS;
-}
 } // namespace cl_ext
 
 ur_result_t mapCLErrorToUR(cl_int Result);
 
 ur_result_t getNativeHandle(void *URObj, ur_native_handle_t *NativeHandle);
 
-cl_int getDeviceCommandBufferUpdateCapabilities(
-    cl_device_id Dev,
+ur_result_t getDeviceCommandBufferUpdateCapabilities(
+    ur_device_handle_t hDevice,
     ur_device_command_buffer_update_capability_flags_t &UpdateCapabilities);
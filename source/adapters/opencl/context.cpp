@@ -10,64 +10,167 @@
 
 #include "context.hpp"
 #include "adapter.hpp"
+#include "queue.hpp"
 
 #include <mutex>
 #include <set>
 #include <unordered_map>
 
-ur_result_t cl_adapter::getDevicesFromContext(
-    ur_context_handle_t hContext,
-    std::unique_ptr<std::vector<cl_device_id>> &DevicesInCtx) {
+ur_context_handle_t_::~ur_context_handle_t_() {
+  for (auto hQueue : RetiredQueues) {
+    ur::cl::getAdapter()->Queues.erase(hQueue->CLQueue, hQueue);
+    delete hQueue;
+  }
+  for (auto &Device : Devices) {
+    urDeviceRelease(Device);
+  }
+}
 
-  cl_uint DeviceCount;
-  CL_RETURN_ON_FAILURE(clGetContextInfo(cl_adapter::cast<cl_context>(hContext),
-                                        CL_CONTEXT_NUM_DEVICES, sizeof(cl_uint),
-                                        &DeviceCount, nullptr));
+bool ur_context_handle_t_::retire() {
+  std::lock_guard<std::mutex> Lock{RetiredMutex};
+  if (HasDestructorCallback) {
+    return true;
+  }
+
+  // The count is only a hint in general, but nothing can start holding the
+  // context once the handle has no references left
+  cl_uint CLRefCount = 0;
+  if (clGetContextInfo(CLContext, CL_CONTEXT_REFERENCE_COUNT,
+                       sizeof(CLRefCount), &CLRefCount,
+                       nullptr) == CL_SUCCESS &&
+      CLRefCount == 1) {
+    return false;
+  }
+
+  auto clSetContextDestructorCallback =
+      ur::cl::getAdapter()->clSetContextDestructorCallback;
+  auto Destructor = [](cl_context CLContext, void *pUserData) {
+    auto hContext = static_cast<ur_context_handle_t>(pUserData);
+    ur::cl::getAdapter()->Contexts.erase(CLContext, hContext);
+    delete hContext;
+  };
+  HasDestructorCallback =
+      clSetContextDestructorCallback &&
+      clSetContextDestructorCallback(CLContext, Destructor, this) ==
+          CL_SUCCESS;
+  return true;
+}
+
+bool ur_context_handle_t_::retireQueue(ur_queue_handle_t hQueue) {
+  std::lock_guard<std::mutex> Lock{RetiredMutex};
+  if (hQueue->Retired) {
+    return true;
+  }
+
+  cl_uint CLRefCount = 0;
+  if (clGetCommandQueueInfo(hQueue->CLQueue, CL_QUEUE_REFERENCE_COUNT,
+                            sizeof(CLRefCount), &CLRefCount,
+                            nullptr) == CL_SUCCESS &&
+      CLRefCount == 1) {
+    return false;
+  }
+  hQueue->Retired = true;
+  RetiredQueues.push_back(hQueue);
+  return true;
+}
 
+// Returns the handle registered for CLContext, or wraps CLContext in a new
+// one, taking over a reference to CLContext either way
+static ur_result_t wrapContext(cl_context CLContext,
+                               ur_context_handle_t &hContext) {
+  auto &Contexts = ur::cl::getAdapter()->Contexts;
+  if ((hContext = Contexts.find(CLContext))) {
+    hContext->RefCount++;
+    return UR_RESULT_SUCCESS;
+  }
+
+  cl_uint DeviceCount;
+  CL_RETURN_ON_FAILURE(clGetContextInfo(CLContext, CL_CONTEXT_NUM_DEVICES,
+                                        sizeof(cl_uint), &DeviceCount,
+                                        nullptr));
   if (DeviceCount < 1) {
     return UR_RESULT_ERROR_INVALID_CONTEXT;
   }
 
-  DevicesInCtx = std::make_unique<std::vector<cl_device_id>>(DeviceCount);
-
-  CL_RETURN_ON_FAILURE(clGetContextInfo(
-      cl_adapter::cast<cl_context>(hContext), CL_CONTEXT_DEVICES,
-      DeviceCount * sizeof(cl_device_id), (*DevicesInCtx).data(), nullptr));
+  std::vector<cl_device_id> CLDevices(DeviceCount);
+  CL_RETURN_ON_FAILURE(clGetContextInfo(CLContext, CL_CONTEXT_DEVICES,
+                                        DeviceCount * sizeof(cl_device_id),
+                                        CLDevices.data(), nullptr));
+  std::vector<ur_device_handle_t> Devices(DeviceCount);
+  for (cl_uint I = 0; I < DeviceCount; I++) {
+    UR_RETURN_ON_FAILURE(cl_adapter::getDevice(CLDevices[I], Devices[I]));
+  }
 
+  try {
+    auto Context =
+        std::make_unique<ur_context_handle_t_>(CLContext, std::move(Devices));
+    hContext = Contexts.insert(CLContext, Context.get());
+    if (hContext == Context.get()) {
+      Context.release();
+    } else {
+      // Another thread got to wrap the context first
+      hContext->RefCount++;
+    }
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t cl_adapter::getContext(cl_context CLContext,
+                                   ur_context_handle_t &hContext) {
+  hContext = nullptr;
+  if (!CLContext ||
+      (hContext = ur::cl::getAdapter()->Contexts.find(CLContext))) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  // The context was created outside of the adapter. It's wrapped like a
+  // native handle, and the reference is dropped right away, which retires the
+  // handle since whoever the context came from still holds it.
+  CL_RETURN_ON_FAILURE(clRetainContext(CLContext));
+  if (auto Result = wrapContext(CLContext, hContext);
+      Result != UR_RESULT_SUCCESS) {
+    clReleaseContext(CLContext);
+    return Result;
+  }
+  return urContextRelease(hContext);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
     uint32_t DeviceCount, const ur_device_handle_t *phDevices,
     const ur_context_properties_t *, ur_context_handle_t *phContext) {
 
+  std::vector<cl_device_id> CLDevices(DeviceCount);
+  for (uint32_t I = 0; I < DeviceCount; I++) {
+    CLDevices[I] = phDevices[I]->CLDevice;
+  }
+
   cl_int Ret;
-  *phContext = cl_adapter::cast<ur_context_handle_t>(
+  cl_context CLContext =
       clCreateContext(nullptr, cl_adapter::cast<cl_uint>(DeviceCount),
-                      cl_adapter::cast<const cl_device_id *>(phDevices),
-                      nullptr, nullptr, cl_adapter::cast<cl_int *>(&Ret)));
-
-  return mapCLErrorToUR(Ret);
-}
-
-static cl_int mapURContextInfoToCL(ur_context_info_t URPropName) {
-
-  cl_int CLPropName;
-  switch (URPropName) {
-  case UR_CONTEXT_INFO_NUM_DEVICES:
-    CLPropName = CL_CONTEXT_NUM_DEVICES;
-    break;
-  case UR_CONTEXT_INFO_DEVICES:
-    CLPropName = CL_CONTEXT_DEVICES;
-    break;
-  case UR_CONTEXT_INFO_REFERENCE_COUNT:
-    CLPropName = CL_CONTEXT_REFERENCE_COUNT;
-    break;
-  default:
-    CLPropName = -1;
+                      CLDevices.data(), nullptr, nullptr, &Ret);
+  CL_RETURN_ON_FAILURE_AND_SET_NULL(Ret, phContext);
+
+  try {
+    auto Context = std::make_unique<ur_context_handle_t_>(
+        CLContext,
+        std::vector<ur_device_handle_t>(phDevices, phDevices + DeviceCount));
+    // A handle still registered for the address is a retired one whose
+    // context is gone, but couldn't report that
+    delete ur::cl::getAdapter()->Contexts.replace(CLContext, Context.get());
+    *phContext = Context.release();
+  } catch (std::bad_alloc &) {
+    clReleaseContext(CLContext);
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    clReleaseContext(CLContext);
+    return UR_RESULT_ERROR_UNKNOWN;
   }
 
-  return CLPropName;
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
@@ -75,7 +178,6 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
                  size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
-  const cl_int CLPropName = mapURContextInfoToCL(propName);
 
   switch (static_cast<uint32_t>(propName)) {
   /* 2D USM memops are not supported. */
@@ -92,21 +194,11 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
   }
   case UR_CONTEXT_INFO_NUM_DEVICES:
+    return ReturnValue(static_cast<uint32_t>(hContext->Devices.size()));
   case UR_CONTEXT_INFO_DEVICES:
-  case UR_CONTEXT_INFO_REFERENCE_COUNT: {
-    size_t CheckPropSize = 0;
-    auto ClResult =
-        clGetContextInfo(cl_adapter::cast<cl_context>(hContext), CLPropName,
-                         propSize, pPropValue, &CheckPropSize);
-    if (pPropValue && CheckPropSize != propSize) {
-      return UR_RESULT_ERROR_INVALID_SIZE;
-    }
-    CL_RETURN_ON_FAILURE(ClResult);
-    if (pPropSizeRet) {
-      *pPropSizeRet = CheckPropSize;
-    }
-    return UR_RESULT_SUCCESS;
-  }
+    return ReturnValue(hContext->Devices.data(), hContext->Devices.size());
+  case UR_CONTEXT_INFO_REFERENCE_COUNT:
+    return ReturnValue(hContext->RefCount.load());
   default:
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
@@ -114,43 +206,34 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urContextRelease(ur_context_handle_t hContext) {
-  // If we're reasonably sure this context is about to be detroyed we should
-  // clear the ext function pointer cache. This isn't foolproof sadly but it
-  // should drastically reduce the chances of the pathological case described
-  // in the comments in common.hpp.
-  static std::mutex contextReleaseMutex;
-  auto clContext = cl_adapter::cast<cl_context>(hContext);
-
-  {
-    std::lock_guard<std::mutex> lock(contextReleaseMutex);
-    size_t refCount = 0;
-    CL_RETURN_ON_FAILURE(clGetContextInfo(clContext, CL_CONTEXT_REFERENCE_COUNT,
-                                          sizeof(size_t), &refCount, nullptr));
-
-    // ExtFuncPtrCache is destroyed in an atexit() callback, so it doesn't
-    // necessarily outlive the adapter (or all the contexts).
-    if (refCount == 1 && cl_ext::ExtFuncPtrCache) {
-      cl_ext::ExtFuncPtrCache->clearCache(clContext);
-    }
+  if (--hContext->RefCount > 0) {
+    return mapCLErrorToUR(clReleaseContext(hContext->CLContext));
   }
 
-  CL_RETURN_ON_FAILURE(
-      clReleaseContext(cl_adapter::cast<cl_context>(hContext)));
+  cl_context CLContext = hContext->CLContext;
+  if (hContext->retire()) {
+    // OpenCL may free the handle as soon as the context is released
+    return mapCLErrorToUR(clReleaseContext(CLContext));
+  }
 
-  return UR_RESULT_SUCCESS;
+  ur::cl::getAdapter()->Contexts.erase(CLContext, hContext);
+  cl_int Ret = clReleaseContext(CLContext);
+  delete hContext;
+  return mapCLErrorToUR(Ret);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urContextRetain(ur_context_handle_t hContext) {
 
-  cl_int Ret = clRetainContext(cl_adapter::cast<cl_context>(hContext));
-  return mapCLErrorToUR(Ret);
+  CL_RETURN_ON_FAILURE(clRetainContext(hContext->CLContext));
+  hContext->RefCount++;
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urContextGetNativeHandle(
     ur_context_handle_t hContext, ur_native_handle_t *phNativeContext) {
 
-  *phNativeContext = reinterpret_cast<ur_native_handle_t>(hContext);
+  *phNativeContext = reinterpret_cast<ur_native_handle_t>(hContext->CLContext);
   return UR_RESULT_SUCCESS;
 }
 
@@ -160,10 +243,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     const ur_context_native_properties_t *pProperties,
     ur_context_handle_t *phContext) {
 
-  *phContext = reinterpret_cast<ur_context_handle_t>(hNativeContext);
+  cl_context CLContext = reinterpret_cast<cl_context>(hNativeContext);
   if (!pProperties || !pProperties->isNativeHandleOwned) {
-    return urContextRetain(*phContext);
+    CL_RETURN_ON_FAILURE(clRetainContext(CLContext));
   }
+
+  if (auto Result = wrapContext(CLContext, *phContext);
+      Result != UR_RESULT_SUCCESS) {
+    clReleaseContext(CLContext);
+    return Result;
+  }
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -221,7 +311,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextSetExtendedDeleter(
     C->execute();
   };
   CL_RETURN_ON_FAILURE(ur::cl::getAdapter()->clSetContextDestructorCallback(
-      cl_adapter::cast<cl_context>(hContext), ClCallback, Callback));
+      hContext->CLContext, ClCallback, Callback));
 
   return UR_RESULT_SUCCESS;
 }
@@ -10,9 +10,63 @@
 #pragma once
 
 #include "common.hpp"
+#include "device.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+/// Handle to an OpenCL context.
+///
+/// Programs, memory objects, events, samplers and command-queues keep the
+/// OpenCL context alive and can be asked for it, so the handle outlives its
+/// last reference for as long as OpenCL does, see retire().
+struct ur_context_handle_t_ {
+  using native_type = cl_context;
+
+  /// OpenCL context object.
+  native_type CLContext;
+  /// Devices the context was created for.
+  std::vector<ur_device_handle_t> Devices;
+  /// Extension functions of the platform of the devices.
+  cl_ext::ExtFuncPtrTableT ExtFuncs;
+  /// Object reference count.
+  std::atomic<uint32_t> RefCount = 1;
+
+  ur_context_handle_t_(native_type CLContext,
+                       std::vector<ur_device_handle_t> Devices)
+      : CLContext(CLContext), Devices(std::move(Devices)) {
+    for (auto &Device : this->Devices) {
+      urDeviceRetain(Device);
+    }
+    ExtFuncs.init(cl_adapter::cast<cl_platform_id>(this->Devices[0]->Platform));
+  }
+
+  ~ur_context_handle_t_();
+
+  /// Called when the last reference is released, before the OpenCL context
+  /// is. Returns false if nothing else holds the OpenCL context, in which case
+  /// the caller frees the handle. Otherwise the handle stays registered with
+  /// the adapter, and is freed once OpenCL destroys the context, or never if
+  /// the platform can't report that.
+  bool retire();
+
+  /// Called when the last reference to \p hQueue is released, before the
+  /// OpenCL command-queue is. Returns false if nothing else holds the
+  /// command-queue, in which case the caller frees the handle. Otherwise the
+  /// context keeps the handle until it's freed itself.
+  bool retireQueue(ur_queue_handle_t hQueue);
+
+private:
+  std::mutex RetiredMutex;
+  /// Whether OpenCL frees the handle when it destroys the context.
+  bool HasDestructorCallback = false;
+  std::vector<ur_queue_handle_t> RetiredQueues;
+};
 
 namespace cl_adapter {
-ur_result_t
-getDevicesFromContext(ur_context_handle_t hContext,
-                      std::unique_ptr<std::vector<cl_device_id>> &DevicesInCtx);
-}
+/// Returns the handle of \p CLContext, creating one if the context was
+/// created outside of the adapter. The caller doesn't get a reference of its
+/// own to the handle.
+ur_result_t getContext(cl_context CLContext, ur_context_handle_t &hContext);
+} // namespace cl_adapter
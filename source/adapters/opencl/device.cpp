@@ -13,6 +13,8 @@
 
 #include <array>
 #include <cassert>
+#include <string_view>
+#include <utility>
 
 ur_result_t cl_adapter::getDeviceVersion(cl_device_id Dev,
                                          oclv::OpenCLVersion &Version) {
@@ -33,44 +35,116 @@ ur_result_t cl_adapter::getDeviceVersion(cl_device_id Dev,
   return UR_RESULT_SUCCESS;
 }
 
-static bool isIntelFPGAEmuDevice(cl_device_id Dev) {
-  size_t NameSize = 0;
-  CL_RETURN_ON_FAILURE(
-      clGetDeviceInfo(Dev, CL_DEVICE_NAME, 0, nullptr, &NameSize));
-  std::string NameStr(NameSize, '\0');
+ur_result_t ur_device_handle_t_::getInfo(cl_device_info Info,
+                                         const std::vector<uint8_t> *&Value) {
+  {
+    std::lock_guard<std::mutex> Lock{InfoMutex};
+    auto It = InfoCache.find(Info);
+    if (It != InfoCache.end()) {
+      Value = &It->second;
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
+  size_t Size = 0;
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(CLDevice, Info, 0, nullptr, &Size));
+  std::vector<uint8_t> Bytes(Size);
   CL_RETURN_ON_FAILURE(
-      clGetDeviceInfo(Dev, CL_DEVICE_NAME, NameSize, NameStr.data(), nullptr));
+      clGetDeviceInfo(CLDevice, Info, Size, Bytes.data(), nullptr));
 
-  return NameStr.find("Intel(R) FPGA Emulation Device") != std::string::npos;
+  // Another thread may have queried it in the meantime, either value will do
+  std::lock_guard<std::mutex> Lock{InfoMutex};
+  Value = &InfoCache.try_emplace(Info, std::move(Bytes)).first->second;
+  return UR_RESULT_SUCCESS;
 }
 
-ur_result_t cl_adapter::checkDeviceExtensions(
-    cl_device_id Dev, const std::vector<std::string> &Exts, bool &Supported) {
-  size_t ExtSize = 0;
+static ur_result_t getDeviceString(cl_device_id Dev, cl_device_info Info,
+                                   std::string &Str) {
+  size_t Size = 0;
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, Info, 0, nullptr, &Size));
+  std::string Value(Size, '\0');
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, Info, Size, Value.data(), nullptr));
+  // Drop the null terminator, so that appending to the string works
+  Value.resize(Value.find('\0'));
+  Str = std::move(Value);
+  return UR_RESULT_SUCCESS;
+}
+
+// Queries the properties cached in the handle of Dev and creates it. The
+// handle takes over a reference to Dev and to hParent.
+static ur_result_t createDevice(cl_device_id Dev, ur_device_handle_t hParent,
+                                ur_device_handle_t &hDevice) {
+  cl_platform_id Platform;
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, CL_DEVICE_PLATFORM,
+                                       sizeof(Platform), &Platform, nullptr));
+  cl_device_type Type;
   CL_RETURN_ON_FAILURE(
-      clGetDeviceInfo(Dev, CL_DEVICE_EXTENSIONS, 0, nullptr, &ExtSize));
-
-  std::string ExtStr(ExtSize, '\0');
-
-  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, CL_DEVICE_EXTENSIONS, ExtSize,
-                                       ExtStr.data(), nullptr));
-
-  Supported = true;
-  for (const std::string &Ext : Exts) {
-    if (!(Supported = (ExtStr.find(Ext) != std::string::npos))) {
-      // The Intel FPGA emulation device does actually support these, even if it
-      // doesn't report them.
-      if (isIntelFPGAEmuDevice(Dev) &&
-          (Ext == "cl_intel_device_attribute_query" ||
-           Ext == "cl_intel_required_subgroup_size" ||
-           Ext == "cl_khr_subgroups")) {
-        Supported = true;
-        continue;
-      }
-      break;
+      clGetDeviceInfo(Dev, CL_DEVICE_TYPE, sizeof(Type), &Type, nullptr));
+  oclv::OpenCLVersion Version;
+  UR_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(Dev, Version));
+  std::string Extensions;
+  UR_RETURN_ON_FAILURE(getDeviceString(Dev, CL_DEVICE_EXTENSIONS, Extensions));
+  std::string Name;
+  UR_RETURN_ON_FAILURE(getDeviceString(Dev, CL_DEVICE_NAME, Name));
+  bool IsFPGAEmulator =
+      Name.find("Intel(R) FPGA Emulation Device") != std::string::npos;
+  auto ExtensionSet = cl_adapter::parseExtensions(Extensions, IsFPGAEmulator);
+
+  try {
+    hDevice = new ur_device_handle_t_(
+        Dev, cl_adapter::cast<ur_platform_handle_t>(Platform), hParent, Type,
+        Version, std::move(Extensions), ExtensionSet);
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t cl_adapter::getDevice(cl_device_id Dev,
+                                  ur_device_handle_t &hDevice) {
+  auto &Devices = ur::cl::getAdapter()->Devices;
+  if ((hDevice = Devices.find(Dev))) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Sub-devices are normally registered by urDevicePartition, so a sub-device
+  // seen for the first time here has been created outside of the adapter. Its
+  // handle keeps a reference to the OpenCL device for as long as the adapter
+  // is around, since nothing else would keep the handle alive.
+  cl_device_id Parent = nullptr;
+  if (clGetDeviceInfo(Dev, CL_DEVICE_PARENT_DEVICE, sizeof(Parent), &Parent,
+                      nullptr) != CL_SUCCESS) {
+    // OpenCL 1.1 devices can't be partitioned
+    Parent = nullptr;
+  }
+  ur_device_handle_t hParent = nullptr;
+  if (Parent) {
+    UR_RETURN_ON_FAILURE(getDevice(Parent, hParent));
+    UR_RETURN_ON_FAILURE(urDeviceRetain(hParent));
+    CL_RETURN_ON_FAILURE(clRetainDevice(Dev));
+  }
+
+  ur_device_handle_t hNewDevice = nullptr;
+  if (auto Result = createDevice(Dev, hParent, hNewDevice);
+      Result != UR_RESULT_SUCCESS) {
+    if (hParent) {
+      clReleaseDevice(Dev);
+      urDeviceRelease(hParent);
     }
+    return Result;
   }
 
+  hDevice = Devices.insert(Dev, hNewDevice);
+  if (hDevice != hNewDevice) {
+    // Another thread got to create the handle first
+    delete hNewDevice;
+    if (hParent) {
+      clReleaseDevice(Dev);
+      urDeviceRelease(hParent);
+    }
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -103,20 +177,28 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
 
+  std::vector<cl_device_id> CLDevices(phDevices ? NumEntries : 0);
   cl_int Result = clGetDeviceIDs(cl_adapter::cast<cl_platform_id>(hPlatform),
                                  Type, cl_adapter::cast<cl_uint>(NumEntries),
-                                 cl_adapter::cast<cl_device_id *>(phDevices),
+                                 phDevices ? CLDevices.data() : nullptr,
                                  cl_adapter::cast<cl_uint *>(pNumDevices));
 
   // Absorb the CL_DEVICE_NOT_FOUND and just return 0 in num_devices
   if (Result == CL_DEVICE_NOT_FOUND) {
-    Result = CL_SUCCESS;
     if (pNumDevices) {
       *pNumDevices = 0;
     }
+    return UR_RESULT_SUCCESS;
   }
+  CL_RETURN_ON_FAILURE(Result);
 
-  return mapCLErrorToUR(Result);
+  if (phDevices) {
+    for (uint32_t I = 0; I < NumEntries && CLDevices[I]; I++) {
+      UR_RETURN_ON_FAILURE(cl_adapter::getDevice(CLDevices[I], phDevices[I]));
+    }
+  }
+
+  return UR_RESULT_SUCCESS;
 }
 
 static ur_device_fp_capability_flags_t
@@ -345,6 +427,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
                                                     void *pPropValue,
                                                     size_t *pPropSizeRet) {
 
+  using cl_adapter::DeviceExtension;
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   const cl_device_info CLPropName = mapURDeviceInfoToCL(propName);
@@ -353,11 +436,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
    * being part of the enum. Can be removed once all UR_EXT enums are promoted
    * to UR */
   switch (static_cast<uint32_t>(propName)) {
+  case UR_DEVICE_INFO_PLATFORM:
+    return ReturnValue(hDevice->Platform);
+  case UR_DEVICE_INFO_PARENT_DEVICE:
+    return ReturnValue(hDevice->ParentDevice);
   case UR_DEVICE_INFO_TYPE: {
-    cl_device_type CLType;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        sizeof(cl_device_type), &CLType, nullptr));
+    const cl_device_type CLType = hDevice->Type;
 
     /* TODO UR: If the device is an Accelerator (FPGA, VPU, etc.), there is not
      * enough information in the OpenCL runtime to know exactly which type it
@@ -376,26 +460,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(URDeviceType);
   }
   case UR_DEVICE_INFO_DEVICE_ID: {
-    bool Supported = false;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_intel_device_attribute_query"}, Supported));
-
-    if (!Supported) {
+    if (!hDevice->hasExtension(DeviceExtension::IntelDeviceAttributeQuery)) {
       return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
     }
 
-    CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-        cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_ID_INTEL, propSize,
-        pPropValue, pPropSizeRet));
-
-    return UR_RESULT_SUCCESS;
+    const std::vector<uint8_t> *Value = nullptr;
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CL_DEVICE_ID_INTEL, Value));
+    return ReturnValue(Value->data(), Value->size());
   }
 
   case UR_DEVICE_INFO_BACKEND_RUNTIME_VERSION: {
-    oclv::OpenCLVersion Version;
-    UR_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(
-        cl_adapter::cast<cl_device_id>(hDevice), Version));
+    const oclv::OpenCLVersion &Version = hDevice->Version;
 
     const std::string Results = std::to_string(Version.getMajor()) + "." +
                                 std::to_string(Version.getMinor());
@@ -404,14 +479,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_SUPPORTED_PARTITIONS: {
     size_t CLSize;
     CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName, 0,
-                        nullptr, &CLSize));
+        clGetDeviceInfo(hDevice->CLDevice, CLPropName, 0, nullptr, &CLSize));
     const size_t NProperties = CLSize / sizeof(cl_device_partition_property);
 
     std::vector<cl_device_partition_property> CLValue(NProperties);
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        CLSize, CLValue.data(), nullptr));
+    CL_RETURN_ON_FAILURE(clGetDeviceInfo(hDevice->CLDevice, CLPropName, CLSize,
+                                         CLValue.data(), nullptr));
 
     /* The OpenCL implementation returns a value of 0 if no properties are
      * supported. UR will return a size of 0 for now.
@@ -433,8 +506,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 
     size_t CLSize;
     CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName, 0,
-                        nullptr, &CLSize));
+        clGetDeviceInfo(hDevice->CLDevice, CLPropName, 0, nullptr, &CLSize));
     const size_t NProperties = CLSize / sizeof(cl_device_partition_property);
 
     /* The OpenCL implementation returns either a size of 0 or a value of 0 if
@@ -448,9 +520,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 
     auto CLValue =
         reinterpret_cast<cl_device_partition_property *>(alloca(CLSize));
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        CLSize, CLValue, nullptr));
+    CL_RETURN_ON_FAILURE(clGetDeviceInfo(hDevice->CLDevice, CLPropName, CLSize,
+                                         CLValue, nullptr));
 
     std::vector<ur_device_partition_property_t> URValue(NProperties - 1);
 
@@ -502,15 +573,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_MAX_NUM_SUB_GROUPS: {
     /* Corresponding OpenCL query is only available starting with OpenCL 2.1
      * and we have to emulate it on older OpenCL runtimes. */
-    oclv::OpenCLVersion DevVer;
-    UR_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(
-        cl_adapter::cast<cl_device_id>(hDevice), DevVer));
+    const oclv::OpenCLVersion &DevVer = hDevice->Version;
 
     if (DevVer >= oclv::V2_1) {
       cl_uint CLValue;
-      CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-          cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_MAX_NUM_SUB_GROUPS,
-          sizeof(cl_uint), &CLValue, nullptr));
+      UR_RETURN_ON_FAILURE(
+          hDevice->getInfo(CL_DEVICE_MAX_NUM_SUB_GROUPS, CLValue));
 
       if (CLValue == 0u) {
         /* OpenCL returns 0 if sub-groups are not supported, but SYCL 2020
@@ -532,11 +600,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     /* CL type: cl_device_fp_config
      * UR type: ur_device_fp_capability_flags_t */
     if (propName == UR_DEVICE_INFO_HALF_FP_CONFIG) {
-      bool Supported;
-      UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-          cl_adapter::cast<cl_device_id>(hDevice), {"cl_khr_fp16"}, Supported));
-
-      if (!Supported) {
+      if (!hDevice->hasExtension(DeviceExtension::KhrFP16)) {
         // If we don't support the extension then our capabilities are 0.
         ur_device_fp_capability_flags_t halfCapabilities = 0;
         return ReturnValue(halfCapabilities);
@@ -544,9 +608,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     }
 
     cl_device_fp_config CLValue;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        sizeof(cl_device_fp_config), &CLValue, nullptr));
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CLPropName, CLValue));
 
     return ReturnValue(mapCLDeviceFpConfigToUR(CLValue));
   }
@@ -554,9 +616,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_ATOMIC_MEMORY_ORDER_CAPABILITIES: {
     /* This query is missing before OpenCL 3.0. Check version and handle
      * appropriately */
-    oclv::OpenCLVersion DevVer;
-    UR_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(
-        cl_adapter::cast<cl_device_id>(hDevice), DevVer));
+    const oclv::OpenCLVersion &DevVer = hDevice->Version;
 
     /* Minimum required capability to be returned. For OpenCL 1.2, this is all
      * that is required */
@@ -566,10 +626,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     if (DevVer >= oclv::V3_0) {
       /* For OpenCL >=3.0, the query should be implemented */
       cl_device_atomic_capabilities CLCapabilities;
-      CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-          cl_adapter::cast<cl_device_id>(hDevice),
-          CL_DEVICE_ATOMIC_MEMORY_CAPABILITIES,
-          sizeof(cl_device_atomic_capabilities), &CLCapabilities, nullptr));
+      UR_RETURN_ON_FAILURE(hDevice->getInfo(
+          CL_DEVICE_ATOMIC_MEMORY_CAPABILITIES, CLCapabilities));
 
       /* Mask operation to only consider atomic_memory_order* capabilities */
       const cl_int Mask = CL_DEVICE_ATOMIC_ORDER_RELAXED |
@@ -614,16 +672,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
         UR_MEMORY_SCOPE_CAPABILITY_FLAG_SUB_GROUP |
         UR_MEMORY_SCOPE_CAPABILITY_FLAG_WORK_GROUP;
 
-    oclv::OpenCLVersion DevVer;
-    UR_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(
-        cl_adapter::cast<cl_device_id>(hDevice), DevVer));
+    const oclv::OpenCLVersion &DevVer = hDevice->Version;
 
     cl_device_atomic_capabilities CLCapabilities;
     if (DevVer >= oclv::V3_0) {
-      CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-          cl_adapter::cast<cl_device_id>(hDevice),
-          CL_DEVICE_ATOMIC_MEMORY_CAPABILITIES,
-          sizeof(cl_device_atomic_capabilities), &CLCapabilities, nullptr));
+      UR_RETURN_ON_FAILURE(hDevice->getInfo(
+          CL_DEVICE_ATOMIC_MEMORY_CAPABILITIES, CLCapabilities));
 
       assert((CLCapabilities & CL_DEVICE_ATOMIC_SCOPE_WORK_GROUP) &&
              "Violates minimum mandated guarantee");
@@ -668,16 +722,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
         UR_MEMORY_ORDER_CAPABILITY_FLAG_RELEASE |
         UR_MEMORY_ORDER_CAPABILITY_FLAG_ACQ_REL;
 
-    oclv::OpenCLVersion DevVer;
-    UR_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(
-        cl_adapter::cast<cl_device_id>(hDevice), DevVer));
+    const oclv::OpenCLVersion &DevVer = hDevice->Version;
 
     cl_device_atomic_capabilities CLCapabilities;
     if (DevVer >= oclv::V3_0) {
-      CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-          cl_adapter::cast<cl_device_id>(hDevice),
-          CL_DEVICE_ATOMIC_FENCE_CAPABILITIES,
-          sizeof(cl_device_atomic_capabilities), &CLCapabilities, nullptr));
+      UR_RETURN_ON_FAILURE(hDevice->getInfo(CL_DEVICE_ATOMIC_FENCE_CAPABILITIES,
+                                            CLCapabilities));
 
       assert((CLCapabilities & CL_DEVICE_ATOMIC_ORDER_RELAXED) &&
              "Violates minimum mandated guarantee");
@@ -718,9 +768,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
         UR_MEMORY_SCOPE_CAPABILITY_FLAG_SUB_GROUP |
         UR_MEMORY_SCOPE_CAPABILITY_FLAG_WORK_GROUP;
 
-    oclv::OpenCLVersion DevVer;
-    UR_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(
-        cl_adapter::cast<cl_device_id>(hDevice), DevVer));
+    const oclv::OpenCLVersion &DevVer = hDevice->Version;
 
     auto convertCapabilities =
         [](cl_device_atomic_capabilities CLCapabilities) {
@@ -743,10 +791,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 
     if (DevVer >= oclv::V3_0) {
       cl_device_atomic_capabilities CLCapabilities;
-      CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-          cl_adapter::cast<cl_device_id>(hDevice),
-          CL_DEVICE_ATOMIC_FENCE_CAPABILITIES,
-          sizeof(cl_device_atomic_capabilities), &CLCapabilities, nullptr));
+      UR_RETURN_ON_FAILURE(hDevice->getInfo(CL_DEVICE_ATOMIC_FENCE_CAPABILITIES,
+                                            CLCapabilities));
       assert((CLCapabilities & CL_DEVICE_ATOMIC_SCOPE_WORK_GROUP) &&
              "Violates minimum mandated guarantee");
       URCapabilities |= convertCapabilities(CLCapabilities);
@@ -764,10 +810,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
       // not return an error if the query is unsuccessful as this is expected
       // of an OpenCL 1.2 driver.
       cl_device_atomic_capabilities CLCapabilities;
-      if (CL_SUCCESS == clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice),
-                                        CL_DEVICE_ATOMIC_FENCE_CAPABILITIES,
-                                        sizeof(cl_device_atomic_capabilities),
-                                        &CLCapabilities, nullptr)) {
+      if (UR_RESULT_SUCCESS ==
+          hDevice->getInfo(CL_DEVICE_ATOMIC_FENCE_CAPABILITIES,
+                           CLCapabilities)) {
         URCapabilities |= convertCapabilities(CLCapabilities);
       }
     }
@@ -783,42 +828,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   }
 
   case UR_DEVICE_INFO_ATOMIC_64: {
-    bool Supported = false;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_khr_int64_base_atomics", "cl_khr_int64_extended_atomics"},
-        Supported));
-
-    return ReturnValue(Supported);
+    return ReturnValue(
+        hDevice->hasExtension(DeviceExtension::KhrInt64BaseAtomics) &&
+        hDevice->hasExtension(DeviceExtension::KhrInt64ExtendedAtomics));
   }
   case UR_DEVICE_INFO_BUILD_ON_SUBDEVICE: {
 
-    cl_device_type DevType = CL_DEVICE_TYPE_DEFAULT;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_TYPE,
-                        sizeof(cl_device_type), &DevType, nullptr));
+    const cl_device_type DevType = hDevice->Type;
 
     return ReturnValue(DevType == CL_DEVICE_TYPE_GPU);
   }
   case UR_DEVICE_INFO_MEM_CHANNEL_SUPPORT: {
-    bool Supported = false;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_intel_mem_channel_property"}, Supported));
-
-    return ReturnValue(Supported);
+    return ReturnValue(
+        hDevice->hasExtension(DeviceExtension::IntelMemChannelProperty));
   }
   case UR_DEVICE_INFO_ESIMD_SUPPORT: {
     bool Supported = false;
-    cl_device_type DevType = CL_DEVICE_TYPE_DEFAULT;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_TYPE,
-                        sizeof(cl_device_type), &DevType, nullptr));
+    const cl_device_type DevType = hDevice->Type;
 
     cl_uint VendorID = 0;
-    CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-        cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_VENDOR_ID,
-        sizeof(VendorID), &VendorID, nullptr));
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CL_DEVICE_VENDOR_ID, VendorID));
 
     /* ESIMD is only supported by Intel GPUs. */
     Supported = DevType == CL_DEVICE_TYPE_GPU && VendorID == 0x8086;
@@ -830,32 +859,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   }
   case UR_DEVICE_INFO_NUM_COMPUTE_UNITS: {
 
-    bool ExtensionSupported = false;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_intel_device_attribute_query"}, ExtensionSupported));
+    const bool ExtensionSupported =
+        hDevice->hasExtension(DeviceExtension::IntelDeviceAttributeQuery);
 
-    cl_device_type CLType;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_TYPE,
-                        sizeof(cl_device_type), &CLType, nullptr));
+    const cl_device_type CLType = hDevice->Type;
 
     cl_uint NumComputeUnits;
     if (ExtensionSupported && (CLType & CL_DEVICE_TYPE_GPU)) {
       cl_uint SliceCount = 0;
       cl_uint SubSlicePerSliceCount = 0;
-      CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-          cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_NUM_SLICES_INTEL,
-          sizeof(cl_uint), &SliceCount, nullptr));
-      CL_RETURN_ON_FAILURE(
-          clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice),
-                          CL_DEVICE_NUM_SUB_SLICES_PER_SLICE_INTEL,
-                          sizeof(cl_uint), &SubSlicePerSliceCount, nullptr));
+      UR_RETURN_ON_FAILURE(
+          hDevice->getInfo(CL_DEVICE_NUM_SLICES_INTEL, SliceCount));
+      UR_RETURN_ON_FAILURE(hDevice->getInfo(
+          CL_DEVICE_NUM_SUB_SLICES_PER_SLICE_INTEL, SubSlicePerSliceCount));
       NumComputeUnits = SliceCount * SubSlicePerSliceCount;
     } else {
-      CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-          cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_MAX_COMPUTE_UNITS,
-          sizeof(cl_uint), &NumComputeUnits, nullptr));
+      UR_RETURN_ON_FAILURE(
+          hDevice->getInfo(CL_DEVICE_MAX_COMPUTE_UNITS, NumComputeUnits));
     }
 
     return ReturnValue(static_cast<uint32_t>(NumComputeUnits));
@@ -867,18 +887,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(false);
   }
   case UR_DEVICE_INFO_HOST_PIPE_READ_WRITE_SUPPORTED: {
-    bool Supported = false;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_intel_program_scope_host_pipe"}, Supported));
-    return ReturnValue(Supported);
+    return ReturnValue(
+        hDevice->hasExtension(DeviceExtension::IntelProgramScopeHostPipe));
   }
   case UR_DEVICE_INFO_GLOBAL_VARIABLE_SUPPORT: {
-    bool Supported = false;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_intel_global_variable_access"}, Supported));
-    return ReturnValue(Supported);
+    return ReturnValue(
+        hDevice->hasExtension(DeviceExtension::IntelGlobalVariableAccess));
   }
   case UR_DEVICE_INFO_QUEUE_PROPERTIES:
   case UR_DEVICE_INFO_QUEUE_ON_DEVICE_PROPERTIES:
@@ -891,9 +905,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
      * UR type: ur_flags_t (uint32_t) */
 
     cl_bitfield CLValue = 0;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        sizeof(cl_bitfield), &CLValue, nullptr));
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CLPropName, CLValue));
 
     /* We can just static_cast the output because OpenCL and UR bitfields
      * map 1 to 1 for these properties. cl_bitfield is uint64_t and ur_flags_t
@@ -907,15 +919,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_USM_SYSTEM_SHARED_SUPPORT: {
     /* CL type: cl_bitfield / enum
      * UR type: ur_flags_t (uint32_t) */
-    bool Supported = false;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_intel_unified_shared_memory"}, Supported));
-    if (Supported) {
+    if (hDevice->hasExtension(DeviceExtension::IntelUnifiedSharedMemory)) {
       cl_bitfield CLValue = 0;
-      CL_RETURN_ON_FAILURE(
-          clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                          sizeof(cl_bitfield), &CLValue, nullptr));
+      UR_RETURN_ON_FAILURE(hDevice->getInfo(CLPropName, CLValue));
       return ReturnValue(static_cast<uint32_t>(CLValue));
     } else {
       return ReturnValue(0);
@@ -925,7 +931,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_ERROR_CORRECTION_SUPPORT:
   case UR_DEVICE_INFO_HOST_UNIFIED_MEMORY:
   case UR_DEVICE_INFO_ENDIAN_LITTLE:
-  case UR_DEVICE_INFO_AVAILABLE:
   case UR_DEVICE_INFO_COMPILER_AVAILABLE:
   case UR_DEVICE_INFO_LINKER_AVAILABLE:
   case UR_DEVICE_INFO_PREFERRED_INTEROP_USER_SYNC: {
@@ -933,27 +938,29 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
      * UR type: ur_bool_t */
 
     cl_bool CLValue;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        sizeof(cl_bool), &CLValue, nullptr));
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CLPropName, CLValue));
 
     /* cl_bool is uint32_t and ur_bool_t is bool */
     return ReturnValue(static_cast<ur_bool_t>(CLValue));
   }
+  case UR_DEVICE_INFO_AVAILABLE: {
+    /* The device may become unavailable, so this one is always queried */
+    cl_bool CLValue;
+    CL_RETURN_ON_FAILURE(clGetDeviceInfo(hDevice->CLDevice, CLPropName,
+                                         sizeof(cl_bool), &CLValue, nullptr));
+
+    return ReturnValue(static_cast<ur_bool_t>(CLValue));
+  }
   case UR_DEVICE_INFO_SUB_GROUP_INDEPENDENT_FORWARD_PROGRESS: {
     /* CL type: cl_bool
      * UR type: ur_bool_t */
 
-    oclv::OpenCLVersion DevVer;
-    CL_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(
-        cl_adapter::cast<cl_device_id>(hDevice), DevVer));
+    const oclv::OpenCLVersion &DevVer = hDevice->Version;
     /* Independent forward progress query is only supported as of OpenCL 2.1
      * if version is older we return a default false. */
     if (DevVer >= oclv::V2_1) {
       cl_bool CLValue;
-      CL_RETURN_ON_FAILURE(
-          clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                          sizeof(cl_bool), &CLValue, nullptr));
+      UR_RETURN_ON_FAILURE(hDevice->getInfo(CLPropName, CLValue));
 
       /* cl_bool is uint32_t and ur_bool_t is bool */
       return ReturnValue(static_cast<ur_bool_t>(CLValue));
@@ -987,7 +994,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_MAX_SAMPLERS:
   case UR_DEVICE_INFO_GLOBAL_MEM_CACHELINE_SIZE:
   case UR_DEVICE_INFO_MAX_CONSTANT_ARGS:
-  case UR_DEVICE_INFO_REFERENCE_COUNT:
   case UR_DEVICE_INFO_PARTITION_MAX_SUB_DEVICES:
   case UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE:
   case UR_DEVICE_INFO_GLOBAL_MEM_CACHE_SIZE:
@@ -1005,8 +1011,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_MAX_PARAMETER_SIZE:
   case UR_DEVICE_INFO_PROFILING_TIMER_RESOLUTION:
   case UR_DEVICE_INFO_PRINTF_BUFFER_SIZE:
-  case UR_DEVICE_INFO_PLATFORM:
-  case UR_DEVICE_INFO_PARENT_DEVICE:
   case UR_DEVICE_INFO_IL_VERSION:
   case UR_DEVICE_INFO_NAME:
   case UR_DEVICE_INFO_VENDOR:
@@ -1023,30 +1027,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
      * | cl_uint            | uint32_t               | 4    |
      * | cl_ulong           | uint64_t               | 8    |
      * | size_t             | size_t                 | 8    |
-     * | cl_platform_id     | ur_platform_handle_t   | 8    |
-     * | ur_device_handle_t | cl_device_id           | 8    |
+     *
+     * None of these change over the lifetime of the device, so the driver
+     * is only asked once.
      */
-
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        propSize, pPropValue, pPropSizeRet));
+    const std::vector<uint8_t> *Value = nullptr;
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CLPropName, Value));
+    return ReturnValue(Value->data(), Value->size());
+  }
+  case UR_DEVICE_INFO_REFERENCE_COUNT: {
+    CL_RETURN_ON_FAILURE(clGetDeviceInfo(hDevice->CLDevice, CLPropName,
+                                         propSize, pPropValue, pPropSizeRet));
 
     return UR_RESULT_SUCCESS;
   }
   case UR_DEVICE_INFO_PCI_ADDRESS: {
-    bool Supported = false;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice), {"cl_khr_pci_bus_info"},
-        Supported));
-
-    if (!Supported) {
+    if (!hDevice->hasExtension(DeviceExtension::KhrPCIBusInfo)) {
       return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
     }
 
     cl_device_pci_bus_info_khr PciInfo = {};
-    CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-        cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_PCI_BUS_INFO_KHR,
-        sizeof(PciInfo), &PciInfo, nullptr));
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CL_DEVICE_PCI_BUS_INFO_KHR, PciInfo));
 
     constexpr size_t AddressBufferSize = 13;
     char AddressBuffer[AddressBufferSize];
@@ -1059,83 +1060,52 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     /* The EU count can be queried using CL_DEVICE_MAX_COMPUTE_UNITS for Intel
      * GPUs. */
 
-    bool Supported;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_intel_device_attribute_query"}, Supported));
-    if (!Supported) {
+    if (!hDevice->hasExtension(DeviceExtension::IntelDeviceAttributeQuery)) {
       return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
     }
 
-    cl_device_type CLType;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_TYPE,
-                        sizeof(cl_device_type), &CLType, nullptr));
+    const cl_device_type CLType = hDevice->Type;
     if (!(CLType & CL_DEVICE_TYPE_GPU)) {
       return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
     }
 
-    CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-        cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_MAX_COMPUTE_UNITS,
-        propSize, pPropValue, pPropSizeRet));
-
-    return UR_RESULT_SUCCESS;
+    const std::vector<uint8_t> *Value = nullptr;
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CL_DEVICE_MAX_COMPUTE_UNITS, Value));
+    return ReturnValue(Value->data(), Value->size());
   }
   case UR_DEVICE_INFO_GPU_EU_SLICES:
   case UR_DEVICE_INFO_GPU_EU_COUNT_PER_SUBSLICE:
   case UR_DEVICE_INFO_GPU_SUBSLICES_PER_SLICE:
   case UR_DEVICE_INFO_GPU_HW_THREADS_PER_EU:
   case UR_DEVICE_INFO_IP_VERSION: {
-    bool Supported;
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice),
-        {"cl_intel_device_attribute_query"}, Supported));
-    if (!Supported) {
+    if (!hDevice->hasExtension(DeviceExtension::IntelDeviceAttributeQuery)) {
       return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
     }
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        propSize, pPropValue, pPropSizeRet));
 
-    return UR_RESULT_SUCCESS;
+    const std::vector<uint8_t> *Value = nullptr;
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CLPropName, Value));
+    return ReturnValue(Value->data(), Value->size());
   }
 
   case UR_DEVICE_INFO_SUB_GROUP_SIZES_INTEL: {
-    bool isExtensionSupported;
-    if (cl_adapter::checkDeviceExtensions(
-            cl_adapter::cast<cl_device_id>(hDevice),
-            {"cl_intel_required_subgroup_size"},
-            isExtensionSupported) != UR_RESULT_SUCCESS ||
-        !isExtensionSupported) {
+    if (!hDevice->hasExtension(DeviceExtension::IntelRequiredSubgroupSize)) {
       std::vector<uint32_t> aThreadIsItsOwnSubGroup({1});
       return ReturnValue(aThreadIsItsOwnSubGroup.data(),
                          aThreadIsItsOwnSubGroup.size());
     }
 
     // Have to convert size_t to uint32_t
-    size_t SubGroupSizesSize = 0;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName, 0,
-                        nullptr, &SubGroupSizesSize));
-    std::vector<size_t> SubGroupSizes(SubGroupSizesSize / sizeof(size_t));
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CLPropName,
-                        SubGroupSizesSize, SubGroupSizes.data(), nullptr));
+    const std::vector<uint8_t> *Value = nullptr;
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CLPropName, Value));
+    std::vector<size_t> SubGroupSizes(Value->size() / sizeof(size_t));
+    std::memcpy(SubGroupSizes.data(), Value->data(),
+                SubGroupSizes.size() * sizeof(size_t));
     return ReturnValue.template operator()<uint32_t>(SubGroupSizes.data(),
                                                      SubGroupSizes.size());
   }
   case UR_DEVICE_INFO_EXTENSIONS: {
-    cl_device_id Dev = cl_adapter::cast<cl_device_id>(hDevice);
-    size_t ExtSize = 0;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(Dev, CL_DEVICE_EXTENSIONS, 0, nullptr, &ExtSize));
-
-    std::string ExtStr(ExtSize, '\0');
-    CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, CL_DEVICE_EXTENSIONS, ExtSize,
-                                         ExtStr.data(), nullptr));
-
-    std::string SupportedExtensions(ExtStr.c_str());
-    if (ExtStr.find("cl_khr_command_buffer") != std::string::npos) {
+    std::string SupportedExtensions = hDevice->Extensions;
+    if (hDevice->hasExtension(DeviceExtension::KhrCommandBuffer)) {
       SupportedExtensions += " ur_exp_command_buffer";
     }
     return ReturnValue(SupportedExtensions.c_str());
@@ -1143,18 +1113,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 
   case UR_DEVICE_INFO_UUID: {
     // Use the cl_khr_device_uuid extension, if available.
-    bool isKhrDeviceUuidSupported = false;
-    if (cl_adapter::checkDeviceExtensions(
-            cl_adapter::cast<cl_device_id>(hDevice), {"cl_khr_device_uuid"},
-            isKhrDeviceUuidSupported) != UR_RESULT_SUCCESS ||
-        !isKhrDeviceUuidSupported) {
+    if (!hDevice->hasExtension(DeviceExtension::KhrDeviceUUID)) {
       return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
     }
     static_assert(CL_UUID_SIZE_KHR == 16);
     std::array<uint8_t, CL_UUID_SIZE_KHR> UUID{};
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice),
-                        CL_DEVICE_UUID_KHR, UUID.size(), UUID.data(), nullptr));
+    UR_RETURN_ON_FAILURE(hDevice->getInfo(CL_DEVICE_UUID_KHR, UUID));
     return ReturnValue(UUID);
   }
 
@@ -1190,12 +1154,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_COMPOSITE_DEVICE:
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
   case UR_DEVICE_INFO_2D_BLOCK_ARRAY_CAPABILITIES_EXP: {
-    bool Is2DBlockIOSupported = false;
-    if (cl_adapter::checkDeviceExtensions(
-            cl_adapter::cast<cl_device_id>(hDevice),
-            {"cl_intel_subgroup_2d_block_io"},
-            Is2DBlockIOSupported) != UR_RESULT_SUCCESS ||
-        !Is2DBlockIOSupported) {
+    if (!hDevice->hasExtension(DeviceExtension::IntelSubgroup2DBlockIO)) {
       return ReturnValue(
           static_cast<ur_exp_device_2d_block_array_capability_flags_t>(0));
     }
@@ -1203,24 +1162,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
                        UR_EXP_DEVICE_2D_BLOCK_ARRAY_CAPABILITY_FLAG_STORE);
   }
   case UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP: {
-    cl_device_id Dev = cl_adapter::cast<cl_device_id>(hDevice);
-    size_t ExtSize = 0;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(Dev, CL_DEVICE_EXTENSIONS, 0, nullptr, &ExtSize));
-
-    std::string ExtStr(ExtSize, '\0');
-    CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, CL_DEVICE_EXTENSIONS, ExtSize,
-                                         ExtStr.data(), nullptr));
-
-    std::string SupportedExtensions(ExtStr.c_str());
-    return ReturnValue(ExtStr.find("cl_khr_command_buffer") !=
-                       std::string::npos);
+    return ReturnValue(
+        hDevice->hasExtension(DeviceExtension::KhrCommandBuffer));
   }
   case UR_DEVICE_INFO_COMMAND_BUFFER_UPDATE_CAPABILITIES_EXP: {
-    cl_device_id Dev = cl_adapter::cast<cl_device_id>(hDevice);
     ur_device_command_buffer_update_capability_flags_t UpdateCapabilities = 0;
-    CL_RETURN_ON_FAILURE(
-        getDeviceCommandBufferUpdateCapabilities(Dev, UpdateCapabilities));
+    UR_RETURN_ON_FAILURE(
+        getDeviceCommandBufferUpdateCapabilities(hDevice, UpdateCapabilities));
     return ReturnValue(UpdateCapabilities);
   }
   case UR_DEVICE_INFO_COMMAND_BUFFER_EVENT_SUPPORT_EXP:
@@ -1275,9 +1223,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
   CLProperties[CLProperties.size() - 1] = 0;
 
   cl_uint CLNumDevicesRet;
-  CL_RETURN_ON_FAILURE(
-      clCreateSubDevices(cl_adapter::cast<cl_device_id>(hDevice),
-                         CLProperties.data(), 0, nullptr, &CLNumDevicesRet));
+  CL_RETURN_ON_FAILURE(clCreateSubDevices(
+      hDevice->CLDevice, CLProperties.data(), 0, nullptr, &CLNumDevicesRet));
 
   if (pNumDevicesRet) {
     *pNumDevicesRet = CLNumDevicesRet;
@@ -1287,28 +1234,58 @@ UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
    * function shall only retrieve that number of sub-devices. */
   if (phSubDevices) {
     std::vector<cl_device_id> CLSubDevices(CLNumDevicesRet);
-    CL_RETURN_ON_FAILURE(clCreateSubDevices(
-        cl_adapter::cast<cl_device_id>(hDevice), CLProperties.data(),
-        CLNumDevicesRet, CLSubDevices.data(), nullptr));
-
-    std::memcpy(phSubDevices, CLSubDevices.data(),
-                sizeof(cl_device_id) * NumDevices);
+    CL_RETURN_ON_FAILURE(
+        clCreateSubDevices(hDevice->CLDevice, CLProperties.data(),
+                           CLNumDevicesRet, CLSubDevices.data(), nullptr));
+
+    auto &Devices = ur::cl::getAdapter()->Devices;
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    for (uint32_t I = 0; I < CLNumDevicesRet; I++) {
+      if (I >= NumDevices || Result != UR_RESULT_SUCCESS) {
+        clReleaseDevice(CLSubDevices[I]);
+        continue;
+      }
+      ur_device_handle_t hSubDevice = nullptr;
+      Result = createDevice(CLSubDevices[I], hDevice, hSubDevice);
+      if (Result != UR_RESULT_SUCCESS) {
+        clReleaseDevice(CLSubDevices[I]);
+        continue;
+      }
+      urDeviceRetain(hDevice);
+      Devices.insert(CLSubDevices[I], hSubDevice);
+      phSubDevices[I] = hSubDevice;
+    }
+    return Result;
   }
 
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t hDevice) {
+  if (hDevice->isRootDevice()) {
+    return UR_RESULT_SUCCESS;
+  }
 
-  cl_int Result = clRetainDevice(cl_adapter::cast<cl_device_id>(hDevice));
-
-  return mapCLErrorToUR(Result);
+  CL_RETURN_ON_FAILURE(clRetainDevice(hDevice->CLDevice));
+  hDevice->RefCount++;
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urDeviceRelease(ur_device_handle_t hDevice) {
+  if (hDevice->isRootDevice()) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  if (--hDevice->RefCount > 0) {
+    return mapCLErrorToUR(clReleaseDevice(hDevice->CLDevice));
+  }
 
-  cl_int Result = clReleaseDevice(cl_adapter::cast<cl_device_id>(hDevice));
+  ur::cl::getAdapter()->Devices.erase(hDevice->CLDevice, hDevice);
+  cl_int Result = clReleaseDevice(hDevice->CLDevice);
+  ur_device_handle_t hParent = hDevice->ParentDevice;
+  delete hDevice;
+  urDeviceRelease(hParent);
 
   return mapCLErrorToUR(Result);
 }
@@ -1316,36 +1293,43 @@ urDeviceRelease(ur_device_handle_t hDevice) {
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
     ur_device_handle_t hDevice, ur_native_handle_t *phNativeDevice) {
 
-  *phNativeDevice = reinterpret_cast<ur_native_handle_t>(hDevice);
+  *phNativeDevice = reinterpret_cast<ur_native_handle_t>(hDevice->CLDevice);
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     ur_native_handle_t hNativeDevice, ur_adapter_handle_t,
-    const ur_device_native_properties_t *, ur_device_handle_t *phDevice) {
+    const ur_device_native_properties_t *pProperties,
+    ur_device_handle_t *phDevice) {
+
+  cl_device_id NativeHandle = reinterpret_cast<cl_device_id>(hNativeDevice);
+  ur_device_handle_t hDevice = nullptr;
+  UR_RETURN_ON_FAILURE(cl_adapter::getDevice(NativeHandle, hDevice));
+  if (!hDevice->isRootDevice()) {
+    // Give the caller a reference of its own, taking over the one to the
+    // OpenCL device if it's passed in with the handle
+    if (pProperties && pProperties->isNativeHandleOwned) {
+      hDevice->RefCount++;
+    } else {
+      UR_RETURN_ON_FAILURE(urDeviceRetain(hDevice));
+    }
+  }
 
-  *phDevice = reinterpret_cast<ur_device_handle_t>(hNativeDevice);
+  *phDevice = hDevice;
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     ur_device_handle_t hDevice, uint64_t *pDeviceTimestamp,
     uint64_t *pHostTimestamp) {
-  oclv::OpenCLVersion DevVer, PlatVer;
-  cl_platform_id Platform;
-  cl_device_id DeviceId = cl_adapter::cast<cl_device_id>(hDevice);
+  oclv::OpenCLVersion PlatVer;
+  cl_device_id DeviceId = hDevice->CLDevice;
 
-  // TODO: Cache OpenCL version for each device and platform
-  auto RetErr = clGetDeviceInfo(DeviceId, CL_DEVICE_PLATFORM,
-                                sizeof(cl_platform_id), &Platform, nullptr);
-  CL_RETURN_ON_FAILURE(RetErr);
+  // TODO: Cache OpenCL version for each platform
+  UR_RETURN_ON_FAILURE(cl_adapter::getPlatformVersion(
+      cl_adapter::cast<cl_platform_id>(hDevice->Platform), PlatVer));
 
-  RetErr = cl_adapter::getDeviceVersion(DeviceId, DevVer);
-  CL_RETURN_ON_FAILURE(RetErr);
-
-  RetErr = cl_adapter::getPlatformVersion(Platform, PlatVer);
-
-  if (PlatVer < oclv::V2_1 || DevVer < oclv::V2_1) {
+  if (PlatVer < oclv::V2_1 || hDevice->Version < oclv::V2_1) {
     return UR_RESULT_ERROR_INVALID_OPERATION;
   }
 
@@ -1381,15 +1365,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
   // Choose the binary target for the provided device
   const char *ImageTarget = nullptr;
   // Get the type of the device
-  cl_device_type DeviceType;
+  const cl_device_type DeviceType = hDevice->Type;
   constexpr uint32_t InvalidInd = std::numeric_limits<uint32_t>::max();
-  cl_int RetErr =
-      clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_TYPE,
-                      sizeof(cl_device_type), &DeviceType, nullptr);
-  if (RetErr != CL_SUCCESS) {
-    *pSelectedBinary = InvalidInd;
-    CL_RETURN_ON_FAILURE(RetErr);
-  }
 
   switch (DeviceType) {
     // TODO: Factor out vendor specifics into a separate source
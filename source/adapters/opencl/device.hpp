@@ -10,11 +10,82 @@
 #pragma once
 
 #include "common.hpp"
+#include "device_extensions.hpp"
+
+#include <atomic>
+#include <bitset>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Handle to an OpenCL device, holding the properties of the device that
+/// entry points need to know on every call.
+struct ur_device_handle_t_ {
+  using native_type = cl_device_id;
+  using ExtensionSetT = cl_adapter::DeviceExtensionSet;
+
+  /// OpenCL device object.
+  native_type CLDevice;
+  /// Platform the device belongs to.
+  ur_platform_handle_t Platform;
+  /// Device this one was partitioned from, nullptr for root devices.
+  ur_device_handle_t ParentDevice;
+  /// OpenCL device type.
+  cl_device_type Type;
+  /// OpenCL version supported by the device.
+  oclv::OpenCLVersion Version;
+  /// Space separated list of the extensions the device reports.
+  std::string Extensions;
+  /// Extensions the adapter checks for that the device supports, parsed once
+  /// from Extensions.
+  ExtensionSetT ExtensionSet;
+  /// Object reference count. Root devices live as long as the adapter, so
+  /// it's only counted for sub-devices.
+  std::atomic<uint32_t> RefCount = 1;
+
+  ur_device_handle_t_(native_type CLDevice, ur_platform_handle_t Platform,
+                      ur_device_handle_t ParentDevice, cl_device_type Type,
+                      oclv::OpenCLVersion Version, std::string Extensions,
+                      ExtensionSetT ExtensionSet)
+      : CLDevice(CLDevice), Platform(Platform), ParentDevice(ParentDevice),
+        Type(Type), Version(Version), Extensions(std::move(Extensions)),
+        ExtensionSet(ExtensionSet) {}
+
+  bool isRootDevice() const { return ParentDevice == nullptr; }
+
+  bool hasExtension(cl_adapter::DeviceExtension Ext) const {
+    return ExtensionSet.test(static_cast<size_t>(Ext));
+  }
+
+  /// Returns the value of \p Info, which mustn't change over the lifetime of
+  /// the device. The driver is only queried the first time it's asked for.
+  ur_result_t getInfo(cl_device_info Info, const std::vector<uint8_t> *&Value);
+
+  /// Returns the value of \p Info as a \p T, zero extended if the driver
+  /// returns a smaller type.
+  template <typename T> ur_result_t getInfo(cl_device_info Info, T &Value) {
+    const std::vector<uint8_t> *Bytes = nullptr;
+    UR_RETURN_ON_FAILURE(getInfo(Info, Bytes));
+    if (Bytes->size() > sizeof(T)) {
+      return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+    Value = T{};
+    std::memcpy(&Value, Bytes->data(), Bytes->size());
+    return UR_RESULT_SUCCESS;
+  }
+
+private:
+  std::mutex InfoMutex;
+  // Entries are never erased, so references to them stay valid
+  std::unordered_map<cl_device_info, std::vector<uint8_t>> InfoCache;
+};
 
 namespace cl_adapter {
 ur_result_t getDeviceVersion(cl_device_id Dev, oclv::OpenCLVersion &Version);
 
-ur_result_t checkDeviceExtensions(cl_device_id Dev,
-                                  const std::vector<std::string> &Exts,
-                                  bool &Supported);
+/// Returns the handle of \p Dev, creating it if \p Dev hasn't been seen
+/// before. The caller doesn't get a reference of its own to the handle.
+ur_result_t getDevice(cl_device_id Dev, ur_device_handle_t &hDevice);
 } // namespace cl_adapter
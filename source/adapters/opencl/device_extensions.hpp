@@ -0,0 +1,63 @@
+//===--------- device_extensions.hpp - OpenCL Adapter ---------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <bitset>
+#include <string_view>
+#include <utility>
+
+namespace cl_adapter {
+/// Device extensions the adapter checks for, see device_extensions.def.
+enum class DeviceExtension {
+#define CL_DEVICE_EXTENSION(Ext, Name) Ext,
+#include "device_extensions.def"
+#undef CL_DEVICE_EXTENSION
+  Count
+};
+
+using DeviceExtensionSet =
+    std::bitset<static_cast<size_t>(DeviceExtension::Count)>;
+
+/// Picks the extensions the adapter checks for out of the space separated
+/// list the device reports.
+inline DeviceExtensionSet parseExtensions(std::string_view Extensions,
+                                          bool IsFPGAEmulator) {
+  static constexpr std::pair<std::string_view, DeviceExtension> Known[] = {
+#define CL_DEVICE_EXTENSION(Ext, Name) {Name, DeviceExtension::Ext},
+#include "device_extensions.def"
+#undef CL_DEVICE_EXTENSION
+  };
+
+  DeviceExtensionSet Set;
+  while (!Extensions.empty()) {
+    size_t End = Extensions.find(' ');
+    std::string_view Name = Extensions.substr(0, End);
+    for (auto &[KnownName, Ext] : Known) {
+      if (Name == KnownName) {
+        Set.set(static_cast<size_t>(Ext));
+        break;
+      }
+    }
+    Extensions.remove_prefix(End == std::string_view::npos ? Extensions.size()
+                                                           : End + 1);
+  }
+
+  // The Intel FPGA emulation device does actually support these, even if it
+  // doesn't report them.
+  if (IsFPGAEmulator) {
+    for (auto Ext : {DeviceExtension::IntelDeviceAttributeQuery,
+                     DeviceExtension::IntelRequiredSubgroupSize,
+                     DeviceExtension::KhrSubgroups}) {
+      Set.set(static_cast<size_t>(Ext));
+    }
+  }
+  return Set;
+}
+} // namespace cl_adapter
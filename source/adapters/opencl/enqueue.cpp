@@ -9,6 +9,9 @@
 //===----------------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "context.hpp"
+#include "kernel.hpp"
+#include "queue.hpp"
 
 cl_map_flags convertURMapFlagsToCL(ur_map_flags_t URFlags) {
   cl_map_flags CLFlags = 0;
@@ -32,15 +35,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
   std::vector<size_t> compiledLocalWorksize;
   if (!pLocalWorkSize) {
-    cl_device_id device = nullptr;
-    CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
-        cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_DEVICE,
-        sizeof(device), &device, nullptr));
     // This query always returns size_t[3], if nothing was specified it returns
     // all zeroes.
     size_t queriedLocalWorkSize[3] = {0, 0, 0};
     CL_RETURN_ON_FAILURE(clGetKernelWorkGroupInfo(
-        cl_adapter::cast<cl_kernel>(hKernel), device,
+        hKernel->CLKernel, hQueue->Device->CLDevice,
         CL_KERNEL_COMPILE_WORK_GROUP_SIZE, sizeof(size_t[3]),
         queriedLocalWorkSize, nullptr));
     if (queriedLocalWorkSize[0] != 0) {
@@ -51,8 +50,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
   }
 
   CL_RETURN_ON_FAILURE(clEnqueueNDRangeKernel(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_kernel>(hKernel), workDim, pGlobalWorkOffset,
+      hQueue->CLQueue, hKernel->CLKernel, workDim, pGlobalWorkOffset,
       pGlobalWorkSize,
       compiledLocalWorksize.empty() ? pLocalWorkSize
                                     : compiledLocalWorksize.data(),
@@ -77,7 +75,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
   CL_RETURN_ON_FAILURE(clEnqueueMarkerWithWaitList(
-      cl_adapter::cast<cl_command_queue>(hQueue), numEventsInWaitList,
+      hQueue->CLQueue, numEventsInWaitList,
       cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
@@ -89,7 +87,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
   CL_RETURN_ON_FAILURE(clEnqueueBarrierWithWaitList(
-      cl_adapter::cast<cl_command_queue>(hQueue), numEventsInWaitList,
+      hQueue->CLQueue, numEventsInWaitList,
       cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
@@ -109,11 +107,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
     size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
-  CL_RETURN_ON_FAILURE(clEnqueueReadBuffer(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hBuffer), blockingRead, offset, size, pDst,
-      numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
-      cl_adapter::cast<cl_event *>(phEvent)));
+  CL_RETURN_ON_FAILURE(
+      clEnqueueReadBuffer(hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBuffer),
+                          blockingRead, offset, size, pDst, numEventsInWaitList,
+                          cl_adapter::cast<const cl_event *>(phEventWaitList),
+                          cl_adapter::cast<cl_event *>(phEvent)));
 
   return UR_RESULT_SUCCESS;
 }
@@ -124,9 +122,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
   CL_RETURN_ON_FAILURE(clEnqueueWriteBuffer(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hBuffer), blockingWrite, offset, size, pSrc,
-      numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBuffer), blockingWrite, offset,
+      size, pSrc, numEventsInWaitList,
+      cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
   return UR_RESULT_SUCCESS;
@@ -145,10 +143,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
   const size_t Region[3] = {region.width, region.height, region.depth};
 
   CL_RETURN_ON_FAILURE(clEnqueueReadBufferRect(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hBuffer), blockingRead, BufferOrigin, HostOrigin,
-      Region, bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
-      pDst, numEventsInWaitList,
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBuffer), blockingRead,
+      BufferOrigin, HostOrigin, Region, bufferRowPitch, bufferSlicePitch,
+      hostRowPitch, hostSlicePitch, pDst, numEventsInWaitList,
       cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
@@ -168,10 +165,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   const size_t Region[3] = {region.width, region.height, region.depth};
 
   CL_RETURN_ON_FAILURE(clEnqueueWriteBufferRect(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hBuffer), blockingWrite, BufferOrigin,
-      HostOrigin, Region, bufferRowPitch, bufferSlicePitch, hostRowPitch,
-      hostSlicePitch, pSrc, numEventsInWaitList,
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBuffer), blockingWrite,
+      BufferOrigin, HostOrigin, Region, bufferRowPitch, bufferSlicePitch,
+      hostRowPitch, hostSlicePitch, pSrc, numEventsInWaitList,
       cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
@@ -185,8 +181,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     ur_event_handle_t *phEvent) {
 
   CL_RETURN_ON_FAILURE(clEnqueueCopyBuffer(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hBufferSrc),
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBufferSrc),
       cl_adapter::cast<cl_mem>(hBufferDst), srcOffset, dstOffset, size,
       numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
@@ -206,8 +201,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
   const size_t Region[3] = {region.width, region.height, region.depth};
 
   CL_RETURN_ON_FAILURE(clEnqueueCopyBufferRect(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hBufferSrc),
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBufferSrc),
       cl_adapter::cast<cl_mem>(hBufferDst), SrcOrigin, DstOrigin, Region,
       srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
       numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
@@ -224,12 +218,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
   // CL FillBuffer only allows pattern sizes up to the largest CL type:
   // long16/double16
   if (patternSize <= 128) {
-    CL_RETURN_ON_FAILURE(
-        clEnqueueFillBuffer(cl_adapter::cast<cl_command_queue>(hQueue),
-                            cl_adapter::cast<cl_mem>(hBuffer), pPattern,
-                            patternSize, offset, size, numEventsInWaitList,
-                            cl_adapter::cast<const cl_event *>(phEventWaitList),
-                            cl_adapter::cast<cl_event *>(phEvent)));
+    CL_RETURN_ON_FAILURE(clEnqueueFillBuffer(
+        hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBuffer), pPattern,
+        patternSize, offset, size, numEventsInWaitList,
+        cl_adapter::cast<const cl_event *>(phEventWaitList),
+        cl_adapter::cast<cl_event *>(phEvent)));
     return UR_RESULT_SUCCESS;
   }
 
@@ -242,10 +235,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
 
   cl_event WriteEvent = nullptr;
   auto ClErr = clEnqueueWriteBuffer(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hBuffer), false, offset, size, HostBuffer,
-      numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
-      &WriteEvent);
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBuffer), false, offset, size,
+      HostBuffer, numEventsInWaitList,
+      cl_adapter::cast<const cl_event *>(phEventWaitList), &WriteEvent);
   if (ClErr != CL_SUCCESS) {
     delete[] HostBuffer;
     CL_RETURN_ON_FAILURE(ClErr);
@@ -283,9 +275,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
   const size_t Region[3] = {region.width, region.height, region.depth};
 
   CL_RETURN_ON_FAILURE(clEnqueueReadImage(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hImage), blockingRead, Origin, Region, rowPitch,
-      slicePitch, pDst, numEventsInWaitList,
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hImage), blockingRead, Origin,
+      Region, rowPitch, slicePitch, pDst, numEventsInWaitList,
       cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
@@ -301,9 +292,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
   const size_t Region[3] = {region.width, region.height, region.depth};
 
   CL_RETURN_ON_FAILURE(clEnqueueWriteImage(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hImage), blockingWrite, Origin, Region, rowPitch,
-      slicePitch, pSrc, numEventsInWaitList,
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hImage), blockingWrite, Origin,
+      Region, rowPitch, slicePitch, pSrc, numEventsInWaitList,
       cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
@@ -321,10 +311,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
   const size_t Region[3] = {region.width, region.height, region.depth};
 
   CL_RETURN_ON_FAILURE(clEnqueueCopyImage(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hImageSrc), cl_adapter::cast<cl_mem>(hImageDst),
-      SrcOrigin, DstOrigin, Region, numEventsInWaitList,
-      cl_adapter::cast<const cl_event *>(phEventWaitList),
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hImageSrc),
+      cl_adapter::cast<cl_mem>(hImageDst), SrcOrigin, DstOrigin, Region,
+      numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
   return UR_RESULT_SUCCESS;
@@ -338,8 +327,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
 
   cl_int Err;
   *ppRetMap = clEnqueueMapBuffer(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hBuffer), blockingMap,
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hBuffer), blockingMap,
       convertURMapFlagsToCL(mapFlags), offset, size, numEventsInWaitList,
       cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent), &Err);
@@ -353,9 +341,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
     ur_event_handle_t *phEvent) {
 
   CL_RETURN_ON_FAILURE(clEnqueueUnmapMemObject(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_mem>(hMem), pMappedPtr, numEventsInWaitList,
-      cl_adapter::cast<const cl_event *>(phEventWaitList),
+      hQueue->CLQueue, cl_adapter::cast<cl_mem>(hMem), pMappedPtr,
+      numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
   return UR_RESULT_SUCCESS;
@@ -367,24 +354,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
 
-  cl_context Ctx = nullptr;
-  cl_int Res =
-      clGetCommandQueueInfo(cl_adapter::cast<cl_command_queue>(hQueue),
-                            CL_QUEUE_CONTEXT, sizeof(Ctx), &Ctx, nullptr);
+  auto F = hQueue->Context->ExtFuncs.clEnqueueWriteGlobalVariableINTEL;
+  UR_ASSERT(F, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  if (Res != CL_SUCCESS)
-    return mapCLErrorToUR(Res);
-
-  cl_ext::clEnqueueWriteGlobalVariable_fn F = nullptr;
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<decltype(F)>(
-      Ctx, cl_ext::ExtFuncPtrCache->clEnqueueWriteGlobalVariableCache,
-      cl_ext::EnqueueWriteGlobalVariableName, &F));
-
-  Res = F(cl_adapter::cast<cl_command_queue>(hQueue),
-          cl_adapter::cast<cl_program>(hProgram), name, blockingWrite, count,
-          offset, pSrc, numEventsInWaitList,
-          cl_adapter::cast<const cl_event *>(phEventWaitList),
-          cl_adapter::cast<cl_event *>(phEvent));
+  cl_int Res = F(hQueue->CLQueue, cl_adapter::cast<cl_program>(hProgram), name,
+                 blockingWrite, count, offset, pSrc, numEventsInWaitList,
+                 cl_adapter::cast<const cl_event *>(phEventWaitList),
+                 cl_adapter::cast<cl_event *>(phEvent));
 
   return mapCLErrorToUR(Res);
 }
@@ -395,24 +371,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
 
-  cl_context Ctx = nullptr;
-  cl_int Res =
-      clGetCommandQueueInfo(cl_adapter::cast<cl_command_queue>(hQueue),
-                            CL_QUEUE_CONTEXT, sizeof(Ctx), &Ctx, nullptr);
-
-  if (Res != CL_SUCCESS)
-    return mapCLErrorToUR(Res);
-
-  cl_ext::clEnqueueReadGlobalVariable_fn F = nullptr;
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<decltype(F)>(
-      Ctx, cl_ext::ExtFuncPtrCache->clEnqueueReadGlobalVariableCache,
-      cl_ext::EnqueueReadGlobalVariableName, &F));
+  auto F = hQueue->Context->ExtFuncs.clEnqueueReadGlobalVariableINTEL;
+  UR_ASSERT(F, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  Res = F(cl_adapter::cast<cl_command_queue>(hQueue),
-          cl_adapter::cast<cl_program>(hProgram), name, blockingRead, count,
-          offset, pDst, numEventsInWaitList,
-          cl_adapter::cast<const cl_event *>(phEventWaitList),
-          cl_adapter::cast<cl_event *>(phEvent));
+  cl_int Res = F(hQueue->CLQueue, cl_adapter::cast<cl_program>(hProgram), name,
+                 blockingRead, count, offset, pDst, numEventsInWaitList,
+                 cl_adapter::cast<const cl_event *>(phEventWaitList),
+                 cl_adapter::cast<cl_event *>(phEvent));
 
   return mapCLErrorToUR(Res);
 }
@@ -423,28 +388,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueReadHostPipe(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
 
-  cl_context CLContext;
-  cl_int CLErr = clGetCommandQueueInfo(
-      cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_CONTEXT,
-      sizeof(cl_context), &CLContext, nullptr);
-  if (CLErr != CL_SUCCESS) {
-    return mapCLErrorToUR(CLErr);
-  }
+  auto FuncPtr = hQueue->Context->ExtFuncs.clEnqueueReadHostPipeINTEL;
+  UR_ASSERT(FuncPtr, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  cl_ext::clEnqueueReadHostPipeINTEL_fn FuncPtr = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<cl_ext::clEnqueueReadHostPipeINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clEnqueueReadHostPipeINTELCache,
-          cl_ext::EnqueueReadHostPipeName, &FuncPtr));
-
-  if (FuncPtr) {
-    CL_RETURN_ON_FAILURE(
-        FuncPtr(cl_adapter::cast<cl_command_queue>(hQueue),
-                cl_adapter::cast<cl_program>(hProgram), pipe_symbol, blocking,
-                pDst, size, numEventsInWaitList,
-                cl_adapter::cast<const cl_event *>(phEventWaitList),
-                cl_adapter::cast<cl_event *>(phEvent)));
-  }
+  CL_RETURN_ON_FAILURE(
+      FuncPtr(hQueue->CLQueue, cl_adapter::cast<cl_program>(hProgram),
+              pipe_symbol, blocking, pDst, size, numEventsInWaitList,
+              cl_adapter::cast<const cl_event *>(phEventWaitList),
+              cl_adapter::cast<cl_event *>(phEvent)));
 
   return UR_RESULT_SUCCESS;
 }
@@ -455,28 +406,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueWriteHostPipe(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
 
-  cl_context CLContext;
-  cl_int CLErr = clGetCommandQueueInfo(
-      cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_CONTEXT,
-      sizeof(cl_context), &CLContext, nullptr);
-  if (CLErr != CL_SUCCESS) {
-    return mapCLErrorToUR(CLErr);
-  }
+  auto FuncPtr = hQueue->Context->ExtFuncs.clEnqueueWriteHostPipeINTEL;
+  UR_ASSERT(FuncPtr, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  cl_ext::clEnqueueWriteHostPipeINTEL_fn FuncPtr = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<cl_ext::clEnqueueWriteHostPipeINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clEnqueueWriteHostPipeINTELCache,
-          cl_ext::EnqueueWriteHostPipeName, &FuncPtr));
-
-  if (FuncPtr) {
-    CL_RETURN_ON_FAILURE(
-        FuncPtr(cl_adapter::cast<cl_command_queue>(hQueue),
-                cl_adapter::cast<cl_program>(hProgram), pipe_symbol, blocking,
-                pSrc, size, numEventsInWaitList,
-                cl_adapter::cast<const cl_event *>(phEventWaitList),
-                cl_adapter::cast<cl_event *>(phEvent)));
-  }
+  CL_RETURN_ON_FAILURE(
+      FuncPtr(hQueue->CLQueue, cl_adapter::cast<cl_program>(hProgram),
+              pipe_symbol, blocking, pSrc, size, numEventsInWaitList,
+              cl_adapter::cast<const cl_event *>(phEventWaitList),
+              cl_adapter::cast<cl_event *>(phEvent)));
 
   return UR_RESULT_SUCCESS;
 }
@@ -8,7 +8,10 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "adapter.hpp"
 #include "common.hpp"
+#include "context.hpp"
+#include "queue.hpp"
 
 #include <mutex>
 #include <set>
@@ -154,6 +157,28 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
                                                    size_t *pPropSizeRet) {
   cl_event_info CLEventInfo = convertUREventInfoToCL(propName);
 
+  // User events report a null queue
+  if (propName == UR_EVENT_INFO_COMMAND_QUEUE) {
+    UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+    cl_command_queue CLQueue;
+    CL_RETURN_ON_FAILURE(clGetEventInfo(cl_adapter::cast<cl_event>(hEvent),
+                                        CLEventInfo, sizeof(CLQueue), &CLQueue,
+                                        nullptr));
+    ur_queue_handle_t hQueue = nullptr;
+    UR_RETURN_ON_FAILURE(cl_adapter::getQueue(CLQueue, hQueue));
+    return ReturnValue(hQueue);
+  }
+  if (propName == UR_EVENT_INFO_CONTEXT) {
+    UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+    cl_context CLContext;
+    CL_RETURN_ON_FAILURE(clGetEventInfo(cl_adapter::cast<cl_event>(hEvent),
+                                        CLEventInfo, sizeof(CLContext),
+                                        &CLContext, nullptr));
+    ur_context_handle_t hContext = nullptr;
+    UR_RETURN_ON_FAILURE(cl_adapter::getContext(CLContext, hContext));
+    return ReturnValue(hContext);
+  }
+
   size_t CheckPropSize = 0;
   cl_int RetErr =
       clGetEventInfo(cl_adapter::cast<cl_event>(hEvent), CLEventInfo, propSize,
@@ -7,29 +7,56 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //===----------------------------------------------------------------------===//
+#include "kernel.hpp"
+#include "adapter.hpp"
 #include "common.hpp"
 #include "device.hpp"
+#include "queue.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <memory>
 
+ur_kernel_handle_t_::~ur_kernel_handle_t_() { urContextRelease(Context); }
+
+// Wraps CLKernel, taking over the reference to it
+static ur_result_t createKernel(cl_kernel CLKernel,
+                                ur_context_handle_t hContext,
+                                ur_kernel_handle_t *phKernel) {
+  try {
+    *phKernel = new ur_kernel_handle_t_(CLKernel, hContext);
+  } catch (std::bad_alloc &) {
+    clReleaseKernel(CLKernel);
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    clReleaseKernel(CLKernel);
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL
 urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
                ur_kernel_handle_t *phKernel) {
 
+  cl_program CLProgram = cl_adapter::cast<cl_program>(hProgram);
+  cl_context CLContext;
+  CL_RETURN_ON_FAILURE(clGetProgramInfo(
+      CLProgram, CL_PROGRAM_CONTEXT, sizeof(CLContext), &CLContext, nullptr));
+  ur_context_handle_t hContext = nullptr;
+  UR_RETURN_ON_FAILURE(cl_adapter::getContext(CLContext, hContext));
+
   cl_int CLResult;
-  *phKernel = cl_adapter::cast<ur_kernel_handle_t>(clCreateKernel(
-      cl_adapter::cast<cl_program>(hProgram), pKernelName, &CLResult));
+  cl_kernel CLKernel = clCreateKernel(CLProgram, pKernelName, &CLResult);
   CL_RETURN_ON_FAILURE(CLResult);
-  return UR_RESULT_SUCCESS;
+  return createKernel(CLKernel, hContext, phKernel);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
     ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
     const ur_kernel_arg_value_properties_t *, const void *pArgValue) {
 
-  CL_RETURN_ON_FAILURE(clSetKernelArg(cl_adapter::cast<cl_kernel>(hKernel),
+  CL_RETURN_ON_FAILURE(clSetKernelArg(hKernel->CLKernel,
                                       cl_adapter::cast<cl_uint>(argIndex),
                                       argSize, pArgValue));
 
@@ -40,7 +67,7 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urKernelSetArgLocal(ur_kernel_handle_t hKernel, uint32_t argIndex,
                     size_t argSize, const ur_kernel_arg_local_properties_t *) {
 
-  CL_RETURN_ON_FAILURE(clSetKernelArg(cl_adapter::cast<cl_kernel>(hKernel),
+  CL_RETURN_ON_FAILURE(clSetKernelArg(hKernel->CLKernel,
                                       cl_adapter::cast<cl_uint>(argIndex),
                                       argSize, nullptr));
 
@@ -82,10 +109,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
   if (propName == UR_KERNEL_INFO_SPILL_MEM_SIZE) {
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
   }
+  if (propName == UR_KERNEL_INFO_CONTEXT) {
+    UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+    return ReturnValue(hKernel->Context);
+  }
+  if (propName == UR_KERNEL_INFO_REFERENCE_COUNT) {
+    UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+    return ReturnValue(hKernel->RefCount.load());
+  }
   size_t CheckPropSize = 0;
-  cl_int ClResult = clGetKernelInfo(cl_adapter::cast<cl_kernel>(hKernel),
-                                    mapURKernelInfoToCL(propName), propSize,
-                                    pPropValue, &CheckPropSize);
+  cl_int ClResult =
+      clGetKernelInfo(hKernel->CLKernel, mapURKernelInfoToCL(propName),
+                      propSize, pPropValue, &CheckPropSize);
   if (pPropValue && CheckPropSize != propSize) {
     return UR_RESULT_ERROR_INVALID_SIZE;
   }
@@ -127,11 +162,7 @@ urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   // way to query whether a kernel is a builtin kernel but this should suffice
   // to deter naive use of the query.
   if (propName == UR_KERNEL_GROUP_INFO_GLOBAL_WORK_SIZE) {
-    cl_device_type ClDeviceType;
-    CL_RETURN_ON_FAILURE(
-        clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice), CL_DEVICE_TYPE,
-                        sizeof(ClDeviceType), &ClDeviceType, nullptr));
-    if (ClDeviceType != CL_DEVICE_TYPE_CUSTOM) {
+    if (hDevice->Type != CL_DEVICE_TYPE_CUSTOM) {
       return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
     }
   }
@@ -140,9 +171,8 @@ urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
   }
   CL_RETURN_ON_FAILURE(clGetKernelWorkGroupInfo(
-      cl_adapter::cast<cl_kernel>(hKernel),
-      cl_adapter::cast<cl_device_id>(hDevice),
-      mapURKernelGroupInfoToCL(propName), propSize, pPropValue, pPropSizeRet));
+      hKernel->CLKernel, hDevice->CLDevice, mapURKernelGroupInfoToCL(propName),
+      propSize, pPropValue, pPropSizeRet));
 
   return UR_RESULT_SUCCESS;
 }
@@ -198,32 +228,18 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   // supports the original khr subgroup extension.
   cl_ext::clGetKernelSubGroupInfoKHR_fn GetKernelSubGroupInfo = nullptr;
 
-  oclv::OpenCLVersion DevVer;
-  CL_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(
-      cl_adapter::cast<cl_device_id>(hDevice), DevVer));
-
-  if (DevVer < oclv::V2_1) {
-    bool SubgroupExtSupported = false;
-
-    UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
-        cl_adapter::cast<cl_device_id>(hDevice), {"cl_khr_subgroups"},
-        SubgroupExtSupported));
-    if (!SubgroupExtSupported) {
+  if (hDevice->Version < oclv::V2_1) {
+    if (!hDevice->hasExtension(cl_adapter::DeviceExtension::KhrSubgroups)) {
       return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
-    cl_context Context = nullptr;
-    CL_RETURN_ON_FAILURE(clGetKernelInfo(cl_adapter::cast<cl_kernel>(hKernel),
-                                         CL_KERNEL_CONTEXT, sizeof(Context),
-                                         &Context, nullptr));
-    UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext(
-        Context, cl_ext::ExtFuncPtrCache->clGetKernelSubGroupInfoKHRCache,
-        cl_ext::GetKernelSubGroupInfoName, &GetKernelSubGroupInfo));
+    GetKernelSubGroupInfo =
+        hKernel->Context->ExtFuncs.clGetKernelSubGroupInfoKHR;
+    UR_ASSERT(GetKernelSubGroupInfo, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
   } else {
     GetKernelSubGroupInfo = clGetKernelSubGroupInfo;
   }
 
-  cl_int Ret = GetKernelSubGroupInfo(cl_adapter::cast<cl_kernel>(hKernel),
-                                     cl_adapter::cast<cl_device_id>(hDevice),
+  cl_int Ret = GetKernelSubGroupInfo(hKernel->CLKernel, hDevice->CLDevice,
                                      mapURKernelSubGroupInfoToCL(propName),
                                      InputValueSize, InputValue.get(),
                                      sizeof(size_t), &RetVal, pPropSizeRet);
@@ -270,13 +286,21 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urKernelRetain(ur_kernel_handle_t hKernel) {
-  CL_RETURN_ON_FAILURE(clRetainKernel(cl_adapter::cast<cl_kernel>(hKernel)));
+  CL_RETURN_ON_FAILURE(clRetainKernel(hKernel->CLKernel));
+  hKernel->RefCount++;
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urKernelRelease(ur_kernel_handle_t hKernel) {
-  CL_RETURN_ON_FAILURE(clReleaseKernel(cl_adapter::cast<cl_kernel>(hKernel)));
+  if (--hKernel->RefCount > 0) {
+    CL_RETURN_ON_FAILURE(clReleaseKernel(hKernel->CLKernel));
+    return UR_RESULT_SUCCESS;
+  }
+
+  cl_int RetErr = clReleaseKernel(hKernel->CLKernel);
+  delete hKernel;
+  CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
@@ -287,49 +311,26 @@ urKernelRelease(ur_kernel_handle_t hKernel) {
 static ur_result_t usmSetIndirectAccess(ur_kernel_handle_t hKernel) {
 
   cl_bool TrueVal = CL_TRUE;
-  clHostMemAllocINTEL_fn HFunc = nullptr;
-  clSharedMemAllocINTEL_fn SFunc = nullptr;
-  clDeviceMemAllocINTEL_fn DFunc = nullptr;
-  cl_context CLContext;
+  const cl_ext::ExtFuncPtrTableT &ExtFuncs = hKernel->Context->ExtFuncs;
 
   /* We test that each alloc type is supported before we actually try to set
    * KernelExecInfo. */
-  CL_RETURN_ON_FAILURE(clGetKernelInfo(cl_adapter::cast<cl_kernel>(hKernel),
-                                       CL_KERNEL_CONTEXT, sizeof(cl_context),
-                                       &CLContext, nullptr));
-
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clHostMemAllocINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clHostMemAllocINTELCache,
-      cl_ext::HostMemAllocName, &HFunc));
-
-  if (HFunc) {
-    CL_RETURN_ON_FAILURE(
-        clSetKernelExecInfo(cl_adapter::cast<cl_kernel>(hKernel),
-                            CL_KERNEL_EXEC_INFO_INDIRECT_HOST_ACCESS_INTEL,
-                            sizeof(cl_bool), &TrueVal));
-  }
-
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clDeviceMemAllocINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clDeviceMemAllocINTELCache,
-      cl_ext::DeviceMemAllocName, &DFunc));
-
-  if (DFunc) {
-    CL_RETURN_ON_FAILURE(
-        clSetKernelExecInfo(cl_adapter::cast<cl_kernel>(hKernel),
-                            CL_KERNEL_EXEC_INFO_INDIRECT_DEVICE_ACCESS_INTEL,
-                            sizeof(cl_bool), &TrueVal));
-  }
-
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clSharedMemAllocINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clSharedMemAllocINTELCache,
-      cl_ext::SharedMemAllocName, &SFunc));
-
-  if (SFunc) {
-    CL_RETURN_ON_FAILURE(
-        clSetKernelExecInfo(cl_adapter::cast<cl_kernel>(hKernel),
-                            CL_KERNEL_EXEC_INFO_INDIRECT_SHARED_ACCESS_INTEL,
-                            sizeof(cl_bool), &TrueVal));
-  }
+  UR_ASSERT(ExtFuncs.clHostMemAllocINTEL, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  CL_RETURN_ON_FAILURE(clSetKernelExecInfo(
+      hKernel->CLKernel, CL_KERNEL_EXEC_INFO_INDIRECT_HOST_ACCESS_INTEL,
+      sizeof(cl_bool), &TrueVal));
+
+  UR_ASSERT(ExtFuncs.clDeviceMemAllocINTEL,
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  CL_RETURN_ON_FAILURE(clSetKernelExecInfo(
+      hKernel->CLKernel, CL_KERNEL_EXEC_INFO_INDIRECT_DEVICE_ACCESS_INTEL,
+      sizeof(cl_bool), &TrueVal));
+
+  UR_ASSERT(ExtFuncs.clSharedMemAllocINTEL,
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  CL_RETURN_ON_FAILURE(clSetKernelExecInfo(
+      hKernel->CLKernel, CL_KERNEL_EXEC_INFO_INDIRECT_SHARED_ACCESS_INTEL,
+      sizeof(cl_bool), &TrueVal));
   return UR_RESULT_SUCCESS;
 }
 
@@ -350,9 +351,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
     return UR_RESULT_SUCCESS;
   }
   case UR_KERNEL_EXEC_INFO_USM_PTRS: {
-    CL_RETURN_ON_FAILURE(clSetKernelExecInfo(
-        cl_adapter::cast<cl_kernel>(hKernel),
-        CL_KERNEL_EXEC_INFO_USM_PTRS_INTEL, propSize, pPropValue));
+    CL_RETURN_ON_FAILURE(clSetKernelExecInfo(hKernel->CLKernel,
+                                             CL_KERNEL_EXEC_INFO_USM_PTRS_INTEL,
+                                             propSize, pPropValue));
     return UR_RESULT_SUCCESS;
   }
   default: {
@@ -365,30 +366,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgPointer(
     ur_kernel_handle_t hKernel, uint32_t argIndex,
     const ur_kernel_arg_pointer_properties_t *, const void *pArgValue) {
 
-  cl_context CLContext;
-  CL_RETURN_ON_FAILURE(clGetKernelInfo(cl_adapter::cast<cl_kernel>(hKernel),
-                                       CL_KERNEL_CONTEXT, sizeof(cl_context),
-                                       &CLContext, nullptr));
-
-  clSetKernelArgMemPointerINTEL_fn FuncPtr = nullptr;
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<clSetKernelArgMemPointerINTEL_fn>(
-          CLContext,
-          cl_ext::ExtFuncPtrCache->clSetKernelArgMemPointerINTELCache,
-          cl_ext::SetKernelArgMemPointerName, &FuncPtr));
-
-  if (FuncPtr) {
-    CL_RETURN_ON_FAILURE(FuncPtr(cl_adapter::cast<cl_kernel>(hKernel),
-                                 cl_adapter::cast<cl_uint>(argIndex),
-                                 pArgValue));
-  }
+  auto FuncPtr = hKernel->Context->ExtFuncs.clSetKernelArgMemPointerINTEL;
+  UR_ASSERT(FuncPtr, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+  CL_RETURN_ON_FAILURE(FuncPtr(hKernel->CLKernel,
+                               cl_adapter::cast<cl_uint>(argIndex), pArgValue));
 
   return UR_RESULT_SUCCESS;
 }
 UR_APIEXPORT ur_result_t UR_APICALL urKernelGetNativeHandle(
     ur_kernel_handle_t hKernel, ur_native_handle_t *phNativeKernel) {
 
-  *phNativeKernel = reinterpret_cast<ur_native_handle_t>(hKernel);
+  *phNativeKernel = reinterpret_cast<ur_native_handle_t>(hKernel->CLKernel);
   return UR_RESULT_SUCCESS;
 }
 
@@ -403,14 +392,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
-    ur_native_handle_t hNativeKernel, ur_context_handle_t, ur_program_handle_t,
-    const ur_kernel_native_properties_t *pProperties,
+    ur_native_handle_t hNativeKernel, ur_context_handle_t hContext,
+    ur_program_handle_t, const ur_kernel_native_properties_t *pProperties,
     ur_kernel_handle_t *phKernel) {
-  *phKernel = reinterpret_cast<ur_kernel_handle_t>(hNativeKernel);
+  cl_kernel CLKernel = reinterpret_cast<cl_kernel>(hNativeKernel);
   if (!pProperties || !pProperties->isNativeHandleOwned) {
-    return urKernelRetain(*phKernel);
+    CL_RETURN_ON_FAILURE(clRetainKernel(CLKernel));
   }
-  return UR_RESULT_SUCCESS;
+  return createKernel(CLKernel, hContext, phKernel);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgMemObj(
@@ -418,8 +407,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgMemObj(
     const ur_kernel_arg_mem_obj_properties_t *, ur_mem_handle_t hArgValue) {
 
   cl_int RetErr = clSetKernelArg(
-      cl_adapter::cast<cl_kernel>(hKernel), cl_adapter::cast<cl_uint>(argIndex),
-      sizeof(hArgValue), cl_adapter::cast<const cl_mem *>(&hArgValue));
+      hKernel->CLKernel, cl_adapter::cast<cl_uint>(argIndex), sizeof(hArgValue),
+      cl_adapter::cast<const cl_mem *>(&hArgValue));
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
@@ -429,8 +418,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgSampler(
     const ur_kernel_arg_sampler_properties_t *, ur_sampler_handle_t hArgValue) {
 
   cl_int RetErr = clSetKernelArg(
-      cl_adapter::cast<cl_kernel>(hKernel), cl_adapter::cast<cl_uint>(argIndex),
-      sizeof(hArgValue), cl_adapter::cast<const cl_sampler *>(&hArgValue));
+      hKernel->CLKernel, cl_adapter::cast<cl_uint>(argIndex), sizeof(hArgValue),
+      cl_adapter::cast<const cl_sampler *>(&hArgValue));
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
@@ -439,26 +428,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     ur_kernel_handle_t hKernel, ur_queue_handle_t hQueue, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     size_t *pSuggestedLocalWorkSize) {
-  cl_device_id Device;
-  cl_platform_id Platform;
-
-  CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
-      cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_DEVICE,
-      sizeof(cl_device_id), &Device, nullptr));
-
-  CL_RETURN_ON_FAILURE(clGetDeviceInfo(
-      Device, CL_DEVICE_PLATFORM, sizeof(cl_platform_id), &Platform, nullptr));
-
   auto GetKernelSuggestedLocalWorkSizeFuncPtr =
-      (clGetKernelSuggestedLocalWorkSizeKHR_fn)
-          clGetExtensionFunctionAddressForPlatform(
-              Platform, "clGetKernelSuggestedLocalWorkSizeKHR");
+      hQueue->Context->ExtFuncs.clGetKernelSuggestedLocalWorkSizeKHR;
   if (!GetKernelSuggestedLocalWorkSizeFuncPtr)
     return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
   CL_RETURN_ON_FAILURE(GetKernelSuggestedLocalWorkSizeFuncPtr(
-      cl_adapter::cast<cl_command_queue>(hQueue),
-      cl_adapter::cast<cl_kernel>(hKernel), workDim, pGlobalWorkOffset,
+      hQueue->CLQueue, hKernel->CLKernel, workDim, pGlobalWorkOffset,
       pGlobalWorkSize, pSuggestedLocalWorkSize));
   return UR_RESULT_SUCCESS;
 }
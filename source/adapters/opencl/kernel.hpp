@@ -0,0 +1,34 @@
+//===--------- kernel.hpp - OpenCL Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common.hpp"
+#include "context.hpp"
+
+#include <atomic>
+
+/// Handle to an OpenCL kernel, keeping the context of its program alive.
+struct ur_kernel_handle_t_ {
+  using native_type = cl_kernel;
+
+  /// OpenCL kernel object.
+  native_type CLKernel;
+  /// Context the program of the kernel was created for.
+  ur_context_handle_t Context;
+  /// Object reference count.
+  std::atomic<uint32_t> RefCount = 1;
+
+  ur_kernel_handle_t_(native_type CLKernel, ur_context_handle_t Context)
+      : CLKernel(CLKernel), Context(Context) {
+    urContextRetain(Context);
+  }
+
+  ~ur_kernel_handle_t_();
+};
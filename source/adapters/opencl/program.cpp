@@ -36,78 +36,58 @@ static ur_result_t getDevicesFromProgram(
   return UR_RESULT_SUCCESS;
 }
 
+static ur_result_t getContextFromProgram(ur_program_handle_t hProgram,
+                                         ur_context_handle_t &hContext) {
+  cl_context CLContext = nullptr;
+  CL_RETURN_ON_FAILURE(clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
+                                        CL_PROGRAM_CONTEXT, sizeof(CLContext),
+                                        &CLContext, nullptr));
+  return cl_adapter::getContext(CLContext, hContext);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithIL(
     ur_context_handle_t hContext, const void *pIL, size_t length,
     const ur_program_properties_t *, ur_program_handle_t *phProgram) {
 
-  std::unique_ptr<std::vector<cl_device_id>> DevicesInCtx;
-  CL_RETURN_ON_FAILURE_AND_SET_NULL(
-      cl_adapter::getDevicesFromContext(hContext, DevicesInCtx), phProgram);
-
-  cl_platform_id CurPlatform;
-  CL_RETURN_ON_FAILURE_AND_SET_NULL(
-      clGetDeviceInfo((*DevicesInCtx)[0], CL_DEVICE_PLATFORM,
-                      sizeof(cl_platform_id), &CurPlatform, nullptr),
-      phProgram);
-
   oclv::OpenCLVersion PlatVer;
   CL_RETURN_ON_FAILURE_AND_SET_NULL(
-      cl_adapter::getPlatformVersion(CurPlatform, PlatVer), phProgram);
+      cl_adapter::getPlatformVersion(
+          cl_adapter::cast<cl_platform_id>(hContext->Devices[0]->Platform),
+          PlatVer),
+      phProgram);
 
   cl_int Err = CL_SUCCESS;
   if (PlatVer >= oclv::V2_1) {
 
     /* Make sure all devices support CL 2.1 or newer as well. */
-    for (cl_device_id Dev : *DevicesInCtx) {
-      oclv::OpenCLVersion DevVer;
-
-      CL_RETURN_ON_FAILURE_AND_SET_NULL(
-          cl_adapter::getDeviceVersion(Dev, DevVer), phProgram);
-
+    for (ur_device_handle_t Dev : hContext->Devices) {
       /* If the device does not support CL 2.1 or greater, we need to make sure
        * it supports the cl_khr_il_program extension.
        */
-      if (DevVer < oclv::V2_1) {
-        bool Supported = false;
-        CL_RETURN_ON_FAILURE_AND_SET_NULL(
-            cl_adapter::checkDeviceExtensions(Dev, {"cl_khr_il_program"},
-                                              Supported),
-            phProgram);
-
-        if (!Supported) {
-          return UR_RESULT_ERROR_COMPILER_NOT_AVAILABLE;
-        }
+      if (Dev->Version < oclv::V2_1 &&
+          !Dev->hasExtension(cl_adapter::DeviceExtension::KhrILProgram)) {
+        return UR_RESULT_ERROR_COMPILER_NOT_AVAILABLE;
       }
     }
 
-    *phProgram = cl_adapter::cast<ur_program_handle_t>(clCreateProgramWithIL(
-        cl_adapter::cast<cl_context>(hContext), pIL, length, &Err));
+    *phProgram = cl_adapter::cast<ur_program_handle_t>(
+        clCreateProgramWithIL(hContext->CLContext, pIL, length, &Err));
   } else {
 
     /* If none of the devices conform with CL 2.1 or newer make sure they all
      * support the cl_khr_il_program extension.
      */
-    for (cl_device_id Dev : *DevicesInCtx) {
-      bool Supported = false;
-      CL_RETURN_ON_FAILURE_AND_SET_NULL(
-          cl_adapter::checkDeviceExtensions(Dev, {"cl_khr_il_program"},
-                                            Supported),
-          phProgram);
-
-      if (!Supported) {
+    for (ur_device_handle_t Dev : hContext->Devices) {
+      if (!Dev->hasExtension(cl_adapter::DeviceExtension::KhrILProgram)) {
         return UR_RESULT_ERROR_COMPILER_NOT_AVAILABLE;
       }
     }
 
-    cl_ext::clCreateProgramWithILKHR_fn CreateProgramWithIL = nullptr;
-
-    UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext(
-        cl_adapter::cast<cl_context>(hContext),
-        cl_ext::ExtFuncPtrCache->clCreateProgramWithILKHRCache,
-        cl_ext::CreateProgramWithILName, &CreateProgramWithIL));
+    auto CreateProgramWithIL = hContext->ExtFuncs.clCreateProgramWithILKHR;
+    UR_ASSERT(CreateProgramWithIL, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-    *phProgram = cl_adapter::cast<ur_program_handle_t>(CreateProgramWithIL(
-        cl_adapter::cast<cl_context>(hContext), pIL, length, &Err));
+    *phProgram = cl_adapter::cast<ur_program_handle_t>(
+        CreateProgramWithIL(hContext->CLContext, pIL, length, &Err));
   }
 
   // INVALID_VALUE is only returned in three circumstances according to the cl
@@ -138,13 +118,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
     const ur_program_properties_t *, ur_program_handle_t *phProgram) {
   std::vector<cl_device_id> Devices(numDevices);
   for (uint32_t i = 0; i < numDevices; ++i)
-    Devices[i] = cl_adapter::cast<cl_device_id>(phDevices[i]);
+    Devices[i] = phDevices[i]->CLDevice;
   std::vector<cl_int> BinaryStatus(numDevices);
   cl_int CLResult;
   *phProgram = cl_adapter::cast<ur_program_handle_t>(clCreateProgramWithBinary(
-      cl_adapter::cast<cl_context>(hContext),
-      cl_adapter::cast<cl_uint>(numDevices), Devices.data(), pLengths,
-      ppBinaries, BinaryStatus.data(), &CLResult));
+      hContext->CLContext, cl_adapter::cast<cl_uint>(numDevices),
+      Devices.data(), pLengths, ppBinaries, BinaryStatus.data(), &CLResult));
   for (uint32_t i = 0; i < numDevices; ++i) {
     CL_RETURN_ON_FAILURE(BinaryStatus[i]);
   }
@@ -197,6 +176,27 @@ static cl_int mapURProgramInfoToCL(ur_program_info_t URPropName) {
 UR_APIEXPORT ur_result_t UR_APICALL
 urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
                  size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_PROGRAM_INFO_CONTEXT: {
+    ur_context_handle_t hContext = nullptr;
+    UR_RETURN_ON_FAILURE(getContextFromProgram(hProgram, hContext));
+    return ReturnValue(hContext);
+  }
+  case UR_PROGRAM_INFO_DEVICES: {
+    std::unique_ptr<std::vector<cl_device_id>> DevicesInProgram;
+    UR_RETURN_ON_FAILURE(getDevicesFromProgram(hProgram, DevicesInProgram));
+    std::vector<ur_device_handle_t> Devices(DevicesInProgram->size());
+    for (size_t I = 0; I < Devices.size(); I++) {
+      UR_RETURN_ON_FAILURE(
+          cl_adapter::getDevice((*DevicesInProgram)[I], Devices[I]));
+    }
+    return ReturnValue(Devices.data(), Devices.size());
+  }
+  default:
+    break;
+  }
+
   size_t CheckPropSize = 0;
   auto ClResult = clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
                                    mapURProgramInfoToCL(propName), propSize,
@@ -231,8 +231,8 @@ urProgramLink(ur_context_handle_t hContext, uint32_t count,
 
   cl_int CLResult;
   *phProgram = cl_adapter::cast<ur_program_handle_t>(
-      clLinkProgram(cl_adapter::cast<cl_context>(hContext), 0, nullptr,
-                    pOptions, cl_adapter::cast<cl_uint>(count),
+      clLinkProgram(hContext->CLContext, 0, nullptr, pOptions,
+                    cl_adapter::cast<cl_uint>(count),
                     cl_adapter::cast<const cl_program *>(phPrograms), nullptr,
                     nullptr, &CLResult));
 
@@ -317,15 +317,14 @@ urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t hDevice,
     UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
     cl_program_binary_type BinaryType;
     CL_RETURN_ON_FAILURE(clGetProgramBuildInfo(
-        cl_adapter::cast<cl_program>(hProgram),
-        cl_adapter::cast<cl_device_id>(hDevice),
+        cl_adapter::cast<cl_program>(hProgram), hDevice->CLDevice,
         mapURProgramBuildInfoToCL(propName), sizeof(cl_program_binary_type),
         &BinaryType, nullptr));
     return ReturnValue(mapCLBinaryTypeToUR(BinaryType));
   }
   size_t CheckPropSize = 0;
   cl_int ClErr = clGetProgramBuildInfo(cl_adapter::cast<cl_program>(hProgram),
-                                       cl_adapter::cast<cl_device_id>(hDevice),
+                                       hDevice->CLDevice,
                                        mapURProgramBuildInfoToCL(propName),
                                        propSize, pPropValue, &CheckPropSize);
   if (pPropValue && CheckPropSize != propSize) {
@@ -377,20 +376,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     const ur_specialization_constant_info_t *pSpecConstants) {
 
   cl_program CLProg = cl_adapter::cast<cl_program>(hProgram);
-  cl_context Ctx = nullptr;
-  size_t RetSize = 0;
-
-  CL_RETURN_ON_FAILURE(clGetProgramInfo(CLProg, CL_PROGRAM_CONTEXT, sizeof(Ctx),
-                                        &Ctx, &RetSize));
-
-  std::unique_ptr<std::vector<cl_device_id>> DevicesInCtx;
-  UR_RETURN_ON_FAILURE(cl_adapter::getDevicesFromContext(
-      cl_adapter::cast<ur_context_handle_t>(Ctx), DevicesInCtx));
-
-  cl_platform_id CurPlatform;
-  CL_RETURN_ON_FAILURE(clGetDeviceInfo((*DevicesInCtx)[0], CL_DEVICE_PLATFORM,
-                                       sizeof(cl_platform_id), &CurPlatform,
-                                       nullptr));
 
   if (ur::cl::getAdapter()->clSetProgramSpecializationConstant) {
     for (uint32_t i = 0; i < count; ++i) {
@@ -436,17 +421,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
     ur_device_handle_t hDevice, ur_program_handle_t hProgram,
     const char *pFunctionName, void **ppFunctionPointer) {
 
-  cl_context CLContext = nullptr;
-  CL_RETURN_ON_FAILURE(clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
-                                        CL_PROGRAM_CONTEXT, sizeof(CLContext),
-                                        &CLContext, nullptr));
-
-  cl_ext::clGetDeviceFunctionPointer_fn FuncT = nullptr;
+  ur_context_handle_t hContext = nullptr;
+  UR_RETURN_ON_FAILURE(getContextFromProgram(hProgram, hContext));
 
-  UR_RETURN_ON_FAILURE(
-      cl_ext::getExtFuncFromContext<cl_ext::clGetDeviceFunctionPointer_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clGetDeviceFunctionPointerCache,
-          cl_ext::GetDeviceFunctionPointerName, &FuncT));
+  auto FuncT = hContext->ExtFuncs.clGetDeviceFunctionPointerINTEL;
+  UR_ASSERT(FuncT, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   // Check if the kernel name exists to prevent the OpenCL runtime from throwing
   // an exception with the cpu runtime.
@@ -473,9 +452,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
   }
 
   const cl_int CLResult =
-      FuncT(cl_adapter::cast<cl_device_id>(hDevice),
-            cl_adapter::cast<cl_program>(hProgram), pFunctionName,
-            reinterpret_cast<cl_ulong *>(ppFunctionPointer));
+      FuncT(hDevice->CLDevice, cl_adapter::cast<cl_program>(hProgram),
+            pFunctionName, reinterpret_cast<cl_ulong *>(ppFunctionPointer));
   // GPU runtime sometimes returns CL_INVALID_ARG_VALUE if the function address
   // cannot be found but the kernel exists. As the kernel does exist, return
   // that the function name is invalid.
@@ -494,22 +472,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     const char *pGlobalVariableName, size_t *pGlobalVariableSizeRet,
     void **ppGlobalVariablePointerRet) {
 
-  cl_context CLContext = nullptr;
-  CL_RETURN_ON_FAILURE(clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
-                                        CL_PROGRAM_CONTEXT, sizeof(CLContext),
-                                        &CLContext, nullptr));
+  ur_context_handle_t hContext = nullptr;
+  UR_RETURN_ON_FAILURE(getContextFromProgram(hProgram, hContext));
 
-  cl_ext::clGetDeviceGlobalVariablePointer_fn FuncT = nullptr;
+  auto FuncT = hContext->ExtFuncs.clGetDeviceGlobalVariablePointerINTEL;
+  UR_ASSERT(FuncT, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<
-                       cl_ext::clGetDeviceGlobalVariablePointer_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clGetDeviceGlobalVariablePointerCache,
-      cl_ext::GetDeviceGlobalVariablePointerName, &FuncT));
-
-  const cl_int CLResult =
-      FuncT(cl_adapter::cast<cl_device_id>(hDevice),
-            cl_adapter::cast<cl_program>(hProgram), pGlobalVariableName,
-            pGlobalVariableSizeRet, ppGlobalVariablePointerRet);
+  const cl_int CLResult = FuncT(
+      hDevice->CLDevice, cl_adapter::cast<cl_program>(hProgram),
+      pGlobalVariableName, pGlobalVariableSizeRet, ppGlobalVariablePointerRet);
 
   if (CLResult != CL_SUCCESS) {
     *ppGlobalVariablePointerRet = nullptr;
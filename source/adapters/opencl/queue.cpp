@@ -6,9 +6,95 @@
 //
 //===-----------------------------------------------------------------===//
 
+#include "queue.hpp"
+#include "adapter.hpp"
 #include "common.hpp"
 #include "platform.hpp"
 
+ur_queue_handle_t_::~ur_queue_handle_t_() {
+  urDeviceRelease(Device);
+  // Retired handles gave up their reference to the context already
+  if (!Retired) {
+    urContextRelease(Context);
+  }
+}
+
+// Gives the caller a reference to hQueue, taking over one to its command-queue
+static void adoptQueue(ur_queue_handle_t hQueue) {
+  if (hQueue->RefCount++ == 0) {
+    // The handle was retired, so it gets its reference to the context back
+    urContextRetain(hQueue->Context);
+  }
+}
+
+// Wraps CLQueue, taking over the reference to it. Command-queues passed in as
+// native handles may have been wrapped before, in which case the handle is
+// shared.
+static ur_result_t createQueue(cl_command_queue CLQueue,
+                               ur_context_handle_t hContext,
+                               ur_device_handle_t hDevice,
+                               ur_queue_handle_t *phQueue, bool IsNew) {
+  auto &Queues = ur::cl::getAdapter()->Queues;
+  if (!IsNew) {
+    if (auto hQueue = Queues.find(CLQueue)) {
+      adoptQueue(hQueue);
+      *phQueue = hQueue;
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
+  try {
+    auto Queue =
+        std::make_unique<ur_queue_handle_t_>(CLQueue, hContext, hDevice);
+    if (IsNew) {
+      // A handle still registered for the address is a retired one, whose
+      // command-queue is gone, and is freed along with its context
+      Queues.replace(CLQueue, Queue.get());
+      *phQueue = Queue.release();
+    } else if (auto hQueue = Queues.insert(CLQueue, Queue.get());
+               hQueue == Queue.get()) {
+      *phQueue = Queue.release();
+    } else {
+      // Another thread got to wrap the command-queue first
+      adoptQueue(hQueue);
+      *phQueue = hQueue;
+    }
+  } catch (std::bad_alloc &) {
+    clReleaseCommandQueue(CLQueue);
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    clReleaseCommandQueue(CLQueue);
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t cl_adapter::getQueue(cl_command_queue CLQueue,
+                                 ur_queue_handle_t &hQueue) {
+  hQueue = nullptr;
+  if (!CLQueue || (hQueue = ur::cl::getAdapter()->Queues.find(CLQueue))) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  // The command-queue was created outside of the adapter. It's wrapped like a
+  // native handle, and the reference is dropped right away, which retires the
+  // handle since whoever the command-queue came from still holds it.
+  cl_context CLContext = nullptr;
+  cl_device_id CLDevice = nullptr;
+  CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
+      CLQueue, CL_QUEUE_CONTEXT, sizeof(CLContext), &CLContext, nullptr));
+  CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
+      CLQueue, CL_QUEUE_DEVICE, sizeof(CLDevice), &CLDevice, nullptr));
+  ur_context_handle_t hContext = nullptr;
+  UR_RETURN_ON_FAILURE(cl_adapter::getContext(CLContext, hContext));
+  ur_device_handle_t hDevice = nullptr;
+  UR_RETURN_ON_FAILURE(cl_adapter::getDevice(CLDevice, hDevice));
+
+  CL_RETURN_ON_FAILURE(clRetainCommandQueue(CLQueue));
+  UR_RETURN_ON_FAILURE(createQueue(CLQueue, hContext, hDevice, &hQueue, false));
+  return urQueueRelease(hQueue);
+}
+
 cl_command_queue_info mapURQueueInfoToCL(const ur_queue_info_t PropName) {
 
   switch (PropName) {
@@ -71,13 +157,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProperties, ur_queue_handle_t *phQueue) {
 
-  cl_platform_id CurPlatform;
-  CL_RETURN_ON_FAILURE_AND_SET_NULL(
-      clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice),
-                      CL_DEVICE_PLATFORM, sizeof(cl_platform_id), &CurPlatform,
-                      nullptr),
-      phQueue);
-
   cl_command_queue_properties CLProperties =
       pProperties ? convertURQueuePropertiesToCL(pProperties) : 0;
 
@@ -88,29 +167,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
 
   oclv::OpenCLVersion Version;
   CL_RETURN_ON_FAILURE_AND_SET_NULL(
-      cl_adapter::getPlatformVersion(CurPlatform, Version), phQueue);
+      cl_adapter::getPlatformVersion(
+          cl_adapter::cast<cl_platform_id>(hDevice->Platform), Version),
+      phQueue);
 
   cl_int RetErr = CL_INVALID_OPERATION;
+  cl_command_queue CLQueue;
 
   if (Version < oclv::V2_0) {
-    *phQueue = cl_adapter::cast<ur_queue_handle_t>(
-        clCreateCommandQueue(cl_adapter::cast<cl_context>(hContext),
-                             cl_adapter::cast<cl_device_id>(hDevice),
-                             CLProperties & SupportByOpenCL, &RetErr));
-    CL_RETURN_ON_FAILURE(RetErr);
-    return UR_RESULT_SUCCESS;
+    CLQueue = clCreateCommandQueue(hContext->CLContext, hDevice->CLDevice,
+                                   CLProperties & SupportByOpenCL, &RetErr);
+  } else {
+    /* TODO: Add support for CL_QUEUE_PRIORITY_KHR */
+    cl_queue_properties CreationFlagProperties[] = {
+        CL_QUEUE_PROPERTIES, CLProperties & SupportByOpenCL, 0};
+    CLQueue = clCreateCommandQueueWithProperties(
+        hContext->CLContext, hDevice->CLDevice, CreationFlagProperties,
+        &RetErr);
   }
+  CL_RETURN_ON_FAILURE_AND_SET_NULL(RetErr, phQueue);
 
-  /* TODO: Add support for CL_QUEUE_PRIORITY_KHR */
-  cl_queue_properties CreationFlagProperties[] = {
-      CL_QUEUE_PROPERTIES, CLProperties & SupportByOpenCL, 0};
-  *phQueue =
-      cl_adapter::cast<ur_queue_handle_t>(clCreateCommandQueueWithProperties(
-          cl_adapter::cast<cl_context>(hContext),
-          cl_adapter::cast<cl_device_id>(hDevice), CreationFlagProperties,
-          &RetErr));
-  CL_RETURN_ON_FAILURE(RetErr);
-  return UR_RESULT_SUCCESS;
+  return createQueue(CLQueue, hContext, hDevice, phQueue, true);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
@@ -124,22 +201,40 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
   }
   cl_command_queue_info CLCommandQueueInfo = mapURQueueInfoToCL(propName);
 
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_QUEUE_INFO_CONTEXT:
+    return ReturnValue(hQueue->Context);
+  case UR_QUEUE_INFO_DEVICE:
+    return ReturnValue(hQueue->Device);
+  case UR_QUEUE_INFO_REFERENCE_COUNT:
+    return ReturnValue(hQueue->RefCount.load());
+  case UR_QUEUE_INFO_DEVICE_DEFAULT: {
+    cl_command_queue CLDefaultQueue = nullptr;
+    CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
+        hQueue->CLQueue, CLCommandQueueInfo, sizeof(CLDefaultQueue),
+        &CLDefaultQueue, nullptr));
+    ur_queue_handle_t hDefaultQueue = nullptr;
+    UR_RETURN_ON_FAILURE(cl_adapter::getQueue(CLDefaultQueue, hDefaultQueue));
+    return ReturnValue(hDefaultQueue);
+  }
+  default:
+    break;
+  }
+
   // Unfortunately the size of cl_bitfield (unsigned long) doesn't line up with
   // our enums (forced to be sizeof(uint32_t)) so this needs special handling.
   if (propName == UR_QUEUE_INFO_FLAGS) {
-    UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
-
     cl_command_queue_properties QueueProperties = 0;
     CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
-        cl_adapter::cast<cl_command_queue>(hQueue), CLCommandQueueInfo,
-        sizeof(QueueProperties), &QueueProperties, nullptr));
+        hQueue->CLQueue, CLCommandQueueInfo, sizeof(QueueProperties),
+        &QueueProperties, nullptr));
 
     return ReturnValue(mapCLQueuePropsToUR(QueueProperties));
   } else {
     size_t CheckPropSize = 0;
-    cl_int RetErr = clGetCommandQueueInfo(
-        cl_adapter::cast<cl_command_queue>(hQueue), CLCommandQueueInfo,
-        propSize, pPropValue, &CheckPropSize);
+    cl_int RetErr = clGetCommandQueueInfo(hQueue->CLQueue, CLCommandQueueInfo,
+                                          propSize, pPropValue, &CheckPropSize);
     if (pPropValue && CheckPropSize != propSize) {
       return UR_RESULT_ERROR_INVALID_SIZE;
     }
@@ -155,45 +250,64 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
 UR_APIEXPORT ur_result_t UR_APICALL
 urQueueGetNativeHandle(ur_queue_handle_t hQueue, ur_queue_native_desc_t *,
                        ur_native_handle_t *phNativeQueue) {
-  return getNativeHandle(hQueue, phNativeQueue);
+  return getNativeHandle(hQueue->CLQueue, phNativeQueue);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
-    ur_native_handle_t hNativeQueue,
-    [[maybe_unused]] ur_context_handle_t hContext,
-    [[maybe_unused]] ur_device_handle_t hDevice,
+    ur_native_handle_t hNativeQueue, ur_context_handle_t hContext,
+    ur_device_handle_t hDevice,
     [[maybe_unused]] const ur_queue_native_properties_t *pProperties,
     ur_queue_handle_t *phQueue) {
 
-  *phQueue = reinterpret_cast<ur_queue_handle_t>(hNativeQueue);
-  cl_int RetErr =
-      clRetainCommandQueue(cl_adapter::cast<cl_command_queue>(*phQueue));
-  CL_RETURN_ON_FAILURE(RetErr);
-  return UR_RESULT_SUCCESS;
+  cl_command_queue CLQueue = reinterpret_cast<cl_command_queue>(hNativeQueue);
+  if (!hDevice) {
+    cl_device_id CLDevice;
+    CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
+        CLQueue, CL_QUEUE_DEVICE, sizeof(CLDevice), &CLDevice, nullptr));
+    UR_RETURN_ON_FAILURE(cl_adapter::getDevice(CLDevice, hDevice));
+  }
+
+  CL_RETURN_ON_FAILURE(clRetainCommandQueue(CLQueue));
+  return createQueue(CLQueue, hContext, hDevice, phQueue, false);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
-  cl_int RetErr = clFinish(cl_adapter::cast<cl_command_queue>(hQueue));
+  cl_int RetErr = clFinish(hQueue->CLQueue);
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
-  cl_int RetErr = clFinish(cl_adapter::cast<cl_command_queue>(hQueue));
+  cl_int RetErr = clFinish(hQueue->CLQueue);
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueRetain(ur_queue_handle_t hQueue) {
-  cl_int RetErr =
-      clRetainCommandQueue(cl_adapter::cast<cl_command_queue>(hQueue));
+  cl_int RetErr = clRetainCommandQueue(hQueue->CLQueue);
   CL_RETURN_ON_FAILURE(RetErr);
+  adoptQueue(hQueue);
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
-  cl_int RetErr =
-      clReleaseCommandQueue(cl_adapter::cast<cl_command_queue>(hQueue));
+  if (--hQueue->RefCount > 0) {
+    CL_RETURN_ON_FAILURE(clReleaseCommandQueue(hQueue->CLQueue));
+    return UR_RESULT_SUCCESS;
+  }
+
+  ur_context_handle_t hContext = hQueue->Context;
+  if (hContext->retireQueue(hQueue)) {
+    cl_int RetErr = clReleaseCommandQueue(hQueue->CLQueue);
+    // Freeing the context frees the handle too
+    urContextRelease(hContext);
+    CL_RETURN_ON_FAILURE(RetErr);
+    return UR_RESULT_SUCCESS;
+  }
+
+  ur::cl::getAdapter()->Queues.erase(hQueue->CLQueue, hQueue);
+  cl_int RetErr = clReleaseCommandQueue(hQueue->CLQueue);
+  delete hQueue;
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
@@ -0,0 +1,54 @@
+//===--------- queue.hpp - OpenCL Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common.hpp"
+#include "context.hpp"
+#include "device.hpp"
+
+#include <atomic>
+
+/// Handle to an OpenCL command-queue, keeping the context and device it was
+/// created for alive.
+///
+/// Events keep the OpenCL command-queue alive and can be asked for it, so
+/// once the last reference is released while OpenCL still holds the
+/// command-queue, the handle stays registered until its context is freed.
+/// It gives up its reference to the context in the meantime.
+struct ur_queue_handle_t_ {
+  using native_type = cl_command_queue;
+
+  /// OpenCL command-queue object.
+  native_type CLQueue;
+  /// Context the queue was created for.
+  ur_context_handle_t Context;
+  /// Device the queue was created for.
+  ur_device_handle_t Device;
+  /// Object reference count.
+  std::atomic<uint32_t> RefCount = 1;
+  /// Whether the context keeps the handle, guarded by the context.
+  bool Retired = false;
+
+  ur_queue_handle_t_(native_type CLQueue, ur_context_handle_t Context,
+                     ur_device_handle_t Device)
+      : CLQueue(CLQueue), Context(Context), Device(Device) {
+    urContextRetain(Context);
+    urDeviceRetain(Device);
+  }
+
+  ~ur_queue_handle_t_();
+};
+
+namespace cl_adapter {
+/// Returns the handle of \p CLQueue, creating one if the command-queue was
+/// created outside of the adapter. The caller doesn't get a reference of its
+/// own to the handle.
+ur_result_t getQueue(cl_command_queue CLQueue, ur_queue_handle_t &hQueue);
+} // namespace cl_adapter
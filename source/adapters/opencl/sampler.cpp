@@ -8,7 +8,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "adapter.hpp"
 #include "common.hpp"
+#include "context.hpp"
 
 namespace {
 
@@ -144,9 +146,8 @@ ur_result_t urSamplerCreate(ur_context_handle_t hContext,
 
   // Always call OpenCL 1.0 API
   *phSampler = cl_adapter::cast<ur_sampler_handle_t>(clCreateSampler(
-      cl_adapter::cast<cl_context>(hContext),
-      static_cast<cl_bool>(pDesc->normalizedCoords), AddressingMode, FilterMode,
-      cl_adapter::cast<cl_int *>(&ErrorCode)));
+      hContext->CLContext, static_cast<cl_bool>(pDesc->normalizedCoords),
+      AddressingMode, FilterMode, cl_adapter::cast<cl_int *>(&ErrorCode)));
 
   return mapCLErrorToUR(ErrorCode);
 }
@@ -159,6 +160,16 @@ urSamplerGetInfo(ur_sampler_handle_t hSampler, ur_sampler_info_t propName,
                 sizeof(ur_sampler_addressing_mode_t));
 
   ur_result_t Err = UR_RESULT_SUCCESS;
+  if (propName == UR_SAMPLER_INFO_CONTEXT) {
+    UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+    cl_context CLContext;
+    CL_RETURN_ON_FAILURE(
+        clGetSamplerInfo(cl_adapter::cast<cl_sampler>(hSampler), SamplerInfo,
+                         sizeof(CLContext), &CLContext, nullptr));
+    ur_context_handle_t hContext = nullptr;
+    UR_RETURN_ON_FAILURE(cl_adapter::getContext(CLContext, hContext));
+    return ReturnValue(hContext);
+  }
   // ur_bool_t have a size of uint8_t, but cl_bool size have the size of
   // uint32_t so this adjust UR_SAMPLER_INFO_NORMALIZED_COORDS info to map
   // between them.
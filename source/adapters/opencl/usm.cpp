@@ -11,8 +11,15 @@
 #include <ur/ur.hpp>
 
 #include "common.hpp"
+#include "context.hpp"
+#include "device.hpp"
+#include "queue.hpp"
 #include "usm.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
 template <class T>
 void AllocDeleterCallback(cl_event event, cl_int, void *pUserData) {
   clReleaseEvent(event);
@@ -113,25 +120,17 @@ urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
         static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
   }
 
-  // First we need to look up the function pointer
-  clHostMemAllocINTEL_fn FuncPtr = nullptr;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
-  if (auto UrResult = cl_ext::getExtFuncFromContext<clHostMemAllocINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clHostMemAllocINTELCache,
-          cl_ext::HostMemAllocName, &FuncPtr)) {
-    return UrResult;
-  }
+  auto FuncPtr = hContext->ExtFuncs.clHostMemAllocINTEL;
+  UR_ASSERT(FuncPtr, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  if (FuncPtr) {
-    cl_int ClResult = CL_SUCCESS;
-    Ptr = FuncPtr(CLContext,
-                  AllocProperties.empty() ? nullptr : AllocProperties.data(),
-                  size, Alignment, &ClResult);
-    if (ClResult == CL_INVALID_BUFFER_SIZE) {
-      return UR_RESULT_ERROR_INVALID_USM_SIZE;
-    }
-    CL_RETURN_ON_FAILURE(ClResult);
+  cl_int ClResult = CL_SUCCESS;
+  Ptr = FuncPtr(hContext->CLContext,
+                AllocProperties.empty() ? nullptr : AllocProperties.data(),
+                size, Alignment, &ClResult);
+  if (ClResult == CL_INVALID_BUFFER_SIZE) {
+    return UR_RESULT_ERROR_INVALID_USM_SIZE;
   }
+  CL_RETURN_ON_FAILURE(ClResult);
 
   *ppMem = Ptr;
 
@@ -161,25 +160,17 @@ urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
         static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
   }
 
-  // First we need to look up the function pointer
-  clDeviceMemAllocINTEL_fn FuncPtr = nullptr;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
-  if (auto UrResult = cl_ext::getExtFuncFromContext<clDeviceMemAllocINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clDeviceMemAllocINTELCache,
-          cl_ext::DeviceMemAllocName, &FuncPtr)) {
-    return UrResult;
-  }
+  auto FuncPtr = hContext->ExtFuncs.clDeviceMemAllocINTEL;
+  UR_ASSERT(FuncPtr, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  if (FuncPtr) {
-    cl_int ClResult = CL_SUCCESS;
-    Ptr = FuncPtr(CLContext, cl_adapter::cast<cl_device_id>(hDevice),
-                  AllocProperties.empty() ? nullptr : AllocProperties.data(),
-                  size, Alignment, &ClResult);
-    if (ClResult == CL_INVALID_BUFFER_SIZE) {
-      return UR_RESULT_ERROR_INVALID_USM_SIZE;
-    }
-    CL_RETURN_ON_FAILURE(ClResult);
+  cl_int ClResult = CL_SUCCESS;
+  Ptr = FuncPtr(hContext->CLContext, hDevice->CLDevice,
+                AllocProperties.empty() ? nullptr : AllocProperties.data(),
+                size, Alignment, &ClResult);
+  if (ClResult == CL_INVALID_BUFFER_SIZE) {
+    return UR_RESULT_ERROR_INVALID_USM_SIZE;
   }
+  CL_RETURN_ON_FAILURE(ClResult);
 
   *ppMem = Ptr;
 
@@ -209,25 +200,17 @@ urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
         static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
   }
 
-  // First we need to look up the function pointer
-  clSharedMemAllocINTEL_fn FuncPtr = nullptr;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
-  if (auto UrResult = cl_ext::getExtFuncFromContext<clSharedMemAllocINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clSharedMemAllocINTELCache,
-          cl_ext::SharedMemAllocName, &FuncPtr)) {
-    return UrResult;
-  }
+  auto FuncPtr = hContext->ExtFuncs.clSharedMemAllocINTEL;
+  UR_ASSERT(FuncPtr, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  if (FuncPtr) {
-    cl_int ClResult = CL_SUCCESS;
-    Ptr = FuncPtr(CLContext, cl_adapter::cast<cl_device_id>(hDevice),
-                  AllocProperties.empty() ? nullptr : AllocProperties.data(),
-                  size, Alignment, cl_adapter::cast<cl_int *>(&ClResult));
-    if (ClResult == CL_INVALID_BUFFER_SIZE) {
-      return UR_RESULT_ERROR_INVALID_USM_SIZE;
-    }
-    CL_RETURN_ON_FAILURE(ClResult);
+  cl_int ClResult = CL_SUCCESS;
+  Ptr = FuncPtr(hContext->CLContext, hDevice->CLDevice,
+                AllocProperties.empty() ? nullptr : AllocProperties.data(),
+                size, Alignment, cl_adapter::cast<cl_int *>(&ClResult));
+  if (ClResult == CL_INVALID_BUFFER_SIZE) {
+    return UR_RESULT_ERROR_INVALID_USM_SIZE;
   }
+  CL_RETURN_ON_FAILURE(ClResult);
 
   *ppMem = Ptr;
 
@@ -242,106 +225,109 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
 
   // Use a blocking free to avoid issues with indirect access from kernels that
   // might be still running.
-  clMemBlockingFreeINTEL_fn FuncPtr = nullptr;
-
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
-  ur_result_t RetVal = UR_RESULT_ERROR_INVALID_OPERATION;
-  RetVal = cl_ext::getExtFuncFromContext<clMemBlockingFreeINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clMemBlockingFreeINTELCache,
-      cl_ext::MemBlockingFreeName, &FuncPtr);
-
-  if (FuncPtr) {
-    RetVal = mapCLErrorToUR(FuncPtr(CLContext, pMem));
-  }
+  auto FuncPtr = hContext->ExtFuncs.clMemBlockingFreeINTEL;
+  UR_ASSERT(FuncPtr, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-  return RetVal;
+  return mapCLErrorToUR(FuncPtr(hContext->CLContext, pMem));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
     const void *pPattern, size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  // Have to look up the context from the kernel
-  cl_context CLContext;
-  cl_int CLErr = clGetCommandQueueInfo(
-      cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_CONTEXT,
-      sizeof(cl_context), &CLContext, nullptr);
-  if (CLErr != CL_SUCCESS) {
-    return mapCLErrorToUR(CLErr);
-  }
+  const cl_ext::ExtFuncPtrTableT &ExtFuncs = hQueue->Context->ExtFuncs;
+  cl_context CLContext = hQueue->Context->CLContext;
 
   if (patternSize <= 128 && isPowerOf2(patternSize)) {
-    clEnqueueMemFillINTEL_fn EnqueueMemFill = nullptr;
-    UR_RETURN_ON_FAILURE(
-        cl_ext::getExtFuncFromContext<clEnqueueMemFillINTEL_fn>(
-            CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemFillINTELCache,
-            cl_ext::EnqueueMemFillName, &EnqueueMemFill));
+    auto EnqueueMemFill = ExtFuncs.clEnqueueMemFillINTEL;
+    UR_ASSERT(EnqueueMemFill, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
-    CL_RETURN_ON_FAILURE(
-        EnqueueMemFill(cl_adapter::cast<cl_command_queue>(hQueue), ptr,
-                       pPattern, patternSize, size, numEventsInWaitList,
-                       cl_adapter::cast<const cl_event *>(phEventWaitList),
-                       cl_adapter::cast<cl_event *>(phEvent)));
+    CL_RETURN_ON_FAILURE(EnqueueMemFill(
+        hQueue->CLQueue, ptr, pPattern, patternSize, size, numEventsInWaitList,
+        cl_adapter::cast<const cl_event *>(phEventWaitList),
+        cl_adapter::cast<cl_event *>(phEvent)));
     return UR_RESULT_SUCCESS;
   }
 
   // OpenCL only supports pattern sizes which are powers of 2 and are as large
-  // as the largest CL type (double16/long16 - 128 bytes), anything larger or
-  // not a power of 2, we need to do on the host side and copy it into the
-  // target allocation.
-  clHostMemAllocINTEL_fn HostMemAlloc = nullptr;
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clHostMemAllocINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clHostMemAllocINTELCache,
-      cl_ext::HostMemAllocName, &HostMemAlloc));
-
-  clEnqueueMemcpyINTEL_fn USMMemcpy = nullptr;
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clEnqueueMemcpyINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemcpyINTELCache,
-      cl_ext::EnqueueMemcpyName, &USMMemcpy));
-
-  clMemBlockingFreeINTEL_fn USMFree = nullptr;
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clMemBlockingFreeINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clMemBlockingFreeINTELCache,
-      cl_ext::MemBlockingFreeName, &USMFree));
+  // as the largest CL type (double16/long16 - 128 bytes). Anything else is
+  // filled by copying a chunk of repeated patterns from the host into the
+  // start of the allocation, then doubling the filled part with copies from
+  // itself, so that the temporary allocation doesn't grow with the fill. The
+  // chunk is a multiple of 128 bytes to keep the doubling copies aligned.
+  auto HostMemAlloc = ExtFuncs.clHostMemAllocINTEL;
+  auto USMMemcpy = ExtFuncs.clEnqueueMemcpyINTEL;
+  auto USMFree = ExtFuncs.clMemBlockingFreeINTEL;
+  UR_ASSERT(HostMemAlloc && USMMemcpy && USMFree,
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+  const size_t ChunkSize = std::min(size, std::lcm(patternSize, size_t{128}));
 
   cl_int ClErr = CL_SUCCESS;
-  auto HostBuffer =
-      static_cast<uint8_t *>(HostMemAlloc(CLContext, nullptr, size, 0, &ClErr));
+  auto Chunk = static_cast<uint8_t *>(
+      HostMemAlloc(CLContext, nullptr, ChunkSize, 0, &ClErr));
   CL_RETURN_ON_FAILURE(ClErr);
 
-  auto *End = HostBuffer + size;
-  for (auto *Iter = HostBuffer; Iter < End; Iter += patternSize) {
-    std::memcpy(Iter, pPattern, patternSize);
+  for (size_t Offset = 0; Offset < ChunkSize; Offset += patternSize) {
+    std::memcpy(Chunk + Offset, pPattern,
+                std::min(patternSize, ChunkSize - Offset));
   }
 
-  cl_event CopyEvent = nullptr;
-  CL_RETURN_ON_FAILURE(USMMemcpy(
-      cl_adapter::cast<cl_command_queue>(hQueue), false, ptr, HostBuffer, size,
-      numEventsInWaitList, cl_adapter::cast<const cl_event *>(phEventWaitList),
-      &CopyEvent));
+  cl_event ChunkEvent = nullptr;
+  ClErr = USMMemcpy(
+      hQueue->CLQueue, false, ptr, Chunk, ChunkSize, numEventsInWaitList,
+      cl_adapter::cast<const cl_event *>(phEventWaitList), &ChunkEvent);
+  if (ClErr != CL_SUCCESS) {
+    USMFree(CLContext, Chunk);
+    CL_RETURN_ON_FAILURE(ClErr);
+  }
 
-  if (phEvent) {
-    // Since we're releasing this in the callback above we need to retain it
-    // here to keep the user copy alive.
-    CL_RETURN_ON_FAILURE(clRetainEvent(CopyEvent));
-    *phEvent = cl_adapter::cast<ur_event_handle_t>(CopyEvent);
+  // The callback releases the event, keep a reference of our own to wait on
+  // it and possibly hand it out.
+  ClErr = clRetainEvent(ChunkEvent);
+  if (ClErr != CL_SUCCESS) {
+    // The free blocks until the copy out of the chunk is done
+    USMFree(CLContext, Chunk);
+    clReleaseEvent(ChunkEvent);
+    CL_RETURN_ON_FAILURE(ClErr);
   }
 
   // This self destructs taking the event and allocation with it.
-  auto Info = new AllocDeleterCallbackInfo(USMFree, CLContext, HostBuffer);
+  auto Info = new AllocDeleterCallbackInfo(USMFree, CLContext, Chunk);
 
   ClErr =
-      clSetEventCallback(CopyEvent, CL_COMPLETE,
+      clSetEventCallback(ChunkEvent, CL_COMPLETE,
                          AllocDeleterCallback<AllocDeleterCallbackInfo>, Info);
   if (ClErr != CL_SUCCESS) {
     // We can attempt to recover gracefully by attempting to wait for the copy
     // to finish and deleting the info struct here.
-    clWaitForEvents(1, &CopyEvent);
+    clWaitForEvents(1, &ChunkEvent);
     delete Info;
-    clReleaseEvent(CopyEvent);
+    clReleaseEvent(ChunkEvent);
+    clReleaseEvent(ChunkEvent);
     CL_RETURN_ON_FAILURE(ClErr);
   }
 
+  // Each copy has to wait for the previous one, as the queue may be out of
+  // order. The last one completing means the whole fill has.
+  auto Dst = static_cast<uint8_t *>(ptr);
+  cl_event LastEvent = ChunkEvent;
+  for (size_t Filled = ChunkSize; Filled < size; Filled *= 2) {
+    cl_event CopyEvent = nullptr;
+    ClErr =
+        USMMemcpy(hQueue->CLQueue, false, Dst + Filled, Dst,
+                  std::min(Filled, size - Filled), 1, &LastEvent, &CopyEvent);
+    clReleaseEvent(LastEvent);
+    CL_RETURN_ON_FAILURE(ClErr);
+    LastEvent = CopyEvent;
+  }
+
+  if (phEvent) {
+    *phEvent = cl_adapter::cast<ur_event_handle_t>(LastEvent);
+  } else {
+    CL_RETURN_ON_FAILURE(clReleaseEvent(LastEvent));
+  }
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -350,67 +336,48 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
-  // Have to look up the context from the kernel
-  cl_context CLContext;
-  cl_int CLErr = clGetCommandQueueInfo(
-      cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_CONTEXT,
-      sizeof(cl_context), &CLContext, nullptr);
-  if (CLErr != CL_SUCCESS) {
-    return mapCLErrorToUR(CLErr);
-  }
-
-  clGetMemAllocInfoINTEL_fn GetMemAllocInfo = nullptr;
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clGetMemAllocInfoINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clGetMemAllocInfoINTELCache,
-      cl_ext::GetMemAllocInfoName, &GetMemAllocInfo));
-
-  clEnqueueMemcpyINTEL_fn USMMemcpy = nullptr;
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clEnqueueMemcpyINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemcpyINTELCache,
-      cl_ext::EnqueueMemcpyName, &USMMemcpy));
-
-  clMemBlockingFreeINTEL_fn USMFree = nullptr;
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clMemBlockingFreeINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clMemBlockingFreeINTELCache,
-      cl_ext::MemBlockingFreeName, &USMFree));
+  const cl_ext::ExtFuncPtrTableT &ExtFuncs = hQueue->Context->ExtFuncs;
+  cl_context CLContext = hQueue->Context->CLContext;
+  auto USMMemcpy = ExtFuncs.clEnqueueMemcpyINTEL;
+  UR_ASSERT(USMMemcpy, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   // Check if the two allocations are DEVICE allocations from different
   // devices, if they are we need to do the copy indirectly via a host
-  // allocation.
+  // allocation. A context with a single device can't have any of those.
   cl_device_id SrcDevice = 0, DstDevice = 0;
-  CL_RETURN_ON_FAILURE(
-      GetMemAllocInfo(CLContext, pSrc, CL_MEM_ALLOC_DEVICE_INTEL,
-                      sizeof(cl_device_id), &SrcDevice, nullptr));
-  CL_RETURN_ON_FAILURE(
-      GetMemAllocInfo(CLContext, pDst, CL_MEM_ALLOC_DEVICE_INTEL,
-                      sizeof(cl_device_id), &DstDevice, nullptr));
+  if (hQueue->Context->Devices.size() > 1) {
+    auto GetMemAllocInfo = ExtFuncs.clGetMemAllocInfoINTEL;
+    UR_ASSERT(GetMemAllocInfo, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    CL_RETURN_ON_FAILURE(
+        GetMemAllocInfo(CLContext, pSrc, CL_MEM_ALLOC_DEVICE_INTEL,
+                        sizeof(cl_device_id), &SrcDevice, nullptr));
+    CL_RETURN_ON_FAILURE(
+        GetMemAllocInfo(CLContext, pDst, CL_MEM_ALLOC_DEVICE_INTEL,
+                        sizeof(cl_device_id), &DstDevice, nullptr));
+  }
 
   if ((SrcDevice && DstDevice) && SrcDevice != DstDevice) {
+    auto HostMemAlloc = ExtFuncs.clHostMemAllocINTEL;
+    auto USMFree = ExtFuncs.clMemBlockingFreeINTEL;
+    UR_ASSERT(HostMemAlloc && USMFree, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
     // We need a queue associated with each device, so first figure out which
     // one we weren't given.
-    cl_device_id QueueDevice = nullptr;
-    CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
-        cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_DEVICE,
-        sizeof(QueueDevice), &QueueDevice, nullptr));
-
+    cl_int CLErr = CL_SUCCESS;
     cl_command_queue MissingQueue = nullptr, SrcQueue = nullptr,
                      DstQueue = nullptr;
-    if (QueueDevice == SrcDevice) {
+    if (hQueue->Device->CLDevice == SrcDevice) {
       MissingQueue = clCreateCommandQueue(CLContext, DstDevice, 0, &CLErr);
-      SrcQueue = cl_adapter::cast<cl_command_queue>(hQueue);
+      SrcQueue = hQueue->CLQueue;
       DstQueue = MissingQueue;
     } else {
       MissingQueue = clCreateCommandQueue(CLContext, SrcDevice, 0, &CLErr);
-      DstQueue = cl_adapter::cast<cl_command_queue>(hQueue);
+      DstQueue = hQueue->CLQueue;
       SrcQueue = MissingQueue;
     }
     CL_RETURN_ON_FAILURE(CLErr);
 
     cl_event HostCopyEvent = nullptr, FinalCopyEvent = nullptr;
-    clHostMemAllocINTEL_fn HostMemAlloc = nullptr;
-    UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clHostMemAllocINTEL_fn>(
-        CLContext, cl_ext::ExtFuncPtrCache->clHostMemAllocINTELCache,
-        cl_ext::HostMemAllocName, &HostMemAlloc));
 
     auto HostAlloc = HostMemAlloc(CLContext, nullptr, size, 0, &CLErr);
     CL_RETURN_ON_FAILURE(CLErr);
@@ -476,11 +443,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
       }
     }
   } else {
-    CL_RETURN_ON_FAILURE(
-        USMMemcpy(cl_adapter::cast<cl_command_queue>(hQueue), blocking, pDst,
-                  pSrc, size, numEventsInWaitList,
-                  cl_adapter::cast<const cl_event *>(phEventWaitList),
-                  cl_adapter::cast<cl_event *>(phEvent)));
+    CL_RETURN_ON_FAILURE(USMMemcpy(
+        hQueue->CLQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
+        cl_adapter::cast<const cl_event *>(phEventWaitList),
+        cl_adapter::cast<cl_event *>(phEvent)));
   }
 
   return UR_RESULT_SUCCESS;
@@ -494,7 +460,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     ur_event_handle_t *phEvent) {
 
   return mapCLErrorToUR(clEnqueueMarkerWithWaitList(
-      cl_adapter::cast<cl_command_queue>(hQueue), numEventsInWaitList,
+      hQueue->CLQueue, numEventsInWaitList,
       cl_adapter::cast<const cl_event *>(phEventWaitList),
       cl_adapter::cast<cl_event *>(phEvent)));
 
@@ -533,8 +499,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMAdvise(
     ur_event_handle_t *phEvent) {
 
   return mapCLErrorToUR(clEnqueueMarkerWithWaitList(
-      cl_adapter::cast<cl_command_queue>(hQueue), 0, nullptr,
-      reinterpret_cast<cl_event *>(phEvent)));
+      hQueue->CLQueue, 0, nullptr, reinterpret_cast<cl_event *>(phEvent)));
 
   /*
   // Change to use this once drivers support it.
@@ -581,25 +546,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     const void *pSrc, size_t srcPitch, size_t width, size_t height,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  cl_context CLContext;
-  CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
-      cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_CONTEXT,
-      sizeof(cl_context), &CLContext, nullptr));
-
-  clEnqueueMemcpyINTEL_fn FuncPtr = nullptr;
-  ur_result_t RetVal = cl_ext::getExtFuncFromContext<clEnqueueMemcpyINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemcpyINTELCache,
-      cl_ext::EnqueueMemcpyName, &FuncPtr);
-
-  if (!FuncPtr) {
-    return RetVal;
-  }
+  auto FuncPtr = hQueue->Context->ExtFuncs.clEnqueueMemcpyINTEL;
+  UR_ASSERT(FuncPtr, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   std::vector<cl_event> Events(height);
   for (size_t HeightIndex = 0; HeightIndex < height; HeightIndex++) {
     cl_event Event = nullptr;
     auto ClResult =
-        FuncPtr(cl_adapter::cast<cl_command_queue>(hQueue), false,
+        FuncPtr(hQueue->CLQueue, false,
                 static_cast<uint8_t *>(pDst) + dstPitch * HeightIndex,
                 static_cast<const uint8_t *>(pSrc) + srcPitch * HeightIndex,
                 width, numEventsInWaitList,
@@ -618,8 +572,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
   }
   if (phEvent && ClResult == CL_SUCCESS) {
     ClResult = clEnqueueBarrierWithWaitList(
-        cl_adapter::cast<cl_command_queue>(hQueue), Events.size(),
-        Events.data(), cl_adapter::cast<cl_event *>(phEvent));
+        hQueue->CLQueue, Events.size(), Events.data(),
+        cl_adapter::cast<cl_event *>(phEvent));
   }
   for (const auto &E : Events) {
     CL_RETURN_ON_FAILURE(clReleaseEvent(E));
@@ -648,11 +602,8 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
                      ur_usm_alloc_info_t propName, size_t propSize,
                      void *pPropValue, size_t *pPropSizeRet) {
 
-  clGetMemAllocInfoINTEL_fn GetMemAllocInfo = nullptr;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clGetMemAllocInfoINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clGetMemAllocInfoINTELCache,
-      cl_ext::GetMemAllocInfoName, &GetMemAllocInfo));
+  auto GetMemAllocInfo = hContext->ExtFuncs.clGetMemAllocInfoINTEL;
+  UR_ASSERT(GetMemAllocInfo, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   cl_mem_info_intel PropNameCL;
   switch (propName) {
@@ -673,9 +624,8 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
   }
 
   size_t CheckPropSize = 0;
-  cl_int ClErr =
-      GetMemAllocInfo(cl_adapter::cast<cl_context>(hContext), pMem, PropNameCL,
-                      propSize, pPropValue, &CheckPropSize);
+  cl_int ClErr = GetMemAllocInfo(hContext->CLContext, pMem, PropNameCL,
+                                 propSize, pPropValue, &CheckPropSize);
   if (pPropValue && CheckPropSize != propSize) {
     return UR_RESULT_ERROR_INVALID_SIZE;
   }
@@ -689,6 +639,15 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
         *static_cast<cl_unified_shared_memory_type_intel *>(pPropValue));
   }
 
+  // Allocations that aren't tied to a device report a null device
+  if (pPropValue && propName == UR_USM_ALLOC_INFO_DEVICE &&
+      *static_cast<cl_device_id *>(pPropValue)) {
+    ur_device_handle_t Device = nullptr;
+    UR_RETURN_ON_FAILURE(cl_adapter::getDevice(
+        *static_cast<cl_device_id *>(pPropValue), Device));
+    *static_cast<ur_device_handle_t *>(pPropValue) = Device;
+  }
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -0,0 +1,216 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_FORMAT_HPP
+#define UR_FORMAT_HPP 1
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Format strings of log sites are checked during compilation where the
+// language allows enforcing it. Otherwise, they are only parsed once a message
+// is known to be written.
+#if defined(__cpp_consteval)
+#define UR_LOGGER_CONSTEVAL consteval
+#else
+#define UR_LOGGER_CONSTEVAL constexpr
+#endif
+
+namespace logger {
+
+namespace detail {
+
+template <typename T> struct type_identity {
+  using type = T;
+};
+
+template <typename T> using type_identity_t = typename type_identity<T>::type;
+
+/// Deliberately not constexpr, so that reaching it while parsing a format
+/// string during compilation makes the log site ill-formed. At runtime, the
+/// format string is left to the sink to report on.
+inline void formatStringError(const char *) {}
+
+} // namespace detail
+
+/// A format string split into literal text and `{}` placeholders, so that
+/// sinks only have to copy the literal text in between the arguments.
+///
+/// Escaped braces `{{` and `}}` stand for a single brace of the literal text.
+/// Unescaped braces other than `{}` and a number of placeholders that doesn't
+/// match NumArgs are errors, which make a constant evaluation ill-formed. At
+/// runtime, the result isn't parsed instead, as is a format string with too
+/// many escaped braces to split.
+template <size_t NumArgs> class ParsedFormat {
+public:
+  struct Piece {
+    uint32_t offset;
+    uint32_t length;
+    bool is_arg;
+  };
+
+  /// Not parsed, for format strings only known at runtime
+  constexpr ParsedFormat() = default;
+
+  constexpr ParsedFormat(const char *fmt, size_t len) { parse(fmt, len); }
+
+  constexpr bool isParsed() const { return parsed; }
+
+  constexpr size_t size() const { return num_pieces; }
+
+  constexpr const Piece &operator[](size_t i) const { return pieces[i]; }
+
+private:
+  // Every argument, the literal text around them and a few escaped braces
+  static constexpr size_t max_pieces = 2 * NumArgs + 5;
+
+  Piece pieces[max_pieces] = {};
+  size_t num_pieces = 0;
+  bool parsed = false;
+
+  constexpr bool addPiece(size_t offset, size_t length, bool is_arg) {
+    if (length == 0 && !is_arg) {
+      return true;
+    }
+    if (num_pieces == max_pieces) {
+      return false;
+    }
+    pieces[num_pieces++] = Piece{static_cast<uint32_t>(offset),
+                                 static_cast<uint32_t>(length), is_arg};
+    return true;
+  }
+
+  constexpr void parse(const char *fmt, size_t len) {
+    size_t num_args = 0;
+    size_t begin = 0;
+    size_t i = 0;
+    while (i < len && fmt[i] != '\0') {
+      char c = fmt[i];
+      if (c != '{' && c != '}') {
+        i++;
+        continue;
+      }
+
+      char next = i + 1 < len ? fmt[i + 1] : '\0';
+      if (next == c) {
+        // Keep one of the escaped braces as part of the literal text
+        if (!addPiece(begin, i + 1 - begin, false)) {
+          return;
+        }
+      } else if (c == '{' && next == '}') {
+        if (!addPiece(begin, i - begin, false) || !addPiece(i, 0, true)) {
+          return;
+        }
+        num_args++;
+      } else {
+        detail::formatStringError(c == '{' ? "Only empty braces are allowed!"
+                                           : "Closing curly brace not "
+                                             "escaped!");
+        return;
+      }
+      i += 2;
+      begin = i;
+    }
+
+    if (!addPiece(begin, i - begin, false)) {
+      return;
+    }
+    if (num_args != NumArgs) {
+      detail::formatStringError(num_args < NumArgs ? "Too many arguments!"
+                                                   : "Not enough arguments!");
+      return;
+    }
+    parsed = true;
+  }
+};
+
+namespace detail {
+
+/// Parsed format strings of recent log sites with NumArgs arguments, by the
+/// address of their string literal, which stays the same for a log site.
+/// Every thread has its own, so that looking one up needs no synchronization.
+/// The result is a copy, the entry may be taken over by a message logged while
+/// formatting this one.
+template <size_t NumArgs>
+ParsedFormat<NumArgs> parseCached(const char *fmt, size_t len) {
+  struct Entry {
+    const char *fmt = nullptr;
+    ParsedFormat<NumArgs> parsed;
+  };
+  static constexpr size_t num_entries = 16;
+  static thread_local Entry entries[num_entries];
+  auto &entry = entries[reinterpret_cast<uintptr_t>(fmt) % num_entries];
+  if (entry.fmt != fmt) {
+    entry.parsed = ParsedFormat<NumArgs>(fmt, len);
+    entry.fmt = fmt;
+  }
+  return entry.parsed;
+}
+
+} // namespace detail
+
+/// Format string of a log message with arguments of types Args.
+///
+/// Constructing one is cheap, as log sites construct it whether or not the
+/// message is written. Format strings created from a string literal are
+/// checked against Args when compiling with consteval support, and are split
+/// by parse() once the message is written, which parsed() only does the first
+/// time a thread writes a message of the log site. Format strings only known
+/// at runtime are parsed by the sink as before.
+template <typename... Args> class FormatString {
+public:
+  template <size_t N>
+  UR_LOGGER_CONSTEVAL FormatString(const char (&fmt)[N])
+      : fmt(fmt), len(N - 1) {
+#if defined(__cpp_consteval)
+    (void)ParsedFormat<sizeof...(Args)>(fmt, len);
+#endif
+  }
+
+  template <size_t N> FormatString(char (&fmt)[N]) : fmt(fmt) {}
+
+  template <typename T,
+            typename = std::enable_if_t<std::is_same_v<T, const char *> ||
+                                        std::is_same_v<T, char *>>>
+  FormatString(T fmt) : fmt(fmt) {}
+
+  constexpr const char *str() const { return fmt; }
+
+  /// Whether fmt outlives the log site, which holds for string literals. With
+  /// consteval, the constructor enforces a constant of static storage, before
+  /// that any constant array of characters is taken to be one.
+  constexpr bool isLiteral() const { return len != runtime_len; }
+
+  constexpr ParsedFormat<sizeof...(Args)> parse() const {
+    if (!isLiteral()) {
+      return {};
+    }
+    return {fmt, len};
+  }
+
+  ParsedFormat<sizeof...(Args)> parsed() const {
+    if (!isLiteral()) {
+      return {};
+    }
+    return detail::parseCached<sizeof...(Args)>(fmt, len);
+  }
+
+private:
+  static constexpr size_t runtime_len = ~size_t{0};
+
+  const char *fmt;
+  size_t len = runtime_len;
+};
+
+/// Format string of a log site, taking part in deducing Args only through
+/// the arguments themselves
+template <typename... Args>
+using format_string_t = FormatString<detail::type_identity_t<Args>...>;
+
+} // namespace logger
+
+#endif /* UR_FORMAT_HPP */
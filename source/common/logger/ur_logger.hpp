@@ -30,27 +30,27 @@ get_logger(std::string name = "common",
 inline void init(const std::string &name) { get_logger(name.c_str()); }
 
 template <typename... Args>
-inline void debug(const char *format, Args &&...args) {
+inline void debug(format_string_t<Args...> format, Args &&...args) {
   get_logger().log(logger::Level::DEBUG, format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void info(const char *format, Args &&...args) {
+inline void info(format_string_t<Args...> format, Args &&...args) {
   get_logger().log(logger::Level::INFO, format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void warning(const char *format, Args &&...args) {
+inline void warning(format_string_t<Args...> format, Args &&...args) {
   get_logger().log(logger::Level::WARN, format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void error(const char *format, Args &&...args) {
+inline void error(format_string_t<Args...> format, Args &&...args) {
   get_logger().log(logger::Level::ERR, format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void always(const char *format, Args &&...args) {
+inline void always(format_string_t<Args...> format, Args &&...args) {
   get_logger().always(format, std::forward<Args>(args)...);
 }
 
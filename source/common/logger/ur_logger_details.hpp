@@ -7,13 +7,14 @@
 #ifndef UR_LOGGER_DETAILS_HPP
 #define UR_LOGGER_DETAILS_HPP 1
 
+#include "ur_format.hpp"
 #include "ur_level.hpp"
 #include "ur_sinks.hpp"
 
 namespace logger {
 
 struct LegacyMessage {
-  LegacyMessage(const char *p) : message(p) {};
+  explicit LegacyMessage(const char *p) : message(p) {};
   const char *message;
 };
 
@@ -39,27 +40,33 @@ public:
     }
   }
 
-  template <typename... Args> void debug(const char *format, Args &&...args) {
+  template <typename... Args>
+  void debug(format_string_t<Args...> format, Args &&...args) {
     log(logger::Level::DEBUG, format, std::forward<Args>(args)...);
   }
 
-  template <typename... Args> void info(const char *format, Args &&...args) {
+  template <typename... Args>
+  void info(format_string_t<Args...> format, Args &&...args) {
     log(logger::Level::INFO, format, std::forward<Args>(args)...);
   }
 
-  template <typename... Args> void warning(const char *format, Args &&...args) {
+  template <typename... Args>
+  void warning(format_string_t<Args...> format, Args &&...args) {
     log(logger::Level::WARN, format, std::forward<Args>(args)...);
   }
 
-  template <typename... Args> void warn(const char *format, Args &&...args) {
+  template <typename... Args>
+  void warn(format_string_t<Args...> format, Args &&...args) {
     warning(format, std::forward<Args>(args)...);
   }
 
-  template <typename... Args> void error(const char *format, Args &&...args) {
+  template <typename... Args>
+  void error(format_string_t<Args...> format, Args &&...args) {
     log(logger::Level::ERR, format, std::forward<Args>(args)...);
   }
 
-  template <typename... Args> void always(const char *format, Args &&...args) {
+  template <typename... Args>
+  void always(format_string_t<Args...> format, Args &&...args) {
     if (sink) {
       sink->log(logger::Level::QUIET, format, std::forward<Args>(args)...);
     }
@@ -90,9 +97,21 @@ public:
   }
 
   template <typename... Args>
-  void log(logger::Level level, const char *format, Args &&...args) {
-    log(logger::LegacyMessage(format), level, format,
-        std::forward<Args>(args)...);
+  void log(logger::Level level, format_string_t<Args...> format,
+           Args &&...args) {
+    if (!sink) {
+      return;
+    }
+
+    if (isLegacySink) {
+      sink->log(level, format.str(), std::forward<Args>(args)...);
+      return;
+    }
+    if (level < this->level) {
+      return;
+    }
+
+    sink->log(level, format, std::forward<Args>(args)...);
   }
 
   template <typename... Args>
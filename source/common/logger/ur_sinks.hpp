@@ -7,12 +7,23 @@
 #ifndef UR_SINKS_HPP
 #define UR_SINKS_HPP 1
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <mutex>
+#include <new>
 #include <sstream>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include "ur_filesystem_resolved.hpp"
+#include "ur_format.hpp"
 #include "ur_level.hpp"
 #include "ur_print.hpp"
 
@@ -22,32 +33,201 @@ namespace logger {
 inline bool isTearDowned = false;
 #endif
 
+class Sink;
+
+namespace detail {
+
+/// A message waiting to be written by a sink's background thread. Its
+/// arguments are stored in place and only formatted by that thread, unless
+/// they or the format string might not be valid anymore by then, in which
+/// case the producer formats the whole message up front.
+struct LogRecord {
+  static constexpr size_t max_args_size = 64;
+
+  uint64_t seq;
+  logger::Level level;
+  // String literal of the log site, only set if args are in use
+  const char *fmt;
+  // Formatted message, owned by the record, if args are not in use
+  std::string *message;
+  void (*format_args)(Sink &sink, std::ostringstream &buffer,
+                      LogRecord &record);
+  alignas(std::max_align_t) unsigned char args[max_args_size];
+};
+
+/// Only values that can't dangle are formatted later, pointers are limited to
+/// void pointers, which are printed as addresses.
+template <typename T> constexpr bool isDeferrable() {
+  using D = std::decay_t<T>;
+  return std::is_arithmetic_v<D> || std::is_enum_v<D> ||
+         std::is_same_v<D, void *> || std::is_same_v<D, const void *>;
+}
+
+/// Single producer, single consumer ring of log records. Every thread logging
+/// to an asynchronous sink owns one of them.
+class LogRing {
+public:
+  explicit LogRing(size_t capacity) : records(capacity) {}
+
+  LogRecord *reserve() {
+    auto t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) == records.size()) {
+      return nullptr;
+    }
+    return &records[t % records.size()];
+  }
+
+  void commit() {
+    tail.store(tail.load(std::memory_order_relaxed) + 1,
+               std::memory_order_release);
+  }
+
+  LogRecord *peek() {
+    auto h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &records[h % records.size()];
+  }
+
+  void pop() {
+    head.store(head.load(std::memory_order_relaxed) + 1,
+               std::memory_order_release);
+  }
+
+  bool isHalfFull() const {
+    return tail.load(std::memory_order_relaxed) -
+               head.load(std::memory_order_relaxed) >
+           records.size() / 2;
+  }
+
+  std::atomic<uint64_t> dropped{0};
+
+private:
+  alignas(64) std::atomic<uint64_t> head{0};
+  alignas(64) std::atomic<uint64_t> tail{0};
+  std::vector<LogRecord> records;
+};
+
+/// Per-thread rings of a sink, together with what is needed to hand records
+/// over to its background thread.
+class LogQueue {
+public:
+  explicit LogQueue(size_t ring_capacity)
+      : ring_capacity(ring_capacity), id(nextId()) {}
+
+  LogRing &getRing() {
+    struct ThreadRing {
+      uint64_t queue_id;
+      LogRing *ring;
+    };
+    static thread_local std::vector<ThreadRing> thread_rings;
+    for (auto &thread_ring : thread_rings) {
+      if (thread_ring.queue_id == id) {
+        return *thread_ring.ring;
+      }
+    }
+
+    // Rings outlive their thread, so messages of short lived threads still
+    // get written
+    std::scoped_lock<std::mutex> lock(rings_mutex);
+    auto &ring = rings.emplace_back(std::make_unique<LogRing>(ring_capacity));
+    thread_rings.push_back({id, ring.get()});
+    return *ring;
+  }
+
+  std::vector<LogRing *> getRings() {
+    std::vector<LogRing *> result;
+    std::scoped_lock<std::mutex> lock(rings_mutex);
+    for (auto &ring : rings) {
+      result.push_back(ring.get());
+    }
+    return result;
+  }
+
+  void wake(bool reliable) {
+    if (reliable) {
+      std::scoped_lock<std::mutex> lock(wake_mutex);
+      wake_requested = true;
+    } else {
+      wake_requested.store(true, std::memory_order_relaxed);
+    }
+    wake_cv.notify_one();
+  }
+
+  /// Blocks until the record with the given sequence number is written
+  void waitWritten(uint64_t seq) {
+    std::unique_lock<std::mutex> lock(written_mutex);
+    written_cv.wait(lock, [&]() { return written_seq.load() > seq; });
+  }
+
+  void setWritten(uint64_t seq) {
+    {
+      std::scoped_lock<std::mutex> lock(written_mutex);
+      written_seq.store(seq);
+    }
+    written_cv.notify_all();
+  }
+
+  std::atomic<uint64_t> seq{0};
+
+  std::mutex wake_mutex;
+  std::condition_variable wake_cv;
+  std::atomic<bool> wake_requested{false};
+  bool stop = false;
+
+private:
+  static uint64_t nextId() {
+    static std::atomic<uint64_t> id{0};
+    return id++;
+  }
+
+  size_t ring_capacity;
+  uint64_t id;
+
+  std::mutex rings_mutex;
+  std::vector<std::unique_ptr<LogRing>> rings;
+
+  std::mutex written_mutex;
+  std::condition_variable written_cv;
+  std::atomic<uint64_t> written_seq{0};
+};
+
+} // namespace detail
+
 class Sink {
 public:
   template <typename... Args>
   void log(logger::Level level, const char *fmt, Args &&...args) {
-    std::ostringstream buffer;
-    if (!skip_prefix && level != logger::Level::QUIET) {
-      buffer << "<" << logger_name << ">"
-             << "[" << level_to_str(level) << "]: ";
+    if (queue) {
+      enqueue(level, fmt, /*literal_fmt*/ false, std::forward<Args>(args)...);
+      return;
     }
 
-    format(buffer, fmt, std::forward<Args &&>(args)...);
-// This is a temporary workaround on windows, where UR adapter is teardowned
-// before the UR loader, which will result in access violation when we use print
-// function as the overrided print function was already released with the UR
-// adapter.
-// TODO: Change adapters to use a common sink class in the loader instead of
-// using thier own sink class that inherit from logger::Sink.
-#if defined(_WIN32)
-    if (isTearDowned) {
-      std::cerr << buffer.str() << "\n";
-    } else {
-      print(level, buffer.str());
+    std::ostringstream buffer;
+    formatMessage(buffer, level, fmt, std::forward<Args>(args)...);
+    output(level, buffer);
+  }
+
+  template <typename... FmtArgs, typename... Args>
+  void log(logger::Level level, const FormatString<FmtArgs...> &fmt,
+           Args &&...args) {
+    static_assert(sizeof...(FmtArgs) == sizeof...(Args));
+    // Records of asynchronous sinks keep referring to the plain format string
+    if (queue) {
+      enqueue(level, fmt.str(), fmt.isLiteral(), std::forward<Args>(args)...);
+      return;
     }
-#else
-    print(level, buffer.str());
-#endif
+    auto parsed = fmt.parsed();
+    if (!parsed.isParsed()) {
+      log(level, fmt.str(), std::forward<Args>(args)...);
+      return;
+    }
+
+    std::ostringstream buffer;
+    formatPrefix(buffer, level);
+    formatParsed(buffer, fmt.str(), parsed, std::forward<Args>(args)...);
+    output(level, buffer);
   }
 
   void setFlushLevel(logger::Level level) { this->flush_level = level; }
@@ -58,6 +238,9 @@ protected:
   std::ostream *ostream;
   logger::Level flush_level;
 
+  // Set by sinks writing from a background thread, see AsyncFileSink
+  detail::LogQueue *queue = nullptr;
+
   Sink(std::string logger_name, bool skip_prefix = false,
        bool skip_linebreak = false)
       : logger_name(std::move(logger_name)), skip_prefix(skip_prefix),
@@ -74,6 +257,16 @@ protected:
     }
   }
 
+  static void formatRecord(Sink &sink, std::ostringstream &buffer,
+                           detail::LogRecord &record) {
+    if (record.message) {
+      buffer << *record.message;
+      delete record.message;
+    } else {
+      record.format_args(sink, buffer, record);
+    }
+  }
+
 private:
   std::string logger_name;
   bool skip_prefix;
@@ -81,6 +274,125 @@ private:
   std::mutex output_mutex;
   const char *error_prefix = "Log message syntax error: ";
 
+  void output(logger::Level level, const std::ostringstream &buffer) {
+// This is a temporary workaround on windows, where UR adapter is teardowned
+// before the UR loader, which will result in access violation when we use print
+// function as the overrided print function was already released with the UR
+// adapter.
+// TODO: Change adapters to use a common sink class in the loader instead of
+// using thier own sink class that inherit from logger::Sink.
+#if defined(_WIN32)
+    if (isTearDowned) {
+      std::cerr << buffer.str() << "\n";
+    } else {
+      print(level, buffer.str());
+    }
+#else
+    print(level, buffer.str());
+#endif
+  }
+
+  void formatPrefix(std::ostringstream &buffer, logger::Level level) {
+    if (!skip_prefix && level != logger::Level::QUIET) {
+      buffer << "<" << logger_name << ">"
+             << "[" << level_to_str(level) << "]: ";
+    }
+  }
+
+  template <typename... Args>
+  void formatMessage(std::ostringstream &buffer, logger::Level level,
+                     const char *fmt, Args &&...args) {
+    formatPrefix(buffer, level);
+    format(buffer, fmt, std::forward<Args &&>(args)...);
+  }
+
+  /// Writes the literal text of fmt, with the arguments in place of its
+  /// placeholders, which is all that's left to do for a parsed format string
+  template <size_t NumArgs, typename... Args>
+  void formatParsed(std::ostringstream &buffer, const char *fmt,
+                    const ParsedFormat<NumArgs> &parsed, Args &&...args) {
+    size_t i = 0;
+    auto writeLiterals = [&]() {
+      for (; i < parsed.size() && !parsed[i].is_arg; i++) {
+        buffer.write(fmt + parsed[i].offset, parsed[i].length);
+      }
+    };
+
+    writeLiterals();
+    (((void)(buffer << args), i++, writeLiterals()), ...);
+    if (!skip_linebreak) {
+      buffer << "\n";
+    }
+  }
+
+  template <typename... Args>
+  static void formatDeferred(Sink &sink, std::ostringstream &buffer,
+                             detail::LogRecord &record) {
+    auto &args =
+        *std::launder(reinterpret_cast<std::tuple<Args...> *>(record.args));
+    std::apply(
+        [&](auto &...arg) {
+          sink.formatMessage(buffer, record.level, record.fmt, arg...);
+        },
+        args);
+  }
+
+  /// Only a string literal may be referred to by the record, any other format
+  /// string could be gone by the time it is written.
+  template <typename... Args>
+  void enqueue(logger::Level level, const char *fmt, bool literal_fmt,
+               Args &&...args) {
+    auto &ring = queue->getRing();
+    bool flush = level >= flush_level;
+    auto *record = ring.reserve();
+    while (!record) {
+      if (!flush) {
+        // Logging mustn't stall the application, messages below the flush
+        // level are dropped instead
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      queue->wake(true);
+      std::this_thread::yield();
+      record = ring.reserve();
+    }
+
+    record->level = level;
+    using ArgsTuple = std::tuple<std::decay_t<Args>...>;
+    bool deferred = false;
+    // Messages without arguments are formatted right away, there is nothing
+    // to gain from deferring them
+    if constexpr (sizeof...(Args) > 0 &&
+                  (detail::isDeferrable<Args>() && ...) &&
+                  sizeof(ArgsTuple) <= detail::LogRecord::max_args_size &&
+                  alignof(ArgsTuple) <= alignof(std::max_align_t)) {
+      static_assert(std::is_trivially_destructible_v<ArgsTuple>);
+      if (literal_fmt) {
+        new (record->args) ArgsTuple(std::forward<Args>(args)...);
+        record->fmt = fmt;
+        record->message = nullptr;
+        record->format_args = &Sink::formatDeferred<std::decay_t<Args>...>;
+        deferred = true;
+      }
+    }
+    if (!deferred) {
+      std::ostringstream buffer;
+      formatMessage(buffer, level, fmt, std::forward<Args>(args)...);
+      record->fmt = nullptr;
+      record->message = new std::string(buffer.str());
+      record->format_args = nullptr;
+    }
+    auto seq = record->seq = queue->seq.fetch_add(1);
+    ring.commit();
+
+    if (flush) {
+      queue->wake(true);
+      queue->waitWritten(seq);
+    } else if (ring.isHalfFull()) {
+      queue->wake(false);
+    }
+  }
+
   void format(std::ostringstream &buffer, const char *fmt) {
     while (*fmt != '\0') {
       while (*fmt != '{' && *fmt != '}' && *fmt != '\0') {
@@ -211,6 +523,110 @@ private:
   std::ofstream ofstream;
 };
 
+/// File sink writing from a background thread. Threads logging to it only
+/// store the message arguments in a ring of their own, formatting and writing
+/// is done in batches by the background thread, in the order the messages
+/// were logged. When a ring is full, further messages below the flush level
+/// are dropped and a note about it is written instead. Messages at the flush
+/// level wait until they are written and flushed.
+class AsyncFileSink : public FileSink {
+public:
+  AsyncFileSink(std::string logger_name, filesystem::path file_path,
+                bool skip_prefix = false, bool skip_linebreak = false,
+                size_t ring_capacity = 1024)
+      : FileSink(logger_name, std::move(file_path), skip_prefix,
+                 skip_linebreak),
+        drop_prefix("<" + logger_name + ">[WARNING]: "),
+        log_queue(ring_capacity) {
+    this->queue = &log_queue;
+    writer = std::thread([this]() { run(); });
+  }
+
+  ~AsyncFileSink() {
+    {
+      std::scoped_lock<std::mutex> lock(log_queue.wake_mutex);
+      log_queue.stop = true;
+    }
+    log_queue.wake_cv.notify_one();
+    writer.join();
+  }
+
+private:
+  static constexpr auto write_interval = std::chrono::milliseconds(10);
+
+  std::string drop_prefix;
+  detail::LogQueue log_queue;
+  uint64_t next_seq = 0;
+  uint64_t reported_drops = 0;
+  std::thread writer;
+
+  void run() {
+    std::unique_lock<std::mutex> lock(log_queue.wake_mutex);
+    while (!log_queue.stop) {
+      log_queue.wake_cv.wait_for(lock, write_interval, [this]() {
+        return log_queue.stop || log_queue.wake_requested.load();
+      });
+      log_queue.wake_requested = false;
+      lock.unlock();
+      write(/*force*/ false);
+      lock.lock();
+    }
+    lock.unlock();
+    write(/*force*/ true);
+  }
+
+  /// Writes records in the order of their sequence numbers, as far as they
+  /// are available. A missing number belongs to a record that is still being
+  /// stored, unless force is set, when all that's there is written.
+  void write(bool force) {
+    auto rings = log_queue.getRings();
+    std::string batch;
+    bool flush = false;
+    uint64_t dropped = 0;
+    while (true) {
+      detail::LogRing *next = nullptr;
+      uint64_t min_seq = std::numeric_limits<uint64_t>::max();
+      for (auto *ring : rings) {
+        auto *record = ring->peek();
+        if (record && record->seq < min_seq) {
+          min_seq = record->seq;
+          next = ring;
+        }
+      }
+      if (!next || (min_seq != next_seq && !force)) {
+        break;
+      }
+
+      auto *record = next->peek();
+      std::ostringstream buffer;
+      formatRecord(*this, buffer, *record);
+      batch += buffer.str();
+      flush |= record->level >= flush_level;
+      next_seq = min_seq + 1;
+      next->pop();
+    }
+
+    for (auto *ring : rings) {
+      dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    if (dropped != reported_drops) {
+      batch += drop_prefix + std::to_string(dropped - reported_drops) +
+               " log messages dropped, the log buffer was full\n";
+      reported_drops = dropped;
+    }
+
+    if (!batch.empty()) {
+      *ostream << batch;
+      if (flush) {
+        ostream->flush();
+      }
+    }
+    if (flush) {
+      log_queue.setWritten(next_seq);
+    }
+  }
+};
+
 inline std::unique_ptr<Sink> sink_from_str(std::string logger_name,
                                            std::string name,
                                            filesystem::path file_path = "",
@@ -225,12 +641,15 @@ inline std::unique_ptr<Sink> sink_from_str(std::string logger_name,
   } else if (name == "file" && !file_path.empty()) {
     return std::make_unique<logger::FileSink>(logger_name, file_path,
                                               skip_prefix, skip_linebreak);
+  } else if (name == "async_file" && !file_path.empty()) {
+    return std::make_unique<logger::AsyncFileSink>(logger_name, file_path,
+                                                   skip_prefix, skip_linebreak);
   }
 
   throw std::invalid_argument(
       std::string("Parsing error: no valid sink for string '") + name +
       std::string("' with path '") + file_path.string() + std::string("'.") +
-      std::string("\nValid sink names are: stdout, stderr, file"));
+      std::string("\nValid sink names are: stdout, stderr, file, async_file"));
 }
 
 } // namespace logger
@@ -24,7 +24,9 @@
 #include <umf/pools/pool_disjoint.h>
 #include <umf/pools/pool_proxy.h>
 
+#include <algorithm>
 #include <functional>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -58,6 +60,14 @@ struct pool_descriptor {
   ur_usm_type_t type;
   bool deviceReadOnly;
 
+  // Filled in by create(), so that hashing and comparing the descriptors it
+  // returns doesn't go through the adapter. Devices sharing a native handle
+  // (e.g. sub-devices) also share the ordinal.
+  std::optional<ur_native_handle_t> hNativeDevice;
+  uint32_t deviceOrdinal = 0;
+
+  ur_native_handle_t getNativeDevice() const;
+
   bool operator==(const pool_descriptor &other) const;
   friend std::ostream &operator<<(std::ostream &os,
                                   const pool_descriptor &desc);
@@ -164,12 +174,12 @@ isSharedAllocationReadOnlyOnDevice(const pool_descriptor &desc) {
   return desc.type == UR_USM_TYPE_SHARED && desc.deviceReadOnly;
 }
 
-inline bool pool_descriptor::operator==(const pool_descriptor &other) const {
+inline ur_native_handle_t pool_descriptor::getNativeDevice() const {
   static usm::detail::ddiTables ddi;
 
-  const pool_descriptor &lhs = *this;
-  const pool_descriptor &rhs = other;
-  ur_native_handle_t lhsNative = 0, rhsNative = 0;
+  if (hNativeDevice.has_value()) {
+    return *hNativeDevice;
+  }
 
   // We want to share a memory pool for sub-devices and sub-sub devices.
   // Sub-devices and sub-sub-devices might be represented by different
@@ -177,24 +187,43 @@ inline bool pool_descriptor::operator==(const pool_descriptor &other) const {
   // by UMF provider). Ref:
   // https://github.com/intel/llvm/commit/86511c5dc84b5781dcfd828caadcb5cac157eae1
   // TODO: is this L0 specific?
-  if (lhs.hDevice) {
-    auto ret = ddi.deviceDdiTable.pfnGetNativeHandle(lhs.hDevice, &lhsNative);
+  ur_native_handle_t native = 0;
+  if (hDevice) {
+    auto ret = ddi.deviceDdiTable.pfnGetNativeHandle(hDevice, &native);
     if (ret != UR_RESULT_SUCCESS) {
       throw ret;
     }
   }
+  return native;
+}
 
-  if (rhs.hDevice) {
-    auto ret = ddi.deviceDdiTable.pfnGetNativeHandle(rhs.hDevice, &rhsNative);
-    if (ret != UR_RESULT_SUCCESS) {
-      throw ret;
-    }
-  }
+inline bool pool_descriptor::operator==(const pool_descriptor &other) const {
+  const pool_descriptor &lhs = *this;
+  const pool_descriptor &rhs = other;
 
-  return lhsNative == rhsNative && lhs.type == rhs.type &&
+  return lhs.type == rhs.type &&
          (isSharedAllocationReadOnlyOnDevice(lhs) ==
           isSharedAllocationReadOnlyOnDevice(rhs)) &&
-         lhs.poolHandle == rhs.poolHandle;
+         lhs.poolHandle == rhs.poolHandle &&
+         lhs.getNativeDevice() == rhs.getNativeDevice();
+}
+
+/// @brief Dense index of a pool among the pools of a single pool handle, as
+/// laid out by pool_descriptor::create: the host pool first, then the device,
+/// shared and read-only shared pool of every device ordinal.
+inline std::optional<size_t> getPoolSlot(uint32_t deviceOrdinal,
+                                         ur_usm_type_t type,
+                                         bool deviceReadOnly) {
+  switch (type) {
+  case UR_USM_TYPE_HOST:
+    return 0;
+  case UR_USM_TYPE_DEVICE:
+    return 1 + size_t(deviceOrdinal) * 3;
+  case UR_USM_TYPE_SHARED:
+    return (deviceReadOnly ? 3 : 2) + size_t(deviceOrdinal) * 3;
+  default:
+    return std::nullopt;
+  }
 }
 
 inline std::ostream &operator<<(std::ostream &os, const pool_descriptor &desc) {
@@ -218,29 +247,36 @@ pool_descriptor::create(ur_usm_pool_handle_t poolHandle,
   desc.poolHandle = poolHandle;
   desc.hContext = hContext;
   desc.type = UR_USM_TYPE_HOST;
+  desc.hNativeDevice = 0;
 
+  std::vector<ur_native_handle_t> nativeDevices;
   for (auto &device : devices) {
+    pool_descriptor deviceDesc{};
+    deviceDesc.poolHandle = poolHandle;
+    deviceDesc.hContext = hContext;
+    deviceDesc.hDevice = device;
+    deviceDesc.hNativeDevice = deviceDesc.getNativeDevice();
+
+    auto it = std::find(nativeDevices.begin(), nativeDevices.end(),
+                        *deviceDesc.hNativeDevice);
+    deviceDesc.deviceOrdinal =
+        static_cast<uint32_t>(std::distance(nativeDevices.begin(), it));
+    if (it == nativeDevices.end()) {
+      nativeDevices.push_back(*deviceDesc.hNativeDevice);
+    }
+
     {
-      pool_descriptor &desc = descriptors.emplace_back();
-      desc.poolHandle = poolHandle;
-      desc.hContext = hContext;
-      desc.hDevice = device;
+      pool_descriptor &desc = descriptors.emplace_back(deviceDesc);
       desc.type = UR_USM_TYPE_DEVICE;
     }
     {
-      pool_descriptor &desc = descriptors.emplace_back();
-      desc.poolHandle = poolHandle;
-      desc.hContext = hContext;
+      pool_descriptor &desc = descriptors.emplace_back(deviceDesc);
       desc.type = UR_USM_TYPE_SHARED;
-      desc.hDevice = device;
       desc.deviceReadOnly = false;
     }
     {
-      pool_descriptor &desc = descriptors.emplace_back();
-      desc.poolHandle = poolHandle;
-      desc.hContext = hContext;
+      pool_descriptor &desc = descriptors.emplace_back(deviceDesc);
       desc.type = UR_USM_TYPE_SHARED;
-      desc.hDevice = device;
       desc.deviceReadOnly = true;
     }
   }
@@ -254,6 +290,62 @@ private:
 
   desc_to_pool_map_t descToPoolMap;
 
+  // Pools of descriptors returned by D::create, indexed by getPoolSlot, so
+  // that looking up the pool of an allocation doesn't need to hash its
+  // descriptor (which may have to query the adapter for the native device).
+  ur_usm_pool_handle_t slotPoolHandle = nullptr;
+  std::unordered_map<ur_device_handle_t, uint32_t> deviceOrdinals;
+  std::vector<umf_memory_pool_handle_t> slotToPool;
+
+  void addPoolSlot(const D &desc, umf_memory_pool_handle_t hPool) {
+    if (!desc.hNativeDevice.has_value()) {
+      return;
+    }
+    if (slotToPool.empty()) {
+      slotPoolHandle = desc.poolHandle;
+    } else if (slotPoolHandle != desc.poolHandle) {
+      // Slots are only unique within a single pool handle
+      return;
+    }
+    if (desc.hDevice) {
+      deviceOrdinals[desc.hDevice] = desc.deviceOrdinal;
+    }
+
+    auto slot = getPoolSlot(desc.deviceOrdinal, desc.type, desc.deviceReadOnly);
+    if (!slot.has_value() || !hPool) {
+      return;
+    }
+    if (*slot >= slotToPool.size()) {
+      slotToPool.resize(*slot + 1, nullptr);
+    }
+    if (!slotToPool[*slot]) {
+      slotToPool[*slot] = hPool;
+    }
+  }
+
+  umf_memory_pool_handle_t findPoolBySlot(const D &desc) const noexcept {
+    if (slotToPool.empty() || desc.poolHandle != slotPoolHandle) {
+      return nullptr;
+    }
+
+    uint32_t deviceOrdinal = 0;
+    if (desc.type != UR_USM_TYPE_HOST) {
+      auto it = deviceOrdinals.find(desc.hDevice);
+      if (it == deviceOrdinals.end()) {
+        return nullptr;
+      }
+      deviceOrdinal = it->second;
+    } else if (desc.hDevice) {
+      return nullptr;
+    }
+
+    auto slot = getPoolSlot(deviceOrdinal, desc.type, desc.deviceReadOnly);
+    if (!slot.has_value() || *slot >= slotToPool.size()) {
+      return nullptr;
+    }
+    return slotToPool[*slot];
+  }
+
 public:
   static std::pair<ur_result_t, pool_manager>
   create(desc_to_pool_map_t &&descToHandleMap = {}) {
@@ -271,7 +363,10 @@ public:
 
   ur_result_t addPool(const D &desc,
                       umf::pool_unique_handle_t &&hPool) noexcept {
-    if (!descToPoolMap.try_emplace(desc, std::move(hPool)).second) {
+    auto [it, inserted] = descToPoolMap.try_emplace(desc, std::move(hPool));
+    // Sub-devices sharing the pool of their parent still need their ordinal
+    addPoolSlot(desc, it->second.get());
+    if (!inserted) {
       logger::error("Pool for pool descriptor: {}, already exists", desc);
       return UR_RESULT_ERROR_INVALID_ARGUMENT;
     }
@@ -280,6 +375,10 @@ public:
   }
 
   std::optional<umf_memory_pool_handle_t> getPool(const D &desc) noexcept {
+    if (auto hPool = findPoolBySlot(desc)) {
+      return hPool;
+    }
+
     auto it = descToPoolMap.find(desc);
     if (it == descToPoolMap.end()) {
       logger::error("Pool descriptor doesn't match any existing pool: {}",
@@ -319,17 +418,7 @@ namespace std {
 /// @brief hash specialization for usm::pool_descriptor
 template <> struct hash<usm::pool_descriptor> {
   inline size_t operator()(const usm::pool_descriptor &desc) const {
-    static usm::detail::ddiTables ddi;
-
-    ur_native_handle_t native = 0;
-    if (desc.hDevice) {
-      auto ret = ddi.deviceDdiTable.pfnGetNativeHandle(desc.hDevice, &native);
-      if (ret != UR_RESULT_SUCCESS) {
-        throw ret;
-      }
-    }
-
-    return combine_hashes(0, desc.type, native,
+    return combine_hashes(0, desc.type, desc.getNativeDevice(),
                           isSharedAllocationReadOnlyOnDevice(desc),
                           desc.poolHandle);
   }
@@ -12,6 +12,7 @@
  */
 
 #include "asan_allocator.hpp"
+#include "asan_libdevice.hpp"
 #include "ur_sanitizer_layer.hpp"
 
 namespace ur_sanitizer_layer {
@@ -24,5 +25,21 @@ void AllocInfo::print() {
       (void *)(UserEnd), AllocSize, ToString(Type));
 }
 
+u8 AllocInfo::getDeallocatedMagic() const {
+  switch (Type) {
+  case AllocType::HOST_USM:
+    return kUsmHostDeallocatedMagic;
+  case AllocType::DEVICE_USM:
+    return kUsmDeviceDeallocatedMagic;
+  case AllocType::SHARED_USM:
+    return kUsmSharedDeallocatedMagic;
+  case AllocType::MEM_BUFFER:
+    return kMemBufferDeallocatedMagic;
+  default:
+    assert(false && "Unknow AllocInfo Type");
+    return 0xff;
+  }
+}
+
 } // namespace asan
 } // namespace ur_sanitizer_layer
@@ -13,10 +13,13 @@
 
 #pragma once
 
+#include "sanitizer_common/sanitizer_allocation_index.hpp"
 #include "sanitizer_common/sanitizer_allocator.hpp"
 #include "sanitizer_common/sanitizer_common.hpp"
 #include "sanitizer_common/sanitizer_stacktrace.hpp"
 
+#include <atomic>
+
 namespace ur_sanitizer_layer {
 namespace asan {
 
@@ -27,7 +30,8 @@ struct AllocInfo {
   size_t AllocSize = 0;
 
   AllocType Type = AllocType::UNKNOWN;
-  bool IsReleased = false;
+  // Launches check their cached arguments against it without any lock
+  std::atomic<bool> IsReleased = false;
 
   ur_context_handle_t Context = nullptr;
   ur_device_handle_t Device = nullptr;
@@ -37,10 +41,11 @@ struct AllocInfo {
 
   void print();
   size_t getRedzoneSize() { return AllocSize - (UserEnd - UserBegin); }
+  // Shadow value of the whole allocation once it is released
+  u8 getDeallocatedMagic() const;
 };
 
-using AllocationMap = std::map<uptr, std::shared_ptr<AllocInfo>>;
-using AllocationIterator = AllocationMap::iterator;
+using AllocationMap = AllocationIndex<AllocInfo>;
 
 } // namespace asan
 } // namespace ur_sanitizer_layer
@@ -19,6 +19,7 @@
 #include "ur_sanitizer_layer.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace ur_sanitizer_layer {
 namespace asan {
@@ -475,12 +476,6 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
     /// particular kernel execution instance.
     ur_event_handle_t *phEvent) {
 
-  // This mutex is to prevent concurrent kernel launches across different queues
-  // as the DeviceASAN local/private shadow memory does not support concurrent
-  // kernel launches now.
-  std::scoped_lock<ur_shared_mutex> Guard(
-      getAsanInterceptor()->KernelLaunchMutex);
-
   auto pfnKernelLaunch = getContext()->urDdiTable.Enqueue.pfnKernelLaunch;
 
   if (nullptr == pfnKernelLaunch) {
@@ -489,17 +484,36 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
 
   getContext()->logger.debug("==== urEnqueueKernelLaunch");
 
+  auto &KernelInfo = getAsanInterceptor()->getOrCreateKernelInfo(hKernel);
   LaunchInfo LaunchInfo(GetContext(hQueue), GetDevice(hQueue), pGlobalWorkSize,
                         pLocalWorkSize, pGlobalWorkOffset, workDim);
-  UR_CALL(LaunchInfo.Data.syncToDevice(hQueue));
-
-  UR_CALL(getAsanInterceptor()->preLaunchKernel(hKernel, hQueue, LaunchInfo));
+  // Reuse the runtime data of a previous launch, which avoids allocating and
+  // uploading it again if nothing changed in between
+  LaunchInfo.Data.useCache(KernelInfo.RuntimeDataCache);
 
+  // Every launch gets its own local/private shadow, so launches only need to
+  // be serialized per kernel while its arguments are being set up.
   ur_event_handle_t hEvent{};
-  ur_result_t result =
-      pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
-                      pGlobalWorkSize, LaunchInfo.LocalWorkSize.data(),
-                      numEventsInWaitList, phEventWaitList, &hEvent);
+  ur_result_t result;
+  {
+    std::scoped_lock<ur_mutex> Guard(KernelInfo.LaunchMutex);
+
+    UR_CALL(getAsanInterceptor()->preLaunchKernel(hKernel, hQueue, LaunchInfo));
+
+    // The kernel waits for the poisoning of the shadow on the device
+    std::vector<ur_event_handle_t> WaitEvents;
+    if (!LaunchInfo.WaitEvents.empty()) {
+      WaitEvents.assign(phEventWaitList, phEventWaitList + numEventsInWaitList);
+      WaitEvents.insert(WaitEvents.end(), LaunchInfo.WaitEvents.begin(),
+                        LaunchInfo.WaitEvents.end());
+      numEventsInWaitList = static_cast<uint32_t>(WaitEvents.size());
+      phEventWaitList = WaitEvents.data();
+    }
+
+    result = pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                             pGlobalWorkSize, LaunchInfo.LocalWorkSize.data(),
+                             numEventsInWaitList, phEventWaitList, &hEvent);
+  }
 
   if (result == UR_RESULT_SUCCESS) {
     UR_CALL(
@@ -1463,6 +1477,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
     auto &KernelInfo = getAsanInterceptor()->getOrCreateKernelInfo(hKernel);
     std::scoped_lock<ur_shared_mutex> Guard(KernelInfo.Mutex);
     KernelInfo.BufferArgs[argIndex] = std::move(MemBuffer);
+    KernelInfo.ArgsVersion++;
   } else {
     UR_CALL(pfnSetArgValue(hKernel, argIndex, argSize, pProperties, pArgValue));
   }
@@ -1494,6 +1509,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
     auto &KernelInfo = getAsanInterceptor()->getOrCreateKernelInfo(hKernel);
     std::scoped_lock<ur_shared_mutex> Guard(KernelInfo.Mutex);
     KernelInfo.BufferArgs[argIndex] = std::move(MemBuffer);
+    KernelInfo.ArgsVersion++;
   } else {
     UR_CALL(pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue));
   }
@@ -1528,6 +1544,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
     auto argSizeWithRZ = GetSizeAndRedzoneSizeForLocal(
         argSize, ASAN_SHADOW_GRANULARITY, ASAN_SHADOW_GRANULARITY);
     KI.LocalArgs[argIndex] = LocalArgsInfo{argSize, argSizeWithRZ};
+    KI.ArgsVersion++;
     argSize = argSizeWithRZ;
   }
 
@@ -1563,6 +1580,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
     auto &KI = getAsanInterceptor()->getOrCreateKernelInfo(hKernel);
     std::scoped_lock<ur_shared_mutex> Guard(KI.Mutex);
     KI.PointerArgs[argIndex] = {pArgValue, GetCurrentBacktrace()};
+    KI.ArgsVersion++;
   }
 
   ur_result_t result =
@@ -28,18 +28,22 @@ namespace asan {
 AsanInterceptor::AsanInterceptor() {
   if (getOptions().MaxQuarantineSizeMB) {
     m_Quarantine = std::make_unique<Quarantine>(
-        static_cast<uint64_t>(getOptions().MaxQuarantineSizeMB) * 1024 * 1024);
+        static_cast<uint64_t>(getOptions().MaxQuarantineSizeMB) * 1024 * 1024,
+        [this](std::vector<std::shared_ptr<AllocInfo>> &AllocInfos) {
+          releaseQuarantined(AllocInfos);
+        });
   }
 }
 
 AsanInterceptor::~AsanInterceptor() {
   // We must release these objects before releasing adapters, since
-  // they may use the adapter in their destructor
+  // they may use the adapter in their destructor. The quarantine goes first,
+  // its evictor still releases shadow memory.
+  m_Quarantine = nullptr;
+
   for (const auto &[_, DeviceInfo] : m_DeviceMap) {
     DeviceInfo->Shadow = nullptr;
   }
-
-  m_Quarantine = nullptr;
   m_MemBufferMap.clear();
   m_KernelMap.clear();
   m_ContextMap.clear();
@@ -136,16 +140,17 @@ ur_result_t AsanInterceptor::allocateMemory(ur_context_handle_t Context,
 
   *ResultPtr = reinterpret_cast<void *>(UserBegin);
 
-  auto AI = std::make_shared<AllocInfo>(AllocInfo{AllocBegin,
-                                                  UserBegin,
-                                                  UserEnd,
-                                                  NeededSize,
-                                                  Type,
-                                                  false,
-                                                  Context,
-                                                  Device,
-                                                  GetCurrentBacktrace(),
-                                                  {}});
+  // AllocInfo holds an atomic, so it is built in place
+  auto AI = std::shared_ptr<AllocInfo>(new AllocInfo{AllocBegin,
+                                                     UserBegin,
+                                                     UserEnd,
+                                                     NeededSize,
+                                                     Type,
+                                                     false,
+                                                     Context,
+                                                     Device,
+                                                     GetCurrentBacktrace(),
+                                                     {}});
 
   AI->print();
 
@@ -157,10 +162,7 @@ ur_result_t AsanInterceptor::allocateMemory(ur_context_handle_t Context,
   }
 
   // For memory release
-  {
-    std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-    m_AllocationMap.emplace(AI->AllocBegin, std::move(AI));
-  }
+  m_AllocationMap.insert(AI);
 
   return UR_RESULT_SUCCESS;
 }
@@ -170,19 +172,14 @@ ur_result_t AsanInterceptor::releaseMemory(ur_context_handle_t Context,
   auto ContextInfo = getContextInfo(Context);
 
   auto Addr = reinterpret_cast<uptr>(Ptr);
-  auto AllocInfoItOp = findAllocInfoByAddress(Addr);
+  auto AllocInfo = findAllocInfoByAddress(Addr);
 
-  if (!AllocInfoItOp) {
+  if (!AllocInfo) {
     // "Addr" might be a host pointer
     ReportBadFree(Addr, GetCurrentBacktrace(), nullptr);
     return UR_RESULT_ERROR_INVALID_ARGUMENT;
   }
 
-  auto AllocInfoIt = *AllocInfoItOp;
-  // NOTE: AllocInfoIt will be erased later, so "AllocInfo" must be a new
-  // reference here
-  auto AllocInfo = AllocInfoIt->second;
-
   if (AllocInfo->Context != Context) {
     if (AllocInfo->UserBegin == Addr) {
       ReportBadContext(Addr, GetCurrentBacktrace(), AllocInfo);
@@ -216,38 +213,67 @@ ur_result_t AsanInterceptor::releaseMemory(ur_context_handle_t Context,
   if (!m_Quarantine) {
     getContext()->logger.debug("Free: {}", (void *)AllocInfo->AllocBegin);
 
+    if (!m_AllocationMap.erase(AllocInfo)) {
+      getContext()->logger.error("Free: {} is not indexed anymore",
+                                 (void *)AllocInfo->AllocBegin);
+      return UR_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
     ContextInfo->Stats.UpdateUSMRealFreed(AllocInfo->AllocSize,
                                           AllocInfo->getRedzoneSize());
 
-    std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-    m_AllocationMap.erase(AllocInfoIt);
-
     return getContext()->urDdiTable.USM.pfnFree(
         Context, (void *)(AllocInfo->AllocBegin));
   }
 
   // If quarantine is enabled, cache it
-  auto ReleaseList = m_Quarantine->put(AllocInfo->Device, AllocInfoIt);
-  if (ReleaseList.size()) {
-    std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-    for (auto &It : ReleaseList) {
-      auto ToFreeAllocInfo = It->second;
-      getContext()->logger.info("Quarantine Free: {}",
-                                (void *)ToFreeAllocInfo->AllocBegin);
+  ContextInfo->Stats.UpdateUSMFreed(AllocInfo->AllocSize);
+  m_Quarantine->put(AllocInfo);
 
-      ContextInfo->Stats.UpdateUSMRealFreed(ToFreeAllocInfo->AllocSize,
-                                            ToFreeAllocInfo->getRedzoneSize());
+  return UR_RESULT_SUCCESS;
+}
 
-      UR_CALL(getContext()->urDdiTable.USM.pfnFree(
-          Context, (void *)(ToFreeAllocInfo->AllocBegin)));
+void AsanInterceptor::releaseQuarantined(
+    std::vector<std::shared_ptr<AllocInfo>> &AllocInfos) {
+  for (auto &AI : AllocInfos) {
+    getContext()->logger.info("Quarantine Free: {}", (void *)AI->AllocBegin);
+
+    // The adapter can't hand out the memory again before it's freed, so
+    // erasing it first is safe and keeps the free out of any lock. Whoever
+    // erased it owns the free, so it's never freed twice.
+    if (!m_AllocationMap.erase(AI)) {
+      getContext()->logger.error("Quarantine Free: {} is not indexed anymore",
+                                 (void *)AI->AllocBegin);
+      continue;
+    }
 
-      // Erase it at last to avoid use-after-free.
-      m_AllocationMap.erase(It);
+    auto ContextInfo = getContextInfo(AI->Context);
+    ContextInfo->Stats.UpdateUSMRealFreed(AI->AllocSize, AI->getRedzoneSize());
+
+    // The shadow of this memory only has to read as deallocated from now on,
+    // so it doesn't need to stay resident. Host USM is shadowed on all
+    // devices of the context, which may share the same shadow memory.
+    std::vector<ShadowMemory *> Released;
+    auto Devices = AI->Type == AllocType::HOST_USM
+                       ? ContextInfo->DeviceList
+                       : std::vector<ur_device_handle_t>{AI->Device};
+    for (auto Device : Devices) {
+      auto Shadow = getDeviceInfo(Device)->Shadow.get();
+      if (!Shadow || std::find(Released.begin(), Released.end(), Shadow) !=
+                         Released.end()) {
+        continue;
+      }
+      Released.push_back(Shadow);
+      ContextInfo->Stats.UpdateShadowReleased(Shadow->ReleaseShadow(AI));
     }
-  }
-  ContextInfo->Stats.UpdateUSMFreed(AllocInfo->AllocSize);
 
-  return UR_RESULT_SUCCESS;
+    auto URes = getContext()->urDdiTable.USM.pfnFree(AI->Context,
+                                                     (void *)AI->AllocBegin);
+    if (URes != UR_RESULT_SUCCESS) {
+      getContext()->logger.error("Failed to free quarantined {}: {}",
+                                 (void *)AI->AllocBegin, URes);
+    }
+  }
 }
 
 ur_result_t AsanInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
@@ -267,7 +293,7 @@ ur_result_t AsanInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
   UR_CALL(prepareLaunch(ContextInfo, DeviceInfo, InternalQueue, Kernel,
                         LaunchInfo));
 
-  UR_CALL(updateShadowMemory(ContextInfo, DeviceInfo, InternalQueue));
+  UR_CALL(updateShadowMemory(ContextInfo, DeviceInfo, LaunchInfo));
 
   return UR_RESULT_SUCCESS;
 }
@@ -335,37 +361,19 @@ AsanInterceptor::getOrCreateShadowMemory(ur_device_handle_t Device,
 ///
 /// ref:
 /// https://github.com/google/sanitizers/wiki/AddressSanitizerAlgorithm#mapping
-ur_result_t
-AsanInterceptor::enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
-                                  ur_queue_handle_t Queue,
-                                  std::shared_ptr<AllocInfo> &AI) {
+void AsanInterceptor::enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
+                                       ShadowPoisonBatch &Batch,
+                                       std::shared_ptr<AllocInfo> &AI) {
+  auto &Shadow = DeviceInfo->Shadow;
+
   if (AI->IsReleased) {
-    int ShadowByte;
-    switch (AI->Type) {
-    case AllocType::HOST_USM:
-      ShadowByte = kUsmHostDeallocatedMagic;
-      break;
-    case AllocType::DEVICE_USM:
-      ShadowByte = kUsmDeviceDeallocatedMagic;
-      break;
-    case AllocType::SHARED_USM:
-      ShadowByte = kUsmSharedDeallocatedMagic;
-      break;
-    case AllocType::MEM_BUFFER:
-      ShadowByte = kMemBufferDeallocatedMagic;
-      break;
-    default:
-      ShadowByte = 0xff;
-      assert(false && "Unknow AllocInfo Type");
-    }
-    UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(Queue, AI->AllocBegin,
-                                                    AI->AllocSize, ShadowByte));
-    return UR_RESULT_SUCCESS;
+    Shadow->PoisonShadow(Batch, AI->AllocBegin, AI->AllocSize,
+                         AI->getDeallocatedMagic());
+    return;
   }
 
   // Init zero
-  UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(Queue, AI->AllocBegin,
-                                                  AI->AllocSize, 0));
+  Shadow->PoisonShadow(Batch, AI->AllocBegin, AI->AllocSize, 0);
 
   uptr TailBegin = RoundUpTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
   uptr TailEnd = AI->AllocBegin + AI->AllocSize;
@@ -374,8 +382,7 @@ AsanInterceptor::enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
   if (TailBegin != AI->UserEnd) {
     auto Value =
         AI->UserEnd - RoundDownTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
-    UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(Queue, AI->UserEnd, 1,
-                                                    static_cast<u8>(Value)));
+    Shadow->PoisonShadow(Batch, AI->UserEnd, 1, static_cast<u8>(Value));
   }
 
   int ShadowByte;
@@ -401,27 +408,61 @@ AsanInterceptor::enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
   }
 
   // Left red zone
-  UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(
-      Queue, AI->AllocBegin, AI->UserBegin - AI->AllocBegin, ShadowByte));
+  Shadow->PoisonShadow(Batch, AI->AllocBegin, AI->UserBegin - AI->AllocBegin,
+                       ShadowByte);
 
   // Right red zone
-  UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(
-      Queue, TailBegin, TailEnd - TailBegin, ShadowByte));
-
-  return UR_RESULT_SUCCESS;
+  Shadow->PoisonShadow(Batch, TailBegin, TailEnd - TailBegin, ShadowByte);
 }
 
 ur_result_t
 AsanInterceptor::updateShadowMemory(std::shared_ptr<ContextInfo> &ContextInfo,
                                     std::shared_ptr<DeviceInfo> &DeviceInfo,
-                                    ur_queue_handle_t Queue) {
+                                    LaunchInfo &LaunchInfo) {
   auto &AllocInfos = ContextInfo->AllocInfosMap[DeviceInfo->Handle];
   std::scoped_lock<ur_shared_mutex> Guard(AllocInfos.Mutex);
 
-  for (auto &AI : AllocInfos.List) {
-    UR_CALL(enqueueAllocInfo(DeviceInfo, Queue, AI));
+  // Poisoning allocation by allocation costs a fill per redzone, so collect
+  // everything first and write the merged ranges at once.
+  if (!AllocInfos.List.empty()) {
+    ShadowPoisonBatch Batch;
+    for (auto &AI : AllocInfos.List) {
+      enqueueAllocInfo(DeviceInfo, Batch, AI);
+    }
+
+    if (!AllocInfos.PoisonQueue) {
+      UR_CALL(getContext()->urDdiTable.Queue.pfnCreate(
+          ContextInfo->Handle, DeviceInfo->Handle, nullptr,
+          &AllocInfos.PoisonQueue));
+    }
+    ur_event_handle_t Event{};
+    UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadowBatch(AllocInfos.PoisonQueue,
+                                                         Batch, &Event));
+    if (Event) {
+      if (AllocInfos.LastPoisonEvent) {
+        getContext()->urDdiTable.Event.pfnRelease(AllocInfos.LastPoisonEvent);
+      }
+      AllocInfos.LastPoisonEvent = Event;
+    }
+    AllocInfos.List.clear();
+  }
+
+  // Launches wait for the poisoning of earlier launches as well, until it is
+  // done.
+  if (AllocInfos.LastPoisonEvent) {
+    ur_event_status_t Status{};
+    auto URes = getContext()->urDdiTable.Event.pfnGetInfo(
+        AllocInfos.LastPoisonEvent, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+        sizeof(Status), &Status, nullptr);
+    if (URes == UR_RESULT_SUCCESS && Status == UR_EVENT_STATUS_COMPLETE) {
+      getContext()->urDdiTable.Event.pfnRelease(AllocInfos.LastPoisonEvent);
+      AllocInfos.LastPoisonEvent = nullptr;
+    } else {
+      UR_CALL(
+          getContext()->urDdiTable.Event.pfnRetain(AllocInfos.LastPoisonEvent));
+      LaunchInfo.WaitEvents.push_back(AllocInfos.LastPoisonEvent);
+    }
   }
-  AllocInfos.List.clear();
 
   return UR_RESULT_SUCCESS;
 }
@@ -448,9 +489,8 @@ ur_result_t AsanInterceptor::unregisterProgram(ur_program_handle_t Program) {
   auto ProgramInfo = getProgramInfo(Program);
   assert(ProgramInfo != nullptr && "unregistered program!");
 
-  std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
   for (auto AI : ProgramInfo->AllocInfoForGlobals) {
-    m_AllocationMap.erase(AI->AllocBegin);
+    m_AllocationMap.erase(AI);
   }
   ProgramInfo->AllocInfoForGlobals.clear();
 
@@ -556,23 +596,22 @@ AsanInterceptor::registerDeviceGlobals(ur_program_handle_t Program) {
     }
 
     for (size_t i = 0; i < NumOfDeviceGlobal; i++) {
-      auto AI = std::make_shared<AllocInfo>(
-          AllocInfo{GVInfos[i].Addr,
-                    GVInfos[i].Addr,
-                    GVInfos[i].Addr + GVInfos[i].Size,
-                    GVInfos[i].SizeWithRedZone,
-                    AllocType::DEVICE_GLOBAL,
-                    false,
-                    Context,
-                    Device,
-                    GetCurrentBacktrace(),
-                    {}});
+      auto AI = std::shared_ptr<AllocInfo>(
+          new AllocInfo{GVInfos[i].Addr,
+                        GVInfos[i].Addr,
+                        GVInfos[i].Addr + GVInfos[i].Size,
+                        GVInfos[i].SizeWithRedZone,
+                        AllocType::DEVICE_GLOBAL,
+                        false,
+                        Context,
+                        Device,
+                        GetCurrentBacktrace(),
+                        {}});
 
       ContextInfo->insertAllocInfo({Device}, AI);
       ProgramInfo->AllocInfoForGlobals.emplace(AI);
 
-      std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-      m_AllocationMap.emplace(AI->AllocBegin, std::move(AI));
+      m_AllocationMap.insert(AI);
     }
   }
 
@@ -597,9 +636,23 @@ ur_result_t AsanInterceptor::insertContext(ur_context_handle_t Context,
 }
 
 ur_result_t AsanInterceptor::eraseContext(ur_context_handle_t Context) {
-  std::scoped_lock<ur_shared_mutex> Guard(m_ContextMapMutex);
-  assert(m_ContextMap.find(Context) != m_ContextMap.end());
-  m_ContextMap.erase(Context);
+  // Stats are printed when the context goes away, they are only exact once
+  // everything it freed into the quarantine is really released.
+  if (m_Quarantine) {
+    m_Quarantine->drain(Context);
+  }
+
+  std::shared_ptr<ContextInfo> CI;
+  {
+    std::scoped_lock<ur_shared_mutex> Guard(m_ContextMapMutex);
+    assert(m_ContextMap.find(Context) != m_ContextMap.end());
+    CI = std::move(m_ContextMap[Context]);
+    m_ContextMap.erase(Context);
+  }
+  // ContextInfo reports leaks and prints stats when it's destroyed, which
+  // must not happen under m_ContextMapMutex.
+  CI = nullptr;
+
   // TODO: Remove devices in each context
   return UR_RESULT_SUCCESS;
 }
@@ -723,22 +776,45 @@ ur_result_t AsanInterceptor::prepareLaunch(
       (void *)Kernel, GetKernelName(Kernel), ArgNums, KernelInfo.IsInstrumented,
       LocalMemoryUsage, PrivateMemoryUsage);
 
-  // Validate pointer arguments
-  if (getOptions().DetectKernelArguments) {
+  // Validate pointer arguments, unless they already passed on a previous
+  // launch and haven't been changed or freed since
+  auto &ValidatedArgs = KernelInfo.ValidatedArgs;
+  if (getOptions().DetectKernelArguments &&
+      !ValidatedArgs.isValid(KernelInfo.ArgsVersion, ContextInfo->Handle,
+                             DeviceInfo->Handle)) {
+    std::vector<std::shared_ptr<AllocInfo>> AllocInfos;
+    bool IsCacheable = true;
     for (const auto &[ArgIndex, PtrPair] : KernelInfo.PointerArgs) {
       auto Ptr = PtrPair.first;
       if (Ptr == nullptr) {
         continue;
       }
-      if (auto ValidateResult = ValidateUSMPointer(
-              ContextInfo->Handle, DeviceInfo->Handle, (uptr)Ptr)) {
+      auto ValidateResult = ValidateUSMPointer(ContextInfo->Handle,
+                                               DeviceInfo->Handle, (uptr)Ptr);
+      if (ValidateResult) {
         ReportInvalidKernelArgument(Kernel, ArgIndex, (uptr)Ptr, ValidateResult,
                                     PtrPair.second);
         if (ValidateResult.Type != ValidateUSMResult::MAYBE_HOST_POINTER) {
           exitWithErrors();
         }
+        IsCacheable = false;
+      } else if (ValidateResult.AI) {
+        AllocInfos.emplace_back(std::move(ValidateResult.AI));
+      } else {
+        // Host pointers may turn into USM we don't know about yet
+        IsCacheable = false;
       }
     }
+
+    ValidatedArgs.ArgsVersion = UINT64_MAX;
+    if (IsCacheable) {
+      ValidatedArgs.ArgsVersion = KernelInfo.ArgsVersion;
+      ValidatedArgs.Context = ContextInfo->Handle;
+      ValidatedArgs.Device = DeviceInfo->Handle;
+      ValidatedArgs.AllocInfos = std::move(AllocInfos);
+    } else {
+      ValidatedArgs.AllocInfos.clear();
+    }
   }
 
   // Set membuffer arguments
@@ -802,6 +878,7 @@ ur_result_t AsanInterceptor::prepareLaunch(
   LaunchInfo.Data.Host.GlobalShadowOffsetEnd = DeviceInfo->Shadow->ShadowEnd;
   LaunchInfo.Data.Host.DeviceTy = DeviceInfo->Type;
   LaunchInfo.Data.Host.Debug = getOptions().Debug ? 1 : 0;
+  LaunchInfo.Shadow = DeviceInfo->Shadow;
 
   // Write shadow memory offset for local memory
   if (getOptions().DetectLocals) {
@@ -868,36 +945,6 @@ ur_result_t AsanInterceptor::prepareLaunch(
   return UR_RESULT_SUCCESS;
 }
 
-std::optional<AllocationIterator>
-AsanInterceptor::findAllocInfoByAddress(uptr Address) {
-  std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-  auto It = m_AllocationMap.upper_bound(Address);
-  if (It == m_AllocationMap.begin()) {
-    return std::nullopt;
-  }
-  --It;
-
-  // Maybe it's a host pointer
-  if (Address < It->second->AllocBegin ||
-      Address >= It->second->AllocBegin + It->second->AllocSize) {
-    return std::nullopt;
-  }
-  return It;
-}
-
-std::vector<AllocationIterator>
-AsanInterceptor::findAllocInfoByContext(ur_context_handle_t Context) {
-  std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-  std::vector<AllocationIterator> AllocInfos;
-  for (auto It = m_AllocationMap.begin(); It != m_AllocationMap.end(); It++) {
-    const auto &[_, AI] = *It;
-    if (AI->Context == Context) {
-      AllocInfos.emplace_back(It);
-    }
-  }
-  return AllocInfos;
-}
-
 bool ProgramInfo::isKernelInstrumented(ur_kernel_handle_t Kernel) const {
   const auto Name = GetKernelName(Kernel);
   return InstrumentedKernels.find(Name) != InstrumentedKernels.end();
@@ -918,10 +965,8 @@ ContextInfo::~ContextInfo() {
   // check memory leaks
   if (getAsanInterceptor()->getOptions().DetectLeaks &&
       getAsanInterceptor()->isNormalExit()) {
-    std::vector<AllocationIterator> AllocInfos =
-        getAsanInterceptor()->findAllocInfoByContext(Handle);
-    for (const auto &It : AllocInfos) {
-      const auto &[_, AI] = *It;
+    auto AllocInfos = getAsanInterceptor()->findAllocInfoByContext(Handle);
+    for (const auto &AI : AllocInfos) {
       if (!AI->IsReleased) {
         ReportMemoryLeak(AI);
       }
@@ -945,20 +990,168 @@ ur_usm_pool_handle_t ContextInfo::getUSMPool() {
   return USMPool;
 }
 
-AsanRuntimeDataWrapper::~AsanRuntimeDataWrapper() {
+AsanRuntimeDeviceData::~AsanRuntimeDeviceData() {
   [[maybe_unused]] ur_result_t Result;
-  if (Host.LocalArgs) {
-    Result =
-        getContext()->urDdiTable.USM.pfnFree(Context, (void *)Host.LocalArgs);
+  if (LocalArgsPtr) {
+    Result = getContext()->urDdiTable.USM.pfnFree(Context, LocalArgsPtr);
     assert(Result == UR_RESULT_SUCCESS);
   }
-  if (DevicePtr) {
-    Result = getContext()->urDdiTable.USM.pfnFree(Context, DevicePtr);
+  if (Ptr) {
+    Result = getContext()->urDdiTable.USM.pfnFree(Context, Ptr);
     assert(Result == UR_RESULT_SUCCESS);
   }
 }
 
+std::unique_ptr<AsanRuntimeDeviceData>
+AsanRuntimeDataCache::acquire(ur_context_handle_t Context,
+                              ur_device_handle_t Device) {
+  {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    auto It =
+        std::find_if(FreeData.begin(), FreeData.end(), [&](const auto &Data) {
+          return Data->Context == Context && Data->Device == Device;
+        });
+    if (It != FreeData.end()) {
+      auto Data = std::move(*It);
+      FreeData.erase(It);
+      return Data;
+    }
+  }
+  return std::make_unique<AsanRuntimeDeviceData>(Context, Device);
+}
+
+void AsanRuntimeDataCache::release(
+    std::unique_ptr<AsanRuntimeDeviceData> Data) {
+  {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    if (FreeData.size() < MaxFreeData) {
+      FreeData.emplace_back(std::move(Data));
+    }
+  }
+  // Otherwise more launches of this kernel were in flight than we keep data
+  // for, so Data is freed here
+}
+
+AsanRuntimeDataWrapper::~AsanRuntimeDataWrapper() {
+  if (DeviceData && Cache) {
+    Cache->release(std::move(DeviceData));
+  }
+}
+
+bool AsanRuntimeDataWrapper::isDeviceUpToDate() const {
+  if (!DeviceData->IsUpToDate) {
+    return false;
+  }
+  // Host never carries reports, so the device side mustn't either
+  const auto &Synced = DeviceData->Synced;
+  if (Synced.ReportFlag ||
+      std::any_of(std::begin(Synced.Report), std::end(Synced.Report),
+                  [](const auto &Report) { return Report.Flag; })) {
+    return false;
+  }
+  return Synced.GlobalShadowOffset == Host.GlobalShadowOffset &&
+         Synced.GlobalShadowOffsetEnd == Host.GlobalShadowOffsetEnd &&
+         Synced.PrivateShadowOffset == Host.PrivateShadowOffset &&
+         Synced.PrivateShadowOffsetEnd == Host.PrivateShadowOffsetEnd &&
+         Synced.LocalShadowOffset == Host.LocalShadowOffset &&
+         Synced.LocalShadowOffsetEnd == Host.LocalShadowOffsetEnd &&
+         Synced.LocalArgs == Host.LocalArgs &&
+         Synced.NumLocalArgs == Host.NumLocalArgs &&
+         Synced.DeviceTy == Host.DeviceTy && Synced.Debug == Host.Debug;
+}
+
+ur_result_t AsanRuntimeDataWrapper::syncFromDevice(ur_queue_handle_t Queue) {
+  // Nothing was uploaded for this launch (e.g. the kernel isn't instrumented),
+  // so there is nothing the device could have reported
+  if (!IsSynced) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  DeviceData->IsUpToDate = false;
+  UR_CALL(getContext()->urDdiTable.Enqueue.pfnUSMMemcpy(
+      Queue, true, ur_cast<void *>(&Host), getDevicePtr(),
+      sizeof(AsanRuntimeData), 0, nullptr, nullptr));
+  DeviceData->Synced = Host;
+  DeviceData->IsUpToDate = true;
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t AsanRuntimeDataWrapper::syncToDevice(ur_queue_handle_t Queue) {
+  auto DevicePtr = getDevicePtr();
+  bool NeedsUpload = !isDeviceUpToDate();
+  IsSynced = true;
+  // From now on the kernel may write its reports into the device side
+  DeviceData->IsUpToDate = false;
+
+  if (NeedsUpload) {
+    UR_CALL(getContext()->urDdiTable.Enqueue.pfnUSMMemcpy(
+        Queue, true, DevicePtr, ur_cast<void *>(&Host), sizeof(AsanRuntimeData),
+        0, nullptr, nullptr));
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t AsanRuntimeDataWrapper::importLocalArgsInfo(
+    ur_queue_handle_t Queue, const std::vector<LocalArgsInfo> &LocalArgs) {
+  assert(!LocalArgs.empty());
+  getDevicePtr();
+
+  auto IsSameArg = [](const LocalArgsInfo &A, const LocalArgsInfo &B) {
+    return A.Size == B.Size && A.SizeWithRedZone == B.SizeWithRedZone;
+  };
+  const size_t LocalArgsInfoSize = sizeof(LocalArgsInfo) * LocalArgs.size();
+  auto &Cached = DeviceData->LocalArgs;
+  if (Cached.size() != LocalArgs.size() && DeviceData->LocalArgsPtr) {
+    UR_CALL(getContext()->urDdiTable.USM.pfnFree(Context,
+                                                 DeviceData->LocalArgsPtr));
+    DeviceData->LocalArgsPtr = nullptr;
+  }
+  if (DeviceData->LocalArgsPtr == nullptr) {
+    Cached.clear();
+    UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
+        Context, Device, nullptr, nullptr, LocalArgsInfoSize,
+        ur_cast<void **>(&DeviceData->LocalArgsPtr)));
+  }
+  if (!std::equal(Cached.begin(), Cached.end(), LocalArgs.begin(),
+                  LocalArgs.end(), IsSameArg)) {
+    Cached.clear();
+    UR_CALL(getContext()->urDdiTable.Enqueue.pfnUSMMemcpy(
+        Queue, true, DeviceData->LocalArgsPtr, &LocalArgs[0], LocalArgsInfoSize,
+        0, nullptr, nullptr));
+    Cached = LocalArgs;
+  }
+
+  Host.NumLocalArgs = LocalArgs.size();
+  Host.LocalArgs = DeviceData->LocalArgsPtr;
+
+  return UR_RESULT_SUCCESS;
+}
+
+AllocInfoList::~AllocInfoList() {
+  if (LastPoisonEvent) {
+    getContext()->urDdiTable.Event.pfnRelease(LastPoisonEvent);
+  }
+  if (PoisonQueue) {
+    getContext()->urDdiTable.Queue.pfnRelease(PoisonQueue);
+  }
+}
+
 LaunchInfo::~LaunchInfo() {
+  for (auto Event : WaitEvents) {
+    getContext()->urDdiTable.Event.pfnRelease(Event);
+  }
+
+  if (Shadow) {
+    if (Data.Host.LocalShadowOffset) {
+      Shadow->ReleaseLocalShadow(Data.Host.LocalShadowOffset);
+    }
+    if (Data.Host.PrivateShadowOffset) {
+      Shadow->ReleasePrivateShadow(Data.Host.PrivateShadowOffset);
+    }
+  }
+
   [[maybe_unused]] ur_result_t Result;
   Result = getContext()->urDdiTable.Context.pfnRelease(Context);
   assert(Result == UR_RESULT_SUCCESS);
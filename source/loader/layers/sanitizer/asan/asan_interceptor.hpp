@@ -22,6 +22,7 @@
 #include "sanitizer_common/sanitizer_common.hpp"
 #include "ur_sanitizer_layer.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <queue>
@@ -37,6 +38,17 @@ class Quarantine;
 struct AllocInfoList {
   std::vector<std::shared_ptr<AllocInfo>> List;
   ur_shared_mutex Mutex;
+
+  // The shadow of the list is poisoned on an in-order queue of its own, which
+  // launches wait for on the device instead of on the host. LastPoisonEvent
+  // completes along with everything enqueued on it so far.
+  ur_queue_handle_t PoisonQueue{};
+  ur_event_handle_t LastPoisonEvent{};
+
+  AllocInfoList() = default;
+  AllocInfoList(const AllocInfoList &) = delete;
+  AllocInfoList &operator=(const AllocInfoList &) = delete;
+  ~AllocInfoList();
 };
 
 struct DeviceInfo {
@@ -80,6 +92,44 @@ struct QueueInfo {
   }
 };
 
+/// Device side AsanRuntimeData, together with what it is known to hold, so
+/// that it can be reused by later launches without uploading it again.
+struct AsanRuntimeDeviceData {
+  ur_context_handle_t Context{};
+  ur_device_handle_t Device{};
+
+  AsanRuntimeData *Ptr = nullptr;
+
+  // Copy of *Ptr, only valid if IsUpToDate, which isn't the case while a
+  // kernel may be writing to it
+  AsanRuntimeData Synced{};
+  bool IsUpToDate = false;
+
+  std::vector<LocalArgsInfo> LocalArgs;
+  LocalArgsInfo *LocalArgsPtr = nullptr;
+
+  AsanRuntimeDeviceData(ur_context_handle_t Context, ur_device_handle_t Device)
+      : Context(Context), Device(Device) {}
+
+  ~AsanRuntimeDeviceData();
+};
+
+/// Device side runtime data of completed launches of a kernel, handed out to
+/// its next launches on the same device.
+class AsanRuntimeDataCache {
+public:
+  std::unique_ptr<AsanRuntimeDeviceData> acquire(ur_context_handle_t Context,
+                                                 ur_device_handle_t Device);
+
+  void release(std::unique_ptr<AsanRuntimeDeviceData> Data);
+
+private:
+  static constexpr size_t MaxFreeData = 4;
+
+  ur_mutex Mutex;
+  std::vector<std::unique_ptr<AsanRuntimeDeviceData>> FreeData;
+};
+
 struct KernelInfo {
   ur_kernel_handle_t Handle;
   std::atomic<int32_t> RefCount = 1;
@@ -95,6 +145,36 @@ struct KernelInfo {
   // Need preserve the order of local arguments
   std::map<uint32_t, LocalArgsInfo> LocalArgs;
 
+  // Bumped by every urKernelSetArg*, which invalidates ValidatedArgs
+  uint64_t ArgsVersion = 0;
+
+  // Launch info is passed as the last kernel argument, so concurrent launches
+  // of this kernel must not interleave until it has been enqueued
+  ur_mutex LaunchMutex;
+
+  // Pointer arguments that passed validation on the last launch, they don't
+  // need to be validated again as long as none of them has been changed or
+  // freed. Only accessed under LaunchMutex.
+  struct ValidatedArgsInfo {
+    uint64_t ArgsVersion = UINT64_MAX;
+    ur_context_handle_t Context{};
+    ur_device_handle_t Device{};
+    std::vector<std::shared_ptr<AllocInfo>> AllocInfos;
+
+    bool isValid(uint64_t Version, ur_context_handle_t Context,
+                 ur_device_handle_t Device) const {
+      if (ArgsVersion != Version || this->Context != Context ||
+          this->Device != Device) {
+        return false;
+      }
+      return std::none_of(AllocInfos.begin(), AllocInfos.end(),
+                          [](const auto &AI) { return AI->IsReleased.load(); });
+    }
+  } ValidatedArgs;
+
+  std::shared_ptr<AsanRuntimeDataCache> RuntimeDataCache =
+      std::make_shared<AsanRuntimeDataCache>();
+
   explicit KernelInfo(ur_kernel_handle_t Kernel, bool IsInstrumented)
       : Handle(Kernel), IsInstrumented(IsInstrumented) {
     [[maybe_unused]] auto Result =
@@ -168,8 +248,6 @@ struct ContextInfo {
 struct AsanRuntimeDataWrapper {
   AsanRuntimeData Host{};
 
-  AsanRuntimeData *DevicePtr = nullptr;
-
   ur_context_handle_t Context{};
 
   ur_device_handle_t Device{};
@@ -179,51 +257,46 @@ struct AsanRuntimeDataWrapper {
 
   ~AsanRuntimeDataWrapper();
 
+  /// Takes the device side data from Cache, and gives it back once this
+  /// launch is done. Must be called before the data is used.
+  void useCache(std::shared_ptr<AsanRuntimeDataCache> Cache) {
+    assert(!DeviceData && "Device data is already in use");
+    DeviceData = Cache->acquire(Context, Device);
+    this->Cache = std::move(Cache);
+  }
+
   AsanRuntimeData *getDevicePtr() {
-    if (DevicePtr == nullptr) {
+    if (!DeviceData) {
+      DeviceData = std::make_unique<AsanRuntimeDeviceData>(Context, Device);
+    }
+    if (DeviceData->Ptr == nullptr) {
       ur_result_t Result = getContext()->urDdiTable.USM.pfnDeviceAlloc(
           Context, Device, nullptr, nullptr, sizeof(AsanRuntimeData),
-          (void **)&DevicePtr);
+          (void **)&DeviceData->Ptr);
       if (Result != UR_RESULT_SUCCESS) {
         getContext()->logger.error(
             "Failed to alloc device usm for asan runtime data: {}", Result);
       }
     }
-    return DevicePtr;
-  }
-
-  ur_result_t syncFromDevice(ur_queue_handle_t Queue) {
-    UR_CALL(getContext()->urDdiTable.Enqueue.pfnUSMMemcpy(
-        Queue, true, ur_cast<void *>(&Host), getDevicePtr(),
-        sizeof(AsanRuntimeData), 0, nullptr, nullptr));
-
-    return UR_RESULT_SUCCESS;
+    return DeviceData->Ptr;
   }
 
-  ur_result_t syncToDevice(ur_queue_handle_t Queue) {
-    UR_CALL(getContext()->urDdiTable.Enqueue.pfnUSMMemcpy(
-        Queue, true, getDevicePtr(), ur_cast<void *>(&Host),
-        sizeof(AsanRuntimeData), 0, nullptr, nullptr));
+  ur_result_t syncFromDevice(ur_queue_handle_t Queue);
 
-    return UR_RESULT_SUCCESS;
-  }
+  ur_result_t syncToDevice(ur_queue_handle_t Queue);
 
   ur_result_t importLocalArgsInfo(ur_queue_handle_t Queue,
-                                  const std::vector<LocalArgsInfo> &LocalArgs) {
-    assert(!LocalArgs.empty());
+                                  const std::vector<LocalArgsInfo> &LocalArgs);
 
-    Host.NumLocalArgs = LocalArgs.size();
-    const size_t LocalArgsInfoSize = sizeof(LocalArgsInfo) * Host.NumLocalArgs;
-    UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
-        Context, Device, nullptr, nullptr, LocalArgsInfoSize,
-        ur_cast<void **>(&Host.LocalArgs)));
+private:
+  bool isDeviceUpToDate() const;
 
-    UR_CALL(getContext()->urDdiTable.Enqueue.pfnUSMMemcpy(
-        Queue, true, Host.LocalArgs, &LocalArgs[0], LocalArgsInfoSize, 0,
-        nullptr, nullptr));
+  std::unique_ptr<AsanRuntimeDeviceData> DeviceData;
 
-    return UR_RESULT_SUCCESS;
-  }
+  std::shared_ptr<AsanRuntimeDataCache> Cache;
+
+  // Whether the device side data has been written for this launch
+  bool IsSynced = false;
 };
 
 struct LaunchInfo {
@@ -236,6 +309,12 @@ struct LaunchInfo {
 
   AsanRuntimeDataWrapper Data;
 
+  // Owner of the local/private shadow slices used by this launch
+  std::shared_ptr<ShadowMemory> Shadow;
+
+  // Poisoning of the shadow the kernel has to wait for, retained
+  std::vector<ur_event_handle_t> WaitEvents;
+
   LaunchInfo(ur_context_handle_t Context, ur_device_handle_t Device,
              const size_t *GlobalWorkSize, const size_t *LocalWorkSize,
              const size_t *GlobalWorkOffset, uint32_t WorkDim)
@@ -314,10 +393,14 @@ public:
     return UR_RESULT_SUCCESS;
   }
 
-  std::optional<AllocationIterator> findAllocInfoByAddress(uptr Address);
+  std::shared_ptr<AllocInfo> findAllocInfoByAddress(uptr Address) {
+    return m_AllocationMap.find(Address);
+  }
 
-  std::vector<AllocationIterator>
-  findAllocInfoByContext(ur_context_handle_t Context);
+  std::vector<std::shared_ptr<AllocInfo>>
+  findAllocInfoByContext(ur_context_handle_t Context) {
+    return m_AllocationMap.findByContext(Context);
+  }
 
   std::shared_ptr<ContextInfo> getContextInfo(ur_context_handle_t Context) {
     std::shared_lock<ur_shared_mutex> Guard(m_ContextMapMutex);
@@ -354,16 +437,26 @@ public:
   std::shared_ptr<ShadowMemory>
   getOrCreateShadowMemory(ur_device_handle_t Device, DeviceType Type);
 
-  ur_shared_mutex KernelLaunchMutex;
+  size_t getShadowResidentSize() {
+    std::shared_lock<ur_shared_mutex> Guard(m_ShadowMapMutex);
+    size_t Size = 0;
+    for (const auto &[_, Shadow] : m_ShadowMap) {
+      Size += Shadow->GetResidentSize();
+    }
+    return Size;
+  }
 
 private:
   ur_result_t updateShadowMemory(std::shared_ptr<ContextInfo> &ContextInfo,
                                  std::shared_ptr<DeviceInfo> &DeviceInfo,
-                                 ur_queue_handle_t Queue);
+                                 LaunchInfo &LaunchInfo);
+
+  void enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
+                        ShadowPoisonBatch &Batch,
+                        std::shared_ptr<AllocInfo> &AI);
 
-  ur_result_t enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
-                               ur_queue_handle_t Queue,
-                               std::shared_ptr<AllocInfo> &AI);
+  /// Returns allocations evicted from the quarantine to the adapter
+  void releaseQuarantined(std::vector<std::shared_ptr<AllocInfo>> &AllocInfos);
 
   /// Initialize Global Variables & Kernel Name at first Launch
   ur_result_t prepareLaunch(std::shared_ptr<ContextInfo> &ContextInfo,
@@ -398,7 +491,6 @@ private:
 
   /// Assumption: all USM chunks are allocated in one VA
   AllocationMap m_AllocationMap;
-  ur_shared_mutex m_AllocationMapMutex;
 
   std::unique_ptr<Quarantine> m_Quarantine;
 
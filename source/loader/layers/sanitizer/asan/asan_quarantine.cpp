@@ -13,26 +13,330 @@
 
 #include "asan_quarantine.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 namespace ur_sanitizer_layer {
 namespace asan {
 
-std::vector<AllocationIterator> Quarantine::put(ur_device_handle_t Device,
-                                                AllocationIterator &It) {
-  auto &AI = It->second;
-  auto AllocSize = AI->AllocSize;
-  auto &Cache = getCache(Device);
+namespace {
+std::atomic<uint64_t> QuarantineGeneration = 0;
+
+constexpr size_t MaxBatchCount = 32;
+
+// Quarantines by generation, for exiting threads to flush their batch into
+// the quarantine it was collected for if that is still around.
+struct LiveQuarantines {
+  std::mutex Mutex;
+  std::unordered_map<uint64_t, Quarantine *> Quarantines;
+};
+
+LiveQuarantines &liveQuarantines() {
+  // Threads may exit after static destructors ran
+  static auto *Live = new LiveQuarantines;
+  return *Live;
+}
+
+template <typename Pred>
+void removeIf(Quarantine::AllocInfoList &AllocInfos, size_t &Size,
+              Quarantine::AllocInfoList &Removed, Pred P) {
+  auto It = std::stable_partition(AllocInfos.begin(), AllocInfos.end(),
+                                  [&](const auto &AI) { return !P(AI); });
+  for (auto RemovedIt = It; RemovedIt != AllocInfos.end(); ++RemovedIt) {
+    Size -= (*RemovedIt)->AllocSize;
+    Removed.emplace_back(std::move(*RemovedIt));
+  }
+  AllocInfos.erase(It, AllocInfos.end());
+}
+} // namespace
+
+struct Quarantine::ThreadState {
+  ~ThreadState() { detach(); }
+
+  // Hands the cache back to the quarantine it was created for, which flushes
+  // what is left in it.
+  void detach() {
+    if (!Cache) {
+      return;
+    }
+    auto &Live = liveQuarantines();
+    std::scoped_lock<std::mutex> Guard(Live.Mutex);
+    auto It = Live.Quarantines.find(Generation);
+    if (It != Live.Quarantines.end()) {
+      It->second->retireThreadCache(Cache);
+    }
+    Cache = nullptr;
+  }
+
+  uint64_t Generation = UINT64_MAX;
+  ThreadCache *Cache = nullptr;
+};
+
+Quarantine::Quarantine(size_t MaxQuarantineSize, ReleaseCallback Release)
+    : m_MaxQuarantineSize(MaxQuarantineSize),
+      m_MaxBatchSize(std::max<size_t>(MaxQuarantineSize / 16, 1)),
+      m_Release(std::move(Release)), m_Generation(QuarantineGeneration++) {
+  m_Evictor = std::thread([this]() { runEvictor(); });
+
+  auto &Live = liveQuarantines();
+  std::scoped_lock<std::mutex> Guard(Live.Mutex);
+  Live.Quarantines[m_Generation] = this;
+}
+
+Quarantine::~Quarantine() {
+  {
+    auto &Live = liveQuarantines();
+    std::scoped_lock<std::mutex> Guard(Live.Mutex);
+    Live.Quarantines.erase(m_Generation);
+  }
+  {
+    std::scoped_lock<std::mutex> Guard(m_EvictMutex);
+    m_StopEvictor = true;
+  }
+  m_EvictCv.notify_all();
+  m_Evictor.join();
+}
+
+Quarantine::ThreadCache &Quarantine::getThreadCache() {
+  static thread_local ThreadState State;
+  if (State.Generation != m_Generation) {
+    State.detach();
+    auto Cache = std::make_unique<ThreadCache>();
+    State.Cache = Cache.get();
+    State.Generation = m_Generation;
+    std::scoped_lock<ur_mutex> Guard(m_ThreadCachesMutex);
+    m_ThreadCaches.emplace_back(std::move(Cache));
+  }
+  return *State.Cache;
+}
+
+void Quarantine::retireThreadCache(ThreadCache *Cache) {
+  std::unique_ptr<ThreadCache> Retired;
+  {
+    std::scoped_lock<ur_mutex> Guard(m_ThreadCachesMutex);
+    auto It = std::find_if(m_ThreadCaches.begin(), m_ThreadCaches.end(),
+                           [&](const auto &C) { return C.get() == Cache; });
+    if (It == m_ThreadCaches.end()) {
+      return;
+    }
+    Retired = std::move(*It);
+    m_ThreadCaches.erase(It);
+  }
+
+  // Nobody else can get to the cache anymore
+  m_BatchedSize -= Retired->Size;
+  if (!Retired->Batch.empty()) {
+    flush(Retired->Batch);
+  }
+}
+
+void Quarantine::flushThreadCaches(bool OnlyIdle) {
+  AllocInfoList Batch;
+  {
+    std::scoped_lock<ur_mutex> Guard(m_ThreadCachesMutex);
+    for (auto &Cache : m_ThreadCaches) {
+      std::scoped_lock<ur_mutex> CacheGuard(Cache->Mutex);
+      // Threads that freed something since the last time are left alone
+      bool Idle = Cache->Idle;
+      Cache->Idle = true;
+      if (OnlyIdle && !Idle) {
+        continue;
+      }
+      for (auto &AI : Cache->Batch) {
+        Batch.emplace_back(std::move(AI));
+      }
+      Cache->Batch.clear();
+      m_BatchedSize -= Cache->Size;
+      Cache->Size = 0;
+    }
+  }
+  if (!Batch.empty()) {
+    flush(Batch);
+  }
+}
+
+Quarantine::DeviceCache &Quarantine::getDeviceCache(ur_device_handle_t Device) {
+  {
+    std::shared_lock<ur_shared_mutex> Guard(m_DeviceCachesMutex);
+    auto It = m_DeviceCaches.find(Device);
+    if (It != m_DeviceCaches.end()) {
+      return *It->second;
+    }
+  }
+  std::scoped_lock<ur_shared_mutex> Guard(m_DeviceCachesMutex);
+  auto &Cache = m_DeviceCaches[Device];
+  if (!Cache) {
+    Cache = std::make_unique<DeviceCache>();
+  }
+  return *Cache;
+}
+
+void Quarantine::put(std::shared_ptr<AllocInfo> &AI) {
+  AllocInfoList Batch;
+  {
+    auto &Cache = getThreadCache();
+    std::scoped_lock<ur_mutex> Guard(Cache.Mutex);
+    Cache.Batch.emplace_back(AI);
+    Cache.Size += AI->AllocSize;
+    Cache.Idle = false;
+    if (Cache.Batch.size() < MaxBatchCount && Cache.Size < m_MaxBatchSize) {
+      // Batches of idle threads only count against the quarantine once they
+      // are flushed, so don't let them pile up.
+      if ((m_BatchedSize += AI->AllocSize) <= 2 * m_MaxBatchSize) {
+        return;
+      }
+    } else {
+      m_BatchedSize -= Cache.Size - AI->AllocSize;
+      Batch.swap(Cache.Batch);
+      Cache.Size = 0;
+    }
+  }
+
+  if (Batch.empty()) {
+    flushThreadCaches(false);
+  } else if (flush(Batch)) {
+    // Each time the quarantine overflows, take the batches of threads that
+    // stopped freeing since it did the last time, so that they don't sit there
+    // forever
+    flushThreadCaches(true);
+  }
+}
+
+bool Quarantine::flush(AllocInfoList &Batch) {
+  std::unordered_map<ur_device_handle_t, Segment> Segments;
+  for (auto &AI : Batch) {
+    auto &DeviceSegment = Segments[AI->Device];
+    DeviceSegment.Size += AI->AllocSize;
+    DeviceSegment.AllocInfos.emplace_back(std::move(AI));
+  }
+
+  std::vector<Segment> Evicted;
+  for (auto &[Device, DeviceSegment] : Segments) {
+    auto &Cache = getDeviceCache(Device);
+    std::scoped_lock<ur_mutex> Guard(Cache.Mutex);
+    Cache.Size += DeviceSegment.Size;
+    Cache.Segments.emplace_back(std::move(DeviceSegment));
+    // The newest segment always stays, even if it's larger than the quarantine
+    while (Cache.Size > m_MaxQuarantineSize && Cache.Segments.size() > 1) {
+      Cache.Size -= Cache.Segments.front().Size;
+      Evicted.emplace_back(std::move(Cache.Segments.front()));
+      Cache.Segments.pop_front();
+    }
+  }
+
+  if (Evicted.empty()) {
+    return false;
+  }
+  evict(Evicted);
+  return true;
+}
 
-  std::vector<AllocationIterator> DequeueList;
-  std::scoped_lock<ur_mutex> Guard(Cache.Mutex);
-  while (Cache.size() + AllocSize > m_MaxQuarantineSize) {
-    auto ElementOp = Cache.dequeue();
-    if (!ElementOp) {
-      break;
+void Quarantine::evict(std::vector<Segment> &Segments) {
+  std::unique_lock<std::mutex> Lock(m_EvictMutex);
+  for (auto &Segment : Segments) {
+    m_EvictQueueSize += Segment.Size;
+    m_EvictQueue.emplace_back(std::move(Segment));
+  }
+  m_EvictCv.notify_all();
+
+  // Frees outpacing the evictor wait for it, instead of piling up evicted
+  // memory the adapter can't hand out again yet.
+  m_EvictCv.wait(Lock, [this]() {
+    return m_StopEvictor || m_EvictQueueSize <= m_MaxQuarantineSize;
+  });
+}
+
+void Quarantine::runEvictor() {
+  std::unique_lock<std::mutex> Lock(m_EvictMutex);
+  while (true) {
+    m_EvictCv.wait(Lock,
+                   [this]() { return m_StopEvictor || !m_EvictQueue.empty(); });
+    // Whatever was queued before stopping is still released
+    if (m_EvictQueue.empty()) {
+      return;
     }
-    DequeueList.emplace_back(*ElementOp);
+
+    AllocInfoList ToRelease;
+    for (auto &Segment : m_EvictQueue) {
+      for (auto &AI : Segment.AllocInfos) {
+        ToRelease.emplace_back(std::move(AI));
+      }
+    }
+    m_EvictQueue.clear();
+    m_EvictQueueSize = 0;
+    m_Evicting = true;
+    m_EvictCv.notify_all();
+
+    Lock.unlock();
+    m_Release(ToRelease);
+    Lock.lock();
+
+    m_Evicting = false;
+    m_NumEvictions++;
+    m_EvictCv.notify_all();
+  }
+}
+
+void Quarantine::drain(ur_context_handle_t Context) {
+  auto IsOfContext = [Context](const std::shared_ptr<AllocInfo> &AI) {
+    return AI->Context == Context;
+  };
+
+  AllocInfoList ToRelease;
+  {
+    std::scoped_lock<ur_mutex> Guard(m_ThreadCachesMutex);
+    for (auto &Cache : m_ThreadCaches) {
+      std::scoped_lock<ur_mutex> CacheGuard(Cache->Mutex);
+      auto OldSize = Cache->Size;
+      removeIf(Cache->Batch, Cache->Size, ToRelease, IsOfContext);
+      m_BatchedSize -= OldSize - Cache->Size;
+    }
+  }
+
+  {
+    std::shared_lock<ur_shared_mutex> Guard(m_DeviceCachesMutex);
+    for (auto &[_, Cache] : m_DeviceCaches) {
+      std::scoped_lock<ur_mutex> CacheGuard(Cache->Mutex);
+      for (auto &Segment : Cache->Segments) {
+        auto OldSize = Segment.Size;
+        removeIf(Segment.AllocInfos, Segment.Size, ToRelease, IsOfContext);
+        Cache->Size -= OldSize - Segment.Size;
+      }
+      Cache->Segments.erase(
+          std::remove_if(Cache->Segments.begin(), Cache->Segments.end(),
+                         [](const Segment &S) { return S.AllocInfos.empty(); }),
+          Cache->Segments.end());
+    }
+  }
+
+  {
+    std::unique_lock<std::mutex> Lock(m_EvictMutex);
+    for (auto &Segment : m_EvictQueue) {
+      auto OldSize = Segment.Size;
+      removeIf(Segment.AllocInfos, Segment.Size, ToRelease, IsOfContext);
+      m_EvictQueueSize -= OldSize - Segment.Size;
+    }
+    m_EvictCv.notify_all();
+    // The evictor may be releasing allocations of Context right now, but any
+    // batch it picks up from now on can't contain them anymore.
+    auto Target = m_NumEvictions + (m_Evicting ? 1 : 0);
+    m_EvictCv.wait(Lock, [&]() { return m_NumEvictions >= Target; });
+  }
+
+  if (!ToRelease.empty()) {
+    m_Release(ToRelease);
+  }
+}
+
+size_t Quarantine::size() {
+  size_t Size = m_BatchedSize;
+  std::shared_lock<ur_shared_mutex> Guard(m_DeviceCachesMutex);
+  for (auto &[_, Cache] : m_DeviceCaches) {
+    std::scoped_lock<ur_mutex> CacheGuard(Cache->Mutex);
+    Size += Cache->Size;
   }
-  Cache.enqueue(It);
-  return DequeueList;
+  return Size;
 }
 
 } // namespace asan
@@ -16,61 +16,102 @@
 #include "asan_allocator.hpp"
 
 #include <atomic>
-#include <queue>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 namespace ur_sanitizer_layer {
 namespace asan {
 
-class QuarantineCache {
+/// Freed allocations are held back here for a while, so that use-after-free
+/// can still be detected on them.
+///
+/// Frees are first collected in a small per-thread batch, which is flushed as
+/// one segment into the FIFO of its device, so that most frees only take an
+/// uncontended lock. Once a device holds more than the quarantine size, its
+/// oldest segments are handed over to an evictor thread, which returns them to
+/// the adapter in batches.
+///
+/// Batches are flushed when their thread exits, and the batches of threads
+/// that stopped freeing are taken over by the others whenever the quarantine
+/// overflows. All batches are flushed once they hold more than two batches
+/// worth together, so that idle threads can't hold back more than that.
+/// Threads freeing while the evictor is more than a quarantine behind wait for
+/// it to catch up.
+class Quarantine {
 public:
-  using Element = AllocationIterator;
-  using List = std::queue<Element>;
-
-  // The following methods are not thread safe, use this lock
-  ur_mutex Mutex;
-
-  // Total memory used, including internal accounting.
-  uptr size() const { return m_Size; }
-
-  void enqueue(Element &It) {
-    m_List.push(It);
-    m_Size += It->second->AllocSize;
-  }
-
-  std::optional<Element> dequeue() {
-    if (m_List.empty()) {
-      return std::optional<Element>{};
-    }
-    auto It = m_List.front();
-    m_List.pop();
-    m_Size -= It->second->AllocSize;
-    return It;
-  }
+  using AllocInfoList = std::vector<std::shared_ptr<AllocInfo>>;
+  using ReleaseCallback = std::function<void(AllocInfoList &)>;
 
-private:
-  List m_List;
-  std::atomic_uintptr_t m_Size = 0;
-};
+  Quarantine(size_t MaxQuarantineSize, ReleaseCallback Release);
+  ~Quarantine();
 
-class Quarantine {
-public:
-  explicit Quarantine(size_t MaxQuarantineSize)
-      : m_MaxQuarantineSize(MaxQuarantineSize) {}
+  void put(std::shared_ptr<AllocInfo> &AI);
+
+  /// Releases every allocation of Context still held by the quarantine,
+  /// including the ones the evictor is currently working on, before returning.
+  void drain(ur_context_handle_t Context);
 
-  std::vector<AllocationIterator> put(ur_device_handle_t Device,
-                                      AllocationIterator &Ptr);
+  /// Bytes held back and not handed over to the evictor yet, including the
+  /// batches of all threads.
+  size_t size();
 
 private:
-  QuarantineCache &getCache(ur_device_handle_t Device) {
-    std::scoped_lock<ur_mutex> Guard(m_Mutex);
-    return m_Map[Device];
-  }
+  struct ThreadCache {
+    ur_mutex Mutex;
+    AllocInfoList Batch;
+    size_t Size = 0;
+    // Nothing was put since the last time the quarantine overflowed
+    bool Idle = false;
+  };
+
+  struct ThreadState;
+
+  struct Segment {
+    AllocInfoList AllocInfos;
+    size_t Size = 0;
+  };
+
+  struct DeviceCache {
+    ur_mutex Mutex;
+    std::deque<Segment> Segments;
+    size_t Size = 0;
+  };
+
+  ThreadCache &getThreadCache();
+  void retireThreadCache(ThreadCache *Cache);
+  void flushThreadCaches(bool OnlyIdle);
+  DeviceCache &getDeviceCache(ur_device_handle_t Device);
+  // Returns whether anything was evicted
+  bool flush(AllocInfoList &Batch);
+  void evict(std::vector<Segment> &Segments);
+  void runEvictor();
 
-  std::unordered_map<ur_device_handle_t, QuarantineCache> m_Map;
-  ur_mutex m_Mutex;
   size_t m_MaxQuarantineSize;
+  size_t m_MaxBatchSize;
+  ReleaseCallback m_Release;
+  uint64_t m_Generation;
+
+  ur_mutex m_ThreadCachesMutex;
+  std::vector<std::unique_ptr<ThreadCache>> m_ThreadCaches;
+  // Bytes in the batches of all threads
+  std::atomic<size_t> m_BatchedSize = 0;
+
+  ur_shared_mutex m_DeviceCachesMutex;
+  std::unordered_map<ur_device_handle_t, std::unique_ptr<DeviceCache>>
+      m_DeviceCaches;
+
+  std::mutex m_EvictMutex;
+  std::condition_variable m_EvictCv;
+  std::vector<Segment> m_EvictQueue;
+  size_t m_EvictQueueSize = 0;
+  bool m_Evicting = false;
+  uint64_t m_NumEvictions = 0;
+  bool m_StopEvictor = false;
+  std::thread m_Evictor;
 };
 
 } // namespace asan
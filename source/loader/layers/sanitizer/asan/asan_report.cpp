@@ -136,14 +136,13 @@ void ReportUseAfterFree(const AsanErrorReport &Report,
   getContext()->logger.always("");
 
   if (getAsanInterceptor()->getOptions().MaxQuarantineSizeMB > 0) {
-    auto AllocInfoItOp =
+    auto AllocInfo =
         getAsanInterceptor()->findAllocInfoByAddress(Report.Address);
 
-    if (!AllocInfoItOp) {
+    if (!AllocInfo) {
       getContext()->logger.always("Failed to find which chunck {} is allocated",
                                   (void *)Report.Address);
     } else {
-      auto &AllocInfo = (*AllocInfoItOp)->second;
       if (AllocInfo->Context != Context) {
         getContext()->logger.always(
             "Failed to find which chunck {} is allocated",
@@ -17,9 +17,166 @@
 #include "sanitizer_common/sanitizer_utils.hpp"
 #include "ur_sanitizer_layer.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
 namespace ur_sanitizer_layer {
 namespace asan {
 
+namespace {
+
+size_t GetTotalSize(const std::vector<ShadowPoisonBatch::Range> &Ranges) {
+  size_t Total = 0;
+  for (const auto &R : Ranges) {
+    Total += R.End - R.Begin;
+  }
+  return Total;
+}
+
+// Workers kept for poisoning large batches, so that batches don't pay for
+// creating threads every time.
+class MemsetPool {
+public:
+  explicit MemsetPool(size_t NumWorkers) {
+    for (size_t I = 0; I < NumWorkers; I++) {
+      // Intentionally detached, the pool lives until the process exits
+      std::thread([this] { work(); }).detach();
+    }
+    NumThreads = NumWorkers + 1;
+  }
+
+  size_t size() const { return NumThreads; }
+
+  // Runs Job on the calling thread and on all workers, and returns once all
+  // of them are done with it.
+  void run(const std::function<void()> &Job) {
+    std::scoped_lock<std::mutex> RunGuard(RunMutex);
+    std::unique_lock<std::mutex> Guard(Mutex);
+    CurrentJob = &Job;
+    Running = NumThreads - 1;
+    Generation++;
+    Guard.unlock();
+    WorkCv.notify_all();
+
+    Job();
+
+    Guard.lock();
+    DoneCv.wait(Guard, [this] { return Running == 0; });
+    CurrentJob = nullptr;
+  }
+
+private:
+  void work() {
+    uint64_t Seen = 0;
+    std::unique_lock<std::mutex> Guard(Mutex);
+    for (;;) {
+      WorkCv.wait(Guard, [&] { return Generation != Seen; });
+      Seen = Generation;
+      auto Job = CurrentJob;
+      Guard.unlock();
+      (*Job)();
+      Guard.lock();
+      if (--Running == 0) {
+        DoneCv.notify_one();
+      }
+    }
+  }
+
+  std::mutex RunMutex;
+  std::mutex Mutex;
+  std::condition_variable WorkCv;
+  std::condition_variable DoneCv;
+  const std::function<void()> *CurrentJob = nullptr;
+  uint64_t Generation = 0;
+  size_t Running = 0;
+  size_t NumThreads = 1;
+};
+
+constexpr size_t MemsetChunkSize = 4 * 1024 * 1024;
+constexpr size_t MemsetMaxThreads = 8;
+
+MemsetPool &GetMemsetPool() {
+  // Intentionally leaked, the workers may still be waiting during exit
+  static auto *Pool =
+      new MemsetPool(std::clamp<size_t>(std::thread::hardware_concurrency(), 1,
+                                        MemsetMaxThreads) -
+                     1);
+  return *Pool;
+}
+
+// memset is already vectorized, but poisoning the shadow of a few large
+// allocations is still worth spreading over several threads. Smaller batches
+// are written inline, handing them to the pool would cost more than it saves.
+void ParallelMemset(const std::vector<ShadowPoisonBatch::Range> &Ranges,
+                    size_t TotalSize) {
+  constexpr size_t MinParallelSize = 8 * MemsetChunkSize;
+
+  if (TotalSize < MinParallelSize || GetMemsetPool().size() < 2) {
+    for (const auto &R : Ranges) {
+      memset((void *)R.Begin, R.Value, R.End - R.Begin);
+    }
+    return;
+  }
+
+  std::vector<ShadowPoisonBatch::Range> Chunks;
+  for (const auto &R : Ranges) {
+    for (uptr Begin = R.Begin; Begin < R.End; Begin += MemsetChunkSize) {
+      Chunks.push_back(
+          {Begin, std::min(Begin + MemsetChunkSize, R.End), R.Value});
+    }
+  }
+
+  std::atomic<size_t> Next{0};
+  GetMemsetPool().run([&]() {
+    for (size_t I = Next++; I < Chunks.size(); I = Next++) {
+      memset((void *)Chunks[I].Begin, Chunks[I].Value,
+             Chunks[I].End - Chunks[I].Begin);
+    }
+  });
+}
+
+} // namespace
+
+std::vector<ShadowPoisonBatch::Range> ShadowPoisonBatch::coalesce() const {
+  // Paint the ranges from the newest to the oldest one, so that only the parts
+  // which aren't covered yet are taken from older ranges.
+  std::map<uptr, Range> Painted;
+  for (auto It = Pending.rbegin(); It != Pending.rend(); ++It) {
+    uptr Cur = It->Begin;
+    auto Next = Painted.upper_bound(Cur);
+    if (Next != Painted.begin() && std::prev(Next)->second.End > Cur) {
+      Next = std::prev(Next);
+    }
+    while (Cur < It->End) {
+      if (Next == Painted.end() || Next->second.Begin >= It->End) {
+        Painted.emplace(Cur, Range{Cur, It->End, It->Value});
+        break;
+      }
+      if (Next->second.Begin > Cur) {
+        Painted.emplace(Cur, Range{Cur, Next->second.Begin, It->Value});
+      }
+      Cur = std::max(Cur, Next->second.End);
+      ++Next;
+    }
+  }
+
+  std::vector<Range> Ranges;
+  for (const auto &[_, R] : Painted) {
+    if (!Ranges.empty() && Ranges.back().End == R.Begin &&
+        Ranges.back().Value == R.Value) {
+      Ranges.back().End = R.End;
+    } else {
+      Ranges.push_back(R);
+    }
+  }
+  return Ranges;
+}
+
 std::shared_ptr<ShadowMemory> GetShadowMemory(ur_context_handle_t Context,
                                               ur_device_handle_t Device,
                                               DeviceType Type) {
@@ -100,6 +257,48 @@ ur_result_t ShadowMemoryCPU::EnqueuePoisonShadow(ur_queue_handle_t, uptr Ptr,
   return UR_RESULT_SUCCESS;
 }
 
+size_t ShadowMemoryCPU::ReleaseShadow(std::shared_ptr<AllocInfo> AI) {
+  // Only pages covered by the shadow of this allocation alone are released,
+  // the partial pages at both ends may still be in use by its neighbours.
+  // They still read as deallocated afterwards, so that use-after-free is
+  // detected until the adapter hands the memory out again.
+  uptr ShadowBegin = MemToShadow(AI->AllocBegin);
+  uptr ShadowEnd = MemToShadow(AI->AllocBegin + AI->AllocSize);
+  auto Released = ReleasePoisonedPagesToOS(ShadowBegin, ShadowEnd - ShadowBegin,
+                                           AI->getDeallocatedMagic());
+  if (Released) {
+    getContext()->logger.debug("ReleaseShadow(addr={}, count={})",
+                               (void *)ShadowBegin, Released);
+  }
+  return Released;
+}
+
+size_t ShadowMemoryCPU::GetResidentSize() {
+  if (ShadowBegin == 0) {
+    return 0;
+  }
+  return ur_sanitizer_layer::GetResidentSize(ShadowBegin,
+                                             ShadowEnd - ShadowBegin);
+}
+
+ur_result_t
+ShadowMemoryCPU::EnqueuePoisonShadowBatch(ur_queue_handle_t,
+                                          const ShadowPoisonBatch &Batch,
+                                          ur_event_handle_t *OutEvent) {
+  *OutEvent = nullptr;
+  if (Batch.empty()) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  auto Ranges = Batch.coalesce();
+  auto TotalSize = GetTotalSize(Ranges);
+  getContext()->logger.debug("EnqueuePoisonShadowBatch(ranges={}, count={})",
+                             Ranges.size(), TotalSize);
+  ParallelMemset(Ranges, TotalSize);
+
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t ShadowMemoryGPU::Setup() {
   // Currently, Level-Zero doesn't create independent VAs for each contexts, if
   // we reserve shadow memory for each contexts, this will cause out-of-resource
@@ -142,11 +341,8 @@ ur_result_t ShadowMemoryGPU::Setup() {
 }
 
 ur_result_t ShadowMemoryGPU::Destory() {
-  if (PrivateShadowOffset != 0) {
-    UR_CALL(getContext()->urDdiTable.USM.pfnFree(Context,
-                                                 (void *)PrivateShadowOffset));
-    PrivateShadowOffset = 0;
-  }
+  UR_CALL(DestroySlices(PrivateShadows));
+  UR_CALL(DestroySlices(LocalShadows));
 
   static ur_result_t Result = [this]() {
     const size_t PageSize = GetVirtualMemGranularity(Context, Device);
@@ -164,11 +360,6 @@ ur_result_t ShadowMemoryGPU::Destory() {
     return Result;
   }
 
-  if (LocalShadowOffset != 0) {
-    UR_CALL(getContext()->urDdiTable.USM.pfnFree(Context,
-                                                 (void *)LocalShadowOffset));
-    LocalShadowOffset = 0;
-  }
   if (ShadowBegin != 0) {
     UR_CALL(getContext()->urDdiTable.VirtualMem.pfnFree(
         Context, (const void *)ShadowBegin, GetShadowSize()));
@@ -188,49 +379,7 @@ ur_result_t ShadowMemoryGPU::EnqueuePoisonShadow(ur_queue_handle_t Queue,
   uptr ShadowBegin = MemToShadow(Ptr);
   uptr ShadowEnd = MemToShadow(Ptr + Size - 1);
   assert(ShadowBegin <= ShadowEnd);
-  {
-    static const size_t PageSize = GetVirtualMemGranularity(Context, Device);
-
-    ur_physical_mem_properties_t Desc{UR_STRUCTURE_TYPE_PHYSICAL_MEM_PROPERTIES,
-                                      nullptr, 0};
-
-    // Make sure [Ptr, Ptr + Size] is mapped to physical memory
-    for (auto MappedPtr = RoundDownTo(ShadowBegin, PageSize);
-         MappedPtr <= ShadowEnd; MappedPtr += PageSize) {
-      std::scoped_lock<ur_mutex> Guard(VirtualMemMapsMutex);
-      if (VirtualMemMaps.find(MappedPtr) == VirtualMemMaps.end()) {
-        ur_physical_mem_handle_t PhysicalMem{};
-        auto URes = getContext()->urDdiTable.PhysicalMem.pfnCreate(
-            Context, Device, PageSize, &Desc, &PhysicalMem);
-        if (URes != UR_RESULT_SUCCESS) {
-          getContext()->logger.error("urPhysicalMemCreate(): {}", URes);
-          return URes;
-        }
-
-        URes = getContext()->urDdiTable.VirtualMem.pfnMap(
-            Context, (void *)MappedPtr, PageSize, PhysicalMem, 0,
-            UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
-        if (URes != UR_RESULT_SUCCESS) {
-          getContext()->logger.error("urVirtualMemMap({}, {}): {}",
-                                     (void *)MappedPtr, PageSize, URes);
-          return URes;
-        }
-
-        getContext()->logger.debug("urVirtualMemMap: {} ~ {}",
-                                   (void *)MappedPtr,
-                                   (void *)(MappedPtr + PageSize - 1));
-
-        // Initialize to zero
-        URes = EnqueueUSMBlockingSet(Queue, (void *)MappedPtr, 0, PageSize);
-        if (URes != UR_RESULT_SUCCESS) {
-          getContext()->logger.error("EnqueueUSMBlockingSet(): {}", URes);
-          return URes;
-        }
-
-        VirtualMemMaps[MappedPtr] = PhysicalMem;
-      }
-    }
-  }
+  UR_CALL(MapShadow(Queue, ShadowBegin, ShadowEnd));
 
   auto URes = EnqueueUSMBlockingSet(Queue, (void *)ShadowBegin, Value,
                                     ShadowEnd - ShadowBegin + 1);
@@ -246,44 +395,152 @@ ur_result_t ShadowMemoryGPU::EnqueuePoisonShadow(ur_queue_handle_t Queue,
   return UR_RESULT_SUCCESS;
 }
 
-ur_result_t ShadowMemoryGPU::AllocLocalShadow(ur_queue_handle_t Queue,
-                                              uint32_t NumWG, uptr &Begin,
-                                              uptr &End) {
-  const size_t LocalMemorySize = GetDeviceLocalMemorySize(Device);
-  const size_t RequiredShadowSize =
-      (NumWG * LocalMemorySize) >> ASAN_SHADOW_SCALE;
-  static size_t LastAllocedSize = 0;
-  if (RequiredShadowSize > LastAllocedSize) {
-    auto ContextInfo = getAsanInterceptor()->getContextInfo(Context);
-    if (LocalShadowOffset) {
-      UR_CALL(getContext()->urDdiTable.USM.pfnFree(Context,
-                                                   (void *)LocalShadowOffset));
-      ContextInfo->Stats.UpdateShadowFreed(LastAllocedSize);
-      LocalShadowOffset = 0;
-      LastAllocedSize = 0;
+size_t ShadowMemoryGPU::GetResidentSize() {
+  static const size_t PageSize = GetVirtualMemGranularity(Context, Device);
+  std::scoped_lock<ur_mutex> Guard(VirtualMemMapsMutex);
+  return VirtualMemMaps.size() * PageSize;
+}
+
+ur_result_t ShadowMemoryGPU::MapShadow(ur_queue_handle_t Queue,
+                                       uptr ShadowBegin, uptr ShadowEnd) {
+  static const size_t PageSize = GetVirtualMemGranularity(Context, Device);
+
+  ur_physical_mem_properties_t Desc{UR_STRUCTURE_TYPE_PHYSICAL_MEM_PROPERTIES,
+                                    nullptr, 0};
+
+  for (auto MappedPtr = RoundDownTo(ShadowBegin, PageSize);
+       MappedPtr <= ShadowEnd; MappedPtr += PageSize) {
+    std::scoped_lock<ur_mutex> Guard(VirtualMemMapsMutex);
+    if (VirtualMemMaps.find(MappedPtr) == VirtualMemMaps.end()) {
+      ur_physical_mem_handle_t PhysicalMem{};
+      auto URes = getContext()->urDdiTable.PhysicalMem.pfnCreate(
+          Context, Device, PageSize, &Desc, &PhysicalMem);
+      if (URes != UR_RESULT_SUCCESS) {
+        getContext()->logger.error("urPhysicalMemCreate(): {}", URes);
+        return URes;
+      }
+
+      URes = getContext()->urDdiTable.VirtualMem.pfnMap(
+          Context, (void *)MappedPtr, PageSize, PhysicalMem, 0,
+          UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+      if (URes != UR_RESULT_SUCCESS) {
+        getContext()->logger.error("urVirtualMemMap({}, {}): {}",
+                                   (void *)MappedPtr, PageSize, URes);
+        return URes;
+      }
+
+      getContext()->logger.debug("urVirtualMemMap: {} ~ {}", (void *)MappedPtr,
+                                 (void *)(MappedPtr + PageSize - 1));
+
+      // Initialize to zero. Other contexts poison the page on queues of
+      // their own once it is in VirtualMemMaps, so wait for it.
+      ur_event_handle_t ZeroEvent{};
+      URes = EnqueueUSMBlockingSet(Queue, (void *)MappedPtr, 0, PageSize, 0,
+                                   nullptr, &ZeroEvent);
+      if (URes != UR_RESULT_SUCCESS) {
+        getContext()->logger.error("EnqueueUSMBlockingSet(): {}", URes);
+        return URes;
+      }
+      URes = getContext()->urDdiTable.Event.pfnWait(1, &ZeroEvent);
+      getContext()->urDdiTable.Event.pfnRelease(ZeroEvent);
+      if (URes != UR_RESULT_SUCCESS) {
+        getContext()->logger.error("urEventWait(): {}", URes);
+        return URes;
+      }
+
+      VirtualMemMaps[MappedPtr] = PhysicalMem;
     }
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+ShadowMemoryGPU::EnqueuePoisonShadowBatch(ur_queue_handle_t Queue,
+                                          const ShadowPoisonBatch &Batch,
+                                          ur_event_handle_t *OutEvent) {
+  *OutEvent = nullptr;
+  if (Batch.empty()) {
+    return UR_RESULT_SUCCESS;
+  }
 
-    UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
-        Context, Device, nullptr, nullptr, RequiredShadowSize,
-        (void **)&LocalShadowOffset));
+  auto Ranges = Batch.coalesce();
+  for (const auto &R : Ranges) {
+    UR_CALL(MapShadow(Queue, R.Begin, R.End - 1));
+  }
 
-    // Initialize shadow memory
-    ur_result_t URes = EnqueueUSMBlockingSet(Queue, (void *)LocalShadowOffset,
-                                             0, RequiredShadowSize);
+  // The queue is in-order, so the last fill completes after all others.
+  for (size_t I = 0; I < Ranges.size(); I++) {
+    const auto &R = Ranges[I];
+    auto URes = EnqueueUSMBlockingSet(
+        Queue, (void *)R.Begin, R.Value, R.End - R.Begin, 0, nullptr,
+        I + 1 == Ranges.size() ? OutEvent : nullptr);
     if (URes != UR_RESULT_SUCCESS) {
-      UR_CALL(getContext()->urDdiTable.USM.pfnFree(Context,
-                                                   (void *)LocalShadowOffset));
-      LocalShadowOffset = 0;
-      LastAllocedSize = 0;
+      getContext()->logger.error("EnqueueUSMBlockingSet(): {}", URes);
+      return URes;
     }
+  }
+  getContext()->logger.debug("EnqueuePoisonShadowBatch(ranges={}, count={})",
+                             Ranges.size(), GetTotalSize(Ranges));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ShadowMemoryGPU::AcquireSlice(ShadowSliceRing &Slices,
+                                          ur_queue_handle_t Queue, size_t Size,
+                                          uptr &Begin) {
+  if (Slices.TryAcquire(Size, Begin)) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  uptr NewBegin = 0;
+  UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
+      Context, Device, nullptr, nullptr, Size, (void **)&NewBegin));
 
-    ContextInfo->Stats.UpdateShadowMalloced(RequiredShadowSize);
+  // Initialize shadow memory
+  ur_result_t URes = EnqueueUSMBlockingSet(Queue, (void *)NewBegin, 0, Size);
+  if (URes != UR_RESULT_SUCCESS) {
+    getContext()->urDdiTable.USM.pfnFree(Context, (void *)NewBegin);
+    return URes;
+  }
+
+  getAsanInterceptor()->getContextInfo(Context)->Stats.UpdateShadowMalloced(
+      Size);
 
-    LastAllocedSize = RequiredShadowSize;
+  Slices.Add(NewBegin, Size);
+  Begin = NewBegin;
+  return UR_RESULT_SUCCESS;
+}
+
+void ShadowMemoryGPU::ReleaseSlice(ShadowSliceRing &Slices, uptr Begin) {
+  ShadowSliceRing::Slice Evicted;
+  if (!Slices.Release(Begin, Evicted)) {
+    return;
   }
 
-  Begin = LocalShadowOffset;
-  End = LocalShadowOffset + RequiredShadowSize - 1;
+  [[maybe_unused]] auto URes =
+      getContext()->urDdiTable.USM.pfnFree(Context, (void *)Evicted.Begin);
+  assert(URes == UR_RESULT_SUCCESS);
+  getAsanInterceptor()->getContextInfo(Context)->Stats.UpdateShadowFreed(
+      Evicted.Size);
+}
+
+ur_result_t ShadowMemoryGPU::DestroySlices(ShadowSliceRing &Slices) {
+  for (const auto &Slice : Slices.TakeAll()) {
+    UR_CALL(getContext()->urDdiTable.USM.pfnFree(Context, (void *)Slice.Begin));
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ShadowMemoryGPU::AllocLocalShadow(ur_queue_handle_t Queue,
+                                              uint32_t NumWG, uptr &Begin,
+                                              uptr &End) {
+  const size_t LocalMemorySize = GetDeviceLocalMemorySize(Device);
+  const size_t RequiredShadowSize =
+      (NumWG * LocalMemorySize) >> ASAN_SHADOW_SCALE;
+
+  UR_CALL(AcquireSlice(LocalShadows, Queue, RequiredShadowSize, Begin));
+  End = Begin + RequiredShadowSize - 1;
   return UR_RESULT_SUCCESS;
 }
 
@@ -292,39 +549,18 @@ ur_result_t ShadowMemoryGPU::AllocPrivateShadow(ur_queue_handle_t Queue,
                                                 uptr &End) {
   const size_t RequiredShadowSize =
       (NumWG * ASAN_PRIVATE_SIZE) >> ASAN_SHADOW_SCALE;
-  static size_t LastAllocedSize = 0;
-  if (RequiredShadowSize > LastAllocedSize) {
-    auto ContextInfo = getAsanInterceptor()->getContextInfo(Context);
-    if (PrivateShadowOffset) {
-      UR_CALL(getContext()->urDdiTable.USM.pfnFree(
-          Context, (void *)PrivateShadowOffset));
-      ContextInfo->Stats.UpdateShadowFreed(LastAllocedSize);
-      PrivateShadowOffset = 0;
-      LastAllocedSize = 0;
-    }
 
-    UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
-        Context, Device, nullptr, nullptr, RequiredShadowSize,
-        (void **)&PrivateShadowOffset));
-
-    // Initialize shadow memory
-    ur_result_t URes = EnqueueUSMBlockingSet(Queue, (void *)PrivateShadowOffset,
-                                             0, RequiredShadowSize);
-    if (URes != UR_RESULT_SUCCESS) {
-      UR_CALL(getContext()->urDdiTable.USM.pfnFree(
-          Context, (void *)PrivateShadowOffset));
-      PrivateShadowOffset = 0;
-      LastAllocedSize = 0;
-    }
-
-    ContextInfo->Stats.UpdateShadowMalloced(RequiredShadowSize);
+  UR_CALL(AcquireSlice(PrivateShadows, Queue, RequiredShadowSize, Begin));
+  End = Begin + RequiredShadowSize - 1;
+  return UR_RESULT_SUCCESS;
+}
 
-    LastAllocedSize = RequiredShadowSize;
-  }
+void ShadowMemoryGPU::ReleaseLocalShadow(uptr Begin) {
+  ReleaseSlice(LocalShadows, Begin);
+}
 
-  Begin = PrivateShadowOffset;
-  End = PrivateShadowOffset + RequiredShadowSize - 1;
-  return UR_RESULT_SUCCESS;
+void ShadowMemoryGPU::ReleasePrivateShadow(uptr Begin) {
+  ReleaseSlice(PrivateShadows, Begin);
 }
 
 uptr ShadowMemoryPVC::MemToShadow(uptr Ptr) {
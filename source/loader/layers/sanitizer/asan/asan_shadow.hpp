@@ -14,14 +14,46 @@
 #pragma once
 
 #include "asan_allocator.hpp"
+#include "asan_shadow_slices.hpp"
 #include "sanitizer_common/sanitizer_libdevice.hpp"
 #include "ur_sanitizer_layer.hpp"
 
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace ur_sanitizer_layer {
 namespace asan {
 
+/// Shadow values to be written in one go, e.g. for all allocations that
+/// changed since the last launch. Ranges added later take precedence over the
+/// overlapping parts of ranges added before, just as if they were poisoned one
+/// after the other.
+class ShadowPoisonBatch {
+public:
+  /// [Begin, End) in shadow memory
+  struct Range {
+    uptr Begin;
+    uptr End;
+    u8 Value;
+  };
+
+  void add(uptr ShadowBegin, uptr ShadowEnd, u8 Value) {
+    if (ShadowBegin < ShadowEnd) {
+      Pending.push_back({ShadowBegin, ShadowEnd, Value});
+    }
+  }
+
+  bool empty() const { return Pending.empty(); }
+
+  /// Returns sorted, disjoint ranges with the overwritten parts dropped and
+  /// adjacent ranges of the same value merged.
+  std::vector<Range> coalesce() const;
+
+private:
+  std::vector<Range> Pending;
+};
+
 struct ShadowMemory {
   ShadowMemory(ur_context_handle_t Context, ur_device_handle_t Device)
       : Context(Context), Device(Device) {
@@ -45,6 +77,20 @@ struct ShadowMemory {
   virtual ur_result_t EnqueuePoisonShadow(ur_queue_handle_t Queue, uptr Ptr,
                                           uptr Size, u8 Value) = 0;
 
+  /// Adds the poisoning of [Ptr, Ptr + Size) to Batch instead of enqueuing it
+  void PoisonShadow(ShadowPoisonBatch &Batch, uptr Ptr, uptr Size, u8 Value) {
+    if (Size) {
+      Batch.add(MemToShadow(Ptr), MemToShadow(Ptr + Size - 1) + 1, Value);
+    }
+  }
+
+  /// Writes Batch without waiting for it. OutEvent is set to an event which
+  /// completes along with all of the writes, or to nullptr if they are done
+  /// already. Queue has to be in-order.
+  virtual ur_result_t EnqueuePoisonShadowBatch(ur_queue_handle_t Queue,
+                                               const ShadowPoisonBatch &Batch,
+                                               ur_event_handle_t *OutEvent) = 0;
+
   virtual size_t GetShadowSize() = 0;
 
   virtual ur_result_t AllocLocalShadow(ur_queue_handle_t Queue, uint32_t NumWG,
@@ -54,6 +100,18 @@ struct ShadowMemory {
                                          uint32_t NumWG, uptr &Begin,
                                          uptr &End) = 0;
 
+  // Return the shadow of a launch that has completed, so that it can be
+  // handed out to later launches.
+  virtual void ReleaseLocalShadow(uptr) {}
+
+  virtual void ReleasePrivateShadow(uptr) {}
+
+  // Return the shadow pages of an allocation that was freed to the adapter.
+  // Returns the number of bytes released.
+  virtual size_t ReleaseShadow(std::shared_ptr<AllocInfo>) { return 0; }
+
+  virtual size_t GetResidentSize() { return 0; }
+
   ur_context_handle_t Context{};
 
   ur_device_handle_t Device{};
@@ -76,8 +134,16 @@ struct ShadowMemoryCPU final : public ShadowMemory {
   ur_result_t EnqueuePoisonShadow(ur_queue_handle_t Queue, uptr Ptr, uptr Size,
                                   u8 Value) override;
 
+  ur_result_t EnqueuePoisonShadowBatch(ur_queue_handle_t Queue,
+                                       const ShadowPoisonBatch &Batch,
+                                       ur_event_handle_t *OutEvent) override;
+
   size_t GetShadowSize() override { return 0x80000000000ULL; }
 
+  size_t ReleaseShadow(std::shared_ptr<AllocInfo> AI) override;
+
+  size_t GetResidentSize() override;
+
   ur_result_t AllocLocalShadow(ur_queue_handle_t, uint32_t, uptr &Begin,
                                uptr &End) override {
     Begin = ShadowBegin;
@@ -103,19 +169,43 @@ struct ShadowMemoryGPU : public ShadowMemory {
   ur_result_t EnqueuePoisonShadow(ur_queue_handle_t Queue, uptr Ptr, uptr Size,
                                   u8 Value) override final;
 
+  ur_result_t
+  EnqueuePoisonShadowBatch(ur_queue_handle_t Queue,
+                           const ShadowPoisonBatch &Batch,
+                           ur_event_handle_t *OutEvent) override final;
+
   ur_result_t AllocLocalShadow(ur_queue_handle_t Queue, uint32_t NumWG,
                                uptr &Begin, uptr &End) override final;
 
   ur_result_t AllocPrivateShadow(ur_queue_handle_t Queue, uint32_t NumWG,
                                  uptr &Begin, uptr &End) override final;
 
+  void ReleaseLocalShadow(uptr Begin) override final;
+
+  void ReleasePrivateShadow(uptr Begin) override final;
+
+  size_t GetResidentSize() override final;
+
+  // Make sure the shadow [ShadowBegin, ShadowEnd] is backed by physical memory
+  ur_result_t MapShadow(ur_queue_handle_t Queue, uptr ShadowBegin,
+                        uptr ShadowEnd);
+
+  // Take a slice of at least Size bytes from Slices, allocating and
+  // initializing a new one if none of the free slices fits
+  ur_result_t AcquireSlice(ShadowSliceRing &Slices, ur_queue_handle_t Queue,
+                           size_t Size, uptr &Begin);
+
+  void ReleaseSlice(ShadowSliceRing &Slices, uptr Begin);
+
+  ur_result_t DestroySlices(ShadowSliceRing &Slices);
+
   ur_mutex VirtualMemMapsMutex;
 
   std::unordered_map<uptr, ur_physical_mem_handle_t> VirtualMemMaps;
 
-  uptr LocalShadowOffset = 0;
+  ShadowSliceRing LocalShadows;
 
-  uptr PrivateShadowOffset = 0;
+  ShadowSliceRing PrivateShadows;
 };
 
 /// Shadow Memory layout of GPU PVC device
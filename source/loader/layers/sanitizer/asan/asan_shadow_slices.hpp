@@ -0,0 +1,115 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_shadow_slices.hpp
+ *
+ */
+
+#pragma once
+
+#include "sanitizer_common/sanitizer_common.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ur_sanitizer_layer {
+namespace asan {
+
+/// Local and private shadow are only needed while a kernel runs, so instead of
+/// sharing a single region per device, which forces launches to be serialized,
+/// every launch borrows a slice of its own. Slices of completed launches are
+/// kept around and reused by later launches that fit into them.
+///
+/// The ring only keeps track of the slices, allocating and freeing them is up
+/// to the owner.
+class ShadowSliceRing {
+public:
+  struct Slice {
+    uptr Begin;
+    size_t Size;
+  };
+
+  static constexpr size_t MaxFreeSlices = 8;
+
+  /// Hands out the smallest free slice of at least Size bytes. Returns false
+  /// if there is none, in which case the caller allocates a new slice and
+  /// hands it over with Add().
+  bool TryAcquire(size_t Size, uptr &Begin) {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    auto Best = FreeSlices.end();
+    for (auto It = FreeSlices.begin(); It != FreeSlices.end(); ++It) {
+      if (It->Size < Size) {
+        continue;
+      }
+      if (Best == FreeSlices.end() || It->Size < Best->Size) {
+        Best = It;
+      }
+    }
+    if (Best == FreeSlices.end()) {
+      return false;
+    }
+    Begin = Best->Begin;
+    UsedSlices.emplace(Best->Begin, Best->Size);
+    FreeSlices.erase(Best);
+    return true;
+  }
+
+  /// Records a newly allocated slice as in use.
+  void Add(uptr Begin, size_t Size) {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    UsedSlices.emplace(Begin, Size);
+  }
+
+  /// Makes the slice at Begin available to later launches. If more than
+  /// MaxFreeSlices are free then, the smallest one is dropped from the ring
+  /// and returned in Evicted, for the caller to free.
+  bool Release(uptr Begin, Slice &Evicted) {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    auto It = UsedSlices.find(Begin);
+    if (It == UsedSlices.end()) {
+      return false;
+    }
+    FreeSlices.push_back({It->first, It->second});
+    UsedSlices.erase(It);
+
+    if (FreeSlices.size() <= MaxFreeSlices) {
+      return false;
+    }
+    // Keep the larger slices, they can serve any launch
+    auto Smallest = std::min_element(
+        FreeSlices.begin(), FreeSlices.end(),
+        [](const Slice &A, const Slice &B) { return A.Size < B.Size; });
+    Evicted = *Smallest;
+    FreeSlices.erase(Smallest);
+    return true;
+  }
+
+  /// Drops all slices, free or in use, and returns them for the caller to
+  /// free.
+  std::vector<Slice> TakeAll() {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    std::vector<Slice> Slices = std::move(FreeSlices);
+    FreeSlices.clear();
+    for (const auto &[Begin, Size] : UsedSlices) {
+      Slices.push_back({Begin, Size});
+    }
+    UsedSlices.clear();
+    return Slices;
+  }
+
+private:
+  ur_mutex Mutex;
+  std::vector<Slice> FreeSlices;
+  std::unordered_map<uptr, size_t> UsedSlices;
+};
+
+} // namespace asan
+} // namespace ur_sanitizer_layer
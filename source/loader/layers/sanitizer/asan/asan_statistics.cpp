@@ -13,6 +13,7 @@
 
 #include "asan_statistics.hpp"
 #include "asan_interceptor.hpp"
+#include "sanitizer_common/sanitizer_stackdepot.hpp"
 #include "ur_sanitizer_layer.hpp"
 
 #include <atomic>
@@ -28,6 +29,7 @@ struct AsanStats {
   void UpdateShadowMmaped(uptr ShadowSize);
   void UpdateShadowMalloced(uptr ShadowSize);
   void UpdateShadowFreed(uptr ShadowSize);
+  void UpdateShadowReleased(uptr ShadowSize);
 
   void Print(ur_context_handle_t Context);
 
@@ -40,6 +42,9 @@ private:
 
   std::atomic<uptr> ShadowMalloced;
 
+  // Shadow pages given back to the OS once their memory was really freed
+  std::atomic<uptr> ShadowReleased{0};
+
   double Overhead = 0.0;
 
   void UpdateOverhead();
@@ -49,6 +54,14 @@ void AsanStats::Print(ur_context_handle_t Context) {
   getContext()->logger.always("Stats: Context {}", (void *)Context);
   getContext()->logger.always("Stats:   peak memory overhead: {}%",
                               Overhead * 100);
+
+  getContext()->logger.always(
+      "Stats:   shadow memory: {} bytes resident, {} bytes released",
+      getAsanInterceptor()->getShadowResidentSize(), ShadowReleased);
+
+  auto DepotStats = StackDepotGetStats();
+  getContext()->logger.always("Stats:   stack depot: {} stacks, {} bytes",
+                              DepotStats.NumStacks, DepotStats.AllocatedSize);
 }
 
 void AsanStats::UpdateUSMMalloced(uptr MallocedSize, uptr RedzoneSize) {
@@ -91,6 +104,12 @@ void AsanStats::UpdateShadowFreed(uptr ShadowSize) {
   UpdateOverhead();
 }
 
+void AsanStats::UpdateShadowReleased(uptr ShadowSize) {
+  ShadowReleased += ShadowSize;
+  getContext()->logger.debug("Stats: UpdateShadowReleased(ShadowReleased={})",
+                             ShadowReleased);
+}
+
 void AsanStats::UpdateOverhead() {
   auto TotalSize = UsmMalloced + ShadowMalloced;
   if (TotalSize == 0) {
@@ -130,6 +149,12 @@ void AsanStatsWrapper::UpdateShadowFreed(uptr ShadowSize) {
   }
 }
 
+void AsanStatsWrapper::UpdateShadowReleased(uptr ShadowSize) {
+  if (Stat) {
+    Stat->UpdateShadowReleased(ShadowSize);
+  }
+}
+
 void AsanStatsWrapper::Print(ur_context_handle_t Context) {
   if (Stat) {
     Stat->Print(Context);
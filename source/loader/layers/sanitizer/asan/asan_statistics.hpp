@@ -31,6 +31,7 @@ struct AsanStatsWrapper {
 
   void UpdateShadowMalloced(uptr ShadowSize);
   void UpdateShadowFreed(uptr ShadowSize);
+  void UpdateShadowReleased(uptr ShadowSize);
 
   void Print(ur_context_handle_t Context);
 
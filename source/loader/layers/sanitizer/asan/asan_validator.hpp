@@ -32,7 +32,10 @@ struct ValidateUSMResult {
 
   operator bool() { return Type != SUCCESS; }
 
-  static ValidateUSMResult success() { return {SUCCESS, nullptr}; }
+  static ValidateUSMResult
+  success(const std::shared_ptr<AllocInfo> &AI = nullptr) {
+    return {SUCCESS, AI};
+  }
 
   static ValidateUSMResult fail(ErrorType Type,
                                 const std::shared_ptr<AllocInfo> &AI) {
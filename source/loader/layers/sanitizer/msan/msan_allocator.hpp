@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include "sanitizer_common/sanitizer_allocation_index.hpp"
 #include "sanitizer_common/sanitizer_allocator.hpp"
 #include "sanitizer_common/sanitizer_common.hpp"
 #include "sanitizer_common/sanitizer_stacktrace.hpp"
@@ -35,8 +36,7 @@ struct MsanAllocInfo {
   void print();
 };
 
-using MsanAllocationMap = std::map<uptr, std::shared_ptr<MsanAllocInfo>>;
-using MsanAllocationIterator = MsanAllocationMap::iterator;
+using MsanAllocationMap = AllocationIndex<MsanAllocInfo>;
 
 } // namespace msan
 } // namespace ur_sanitizer_layer
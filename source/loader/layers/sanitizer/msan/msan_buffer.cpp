@@ -50,9 +50,9 @@ ur_result_t EnqueueMemCopyRectHelper(
                     DstSlicePitch * DstOffset.z;
 
   const bool IsDstDeviceUSM =
-      getMsanInterceptor()->findAllocInfoByAddress((uptr)DstOrigin).has_value();
+      getMsanInterceptor()->findAllocInfoByAddress((uptr)DstOrigin) != nullptr;
   const bool IsSrcDeviceUSM =
-      getMsanInterceptor()->findAllocInfoByAddress((uptr)SrcOrigin).has_value();
+      getMsanInterceptor()->findAllocInfoByAddress((uptr)SrcOrigin) != nullptr;
 
   ur_device_handle_t Device = GetDevice(Queue);
   std::shared_ptr<DeviceInfo> DeviceInfo =
@@ -1424,10 +1424,8 @@ ur_result_t UR_APICALL urEnqueueUSMFill(
   Events.push_back(Event);
 
   const auto Mem = (uptr)pMem;
-  auto MemInfoItOp = getMsanInterceptor()->findAllocInfoByAddress(Mem);
-  if (MemInfoItOp) {
-    auto MemInfo = (*MemInfoItOp)->second;
-
+  auto MemInfo = getMsanInterceptor()->findAllocInfoByAddress(Mem);
+  if (MemInfo) {
     const auto &DeviceInfo =
         getMsanInterceptor()->getDeviceInfo(MemInfo->Device);
     const auto MemShadow = DeviceInfo->Shadow->MemToShadow(Mem);
@@ -1480,13 +1478,10 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy(
   Events.push_back(Event);
 
   const auto Src = (uptr)pSrc, Dst = (uptr)pDst;
-  auto SrcInfoItOp = getMsanInterceptor()->findAllocInfoByAddress(Src);
-  auto DstInfoItOp = getMsanInterceptor()->findAllocInfoByAddress(Dst);
-
-  if (SrcInfoItOp && DstInfoItOp) {
-    auto SrcInfo = (*SrcInfoItOp)->second;
-    auto DstInfo = (*DstInfoItOp)->second;
+  auto SrcInfo = getMsanInterceptor()->findAllocInfoByAddress(Src);
+  auto DstInfo = getMsanInterceptor()->findAllocInfoByAddress(Dst);
 
+  if (SrcInfo && DstInfo) {
     const auto &DeviceInfo =
         getMsanInterceptor()->getDeviceInfo(SrcInfo->Device);
     const auto SrcShadow = DeviceInfo->Shadow->MemToShadow(Src);
@@ -1496,9 +1491,7 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     UR_CALL(pfnUSMMemcpy(hQueue, blocking, (void *)DstShadow, (void *)SrcShadow,
                          size, 0, nullptr, &Event));
     Events.push_back(Event);
-  } else if (DstInfoItOp) {
-    auto DstInfo = (*DstInfoItOp)->second;
-
+  } else if (DstInfo) {
     const auto &DeviceInfo =
         getMsanInterceptor()->getDeviceInfo(DstInfo->Device);
     auto DstShadow = DeviceInfo->Shadow->MemToShadow(Dst);
@@ -1557,10 +1550,8 @@ ur_result_t UR_APICALL urEnqueueUSMFill2D(
   Events.push_back(Event);
 
   const auto Mem = (uptr)pMem;
-  auto MemInfoItOp = getMsanInterceptor()->findAllocInfoByAddress(Mem);
-  if (MemInfoItOp) {
-    auto MemInfo = (*MemInfoItOp)->second;
-
+  auto MemInfo = getMsanInterceptor()->findAllocInfoByAddress(Mem);
+  if (MemInfo) {
     const auto &DeviceInfo =
         getMsanInterceptor()->getDeviceInfo(MemInfo->Device);
     const auto MemShadow = DeviceInfo->Shadow->MemToShadow(Mem);
@@ -1622,13 +1613,10 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
   Events.push_back(Event);
 
   const auto Src = (uptr)pSrc, Dst = (uptr)pDst;
-  auto SrcInfoItOp = getMsanInterceptor()->findAllocInfoByAddress(Src);
-  auto DstInfoItOp = getMsanInterceptor()->findAllocInfoByAddress(Dst);
-
-  if (SrcInfoItOp && DstInfoItOp) {
-    auto SrcInfo = (*SrcInfoItOp)->second;
-    auto DstInfo = (*DstInfoItOp)->second;
+  auto SrcInfo = getMsanInterceptor()->findAllocInfoByAddress(Src);
+  auto DstInfo = getMsanInterceptor()->findAllocInfoByAddress(Dst);
 
+  if (SrcInfo && DstInfo) {
     const auto &DeviceInfo =
         getMsanInterceptor()->getDeviceInfo(SrcInfo->Device);
     const auto SrcShadow = DeviceInfo->Shadow->MemToShadow(Src);
@@ -1639,9 +1627,7 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
                            (void *)SrcShadow, srcPitch, width, height, 0,
                            nullptr, &Event));
     Events.push_back(Event);
-  } else if (DstInfoItOp) {
-    auto DstInfo = (*DstInfoItOp)->second;
-
+  } else if (DstInfo) {
     const auto &DeviceInfo =
         getMsanInterceptor()->getDeviceInfo(DstInfo->Device);
     const auto DstShadow = DeviceInfo->Shadow->MemToShadow(Dst);
@@ -88,10 +88,7 @@ ur_result_t MsanInterceptor::allocateMemory(ur_context_handle_t Context,
   AI->print();
 
   // For memory release
-  {
-    std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-    m_AllocationMap.emplace(AI->AllocBegin, AI);
-  }
+  m_AllocationMap.insert(AI);
 
   // Update shadow memory
   ManagedQueue Queue(Context, Device);
@@ -104,11 +101,16 @@ ur_result_t MsanInterceptor::allocateMemory(ur_context_handle_t Context,
 ur_result_t MsanInterceptor::releaseMemory(ur_context_handle_t Context,
                                            void *Ptr) {
   auto Addr = reinterpret_cast<uptr>(Ptr);
-  auto AddrInfoItOp = findAllocInfoByAddress(Addr);
-
-  if (AddrInfoItOp) {
-    std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-    m_AllocationMap.erase(*AddrInfoItOp);
+  auto AllocInfo = findAllocInfoByAddress(Addr);
+
+  if (AllocInfo) {
+    m_AllocationMap.erase(AllocInfo);
+    // The GPU shadow only tracks the allocations that were around when a page
+    // got mapped, so it can't tell when a page isn't used anymore
+    auto DeviceInfo = getDeviceInfo(AllocInfo->Device);
+    if (DeviceInfo->Type == DeviceType::CPU) {
+      UR_CALL(DeviceInfo->Shadow->ReleaseShadow(AllocInfo));
+    }
   }
 
   return getContext()->urDdiTable.USM.pfnFree(Context, Ptr);
@@ -474,38 +476,6 @@ ur_result_t MsanInterceptor::prepareLaunch(
   return UR_RESULT_SUCCESS;
 }
 
-std::optional<MsanAllocationIterator>
-MsanInterceptor::findAllocInfoByAddress(uptr Address) {
-  std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-  auto It = m_AllocationMap.upper_bound(Address);
-  if (It == m_AllocationMap.begin()) {
-    return std::nullopt;
-  }
-  --It;
-
-  // Since we haven't intercepted all USM APIs, we can't make sure the found
-  // AllocInfo is correct.
-  if (Address < It->second->AllocBegin ||
-      Address >= It->second->AllocBegin + It->second->AllocSize) {
-    return std::nullopt;
-  }
-
-  return It;
-}
-
-std::vector<MsanAllocationIterator>
-MsanInterceptor::findAllocInfoByContext(ur_context_handle_t Context) {
-  std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-  std::vector<MsanAllocationIterator> AllocInfos;
-  for (auto It = m_AllocationMap.begin(); It != m_AllocationMap.end(); It++) {
-    const auto &[_, AI] = *It;
-    if (AI->Context == Context) {
-      AllocInfos.emplace_back(It);
-    }
-  }
-  return AllocInfos;
-}
-
 ur_result_t DeviceInfo::allocShadowMemory(ur_context_handle_t Context) {
   Shadow = GetMsanShadowMemory(Context, Handle, Type);
   assert(Shadow && "Failed to get shadow memory");
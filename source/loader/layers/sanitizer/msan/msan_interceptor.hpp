@@ -219,10 +219,14 @@ public:
     return UR_RESULT_SUCCESS;
   }
 
-  std::optional<MsanAllocationIterator> findAllocInfoByAddress(uptr Address);
+  std::shared_ptr<MsanAllocInfo> findAllocInfoByAddress(uptr Address) {
+    return m_AllocationMap.find(Address);
+  }
 
-  std::vector<MsanAllocationIterator>
-  findAllocInfoByContext(ur_context_handle_t Context);
+  std::vector<std::shared_ptr<MsanAllocInfo>>
+  findAllocInfoByContext(ur_context_handle_t Context) {
+    return m_AllocationMap.findByContext(Context);
+  }
 
   std::shared_ptr<msan::ContextInfo>
   getContextInfo(ur_context_handle_t Context) {
@@ -290,7 +294,6 @@ private:
 
   /// Assumption: all USM chunks are allocated in one VA
   MsanAllocationMap m_AllocationMap;
-  ur_shared_mutex m_AllocationMapMutex;
 
   MsanOptions m_Options;
 
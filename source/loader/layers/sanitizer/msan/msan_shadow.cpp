@@ -131,6 +131,19 @@ ur_result_t MsanShadowMemoryCPU::EnqueuePoisonShadow(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t
+MsanShadowMemoryCPU::ReleaseShadow(std::shared_ptr<MsanAllocInfo> AI) {
+  // Only pages covered by the shadow of this allocation alone are released
+  const uptr ShadowBegin = MemToShadow(AI->AllocBegin);
+  const uptr ShadowEnd = MemToShadow(AI->AllocBegin + AI->AllocSize);
+  auto Released = ReleaseMemoryPagesToOS(ShadowBegin, ShadowEnd - ShadowBegin);
+  if (Released) {
+    getContext()->logger.debug("ReleaseShadow(addr={}, count={})",
+                               (void *)ShadowBegin, Released);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t MsanShadowMemoryGPU::Setup() {
   // Currently, Level-Zero doesn't create independent VAs for each contexts, if
   // we reserve shadow memory for each contexts, this will cause out-of-resource
@@ -225,9 +238,9 @@ ur_result_t MsanShadowMemoryGPU::EnqueueMapShadow(
       VirtualMemMaps[MappedPtr].first = PhysicalMem;
     }
 
-    auto AllocInfoItOp = getMsanInterceptor()->findAllocInfoByAddress(Ptr);
-    if (AllocInfoItOp) {
-      VirtualMemMaps[MappedPtr].second.insert((*AllocInfoItOp)->second);
+    auto AllocInfo = getMsanInterceptor()->findAllocInfoByAddress(Ptr);
+    if (AllocInfo) {
+      VirtualMemMaps[MappedPtr].second.insert(AllocInfo);
     }
   }
 
@@ -285,6 +298,7 @@ MsanShadowMemoryGPU::ReleaseShadow(std::shared_ptr<MsanAllocInfo> AI) {
           Context, (void *)MappedPtr, PageSize));
       UR_CALL(getContext()->urDdiTable.PhysicalMem.pfnRelease(
           VirtualMemMaps[MappedPtr].first));
+      VirtualMemMaps.erase(MappedPtr);
       getContext()->logger.debug("urVirtualMemUnmap: {} ~ {}",
                                  (void *)MappedPtr,
                                  (void *)(MappedPtr + PageSize - 1));
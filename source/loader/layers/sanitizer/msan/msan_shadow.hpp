@@ -83,6 +83,8 @@ struct MsanShadowMemoryCPU final : public MsanShadowMemory {
                       uint32_t NumEvents = 0,
                       const ur_event_handle_t *EventWaitList = nullptr,
                       ur_event_handle_t *OutEvent = nullptr) override;
+
+  ur_result_t ReleaseShadow(std::shared_ptr<MsanAllocInfo> AI) override;
 };
 
 struct MsanShadowMemoryGPU : public MsanShadowMemory {
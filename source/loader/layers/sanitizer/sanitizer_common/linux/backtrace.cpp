@@ -22,8 +22,9 @@ StackTrace GetCurrentBacktrace() {
   int FrameCount = backtrace(Frames, MAX_BACKTRACE_FRAMES);
 
   StackTrace Stack;
-  Stack.stack =
-      std::vector<BacktraceFrame>(&Frames[0], &Frames[FrameCount - 1]);
+  if (FrameCount > 0) {
+    Stack.id = StackDepotPut(Frames, FrameCount - 1);
+  }
 
   return Stack;
 }
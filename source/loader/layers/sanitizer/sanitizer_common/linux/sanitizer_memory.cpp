@@ -0,0 +1,167 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file sanitizer_memory.cpp
+ *
+ */
+
+#include "sanitizer_common/sanitizer_common.hpp"
+
+#include <algorithm>
+#include <asm/param.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+namespace ur_sanitizer_layer {
+
+uptr MmapFixedNoReserve(uptr Addr, uptr Size) {
+  Size = RoundUpTo(Size, EXEC_PAGESIZE);
+  Addr = RoundDownTo(Addr, EXEC_PAGESIZE);
+  void *P =
+      mmap((void *)Addr, Size, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_FIXED | MAP_NORESERVE | MAP_ANONYMOUS, -1, 0);
+  return (uptr)P;
+}
+
+uptr MmapNoReserve(uptr Addr, uptr Size) {
+  Size = RoundUpTo(Size, EXEC_PAGESIZE);
+  Addr = RoundDownTo(Addr, EXEC_PAGESIZE);
+  void *P = mmap((void *)Addr, Size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_NORESERVE | MAP_ANONYMOUS, -1, 0);
+  if (P == MAP_FAILED) {
+    return 0;
+  }
+  return (uptr)P;
+}
+
+bool Munmap(uptr Addr, uptr Size) { return munmap((void *)Addr, Size) == 0; }
+
+uptr ProtectMemoryRange(uptr Addr, uptr Size) {
+  Size = RoundUpTo(Size, EXEC_PAGESIZE);
+  Addr = RoundDownTo(Addr, EXEC_PAGESIZE);
+  void *P =
+      mmap((void *)Addr, Size, PROT_NONE,
+           MAP_PRIVATE | MAP_FIXED | MAP_NORESERVE | MAP_ANONYMOUS, -1, 0);
+  return (uptr)P;
+}
+
+bool DontCoredumpRange(uptr Addr, uptr Size) {
+  Size = RoundUpTo(Size, EXEC_PAGESIZE);
+  Addr = RoundDownTo(Addr, EXEC_PAGESIZE);
+  return madvise((void *)Addr, Size, MADV_DONTDUMP) == 0;
+}
+
+uptr ReleaseMemoryPagesToOS(uptr Addr, uptr Size) {
+  uptr Begin = RoundUpTo(Addr, EXEC_PAGESIZE);
+  uptr End = RoundDownTo(Addr + Size, EXEC_PAGESIZE);
+  if (Begin >= End) {
+    return 0;
+  }
+  if (madvise((void *)Begin, End - Begin, MADV_DONTNEED) != 0) {
+    return 0;
+  }
+  return End - Begin;
+}
+
+namespace {
+
+// Poisoned pages are mapped in chunks of this size, which bounds the number
+// of mappings a released range takes.
+constexpr uptr kPoisonChunkSize = 64 * 1024;
+
+// Returns a file of kPoisonChunkSize bytes filled with Value, which is created
+// once per value and kept open for the lifetime of the process.
+int GetPoisonFile(u8 Value) {
+  static std::mutex Mutex;
+  static int Files[256] = {};
+
+  std::scoped_lock<std::mutex> Guard(Mutex);
+  // Stored off by one, so that zero means not created yet
+  if (Files[Value]) {
+    return Files[Value] - 1;
+  }
+
+  int Fd = memfd_create("ur_sanitizer_poison", MFD_CLOEXEC);
+  if (Fd < 0) {
+    Files[Value] = Fd + 1;
+    return Fd;
+  }
+  std::vector<char> Chunk(kPoisonChunkSize, static_cast<char>(Value));
+  if (write(Fd, Chunk.data(), Chunk.size()) != (ssize_t)Chunk.size()) {
+    close(Fd);
+    Fd = -1;
+  }
+  Files[Value] = Fd + 1;
+  return Fd;
+}
+
+} // namespace
+
+uptr ReleasePoisonedPagesToOS(uptr Addr, uptr Size, u8 Value) {
+  if (Value == 0) {
+    return ReleaseMemoryPagesToOS(Addr, Size);
+  }
+
+  uptr Begin = RoundUpTo(Addr, EXEC_PAGESIZE);
+  uptr End = RoundDownTo(Addr + Size, EXEC_PAGESIZE);
+  if (Begin >= End || End - Begin < kPoisonChunkSize) {
+    return 0;
+  }
+  int Fd = GetPoisonFile(Value);
+  if (Fd < 0) {
+    return 0;
+  }
+
+  for (uptr Chunk = Begin; Chunk < End; Chunk += kPoisonChunkSize) {
+    uptr ChunkSize = std::min(kPoisonChunkSize, End - Chunk);
+    void *P = mmap((void *)Chunk, ChunkSize, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_FIXED | MAP_NORESERVE, Fd, 0);
+    if (P == MAP_FAILED) {
+      // A failed fixed mapping may have unmapped the range already, so the
+      // rest is backed by anonymous memory and poisoned again.
+      if (MmapFixedNoReserve(Chunk, End - Chunk) != (uptr)MAP_FAILED) {
+        memset((void *)Chunk, Value, End - Chunk);
+      }
+      DontCoredumpRange(Begin, Chunk - Begin);
+      return Chunk - Begin;
+    }
+  }
+  DontCoredumpRange(Begin, End - Begin);
+  return End - Begin;
+}
+
+uptr GetResidentSize(uptr Addr, uptr Size) {
+  std::ifstream Smaps("/proc/self/smaps");
+  std::string Line;
+  bool InRange = false;
+  uptr Resident = 0;
+  while (std::getline(Smaps, Line)) {
+    uptr Begin = 0, End = 0;
+    // Every mapping starts with a "begin-end perms ..." line
+    if (sscanf(Line.c_str(), "%lx-%lx ", &Begin, &End) == 2) {
+      InRange = Begin < Addr + Size && Addr < End;
+      continue;
+    }
+    // Poisoned pages share the same page cache, so Rss would count them
+    // once for every mapping.
+    unsigned long PssKB = 0;
+    if (InRange && sscanf(Line.c_str(), "Pss: %lu kB", &PssKB) == 1) {
+      Resident += PssKB * 1024;
+    }
+  }
+  return Resident;
+}
+
+} // namespace ur_sanitizer_layer
@@ -0,0 +1,215 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file sanitizer_allocation_index.hpp
+ *
+ */
+
+#pragma once
+
+#include "sanitizer_common.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ur_sanitizer_layer {
+
+/// Index of the live allocations of an interceptor, answering which allocation
+/// an address points into and which allocations belong to a context.
+///
+/// The address space is cut into granules on a few levels of increasing size.
+/// An allocation is registered in every granule it overlaps, on the finest
+/// level where that takes at most MaxGranulesPerAlloc granules, so a lookup
+/// only has to probe a single bucket per level. Buckets are spread over shards
+/// with their own lock, so that lookups from concurrent launches and
+/// allocations in unrelated address ranges don't contend with each other, and
+/// the allocations of every context have a lock of their own as well.
+///
+/// AllocInfoT must provide AllocBegin, AllocSize and Context, which are not
+/// allowed to change while the allocation is indexed.
+template <typename AllocInfoT> class AllocationIndex {
+public:
+  using AllocInfoPtr = std::shared_ptr<AllocInfoT>;
+
+  void insert(const AllocInfoPtr &AI) {
+    auto Level = getLevel(AI->AllocBegin, AI->AllocSize);
+    forEachGranule(AI, Level, [&](uptr Granule) {
+      auto &S = getShard(Granule);
+      std::scoped_lock<ur_shared_mutex> Guard(S.Mutex);
+      S.Buckets[Level][Granule].push_back(AI);
+    });
+
+    auto &C = getContextAllocs(AI->Context);
+    std::scoped_lock<ur_shared_mutex> Guard(C.Mutex);
+    C.Allocs[AI->AllocBegin] = AI;
+  }
+
+  /// Returns false if AI was not indexed (anymore), which lets concurrent
+  /// callers agree on who owns the release of the allocation.
+  bool erase(const AllocInfoPtr &AI) {
+    auto C = findContextAllocs(AI->Context);
+    if (!C) {
+      return false;
+    }
+    {
+      std::scoped_lock<ur_shared_mutex> Guard(C->Mutex);
+      auto It = C->Allocs.find(AI->AllocBegin);
+      if (It == C->Allocs.end() || It->second != AI) {
+        return false;
+      }
+      C->Allocs.erase(It);
+    }
+
+    auto Level = getLevel(AI->AllocBegin, AI->AllocSize);
+    forEachGranule(AI, Level, [&](uptr Granule) {
+      auto &S = getShard(Granule);
+      std::scoped_lock<ur_shared_mutex> Guard(S.Mutex);
+      auto &Buckets = S.Buckets[Level];
+      auto BucketIt = Buckets.find(Granule);
+      if (BucketIt == Buckets.end()) {
+        return;
+      }
+      auto &Bucket = BucketIt->second;
+      Bucket.erase(std::remove(Bucket.begin(), Bucket.end(), AI), Bucket.end());
+      if (Bucket.empty()) {
+        Buckets.erase(BucketIt);
+      }
+    });
+    return true;
+  }
+
+  /// Returns the allocation containing Address, or nullptr if Address doesn't
+  /// belong to any allocation we know of (e.g. it's a host pointer).
+  AllocInfoPtr find(uptr Address) {
+    for (size_t Level = 0; Level < NumLevels; Level++) {
+      auto Granule = Address >> LevelShift[Level];
+      auto &S = getShard(Granule);
+      std::shared_lock<ur_shared_mutex> Guard(S.Mutex);
+      auto BucketIt = S.Buckets[Level].find(Granule);
+      if (BucketIt == S.Buckets[Level].end()) {
+        continue;
+      }
+      for (const auto &AI : BucketIt->second) {
+        if (Address >= AI->AllocBegin &&
+            Address - AI->AllocBegin < AI->AllocSize) {
+          return AI;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  std::vector<AllocInfoPtr> findByContext(ur_context_handle_t Context) {
+    std::vector<AllocInfoPtr> AllocInfos;
+    auto C = findContextAllocs(Context);
+    if (!C) {
+      return AllocInfos;
+    }
+    std::shared_lock<ur_shared_mutex> Guard(C->Mutex);
+    AllocInfos.reserve(C->Allocs.size());
+    for (const auto &[_, AI] : C->Allocs) {
+      AllocInfos.emplace_back(AI);
+    }
+    return AllocInfos;
+  }
+
+  void clear() {
+    for (auto &S : m_Shards) {
+      std::scoped_lock<ur_shared_mutex> Guard(S.Mutex);
+      for (auto &Buckets : S.Buckets) {
+        Buckets.clear();
+      }
+    }
+    std::shared_lock<ur_shared_mutex> Guard(m_ContextMutex);
+    for (auto &[_, C] : m_ContextMap) {
+      std::scoped_lock<ur_shared_mutex> ContextGuard(C->Mutex);
+      C->Allocs.clear();
+    }
+  }
+
+private:
+  static constexpr size_t NumLevels = 4;
+  static constexpr uptr LevelShift[NumLevels] = {16, 24, 32, 40};
+  static constexpr uptr MaxGranulesPerAlloc = 16;
+  static constexpr size_t NumShards = 64;
+
+  struct Shard {
+    ur_shared_mutex Mutex;
+    std::array<std::unordered_map<uptr, std::vector<AllocInfoPtr>>, NumLevels>
+        Buckets;
+  };
+
+  static uptr getLastByte(uptr Begin, uptr Size) {
+    return Size ? Begin + Size - 1 : Begin;
+  }
+
+  static size_t getLevel(uptr Begin, uptr Size) {
+    auto Last = getLastByte(Begin, Size);
+    for (size_t Level = 0; Level + 1 < NumLevels; Level++) {
+      auto Shift = LevelShift[Level];
+      if ((Last >> Shift) - (Begin >> Shift) < MaxGranulesPerAlloc) {
+        return Level;
+      }
+    }
+    return NumLevels - 1;
+  }
+
+  template <typename Fn>
+  static void forEachGranule(const AllocInfoPtr &AI, size_t Level, Fn &&F) {
+    auto Shift = LevelShift[Level];
+    auto Last = getLastByte(AI->AllocBegin, AI->AllocSize) >> Shift;
+    for (auto Granule = AI->AllocBegin >> Shift; Granule <= Last; Granule++) {
+      F(Granule);
+    }
+  }
+
+  Shard &getShard(uptr Granule) {
+    // Fibonacci hashing, neighbouring granules end up in different shards
+    auto Hash = static_cast<uint64_t>(Granule) * 0x9E3779B97F4A7C15ULL;
+    return m_Shards[(Hash >> 32) % NumShards];
+  }
+
+  struct ContextAllocs {
+    ur_shared_mutex Mutex;
+    std::unordered_map<uptr, AllocInfoPtr> Allocs;
+  };
+
+  ContextAllocs *findContextAllocs(ur_context_handle_t Context) {
+    std::shared_lock<ur_shared_mutex> Guard(m_ContextMutex);
+    auto It = m_ContextMap.find(Context);
+    return It == m_ContextMap.end() ? nullptr : It->second.get();
+  }
+
+  ContextAllocs &getContextAllocs(ur_context_handle_t Context) {
+    if (auto C = findContextAllocs(Context)) {
+      return *C;
+    }
+    std::scoped_lock<ur_shared_mutex> Guard(m_ContextMutex);
+    auto &C = m_ContextMap[Context];
+    if (!C) {
+      C = std::make_unique<ContextAllocs>();
+    }
+    return *C;
+  }
+
+  std::array<Shard, NumShards> m_Shards;
+
+  // Only taken exclusively the first time a context allocates, allocations
+  // and frees only lock the allocations of their own context. Contexts are
+  // never removed from the map, so that their allocations can be used
+  // without holding the lock of the map.
+  ur_shared_mutex m_ContextMutex;
+  std::unordered_map<ur_context_handle_t, std::unique_ptr<ContextAllocs>>
+      m_ContextMap;
+};
+
+} // namespace ur_sanitizer_layer
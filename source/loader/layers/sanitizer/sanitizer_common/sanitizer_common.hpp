@@ -145,6 +145,17 @@ uptr MmapNoReserve(uptr Addr, uptr Size);
 bool Munmap(uptr Addr, uptr Size);
 uptr ProtectMemoryRange(uptr Addr, uptr Size);
 bool DontCoredumpRange(uptr Addr, uptr Size);
+// Gives the whole pages in [Addr, Addr + Size) back to the OS, they read as
+// zero afterwards. Returns the number of bytes released.
+uptr ReleaseMemoryPagesToOS(uptr Addr, uptr Size);
+// Like ReleaseMemoryPagesToOS, but the pages read as Value afterwards. They
+// are mapped copy-on-write from a file filled with Value, so they take no
+// memory of their own until they are written again. Ranges too small to be
+// worth the mappings are kept. Returns the number of bytes released.
+uptr ReleasePoisonedPagesToOS(uptr Addr, uptr Size, u8 Value);
+// Returns the proportional resident size of the mappings overlapping
+// [Addr, Addr + Size), pages mapped more than once are only counted once
+uptr GetResidentSize(uptr Addr, uptr Size);
 
 void *GetMemFunctionPointer(const char *);
 
@@ -0,0 +1,224 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file sanitizer_stackdepot.cpp
+ *
+ */
+
+#include "sanitizer_stackdepot.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace ur_sanitizer_layer {
+
+namespace {
+
+constexpr uptr kTabBits = 16;
+constexpr uptr kTabSize = 1 << kTabBits;
+constexpr uptr kIdChunkBits = 16;
+constexpr uptr kIdChunkSize = 1 << kIdChunkBits;
+constexpr uptr kMaxIdChunks = 1 << (32 - kIdChunkBits);
+
+// Nodes are immutable once they are linked into the table and are never
+// freed, so readers can walk the buckets without taking any lock.
+struct StackNode {
+  StackNode *Next;
+  u32 Hash;
+  StackId Id;
+  uptr Size;
+
+  BacktraceFrame *Frames() {
+    return reinterpret_cast<BacktraceFrame *>(this + 1);
+  }
+
+  static uptr AllocSize(uptr NumFrames) {
+    return sizeof(StackNode) + NumFrames * sizeof(BacktraceFrame);
+  }
+
+  bool Equals(u32 OtherHash, const BacktraceFrame *OtherFrames,
+              uptr NumFrames) {
+    return Hash == OtherHash && Size == NumFrames &&
+           std::memcmp(Frames(), OtherFrames,
+                       NumFrames * sizeof(BacktraceFrame)) == 0;
+  }
+};
+
+u32 HashFrames(const BacktraceFrame *Frames, uptr NumFrames) {
+  // MurmurHash2, as used by compiler-rt's stack depot
+  const u32 M = 0x5bd1e995;
+  const u32 R = 24;
+  u32 H = 0x9747b28c ^ static_cast<u32>(NumFrames * sizeof(uptr));
+  for (uptr I = 0; I < NumFrames; ++I) {
+    auto Frame = reinterpret_cast<uptr>(Frames[I]);
+    for (u32 K : {static_cast<u32>(Frame), static_cast<u32>(Frame >> 32)}) {
+      K *= M;
+      K ^= K >> R;
+      K *= M;
+      H *= M;
+      H ^= K;
+    }
+  }
+  H ^= H >> 13;
+  H *= M;
+  H ^= H >> 15;
+  return H;
+}
+
+class StackDepot {
+public:
+  StackId Put(const BacktraceFrame *Frames, uptr NumFrames) {
+    u32 Hash = HashFrames(Frames, NumFrames);
+    auto &Bucket = Tab[Hash & (kTabSize - 1)];
+
+    StackNode *Head = Bucket.load(std::memory_order_acquire);
+    if (auto Node = Find(Head, nullptr, Hash, Frames, NumFrames)) {
+      return Node->Id;
+    }
+
+    StackNode *New = Allocate(Hash, Frames, NumFrames);
+    if (!New) {
+      // Out of memory or ids, the stack is reported as empty then
+      return 0;
+    }
+    for (;;) {
+      New->Next = Head;
+      if (Bucket.compare_exchange_weak(Head, New, std::memory_order_release,
+                                       std::memory_order_acquire)) {
+        NumStacks++;
+        AllocatedSize += StackNode::AllocSize(NumFrames);
+        return New->Id;
+      }
+      // Only the nodes pushed since our last look can be a match
+      if (auto Node = Find(Head, New->Next, Hash, Frames, NumFrames)) {
+        Discard(New);
+        return Node->Id;
+      }
+    }
+  }
+
+  std::vector<BacktraceFrame> Get(StackId Id) {
+    auto Chunk = IdChunks[Id >> kIdChunkBits].load(std::memory_order_acquire);
+    if (!Chunk) {
+      return {};
+    }
+    auto Node = Chunk[Id & (kIdChunkSize - 1)].load(std::memory_order_acquire);
+    if (!Node) {
+      return {};
+    }
+    return std::vector<BacktraceFrame>(Node->Frames(),
+                                       Node->Frames() + Node->Size);
+  }
+
+  StackDepotStats GetStats() { return {NumStacks, AllocatedSize}; }
+
+private:
+  static StackNode *Find(StackNode *From, StackNode *Until, u32 Hash,
+                         const BacktraceFrame *Frames, uptr NumFrames) {
+    for (auto Node = From; Node != Until; Node = Node->Next) {
+      if (Node->Equals(Hash, Frames, NumFrames)) {
+        return Node;
+      }
+    }
+    return nullptr;
+  }
+
+  StackNode *Allocate(u32 Hash, const BacktraceFrame *Frames, uptr NumFrames) {
+    auto Node =
+        static_cast<StackNode *>(std::malloc(StackNode::AllocSize(NumFrames)));
+    if (!Node) {
+      return nullptr;
+    }
+    Node->Next = nullptr;
+    Node->Hash = Hash;
+    Node->Size = NumFrames;
+    std::memcpy(Node->Frames(), Frames, NumFrames * sizeof(BacktraceFrame));
+
+    // Ids are never reused, wrapping around would hand out ids which still
+    // resolve to other stacks. The counter is wider than the ids so that it
+    // cannot wrap around itself.
+    auto Id = NextId.fetch_add(1, std::memory_order_relaxed);
+    if (Id > std::numeric_limits<StackId>::max()) {
+      std::free(Node);
+      return nullptr;
+    }
+    Node->Id = static_cast<StackId>(Id);
+
+    // The id is resolvable before the node becomes visible in the table, so
+    // that every id handed out can be looked up right away.
+    auto Slot = IdSlot(Node->Id);
+    if (!Slot) {
+      std::free(Node);
+      return nullptr;
+    }
+    Slot->store(Node, std::memory_order_release);
+    return Node;
+  }
+
+  void Discard(StackNode *Node) {
+    // The slot was created when the node was allocated
+    IdSlot(Node->Id)->store(nullptr, std::memory_order_relaxed);
+    std::free(Node);
+  }
+
+  std::atomic<StackNode *> *IdSlot(StackId Id) {
+    auto &ChunkPtr = IdChunks[Id >> kIdChunkBits];
+    auto Chunk = ChunkPtr.load(std::memory_order_acquire);
+    if (!Chunk) {
+      auto NewChunk =
+          new (std::nothrow) std::atomic<StackNode *>[kIdChunkSize]();
+      if (!NewChunk) {
+        return nullptr;
+      }
+      if (ChunkPtr.compare_exchange_strong(Chunk, NewChunk,
+                                           std::memory_order_acq_rel)) {
+        Chunk = NewChunk;
+      } else {
+        delete[] NewChunk;
+      }
+    }
+    return &Chunk[Id & (kIdChunkSize - 1)];
+  }
+
+  std::atomic<StackNode *> Tab[kTabSize] = {};
+  std::atomic<std::atomic<StackNode *> *> IdChunks[kMaxIdChunks] = {};
+  std::atomic<uint64_t> NextId = 1;
+  std::atomic<uptr> NumStacks = 0;
+  std::atomic<uptr> AllocatedSize = 0;
+};
+
+StackDepot &GetStackDepot() {
+  // Intentionally leaked, stacks may still be reported during exit
+  static StackDepot *Depot = new StackDepot();
+  return *Depot;
+}
+
+} // namespace
+
+StackId StackDepotPut(const BacktraceFrame *Frames, uptr NumFrames) {
+  if (!Frames || NumFrames == 0) {
+    return 0;
+  }
+  return GetStackDepot().Put(Frames, NumFrames);
+}
+
+std::vector<BacktraceFrame> StackDepotGet(StackId Id) {
+  if (Id == 0) {
+    return {};
+  }
+  return GetStackDepot().Get(Id);
+}
+
+StackDepotStats StackDepotGetStats() { return GetStackDepot().GetStats(); }
+
+} // namespace ur_sanitizer_layer
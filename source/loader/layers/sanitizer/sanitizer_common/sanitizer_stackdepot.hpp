@@ -0,0 +1,39 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file sanitizer_stackdepot.hpp
+ *
+ */
+
+#pragma once
+
+#include "sanitizer_common.hpp"
+
+#include <vector>
+
+namespace ur_sanitizer_layer {
+
+/// Id of a stack interned in the stack depot, 0 stands for an empty stack.
+using StackId = u32;
+
+struct StackDepotStats {
+  uptr NumStacks;
+  uptr AllocatedSize;
+};
+
+/// Interns the stack and returns its id. The same frames always map to the
+/// same id, so repeated allocation sites only cost a hash table lookup.
+StackId StackDepotPut(const BacktraceFrame *Frames, uptr NumFrames);
+
+/// Returns the frames of a stack previously stored in the depot.
+std::vector<BacktraceFrame> StackDepotGet(StackId Id);
+
+StackDepotStats StackDepotGetStats();
+
+} // namespace ur_sanitizer_layer
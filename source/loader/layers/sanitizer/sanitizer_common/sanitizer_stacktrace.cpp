@@ -81,8 +81,10 @@ SourceInfo ParseSymbolizerOutput(const std::string &Output) {
 } // namespace
 
 void StackTrace::print() const {
+  auto stack = StackDepotGet(id);
   if (!stack.size()) {
     getContext()->logger.always("  failed to acquire backtrace");
+    return;
   }
 
   unsigned index = 0;
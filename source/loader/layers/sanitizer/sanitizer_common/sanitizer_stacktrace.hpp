@@ -14,6 +14,7 @@
 #pragma once
 
 #include "sanitizer_common.hpp"
+#include "sanitizer_stackdepot.hpp"
 
 #include <vector>
 
@@ -21,8 +22,9 @@ namespace ur_sanitizer_layer {
 
 constexpr size_t MAX_BACKTRACE_FRAMES = 64;
 
+// Stacks are interned in the stack depot and only symbolized when printed.
 struct StackTrace {
-  std::vector<BacktraceFrame> stack;
+  StackId id = 0;
 
   void print() const;
 };
@@ -0,0 +1,328 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_tracing_binary.cpp
+ *
+ */
+#include "ur_tracing_binary.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <winioctl.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ur_tracing_layer {
+
+namespace {
+// Deep enough for the loader calling back into itself, anything nested
+// further is still counted so that begin and end stay balanced.
+constexpr uint32_t MAX_CALL_DEPTH = 16;
+
+constexpr uint32_t NO_REGION = UINT32_MAX;
+
+std::atomic<uint64_t> writerGeneration = 0;
+
+// Writers by generation, for threads exiting to hand their region back to the
+// writer it came from if that is still around.
+struct LiveWriters {
+  std::mutex mutex;
+  std::unordered_map<uint64_t, BinaryTraceWriter *> writers;
+};
+
+LiveWriters &liveWriters() {
+  // Threads may exit after static destructors ran
+  static auto *live = new LiveWriters;
+  return *live;
+}
+
+uint64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+} // namespace
+
+struct BinaryTraceWriter::ThreadState {
+  ~ThreadState() { detach(); }
+
+  // Hands the region back to the writer it was claimed from.
+  void detach() {
+    if (region == NO_REGION) {
+      return;
+    }
+    auto &live = liveWriters();
+    std::lock_guard<std::mutex> lock(live.mutex);
+    auto it = live.writers.find(generation);
+    if (it != live.writers.end()) {
+      it->second->releaseRegion(region);
+    }
+    region = NO_REGION;
+  }
+
+  uint64_t generation = UINT64_MAX;
+  uint32_t threadId = 0;
+  uint32_t region = NO_REGION;
+  binary_trace_record_t *slots = nullptr;
+  // Records written to the region, the next one goes to slot
+  // written % regionCapacity.
+  uint64_t written = 0;
+  // Sequence numbers of the records of the calls in flight, which tell
+  // whether one has been overwritten by calls nested in it after the region
+  // wrapped around.
+  uint64_t open[MAX_CALL_DEPTH] = {};
+  uint32_t depth = 0;
+};
+
+std::unique_ptr<BinaryTraceWriter>
+BinaryTraceWriter::create(const std::string &path, uint64_t capacity) {
+  std::unique_ptr<BinaryTraceWriter> writer(
+      new BinaryTraceWriter(path, capacity));
+  if (!writer->records) {
+    return nullptr;
+  }
+  auto &live = liveWriters();
+  std::lock_guard<std::mutex> lock(live.mutex);
+  live.writers[writer->generation] = writer.get();
+  return writer;
+}
+
+BinaryTraceWriter::BinaryTraceWriter(const std::string &path, uint64_t capacity)
+    : path(path), generation(writerGeneration++) {
+  numRegions = static_cast<uint32_t>(
+      std::clamp<uint64_t>(capacity / minRegionSize, 1, maxRegions));
+  regionCapacity =
+      std::max<uint64_t>(1, (capacity + numRegions - 1) / numRegions);
+  size_t size = sizeof(binary_trace_header_t) +
+                BINARY_TRACE_MAX_FUNCTIONS * BINARY_TRACE_NAME_SIZE +
+                numRegions * regionCapacity * sizeof(binary_trace_record_t);
+#ifdef _WIN32
+  // Mapped like on other platforms, so that the records of a process that
+  // crashed still make it to the file.
+  file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                     FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                     nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    file = nullptr;
+    return;
+  }
+  // Pages only get backed once threads write to them, if the file system
+  // supports sparse files.
+  DWORD returned = 0;
+  DeviceIoControl(file, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &returned,
+                  nullptr);
+  mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                               static_cast<DWORD>(uint64_t(size) >> 32),
+                               static_cast<DWORD>(size), nullptr);
+  if (!mapping) {
+    CloseHandle(file);
+    file = nullptr;
+    return;
+  }
+  storage = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+  if (!storage) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    mapping = file = nullptr;
+    return;
+  }
+#else
+  // A previous writer of the same path may still be mapped, writing to a new
+  // file rather than truncating it keeps that mapping valid. The file is
+  // sparse, pages only get backed once threads write to them.
+  unlink(path.c_str());
+  fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return;
+  }
+  if (ftruncate(fd, size) != 0) {
+    close(fd);
+    fd = -1;
+    return;
+  }
+  storage = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (storage == MAP_FAILED) {
+    storage = nullptr;
+    close(fd);
+    fd = -1;
+    return;
+  }
+#endif
+  storageSize = size;
+  nameTable = static_cast<char *>(storage) + sizeof(binary_trace_header_t);
+  records = reinterpret_cast<binary_trace_record_t *>(
+      nameTable + BINARY_TRACE_MAX_FUNCTIONS * BINARY_TRACE_NAME_SIZE);
+
+  regions.reset(new Region[numRegions]);
+  // Handed out lowest first
+  for (uint32_t region = numRegions; region > 0; region--) {
+    freeRegions.push_back(region - 1);
+  }
+
+  flush();
+}
+
+BinaryTraceWriter::~BinaryTraceWriter() {
+  {
+    auto &live = liveWriters();
+    std::lock_guard<std::mutex> lock(live.mutex);
+    live.writers.erase(generation);
+  }
+  if (!storage) {
+    return;
+  }
+  flush();
+#ifdef _WIN32
+  UnmapViewOfFile(storage);
+  CloseHandle(mapping);
+  CloseHandle(file);
+#else
+  munmap(storage, storageSize);
+  close(fd);
+#endif
+}
+
+BinaryTraceWriter::ThreadState &BinaryTraceWriter::getThreadState() {
+  static thread_local ThreadState state;
+  if (state.generation != generation) {
+    state.detach();
+    state = ThreadState{};
+    state.generation = generation;
+    state.threadId = nextThreadId++;
+    claimRegion(state);
+  }
+  return state;
+}
+
+bool BinaryTraceWriter::claimRegion(ThreadState &state) {
+  std::lock_guard<std::mutex> lock(regionsMutex);
+  if (freeRegions.empty()) {
+    return false;
+  }
+  state.region = freeRegions.back();
+  freeRegions.pop_back();
+  state.slots = records + state.region * regionCapacity;
+  state.written = regions[state.region].written.load(std::memory_order_relaxed);
+  return true;
+}
+
+void BinaryTraceWriter::releaseRegion(uint32_t region) {
+  std::lock_guard<std::mutex> lock(regionsMutex);
+  freeRegions.push_back(region);
+}
+
+void BinaryTraceWriter::begin(uint32_t functionId, const char *name) {
+  auto &state = getThreadState();
+
+  if (functionId < BINARY_TRACE_MAX_FUNCTIONS &&
+      !named[functionId].load(std::memory_order_relaxed) &&
+      !named[functionId].exchange(true)) {
+    std::strncpy(nameTable + functionId * BINARY_TRACE_NAME_SIZE, name,
+                 BINARY_TRACE_NAME_SIZE - 1);
+  }
+
+  if (state.region == NO_REGION) {
+    unrecorded.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  uint64_t sequence = state.written++;
+  auto record = state.slots + sequence % regionCapacity;
+  *record = {};
+  record->functionId = functionId;
+  record->threadId = state.threadId;
+  record->begin = now();
+  regions[state.region].written.store(state.written, std::memory_order_relaxed);
+
+  if (state.depth < MAX_CALL_DEPTH) {
+    state.open[state.depth] = sequence;
+  }
+  state.depth++;
+}
+
+void BinaryTraceWriter::handles(std::initializer_list<const void *> handles) {
+  auto &state = getThreadState();
+  if (state.depth == 0 || state.depth > MAX_CALL_DEPTH) {
+    return;
+  }
+
+  uint64_t sequence = state.open[state.depth - 1];
+  if (sequence + regionCapacity < state.written) {
+    return;
+  }
+  auto record = state.slots + sequence % regionCapacity;
+  for (auto handle : handles) {
+    if (record->numHandles == BINARY_TRACE_MAX_HANDLES) {
+      break;
+    }
+    record->handles[record->numHandles++] = reinterpret_cast<uint64_t>(handle);
+  }
+}
+
+void BinaryTraceWriter::end(ur_result_t result) {
+  auto &state = getThreadState();
+  if (state.depth == 0) {
+    return;
+  }
+
+  state.depth--;
+  if (state.depth >= MAX_CALL_DEPTH) {
+    return;
+  }
+
+  uint64_t sequence = state.open[state.depth];
+  if (sequence + regionCapacity < state.written) {
+    return;
+  }
+  auto record = state.slots + sequence % regionCapacity;
+  record->result = result;
+  record->end = now();
+}
+
+uint64_t BinaryTraceWriter::lostCount() const {
+  uint64_t lost = unrecorded.load(std::memory_order_relaxed);
+  for (uint32_t region = 0; region < numRegions; region++) {
+    uint64_t written = regions[region].written.load(std::memory_order_relaxed);
+    lost += written > regionCapacity ? written - regionCapacity : 0;
+  }
+  return lost;
+}
+
+binary_trace_header_t BinaryTraceWriter::makeHeader() const {
+  binary_trace_header_t header{};
+  std::memcpy(header.magic, BINARY_TRACE_MAGIC, sizeof(header.magic));
+  header.version = BINARY_TRACE_VERSION;
+  header.recordSize = sizeof(binary_trace_record_t);
+  header.recordCount = numRegions * regionCapacity;
+  header.overwrittenCount = lostCount();
+  header.nameTableOffset = sizeof(binary_trace_header_t);
+  header.recordsOffset = header.nameTableOffset +
+                         BINARY_TRACE_MAX_FUNCTIONS * BINARY_TRACE_NAME_SIZE;
+  return header;
+}
+
+void BinaryTraceWriter::flush() {
+  if (!storage) {
+    return;
+  }
+  auto header = makeHeader();
+  std::memcpy(storage, &header, sizeof(header));
+}
+
+} // namespace ur_tracing_layer
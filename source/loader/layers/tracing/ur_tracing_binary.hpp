@@ -0,0 +1,147 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_tracing_binary.hpp
+ *
+ */
+
+#ifndef UR_TRACING_BINARY_H
+#define UR_TRACING_BINARY_H 1
+
+#include "ur_api.h"
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ur_tracing_layer {
+
+// On-disk layout of a binary trace, decoded offline by `urtrace --decode`:
+//   binary_trace_header_t
+//   name table, char name[BINARY_TRACE_NAME_SIZE] per function id
+//   binary_trace_record_t[header.recordCount]
+// The header is written when the file is created and the name table is filled
+// in as functions are first called, so the trace of a process that crashed
+// can still be decoded. The records are split into one region per thread
+// traced, recordCount covers every slot of every region and slots that were
+// never written have functionId == 0. Once a thread has filled its region, its
+// oldest records are overwritten.
+constexpr char BINARY_TRACE_MAGIC[8] = {'U', 'R', 'T', 'R', 'A', 'C', 'E', 0};
+constexpr uint32_t BINARY_TRACE_VERSION = 2;
+constexpr uint32_t BINARY_TRACE_MAX_HANDLES = 4;
+constexpr uint32_t BINARY_TRACE_MAX_FUNCTIONS = 512;
+constexpr uint32_t BINARY_TRACE_NAME_SIZE = 64;
+
+struct binary_trace_header_t {
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;
+  uint64_t recordCount;
+  uint64_t overwrittenCount;
+  uint64_t nameTableOffset;
+  uint64_t recordsOffset;
+  uint64_t reserved[2];
+};
+static_assert(sizeof(binary_trace_header_t) == 64);
+
+struct binary_trace_record_t {
+  uint64_t begin; // steady clock, nanoseconds
+  uint64_t end;
+  uint32_t functionId;
+  uint32_t threadId;
+  int32_t result;
+  uint32_t numHandles;
+  uint64_t handles[BINARY_TRACE_MAX_HANDLES];
+};
+static_assert(sizeof(binary_trace_record_t) == 64);
+
+///////////////////////////////////////////////////////////////////////////////
+// Writes fixed-size binary records of traced calls straight into a memory
+// mapped file. Every thread is handed a region of record slots of its own the
+// first time it records a call, and fills it as a ring without any further
+// synchronization, so the cost per call is two clock reads and a few stores.
+// Regions of threads that exited are handed to new threads. Threads that find
+// no region left aren't recorded, their calls are counted as lost along with
+// the records overwritten.
+//
+// Calls must not be recorded while the writer is destroyed, which the layer
+// guarantees by only replacing its writer in urLoaderInit and
+// urLoaderTearDown.
+class BinaryTraceWriter {
+public:
+  static std::unique_ptr<BinaryTraceWriter> create(const std::string &path,
+                                                   uint64_t capacity);
+  ~BinaryTraceWriter();
+
+  void begin(uint32_t functionId, const char *name);
+  void handles(std::initializer_list<const void *> handles);
+  void end(ur_result_t result);
+
+  // Updates the header with the records written so far.
+  void flush();
+
+  // Records overwritten or not recorded for want of a region.
+  uint64_t lostCount() const;
+
+  // Record slots per thread.
+  uint64_t regionSize() const { return regionCapacity; }
+
+  // Threads that can record at the same time.
+  uint32_t regionCount() const { return numRegions; }
+
+private:
+  BinaryTraceWriter(const std::string &path, uint64_t capacity);
+
+  struct ThreadState;
+  ThreadState &getThreadState();
+  bool claimRegion(ThreadState &state);
+  void releaseRegion(uint32_t region);
+  binary_trace_header_t makeHeader() const;
+
+  // Regions are split off the capacity as long as they keep this many slots.
+  static constexpr uint64_t minRegionSize = 1024;
+  static constexpr uint32_t maxRegions = 256;
+
+  // Owned by the thread the region is handed to, padded so that threads
+  // don't share cache lines.
+  struct alignas(64) Region {
+    // Records ever written to the region, by all threads it was handed to.
+    std::atomic<uint64_t> written = 0;
+  };
+
+  std::string path;
+  uint64_t generation;
+  uint64_t regionCapacity = 0;
+  uint32_t numRegions = 0;
+  size_t storageSize = 0;
+#ifdef _WIN32
+  void *file = nullptr;
+  void *mapping = nullptr;
+#else
+  int fd = -1;
+#endif
+  void *storage = nullptr;
+  char *nameTable = nullptr;
+  binary_trace_record_t *records = nullptr;
+
+  std::unique_ptr<Region[]> regions;
+  std::mutex regionsMutex;
+  std::vector<uint32_t> freeRegions;
+  std::atomic<uint64_t> unrecorded = 0;
+  std::atomic<uint32_t> nextThreadId = 0;
+  std::atomic<bool> named[BINARY_TRACE_MAX_FUNCTIONS] = {};
+};
+
+} // namespace ur_tracing_layer
+
+#endif /* UR_TRACING_BINARY_H */
@@ -0,0 +1,126 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_tracing_codeloc.hpp
+ *
+ */
+
+#ifndef UR_TRACING_CODELOC_H
+#define UR_TRACING_CODELOC_H 1
+
+#include "ur_api.h"
+#include "xpti/xpti_data_types.h"
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace ur_tracing_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+// Caches the XPTI event made for the code locations seen by a thread.
+// Callbacks usually return the same string literals for a given call site, so
+// lookups are keyed on the pointers and only confirmed against the interned
+// copies with a string compare instead of hashing them again in xptiMakeEvent.
+// Only the most recently used locations are kept, callbacks building their
+// strings on the fly may return a new location for every call.
+class CodelocEventCache {
+public:
+  using MakeEvent = xpti_td *(*)(const char *functionName,
+                                 const char *sourceFile, uint32_t lineNumber,
+                                 uint32_t columnNumber);
+
+  static constexpr size_t defaultCapacity = 256;
+
+  explicit CodelocEventCache(MakeEvent makeEvent,
+                             size_t capacity = defaultCapacity)
+      : makeEvent(makeEvent), capacity(capacity ? capacity : 1) {}
+
+  xpti_td *get(const ur_code_location_t &loc) {
+    Key key{loc.functionName, loc.sourceFile, loc.lineNumber, loc.columnNumber};
+    auto it = index.find(key);
+    if (it != index.end()) {
+      entries.splice(entries.begin(), entries, it->second);
+      if (entries.front().matches(loc)) {
+        return entries.front().event;
+      }
+    } else {
+      if (entries.size() >= capacity) {
+        index.erase(entries.back().key);
+        entries.pop_back();
+      }
+      entries.emplace_front();
+      entries.front().key = key;
+      index.emplace(key, entries.begin());
+    }
+
+    auto &entry = entries.front();
+    entry.functionName = str(loc.functionName);
+    entry.sourceFile = str(loc.sourceFile);
+    entry.event =
+        makeEvent(entry.functionName.c_str(), entry.sourceFile.c_str(),
+                  loc.lineNumber, loc.columnNumber);
+    return entry.event;
+  }
+
+  size_t size() const { return entries.size(); }
+
+private:
+  static const char *str(const char *s) { return s ? s : ""; }
+
+  struct Key {
+    const char *functionName;
+    const char *sourceFile;
+    uint32_t lineNumber;
+    uint32_t columnNumber;
+
+    bool operator==(const Key &other) const {
+      return functionName == other.functionName &&
+             sourceFile == other.sourceFile && lineNumber == other.lineNumber &&
+             columnNumber == other.columnNumber;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const {
+      size_t seed = std::hash<const void *>{}(key.functionName);
+      seed ^= std::hash<const void *>{}(key.sourceFile) + 0x9e3779b9 +
+              (seed << 6) + (seed >> 2);
+      uint64_t position = uint64_t(key.lineNumber) << 32 | key.columnNumber;
+      seed ^= std::hash<uint64_t>{}(position) + 0x9e3779b9 + (seed << 6) +
+              (seed >> 2);
+      return seed;
+    }
+  };
+
+  struct Entry {
+    Key key;
+    std::string functionName;
+    std::string sourceFile;
+    xpti_td *event = nullptr;
+
+    // The pointers may point to a buffer the callback reuses.
+    bool matches(const ur_code_location_t &loc) const {
+      return functionName == str(loc.functionName) &&
+             sourceFile == str(loc.sourceFile);
+    }
+  };
+
+  MakeEvent makeEvent;
+  size_t capacity;
+  // Most recently used first.
+  std::list<Entry> entries;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+};
+
+} // namespace ur_tracing_layer
+
+#endif /* UR_TRACING_CODELOC_H */
@@ -0,0 +1,265 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_tracing_latency.cpp
+ *
+ */
+#include "ur_tracing_latency.hpp"
+
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+
+#include "ur_util.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+
+namespace ur_tracing_layer {
+
+namespace {
+std::atomic<uint64_t> trackerGeneration = 0;
+
+// Trackers by generation, for threads exiting to hand their histograms over
+// to the tracker they recorded for if that is still around.
+struct LiveTrackers {
+  std::mutex mutex;
+  std::unordered_map<uint64_t, FunctionLatencyTracker *> trackers;
+};
+
+LiveTrackers &liveTrackers() {
+  // Threads may exit after static destructors ran
+  static auto *live = new LiveTrackers;
+  return *live;
+}
+
+histogram_ptr makeHistogram() {
+  struct hdr_histogram *histogram = nullptr;
+  if (hdr_init(1, 100'000'000'000, 3, &histogram) != 0) {
+    return histogram_ptr(nullptr, &hdr_close);
+  }
+  return histogram_ptr(histogram, &hdr_close);
+}
+} // namespace
+
+struct FunctionLatencyTracker::ThreadHistograms {
+  ~ThreadHistograms() {
+    for (auto histogram : histograms) {
+      if (histogram) {
+        hdr_close(histogram);
+      }
+    }
+  }
+
+  // Adds what other recorded, the caller holds the locks of both.
+  void add(const ThreadHistograms &other) {
+    for (uint32_t id = 0; id < maxFunctionId; ++id) {
+      if (!other.histograms[id]) {
+        continue;
+      }
+      if (!histograms[id]) {
+        histograms[id] = makeHistogram().release();
+        if (!histograms[id]) {
+          continue;
+        }
+      }
+      hdr_add(histograms[id], other.histograms[id]);
+    }
+  }
+
+  // Taken by the owning thread to record, so only ever contended by
+  // snapshots merging the histograms.
+  std::mutex mutex;
+  // Created on the first call of each function.
+  struct hdr_histogram *histograms[maxFunctionId] = {};
+};
+
+struct FunctionLatencyTracker::ThreadState {
+  ~ThreadState() { detach(); }
+
+  // Hands the histograms over to the tracker they were recorded for.
+  void detach() {
+    if (!histograms) {
+      return;
+    }
+    auto &live = liveTrackers();
+    std::lock_guard<std::mutex> lock(live.mutex);
+    auto it = live.trackers.find(generation);
+    if (it != live.trackers.end()) {
+      it->second->detach(histograms.get());
+    }
+    histograms.reset();
+  }
+
+  uint64_t generation = UINT64_MAX;
+  std::unique_ptr<ThreadHistograms> histograms;
+  std::chrono::steady_clock::time_point begin[maxCallDepth];
+  uint32_t depth = 0;
+};
+
+FunctionLatencyTracker::FunctionLatencyTracker()
+    : generation(trackerGeneration++),
+      exited(std::make_unique<ThreadHistograms>()) {
+  {
+    auto &live = liveTrackers();
+    std::lock_guard<std::mutex> lock(live.mutex);
+    live.trackers[generation] = this;
+  }
+
+  auto interval = getenv_to_unsigned("UR_TRACING_LATENCY_INTERVAL");
+  if (!interval || *interval == 0) {
+    return;
+  }
+
+  intervalThread = std::thread([this, period = *interval] {
+    std::unique_lock<std::mutex> lock(intervalMutex);
+    while (!intervalCv.wait_for(lock, std::chrono::milliseconds(period),
+                                [this] { return intervalStopped; })) {
+      printSnapshot();
+    }
+  });
+}
+
+FunctionLatencyTracker::~FunctionLatencyTracker() {
+  stopInterval();
+  // Threads still recording keep their histograms until they exit.
+  auto &live = liveTrackers();
+  std::lock_guard<std::mutex> lock(live.mutex);
+  live.trackers.erase(generation);
+}
+
+void FunctionLatencyTracker::stopInterval() {
+  if (!intervalThread.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(intervalMutex);
+    intervalStopped = true;
+  }
+  intervalCv.notify_one();
+  intervalThread.join();
+}
+
+FunctionLatencyTracker::ThreadState &FunctionLatencyTracker::getThreadState() {
+  static thread_local ThreadState state;
+  if (state.generation != generation) {
+    state.detach();
+    state.generation = generation;
+    state.histograms = std::make_unique<ThreadHistograms>();
+    state.depth = 0;
+    attach(state.histograms.get());
+  }
+  return state;
+}
+
+void FunctionLatencyTracker::attach(ThreadHistograms *thread) {
+  std::lock_guard<std::mutex> lock(threadsMutex);
+  threads.push_back(thread);
+}
+
+void FunctionLatencyTracker::detach(ThreadHistograms *thread) {
+  std::lock_guard<std::mutex> lock(threadsMutex);
+  {
+    std::lock_guard<std::mutex> threadLock(thread->mutex);
+    exited->add(*thread);
+  }
+  threads.erase(std::find(threads.begin(), threads.end(), thread));
+}
+
+void FunctionLatencyTracker::begin() {
+  auto &state = getThreadState();
+  if (state.depth < maxCallDepth) {
+    state.begin[state.depth] = std::chrono::steady_clock::now();
+  }
+  state.depth++;
+}
+
+void FunctionLatencyTracker::end(uint32_t functionId, const char *name) {
+  auto &state = getThreadState();
+  if (state.depth == 0) {
+    return;
+  }
+
+  state.depth--;
+  if (state.depth >= maxCallDepth || functionId >= maxFunctionId) {
+    return;
+  }
+
+  auto elapsed = std::chrono::steady_clock::now() - state.begin[state.depth];
+  auto latency =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+
+  auto &thread = *state.histograms;
+  std::lock_guard<std::mutex> lock(thread.mutex);
+  auto &histogram = thread.histograms[functionId];
+  if (!histogram) {
+    histogram = makeHistogram().release();
+    if (!histogram) {
+      return;
+    }
+    const char *unnamed = nullptr;
+    names[functionId].compare_exchange_strong(unnamed, name,
+                                              std::memory_order_release);
+  }
+  hdr_record_value(histogram, latency);
+}
+
+std::vector<std::pair<const char *, histogram_ptr>>
+FunctionLatencyTracker::snapshot() {
+  ThreadHistograms merged;
+  {
+    std::lock_guard<std::mutex> lock(threadsMutex);
+    merged.add(*exited);
+    for (auto thread : threads) {
+      std::lock_guard<std::mutex> threadLock(thread->mutex);
+      merged.add(*thread);
+    }
+  }
+
+  std::vector<std::pair<const char *, histogram_ptr>> histograms;
+  for (uint32_t id = 0; id < maxFunctionId; ++id) {
+    const char *name = names[id].load(std::memory_order_acquire);
+    if (!name || !merged.histograms[id]) {
+      continue;
+    }
+    histograms.emplace_back(
+        name, histogram_ptr(std::exchange(merged.histograms[id], nullptr),
+                            &hdr_close));
+  }
+  return histograms;
+}
+
+std::optional<latencyValues> FunctionLatencyTracker::query(const char *name) {
+  for (auto &[functionName, histogram] : snapshot()) {
+    if (!std::strcmp(functionName, name)) {
+      return getValues(histogram.get());
+    }
+  }
+  return std::nullopt;
+}
+
+void FunctionLatencyTracker::printSnapshot() {
+  // A printer outputs everything published to it once it goes out of scope.
+  latency_printer printer;
+  for (auto &[name, histogram] : snapshot()) {
+    printer.publishLatency(name, std::move(histogram));
+  }
+}
+
+void FunctionLatencyTracker::publish() {
+  stopInterval();
+  for (auto &[name, histogram] : snapshot()) {
+    globalLatencyPrinter().publishLatency(name, std::move(histogram));
+  }
+}
+
+} // namespace ur_tracing_layer
+
+#endif // UR_ENABLE_LATENCY_HISTOGRAM
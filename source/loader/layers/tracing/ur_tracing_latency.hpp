@@ -0,0 +1,90 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_tracing_latency.hpp
+ *
+ */
+
+#ifndef UR_TRACING_LATENCY_H
+#define UR_TRACING_LATENCY_H 1
+
+#include "latency_tracker.hpp"
+
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace ur_tracing_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+// Keeps a latency histogram per UR entry point and thread, so that threads
+// never contend on recording. Snapshots merge the histograms of all threads,
+// each under its own lock, are printed periodically if
+// UR_TRACING_LATENCY_INTERVAL is set and handed over to the global latency
+// printer at teardown.
+class FunctionLatencyTracker {
+public:
+  FunctionLatencyTracker();
+  ~FunctionLatencyTracker();
+
+  void begin();
+  void end(uint32_t functionId, const char *name);
+
+  // Copies of the histograms recorded so far by all threads, by function
+  // name.
+  std::vector<std::pair<const char *, histogram_ptr>> snapshot();
+
+  // Latency of a single function recorded so far by all threads, if it was
+  // called at all.
+  std::optional<latencyValues> query(const char *name);
+
+  // Prints a snapshot of the histograms recorded so far.
+  void printSnapshot();
+
+  // Stops periodic printing and hands a snapshot to the global latency
+  // printer.
+  void publish();
+
+private:
+  static constexpr uint32_t maxFunctionId = 512;
+  static constexpr uint32_t maxCallDepth = 16;
+
+  struct ThreadHistograms;
+  struct ThreadState;
+  ThreadState &getThreadState();
+  void attach(ThreadHistograms *thread);
+  void detach(ThreadHistograms *thread);
+  void stopInterval();
+
+  uint64_t generation;
+  std::atomic<const char *> names[maxFunctionId] = {};
+
+  // Histograms of the threads recording into the tracker, and what threads
+  // which have since exited recorded.
+  std::mutex threadsMutex;
+  std::vector<ThreadHistograms *> threads;
+  std::unique_ptr<ThreadHistograms> exited;
+
+  std::mutex intervalMutex;
+  std::condition_variable intervalCv;
+  bool intervalStopped = false;
+  std::thread intervalThread;
+};
+
+} // namespace ur_tracing_layer
+
+#endif // UR_ENABLE_LATENCY_HISTOGRAM
+
+#endif /* UR_TRACING_LATENCY_H */
@@ -12,6 +12,7 @@
  */
 #include "ur_tracing_layer.hpp"
 #include "ur_api.h"
+#include "ur_tracing_codeloc.hpp"
 #include "ur_util.hpp"
 #include "xpti/xpti_data_types.h"
 #include "xpti/xpti_trace_framework.h"
@@ -26,6 +27,7 @@ context_t *getContext() { return context_t::get_direct(); }
 constexpr auto CALL_STREAM_NAME = "ur.call";
 constexpr auto STREAM_VER_MAJOR = UR_MAJOR_VERSION(UR_API_VERSION_CURRENT);
 constexpr auto STREAM_VER_MINOR = UR_MINOR_VERSION(UR_API_VERSION_CURRENT);
+constexpr uint64_t DEFAULT_BINARY_TRACE_CAPACITY = 1 << 22;
 
 // UR loader can be inited and teardown'ed multiple times in a single process.
 // Unfortunately this doesn't match the semantics of XPTI, which can be
@@ -42,6 +44,19 @@ static std::shared_ptr<XptiContextManager> xptiContextManagerGet() {
 }
 static thread_local xpti_td *activeEvent;
 
+static xpti_td *makeCodelocEvent(const char *functionName,
+                                 const char *sourceFile, uint32_t lineNumber,
+                                 uint32_t columnNumber) {
+  xpti::payload_t payload(functionName, sourceFile, lineNumber, columnNumber,
+                          nullptr);
+  uint64_t InstanceNumber{};
+  return xptiMakeEvent("Unified Runtime call", &payload,
+                       xpti::trace_graph_event, xpti_at::active,
+                       &InstanceNumber);
+}
+
+static thread_local CodelocEventCache codelocEvents(makeCodelocEvent);
+
 ///////////////////////////////////////////////////////////////////////////////
 context_t::context_t() : logger(logger::create_logger("tracing", true, true)) {
   this->xptiContextManager = xptiContextManagerGet();
@@ -61,6 +76,15 @@ void context_t::notify(uint16_t trace_type, uint32_t id, const char *name,
 }
 
 uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
+  if (auto writer = binaryTrace.load(std::memory_order_acquire)) {
+    writer->begin(id, name);
+  }
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+  if (auto tracker = latencyTracker.load(std::memory_order_acquire)) {
+    tracker->begin();
+  }
+#endif
+
   // we use UINT64_MAX as a special value that means "tracing disabled",
   // so that we don't have to repeat this check in notify_end.
   if (!xptiCheckTraceEnabled(call_stream_id)) {
@@ -68,13 +92,7 @@ uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
   }
 
   if (auto loc = codelocData.get_codeloc()) {
-    xpti::payload_t payload =
-        xpti::payload_t(loc->functionName, loc->sourceFile, loc->lineNumber,
-                        loc->columnNumber, nullptr);
-    uint64_t InstanceNumber{};
-    activeEvent =
-        xptiMakeEvent("Unified Runtime call", &payload, xpti::trace_graph_event,
-                      xpti_at::active, &InstanceNumber);
+    activeEvent = codelocEvents.get(*loc);
   }
 
   uint64_t instance = xptiGetUniqueId();
@@ -85,6 +103,15 @@ uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
 
 void context_t::notify_end(uint32_t id, const char *name, void *args,
                            ur_result_t *resultp, uint64_t instance) {
+  if (auto writer = binaryTrace.load(std::memory_order_acquire)) {
+    writer->end(*resultp);
+  }
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+  if (auto tracker = latencyTracker.load(std::memory_order_acquire)) {
+    tracker->end(id, name);
+  }
+#endif
+
   if (instance == UINT64_MAX) { // tracing disabled
     return;
   }
@@ -93,6 +120,68 @@ void context_t::notify_end(uint32_t id, const char *name, void *args,
          args, resultp, instance);
 }
 
+void context_t::retire_binary_trace() {
+  std::unique_ptr<BinaryTraceWriter> writer(binaryTrace.exchange(nullptr));
+  if (!writer) {
+    return;
+  }
+  writer->flush();
+  if (writer->lostCount()) {
+    logger.warning("binary trace lost {} records, increase "
+                   "UR_TRACING_BINARY_CAPACITY to keep them\n",
+                   writer->lostCount());
+  }
+}
+
+void context_t::init_binary_trace() {
+  retire_binary_trace();
+
+  auto path = ur_getenv("UR_TRACING_BINARY_OUTPUT");
+  if (!path) {
+    return;
+  }
+
+  uint64_t capacity = DEFAULT_BINARY_TRACE_CAPACITY;
+  if (auto value = getenv_to_unsigned("UR_TRACING_BINARY_CAPACITY")) {
+    capacity = *value;
+  }
+
+  auto writer = BinaryTraceWriter::create(*path, capacity);
+  if (!writer) {
+    logger.error("failed to create binary trace file {}\n", *path);
+    return;
+  }
+  binaryTrace.store(writer.release(), std::memory_order_release);
+}
+
+void context_t::init_latency_tracker() {
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+  retire_latency_tracker();
+  if (trackLatency) {
+    latencyTracker.store(new FunctionLatencyTracker(),
+                         std::memory_order_release);
+  }
+#endif
+}
+
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+void context_t::retire_latency_tracker() {
+  std::unique_ptr<FunctionLatencyTracker> tracker(
+      latencyTracker.exchange(nullptr));
+  if (tracker) {
+    tracker->publish();
+  }
+}
+#endif
+
+ur_result_t context_t::tearDown() {
+  retire_binary_trace();
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+  retire_latency_tracker();
+#endif
+  return UR_RESULT_SUCCESS;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 context_t::~context_t() { xptiFinalize(CALL_STREAM_NAME); }
 } // namespace ur_tracing_layer
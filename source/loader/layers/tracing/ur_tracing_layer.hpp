@@ -17,8 +17,14 @@
 #include "logger/ur_logger.hpp"
 #include "ur_ddi.h"
 #include "ur_proxy_layer.hpp"
+#include "ur_tracing_binary.hpp"
+#include "ur_tracing_latency.hpp"
 #include "ur_util.hpp"
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #define TRACING_COMP_NAME "tracing layer"
 
 namespace ur_tracing_layer {
@@ -39,11 +45,30 @@ public:
   ur_result_t init(ur_dditable_t *dditable,
                    const std::set<std::string> &enabledLayerNames,
                    codeloc_data codelocData) override;
-  ur_result_t tearDown() override { return UR_RESULT_SUCCESS; }
+  ur_result_t tearDown() override;
   uint64_t notify_begin(uint32_t id, const char *name, void *args);
   void notify_end(uint32_t id, const char *name, void *args,
                   ur_result_t *resultp, uint64_t instance);
 
+  // Handle arguments of the call in flight, only kept by the binary backend.
+  void notify_handles(std::initializer_list<const void *> handles) {
+    if (auto writer = binaryTrace.load(std::memory_order_acquire)) {
+      writer->handles(handles);
+    }
+  }
+
+  void init_binary_trace();
+  void init_latency_tracker();
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+  // Latency recorded so far for a UR entry point, by all threads.
+  std::optional<latencyValues> query_latency(const char *name) {
+    if (auto tracker = latencyTracker.load(std::memory_order_acquire)) {
+      return tracker->query(name);
+    }
+    return std::nullopt;
+  }
+#endif
+
 private:
   void notify(uint16_t trace_type, uint32_t id, const char *name, void *args,
               ur_result_t *resultp, uint64_t instance);
@@ -52,6 +77,15 @@ private:
   inline static const std::string name = "UR_LAYER_TRACING";
 
   std::shared_ptr<XptiContextManager> xptiContextManager;
+  // Only replaced in urLoaderInit and urLoaderTearDown, which no calls may
+  // run concurrently with, so a writer retired then is destroyed right away.
+  std::atomic<BinaryTraceWriter *> binaryTrace = nullptr;
+  void retire_binary_trace();
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+  // Replaced along with the binary trace writer.
+  std::atomic<FunctionLatencyTracker *> latencyTracker = nullptr;
+  void retire_latency_tracker();
+#endif
 };
 
 context_t *getContext();
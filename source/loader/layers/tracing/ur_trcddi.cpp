@@ -71,6 +71,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
   ur_adapter_release_params_t params = {&hAdapter};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RELEASE,
                                                  "urAdapterRelease", &params);
+  getContext()->notify_handles({hAdapter});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urAdapterRelease\n");
@@ -104,6 +105,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
   ur_adapter_retain_params_t params = {&hAdapter};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RETAIN,
                                                  "urAdapterRetain", &params);
+  getContext()->notify_handles({hAdapter});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urAdapterRetain\n");
@@ -143,6 +145,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
   ur_adapter_get_last_error_params_t params = {&hAdapter, &ppMessage, &pError};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ADAPTER_GET_LAST_ERROR, "urAdapterGetLastError", &params);
+  getContext()->notify_handles({hAdapter});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urAdapterGetLastError\n");
@@ -190,6 +193,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
                                          &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET_INFO,
                                                  "urAdapterGetInfo", &params);
+  getContext()->notify_handles({hAdapter});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urAdapterGetInfo\n");
@@ -285,6 +289,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
                                           &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_INFO,
                                                  "urPlatformGetInfo", &params);
+  getContext()->notify_handles({hPlatform});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPlatformGetInfo\n");
@@ -321,6 +326,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
   ur_platform_get_api_version_params_t params = {&hPlatform, &pVersion};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PLATFORM_GET_API_VERSION, "urPlatformGetApiVersion", &params);
+  getContext()->notify_handles({hPlatform});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPlatformGetApiVersion\n");
@@ -360,6 +366,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE,
                                  "urPlatformGetNativeHandle", &params);
+  getContext()->notify_handles({hPlatform});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPlatformGetNativeHandle\n");
@@ -403,6 +410,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
                                  "urPlatformCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hAdapter});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPlatformCreateWithNativeHandle\n");
@@ -446,6 +454,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION,
                                  "urPlatformGetBackendOption", &params);
+  getContext()->notify_handles({hPlatform});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPlatformGetBackendOption\n");
@@ -496,6 +505,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
                                    &phDevices, &pNumDevices};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET,
                                                  "urDeviceGet", &params);
+  getContext()->notify_handles({hPlatform});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDeviceGet\n");
@@ -543,6 +553,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
                                         &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_INFO,
                                                  "urDeviceGetInfo", &params);
+  getContext()->notify_handles({hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDeviceGetInfo\n");
@@ -576,6 +587,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
   ur_device_retain_params_t params = {&hDevice};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RETAIN,
                                                  "urDeviceRetain", &params);
+  getContext()->notify_handles({hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDeviceRetain\n");
@@ -608,6 +620,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
   ur_device_release_params_t params = {&hDevice};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RELEASE,
                                                  "urDeviceRelease", &params);
+  getContext()->notify_handles({hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDeviceRelease\n");
@@ -652,6 +665,7 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
                                          &phSubDevices, &pNumDevicesRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_PARTITION,
                                                  "urDevicePartition", &params);
+  getContext()->notify_handles({hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDevicePartition\n");
@@ -697,6 +711,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
                                              &pSelectedBinary};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_DEVICE_SELECT_BINARY, "urDeviceSelectBinary", &params);
+  getContext()->notify_handles({hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDeviceSelectBinary\n");
@@ -733,6 +748,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
   ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, "urDeviceGetNativeHandle", &params);
+  getContext()->notify_handles({hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDeviceGetNativeHandle\n");
@@ -776,6 +792,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
                                  "urDeviceCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hAdapter});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDeviceCreateWithNativeHandle\n");
@@ -820,6 +837,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS,
                                  "urDeviceGetGlobalTimestamps", &params);
+  getContext()->notify_handles({hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urDeviceGetGlobalTimestamps\n");
@@ -895,6 +913,7 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
   ur_context_retain_params_t params = {&hContext};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RETAIN,
                                                  "urContextRetain", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urContextRetain\n");
@@ -927,6 +946,7 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
   ur_context_release_params_t params = {&hContext};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RELEASE,
                                                  "urContextRelease", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urContextRelease\n");
@@ -975,6 +995,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
                                          &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_GET_INFO,
                                                  "urContextGetInfo", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urContextGetInfo\n");
@@ -1012,6 +1033,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE,
                                  "urContextGetNativeHandle", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urContextGetNativeHandle\n");
@@ -1061,6 +1083,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
                                  "urContextCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hAdapter});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urContextCreateWithNativeHandle\n");
@@ -1103,6 +1126,7 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER,
                                  "urContextSetExtendedDeleter", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urContextSetExtendedDeleter\n");
@@ -1148,6 +1172,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
                                          &pImageDesc, &pHost, &phMem};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_IMAGE_CREATE,
                                                  "urMemImageCreate", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemImageCreate\n");
@@ -1191,6 +1216,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
                                           &pProperties, &phBuffer};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_BUFFER_CREATE,
                                                  "urMemBufferCreate", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemBufferCreate\n");
@@ -1225,6 +1251,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
   ur_mem_retain_params_t params = {&hMem};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RETAIN,
                                                  "urMemRetain", &params);
+  getContext()->notify_handles({hMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemRetain\n");
@@ -1256,6 +1283,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
   ur_mem_release_params_t params = {&hMem};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RELEASE,
                                                  "urMemRelease", &params);
+  getContext()->notify_handles({hMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemRelease\n");
@@ -1296,6 +1324,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
       &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_MEM_BUFFER_PARTITION, "urMemBufferPartition", &params);
+  getContext()->notify_handles({hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemBufferPartition\n");
@@ -1335,6 +1364,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
   ur_mem_get_native_handle_params_t params = {&hMem, &hDevice, &phNativeMem};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_MEM_GET_NATIVE_HANDLE, "urMemGetNativeHandle", &params);
+  getContext()->notify_handles({hMem, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemGetNativeHandle\n");
@@ -1377,6 +1407,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
       "urMemBufferCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemBufferCreateWithNativeHandle\n");
@@ -1425,6 +1456,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE,
       "urMemImageCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemImageCreateWithNativeHandle\n");
@@ -1474,6 +1506,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
                                      &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_GET_INFO,
                                                  "urMemGetInfo", &params);
+  getContext()->notify_handles({hMemory});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemGetInfo\n");
@@ -1521,6 +1554,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
                                            &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_IMAGE_GET_INFO,
                                                  "urMemImageGetInfo", &params);
+  getContext()->notify_handles({hMemory});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urMemImageGetInfo\n");
@@ -1559,6 +1593,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
   ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_CREATE,
                                                  "urSamplerCreate", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urSamplerCreate\n");
@@ -1591,6 +1626,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
   ur_sampler_retain_params_t params = {&hSampler};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RETAIN,
                                                  "urSamplerRetain", &params);
+  getContext()->notify_handles({hSampler});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urSamplerRetain\n");
@@ -1623,6 +1659,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
   ur_sampler_release_params_t params = {&hSampler};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RELEASE,
                                                  "urSamplerRelease", &params);
+  getContext()->notify_handles({hSampler});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urSamplerRelease\n");
@@ -1666,6 +1703,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
                                          &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_GET_INFO,
                                                  "urSamplerGetInfo", &params);
+  getContext()->notify_handles({hSampler});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urSamplerGetInfo\n");
@@ -1703,6 +1741,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE,
                                  "urSamplerGetNativeHandle", &params);
+  getContext()->notify_handles({hSampler});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urSamplerGetNativeHandle\n");
@@ -1746,6 +1785,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
                                  "urSamplerCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urSamplerCreateWithNativeHandle\n");
@@ -1790,6 +1830,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
                                        &ppMem};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_HOST_ALLOC,
                                                  "urUSMHostAlloc", &params);
+  getContext()->notify_handles({hContext, pool});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMHostAlloc\n");
@@ -1833,6 +1874,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
                                          &pool,     &size,    &ppMem};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_DEVICE_ALLOC,
                                                  "urUSMDeviceAlloc", &params);
+  getContext()->notify_handles({hContext, hDevice, pool});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMDeviceAlloc\n");
@@ -1878,6 +1920,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
                                          &pool,     &size,    &ppMem};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_SHARED_ALLOC,
                                                  "urUSMSharedAlloc", &params);
+  getContext()->notify_handles({hContext, hDevice, pool});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMSharedAlloc\n");
@@ -1914,6 +1957,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
   ur_usm_free_params_t params = {&hContext, &pMem};
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_USM_FREE, "urUSMFree", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMFree\n");
@@ -1957,6 +2001,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
       &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, "urUSMGetMemAllocInfo", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMGetMemAllocInfo\n");
@@ -1996,6 +2041,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
   ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_CREATE,
                                                  "urUSMPoolCreate", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMPoolCreate\n");
@@ -2028,6 +2074,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
   ur_usm_pool_retain_params_t params = {&pPool};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RETAIN,
                                                  "urUSMPoolRetain", &params);
+  getContext()->notify_handles({pPool});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMPoolRetain\n");
@@ -2060,6 +2107,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
   ur_usm_pool_release_params_t params = {&pPool};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RELEASE,
                                                  "urUSMPoolRelease", &params);
+  getContext()->notify_handles({pPool});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMPoolRelease\n");
@@ -2103,6 +2151,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
                                           &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_GET_INFO,
                                                  "urUSMPoolGetInfo", &params);
+  getContext()->notify_handles({hPool});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMPoolGetInfo\n");
@@ -2156,6 +2205,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO,
                                  "urVirtualMemGranularityGetInfo", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urVirtualMemGranularityGetInfo\n");
@@ -2201,6 +2251,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
                                             &ppStart};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_VIRTUAL_MEM_RESERVE, "urVirtualMemReserve", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urVirtualMemReserve\n");
@@ -2238,6 +2289,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
   ur_virtual_mem_free_params_t params = {&hContext, &pStart, &size};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_FREE,
                                                  "urVirtualMemFree", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urVirtualMemFree\n");
@@ -2282,6 +2334,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
                                         &hPhysicalMem, &offset, &flags};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_MAP,
                                                  "urVirtualMemMap", &params);
+  getContext()->notify_handles({hContext, hPhysicalMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urVirtualMemMap\n");
@@ -2319,6 +2372,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
   ur_virtual_mem_unmap_params_t params = {&hContext, &pStart, &size};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_UNMAP,
                                                  "urVirtualMemUnmap", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urVirtualMemUnmap\n");
@@ -2359,6 +2413,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
                                                &flags};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, "urVirtualMemSetAccess", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urVirtualMemSetAccess\n");
@@ -2410,6 +2465,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
       &propSize, &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_VIRTUAL_MEM_GET_INFO, "urVirtualMemGetInfo", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urVirtualMemGetInfo\n");
@@ -2454,6 +2510,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
                                             &pProperties, &phPhysicalMem};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PHYSICAL_MEM_CREATE, "urPhysicalMemCreate", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPhysicalMemCreate\n");
@@ -2488,6 +2545,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
   ur_physical_mem_retain_params_t params = {&hPhysicalMem};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PHYSICAL_MEM_RETAIN, "urPhysicalMemRetain", &params);
+  getContext()->notify_handles({hPhysicalMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPhysicalMemRetain\n");
@@ -2521,6 +2579,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
   ur_physical_mem_release_params_t params = {&hPhysicalMem};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PHYSICAL_MEM_RELEASE, "urPhysicalMemRelease", &params);
+  getContext()->notify_handles({hPhysicalMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPhysicalMemRelease\n");
@@ -2567,6 +2626,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemGetInfo(
       &hPhysicalMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PHYSICAL_MEM_GET_INFO, "urPhysicalMemGetInfo", &params);
+  getContext()->notify_handles({hPhysicalMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urPhysicalMemGetInfo\n");
@@ -2610,6 +2670,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
                                                &pProperties, &phProgram};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PROGRAM_CREATE_WITH_IL, "urProgramCreateWithIL", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramCreateWithIL\n");
@@ -2663,6 +2724,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY,
                                  "urProgramCreateWithBinary", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramCreateWithBinary\n");
@@ -2703,6 +2765,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
   ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_BUILD,
                                                  "urProgramBuild", &params);
+  getContext()->notify_handles({hContext, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramBuild\n");
@@ -2739,6 +2802,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
   ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_COMPILE,
                                                  "urProgramCompile", &params);
+  getContext()->notify_handles({hContext, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramCompile\n");
@@ -2784,6 +2848,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
                                      &phProgram};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK,
                                                  "urProgramLink", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramLink\n");
@@ -2817,6 +2882,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
   ur_program_retain_params_t params = {&hProgram};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RETAIN,
                                                  "urProgramRetain", &params);
+  getContext()->notify_handles({hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramRetain\n");
@@ -2849,6 +2915,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
   ur_program_release_params_t params = {&hProgram};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RELEASE,
                                                  "urProgramRelease", &params);
+  getContext()->notify_handles({hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramRelease\n");
@@ -2893,6 +2960,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER,
                                  "urProgramGetFunctionPointer", &params);
+  getContext()->notify_handles({hDevice, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramGetFunctionPointer\n");
@@ -2942,6 +3010,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER,
       "urProgramGetGlobalVariablePointer", &params);
+  getContext()->notify_handles({hDevice, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramGetGlobalVariablePointer\n");
@@ -2993,6 +3062,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
                                          &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_INFO,
                                                  "urProgramGetInfo", &params);
+  getContext()->notify_handles({hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramGetInfo\n");
@@ -3043,6 +3113,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
       &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PROGRAM_GET_BUILD_INFO, "urProgramGetBuildInfo", &params);
+  getContext()->notify_handles({hProgram, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramGetBuildInfo\n");
@@ -3085,6 +3156,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
       "urProgramSetSpecializationConstants", &params);
+  getContext()->notify_handles({hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramSetSpecializationConstants\n");
@@ -3123,6 +3195,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE,
                                  "urProgramGetNativeHandle", &params);
+  getContext()->notify_handles({hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramGetNativeHandle\n");
@@ -3166,6 +3239,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
                                  "urProgramCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramCreateWithNativeHandle\n");
@@ -3205,6 +3279,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
   ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_CREATE,
                                                  "urKernelCreate", &params);
+  getContext()->notify_handles({hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelCreate\n");
@@ -3248,6 +3323,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
                                              &pProperties, &pArgValue};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_SET_ARG_VALUE, "urKernelSetArgValue", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelSetArgValue\n");
@@ -3289,6 +3365,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
                                              &pProperties};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_SET_ARG_LOCAL, "urKernelSetArgLocal", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelSetArgLocal\n");
@@ -3337,6 +3414,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
                                         &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_INFO,
                                                  "urKernelGetInfo", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelGetInfo\n");
@@ -3383,6 +3461,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
       &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_GET_GROUP_INFO, "urKernelGetGroupInfo", &params);
+  getContext()->notify_handles({hKernel, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelGetGroupInfo\n");
@@ -3431,6 +3510,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO,
                                  "urKernelGetSubGroupInfo", &params);
+  getContext()->notify_handles({hKernel, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelGetSubGroupInfo\n");
@@ -3466,6 +3546,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
   ur_kernel_retain_params_t params = {&hKernel};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RETAIN,
                                                  "urKernelRetain", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelRetain\n");
@@ -3498,6 +3579,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
   ur_kernel_release_params_t params = {&hKernel};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RELEASE,
                                                  "urKernelRelease", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelRelease\n");
@@ -3538,6 +3620,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
                                                &pProperties, &pArgValue};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_SET_ARG_POINTER, "urKernelSetArgPointer", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelSetArgPointer\n");
@@ -3582,6 +3665,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
                                              &pProperties, &pPropValue};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_SET_EXEC_INFO, "urKernelSetExecInfo", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelSetExecInfo\n");
@@ -3623,6 +3707,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
                                                &pProperties, &hArgValue};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, "urKernelSetArgSampler", &params);
+  getContext()->notify_handles({hKernel, hArgValue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelSetArgSampler\n");
@@ -3664,6 +3749,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
                                                &pProperties, &hArgValue};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, "urKernelSetArgMemObj", &params);
+  getContext()->notify_handles({hKernel, hArgValue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelSetArgMemObj\n");
@@ -3705,6 +3791,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
       "urKernelSetSpecializationConstants", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelSetSpecializationConstants\n");
@@ -3742,6 +3829,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
   ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, "urKernelGetNativeHandle", &params);
+  getContext()->notify_handles({hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelGetNativeHandle\n");
@@ -3787,6 +3875,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
                                  "urKernelCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hContext, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelCreateWithNativeHandle\n");
@@ -3841,6 +3930,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
       "urKernelGetSuggestedLocalWorkSize", &params);
+  getContext()->notify_handles({hKernel, hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelGetSuggestedLocalWorkSize\n");
@@ -3887,6 +3977,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
                                        &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_GET_INFO,
                                                  "urQueueGetInfo", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urQueueGetInfo\n");
@@ -3927,6 +4018,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
                                      &phQueue};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_CREATE,
                                                  "urQueueCreate", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urQueueCreate\n");
@@ -3959,6 +4051,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
   ur_queue_retain_params_t params = {&hQueue};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RETAIN,
                                                  "urQueueRetain", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urQueueRetain\n");
@@ -3991,6 +4084,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
   ur_queue_release_params_t params = {&hQueue};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RELEASE,
                                                  "urQueueRelease", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urQueueRelease\n");
@@ -4028,6 +4122,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
                                                 &phNativeQueue};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, "urQueueGetNativeHandle", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urQueueGetNativeHandle\n");
@@ -4073,6 +4168,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
                                  "urQueueCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urQueueCreateWithNativeHandle\n");
@@ -4108,6 +4204,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
   ur_queue_finish_params_t params = {&hQueue};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FINISH,
                                                  "urQueueFinish", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urQueueFinish\n");
@@ -4140,6 +4237,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
   ur_queue_flush_params_t params = {&hQueue};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FLUSH,
                                                  "urQueueFlush", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urQueueFlush\n");
@@ -4181,6 +4279,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
                                        &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_GET_INFO,
                                                  "urEventGetInfo", &params);
+  getContext()->notify_handles({hEvent});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEventGetInfo\n");
@@ -4225,6 +4324,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
                                                  &pPropValue, &pPropSizeRet};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_EVENT_GET_PROFILING_INFO, "urEventGetProfilingInfo", &params);
+  getContext()->notify_handles({hEvent});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEventGetProfilingInfo\n");
@@ -4294,6 +4394,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
   ur_event_retain_params_t params = {&hEvent};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RETAIN,
                                                  "urEventRetain", &params);
+  getContext()->notify_handles({hEvent});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEventRetain\n");
@@ -4326,6 +4427,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
   ur_event_release_params_t params = {&hEvent};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RELEASE,
                                                  "urEventRelease", &params);
+  getContext()->notify_handles({hEvent});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEventRelease\n");
@@ -4360,6 +4462,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
   ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, "urEventGetNativeHandle", &params);
+  getContext()->notify_handles({hEvent});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEventGetNativeHandle\n");
@@ -4403,6 +4506,7 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
                                  "urEventCreateWithNativeHandle", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEventCreateWithNativeHandle\n");
@@ -4445,6 +4549,7 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
                                            &pUserData};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_SET_CALLBACK,
                                                  "urEventSetCallback", &params);
+  getContext()->notify_handles({hEvent});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEventSetCallback\n");
@@ -4515,6 +4620,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                                               &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, "urEnqueueKernelLaunch", &params);
+  getContext()->notify_handles({hQueue, hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueKernelLaunch\n");
@@ -4563,6 +4669,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
                                             &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_EVENTS_WAIT, "urEnqueueEventsWait", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueEventsWait\n");
@@ -4612,6 +4719,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
                                  "urEnqueueEventsWaitWithBarrier", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueEventsWaitWithBarrier\n");
@@ -4671,6 +4779,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
       &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, "urEnqueueMemBufferRead", &params);
+  getContext()->notify_handles({hQueue, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemBufferRead\n");
@@ -4731,6 +4840,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
       &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, "urEnqueueMemBufferWrite", &params);
+  getContext()->notify_handles({hQueue, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemBufferWrite\n");
@@ -4806,6 +4916,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
                                  "urEnqueueMemBufferReadRect", &params);
+  getContext()->notify_handles({hQueue, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemBufferReadRect\n");
@@ -4883,6 +4994,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
                                  "urEnqueueMemBufferWriteRect", &params);
+  getContext()->notify_handles({hQueue, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemBufferWriteRect\n");
@@ -4943,6 +5055,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
       &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, "urEnqueueMemBufferCopy", &params);
+  getContext()->notify_handles({hQueue, hBufferSrc, hBufferDst});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemBufferCopy\n");
@@ -5014,6 +5127,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
                                  "urEnqueueMemBufferCopyRect", &params);
+  getContext()->notify_handles({hQueue, hBufferSrc, hBufferDst});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemBufferCopyRect\n");
@@ -5080,6 +5194,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                                                 &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, "urEnqueueMemBufferFill", &params);
+  getContext()->notify_handles({hQueue, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemBufferFill\n");
@@ -5146,6 +5261,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
       &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, "urEnqueueMemImageRead", &params);
+  getContext()->notify_handles({hQueue, hImage});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemImageRead\n");
@@ -5211,6 +5327,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
       &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, "urEnqueueMemImageWrite", &params);
+  getContext()->notify_handles({hQueue, hImage});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemImageWrite\n");
@@ -5273,6 +5390,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
       &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, "urEnqueueMemImageCopy", &params);
+  getContext()->notify_handles({hQueue, hImageSrc, hImageDst});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemImageCopy\n");
@@ -5335,6 +5453,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
       &phEvent, &ppRetMap};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, "urEnqueueMemBufferMap", &params);
+  getContext()->notify_handles({hQueue, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemBufferMap\n");
@@ -5387,6 +5506,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
       &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_UNMAP,
                                                  "urEnqueueMemUnmap", &params);
+  getContext()->notify_handles({hQueue, hMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueMemUnmap\n");
@@ -5444,6 +5564,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
       &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ENQUEUE_USM_FILL,
                                                  "urEnqueueUSMFill", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueUSMFill\n");
@@ -5500,6 +5621,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
       &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ENQUEUE_USM_MEMCPY,
                                                  "urEnqueueUSMMemcpy", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueUSMMemcpy\n");
@@ -5554,6 +5676,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
       &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_USM_PREFETCH, "urEnqueueUSMPrefetch", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueUSMPrefetch\n");
@@ -5598,6 +5721,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
                                            &phEvent};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ENQUEUE_USM_ADVISE,
                                                  "urEnqueueUSMAdvise", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueUSMAdvise\n");
@@ -5660,6 +5784,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
       &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_USM_FILL_2D, "urEnqueueUSMFill2D", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueUSMFill2D\n");
@@ -5726,6 +5851,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
       &phEventWaitList, &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, "urEnqueueUSMMemcpy2D", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueUSMMemcpy2D\n");
@@ -5790,6 +5916,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
       "urEnqueueDeviceGlobalVariableWrite", &params);
+  getContext()->notify_handles({hQueue, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueDeviceGlobalVariableWrite\n");
@@ -5855,6 +5982,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
       "urEnqueueDeviceGlobalVariableRead", &params);
+  getContext()->notify_handles({hQueue, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueDeviceGlobalVariableRead\n");
@@ -5920,6 +6048,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
       &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, "urEnqueueReadHostPipe", &params);
+  getContext()->notify_handles({hQueue, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueReadHostPipe\n");
@@ -5985,6 +6114,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
       &phEvent};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, "urEnqueueWriteHostPipe", &params);
+  getContext()->notify_handles({hQueue, hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueWriteHostPipe\n");
@@ -6039,6 +6169,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
       &height,   &elementSizeBytes, &ppMem,    &pResultPitch};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_USM_PITCHED_ALLOC_EXP, "urUSMPitchedAllocExp", &params);
+  getContext()->notify_handles({hContext, hDevice, pool});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMPitchedAllocExp\n");
@@ -6083,6 +6214,7 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
       "urBindlessImagesUnsampledImageHandleDestroyExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesUnsampledImageHandleDestroyExp\n");
@@ -6131,6 +6263,7 @@ urBindlessImagesSampledImageHandleDestroyExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
       "urBindlessImagesSampledImageHandleDestroyExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesSampledImageHandleDestroyExp\n");
@@ -6180,6 +6313,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP,
                                  "urBindlessImagesImageAllocateExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesImageAllocateExp\n");
@@ -6222,6 +6356,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP,
                                  "urBindlessImagesImageFreeExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesImageFreeExp\n");
@@ -6269,6 +6404,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
       "urBindlessImagesUnsampledImageCreateExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesUnsampledImageCreateExp\n");
@@ -6321,6 +6457,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
       "urBindlessImagesSampledImageCreateExp", &params);
+  getContext()->notify_handles({hContext, hDevice, hSampler});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesSampledImageCreateExp\n");
@@ -6400,6 +6537,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
                                  "urBindlessImagesImageCopyExp", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesImageCopyExp\n");
@@ -6448,6 +6586,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP,
                                  "urBindlessImagesImageGetInfoExp", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesImageGetInfoExp\n");
@@ -6494,6 +6633,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
       "urBindlessImagesMipmapGetLevelExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesMipmapGetLevelExp\n");
@@ -6536,6 +6676,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP,
                                  "urBindlessImagesMipmapFreeExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesMipmapFreeExp\n");
@@ -6584,6 +6725,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
       "urBindlessImagesImportExternalMemoryExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesImportExternalMemoryExp\n");
@@ -6634,6 +6776,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
       "urBindlessImagesMapExternalArrayExp", &params);
+  getContext()->notify_handles({hContext, hDevice, hExternalMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesMapExternalArrayExp\n");
@@ -6682,6 +6825,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
       "urBindlessImagesMapExternalLinearMemoryExp", &params);
+  getContext()->notify_handles({hContext, hDevice, hExternalMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesMapExternalLinearMemoryExp\n");
@@ -6726,6 +6870,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
       "urBindlessImagesReleaseExternalMemoryExp", &params);
+  getContext()->notify_handles({hContext, hDevice, hExternalMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesReleaseExternalMemoryExp\n");
@@ -6774,6 +6919,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
       "urBindlessImagesImportExternalSemaphoreExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesImportExternalSemaphoreExp\n");
@@ -6819,6 +6965,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
       "urBindlessImagesReleaseExternalSemaphoreExp", &params);
+  getContext()->notify_handles({hContext, hDevice, hExternalSemaphore});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesReleaseExternalSemaphoreExp\n");
@@ -6883,6 +7030,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
       "urBindlessImagesWaitExternalSemaphoreExp", &params);
+  getContext()->notify_handles({hQueue, hSemaphore});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesWaitExternalSemaphoreExp\n");
@@ -6946,6 +7094,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
       "urBindlessImagesSignalExternalSemaphoreExp", &params);
+  getContext()->notify_handles({hQueue, hSemaphore});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urBindlessImagesSignalExternalSemaphoreExp\n");
@@ -6992,6 +7141,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP,
                                  "urCommandBufferCreateExp", &params);
+  getContext()->notify_handles({hContext, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferCreateExp\n");
@@ -7028,6 +7178,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP,
                                  "urCommandBufferRetainExp", &params);
+  getContext()->notify_handles({hCommandBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferRetainExp\n");
@@ -7063,6 +7214,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP,
                                  "urCommandBufferReleaseExp", &params);
+  getContext()->notify_handles({hCommandBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferReleaseExp\n");
@@ -7099,6 +7251,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP,
                                  "urCommandBufferFinalizeExp", &params);
+  getContext()->notify_handles({hCommandBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferFinalizeExp\n");
@@ -7191,6 +7344,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
       "urCommandBufferAppendKernelLaunchExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendKernelLaunchExp\n");
@@ -7267,6 +7421,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
       "urCommandBufferAppendUSMMemcpyExp", &params);
+  getContext()->notify_handles({hCommandBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendUSMMemcpyExp\n");
@@ -7345,6 +7500,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP,
                                  "urCommandBufferAppendUSMFillExp", &params);
+  getContext()->notify_handles({hCommandBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendUSMFillExp\n");
@@ -7426,6 +7582,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
       "urCommandBufferAppendMemBufferCopyExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hSrcMem, hDstMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendMemBufferCopyExp\n");
@@ -7505,6 +7662,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
       "urCommandBufferAppendMemBufferWriteExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendMemBufferWriteExp\n");
@@ -7584,6 +7742,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
       "urCommandBufferAppendMemBufferReadExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendMemBufferReadExp\n");
@@ -7678,6 +7837,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
       "urCommandBufferAppendMemBufferCopyRectExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hSrcMem, hDstMem});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendMemBufferCopyRectExp\n");
@@ -7777,6 +7937,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
       "urCommandBufferAppendMemBufferWriteRectExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendMemBufferWriteRectExp\n");
@@ -7875,6 +8036,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
       "urCommandBufferAppendMemBufferReadRectExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendMemBufferReadRectExp\n");
@@ -7959,6 +8121,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
       "urCommandBufferAppendMemBufferFillExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendMemBufferFillExp\n");
@@ -8035,6 +8198,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
       "urCommandBufferAppendUSMPrefetchExp", &params);
+  getContext()->notify_handles({hCommandBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendUSMPrefetchExp\n");
@@ -8110,6 +8274,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
       "urCommandBufferAppendUSMAdviseExp", &params);
+  getContext()->notify_handles({hCommandBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferAppendUSMAdviseExp\n");
@@ -8164,6 +8329,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP,
                                  "urCommandBufferEnqueueExp", &params);
+  getContext()->notify_handles({hCommandBuffer, hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferEnqueueExp\n");
@@ -8205,6 +8371,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
       "urCommandBufferUpdateKernelLaunchExp", &params);
+  getContext()->notify_handles({hCommand});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferUpdateKernelLaunchExp\n");
@@ -8244,6 +8411,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP,
       "urCommandBufferUpdateSignalEventExp", &params);
+  getContext()->notify_handles({hCommand});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferUpdateSignalEventExp\n");
@@ -8287,6 +8455,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP,
       "urCommandBufferUpdateWaitEventsExp", &params);
+  getContext()->notify_handles({hCommand});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferUpdateWaitEventsExp\n");
@@ -8333,6 +8502,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP,
                                  "urCommandBufferGetInfoExp", &params);
+  getContext()->notify_handles({hCommandBuffer});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urCommandBufferGetInfoExp\n");
@@ -8408,6 +8578,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
       "urEnqueueCooperativeKernelLaunchExp", &params);
+  getContext()->notify_handles({hQueue, hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueCooperativeKernelLaunchExp\n");
@@ -8466,6 +8637,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
       "urKernelSuggestMaxCooperativeGroupCountExp", &params);
+  getContext()->notify_handles({hKernel, hDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urKernelSuggestMaxCooperativeGroupCountExp\n");
@@ -8529,6 +8701,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP,
                                  "urEnqueueTimestampRecordingExp", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueTimestampRecordingExp\n");
@@ -8610,6 +8783,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP,
                                  "urEnqueueKernelLaunchCustomExp", &params);
+  getContext()->notify_handles({hQueue, hKernel});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueKernelLaunchCustomExp\n");
@@ -8654,6 +8828,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
                                           &pOptions};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_BUILD_EXP,
                                                  "urProgramBuildExp", &params);
+  getContext()->notify_handles({hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramBuildExp\n");
@@ -8694,6 +8869,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
                                             &pOptions};
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_PROGRAM_COMPILE_EXP, "urProgramCompileExp", &params);
+  getContext()->notify_handles({hProgram});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramCompileExp\n");
@@ -8744,6 +8920,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
                                          &phProgram};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK_EXP,
                                                  "urProgramLinkExp", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urProgramLinkExp\n");
@@ -8782,6 +8959,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
   ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_IMPORT_EXP,
                                                  "urUSMImportExp", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMImportExp\n");
@@ -8816,6 +8994,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
   ur_usm_release_exp_params_t params = {&hContext, &pMem};
   uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_RELEASE_EXP,
                                                  "urUSMReleaseExp", &params);
+  getContext()->notify_handles({hContext});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUSMReleaseExp\n");
@@ -8853,6 +9032,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
                                  "urUsmP2PEnablePeerAccessExp", &params);
+  getContext()->notify_handles({commandDevice, peerDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUsmP2PEnablePeerAccessExp\n");
@@ -8892,6 +9072,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
                                  "urUsmP2PDisablePeerAccessExp", &params);
+  getContext()->notify_handles({commandDevice, peerDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUsmP2PDisablePeerAccessExp\n");
@@ -8946,6 +9127,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
                                  "urUsmP2PPeerAccessGetInfoExp", &params);
+  getContext()->notify_handles({commandDevice, peerDevice});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urUsmP2PPeerAccessGetInfoExp\n");
@@ -8998,6 +9180,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrierExt(
   uint64_t instance = getContext()->notify_begin(
       UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER_EXT,
       "urEnqueueEventsWaitWithBarrierExt", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueEventsWaitWithBarrierExt\n");
@@ -9070,6 +9253,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
   uint64_t instance =
       getContext()->notify_begin(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
                                  "urEnqueueNativeCommandExp", &params);
+  getContext()->notify_handles({hQueue});
 
   auto &logger = getContext()->logger;
   logger.info("   ---> urEnqueueNativeCommandExp\n");
@@ -10337,6 +10521,8 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
   // Recreate the logger in case env variables have been modified between
   // program launch and the call to `urLoaderInit`
   logger = logger::create_logger("tracing", true, true);
+  init_binary_trace();
+  init_latency_tracker();
 
   ur_tracing_layer::getContext()->codelocData = codelocData;
 
@@ -13,7 +13,16 @@
 namespace ur_validation_layer {
 
 using BacktraceLine = std::string;
-std::vector<BacktraceLine> getCurrentBacktrace();
+using BacktraceFrames = std::vector<void *>;
+
+// Only records the raw return addresses, which is cheap enough to do on every
+// handle creation. Symbolization is deferred until the frames are reported.
+BacktraceFrames captureBacktrace();
+std::vector<BacktraceLine> symbolizeBacktrace(const BacktraceFrames &frames);
+
+inline std::vector<BacktraceLine> getCurrentBacktrace() {
+  return symbolizeBacktrace(captureBacktrace());
+}
 
 } // namespace ur_validation_layer
 
@@ -17,27 +17,30 @@
 
 namespace ur_validation_layer {
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
-  HANDLE process = GetCurrentProcess();
-  SymInitialize(process, nullptr, true);
-
+BacktraceFrames captureBacktrace() {
   PVOID frames[MAX_BACKTRACE_FRAMES];
   WORD frameCount =
       CaptureStackBackTrace(0, MAX_BACKTRACE_FRAMES, frames, NULL);
 
-  if (frameCount == 0) {
-    SymCleanup(process);
+  return BacktraceFrames(frames, frames + frameCount);
+}
+
+std::vector<BacktraceLine> symbolizeBacktrace(const BacktraceFrames &frames) {
+  if (frames.empty()) {
     return std::vector<BacktraceLine>(1, "Failed to acquire a backtrace");
   }
 
+  HANDLE process = GetCurrentProcess();
+  SymInitialize(process, nullptr, true);
+
   DWORD displacement = 0;
   IMAGEHLP_LINE64 line;
   line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
 
   std::vector<BacktraceLine> backtrace;
   try {
-    for (int i = 0; i < frameCount; i++) {
-      if (SymGetLineFromAddr64(process, (DWORD64)frames[i], &displacement,
+    for (auto frame : frames) {
+      if (SymGetLineFromAddr64(process, (DWORD64)frame, &displacement,
                                &line)) {
         backtrace.push_back(std::string(line.FileName) + ":" +
                             std::to_string(line.LineNumber));
@@ -9,12 +9,13 @@
 #include "backtrace.hpp"
 #include "ur_validation_layer.hpp"
 
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <typeindex>
 #include <unordered_map>
 #include <utility>
-
-#define MAX_BACKTRACE_FRAMES 64
+#include <vector>
 
 namespace ur_validation_layer {
 
@@ -23,11 +24,11 @@ private:
   struct RefRuntimeInfo {
     int64_t refCount;
     std::type_index type;
-    std::vector<BacktraceLine> backtrace;
+    BacktraceFrames backtrace;
 
     RefRuntimeInfo(int64_t refCount, std::type_index type,
-                   std::vector<BacktraceLine> backtrace)
-        : refCount(refCount), type(type), backtrace(backtrace) {}
+                   BacktraceFrames backtrace)
+        : refCount(refCount), type(type), backtrace(std::move(backtrace)) {}
   };
 
   enum RefCountUpdateType {
@@ -37,83 +38,165 @@ private:
     REFCOUNT_DECREASE,
   };
 
-  std::mutex mutex;
-  std::unordered_map<void *, struct RefRuntimeInfo> counts;
-  int64_t adapterCount = 0;
+  // Handles are spread over independently locked shards so that threads
+  // working on unrelated handles don't contend on a single mutex.
+  static constexpr size_t numShards = 64;
+
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::unordered_map<void *, struct RefRuntimeInfo> counts;
+  };
+
+  std::array<Shard, numShards> shards;
+  std::atomic<int64_t> adapterCount = 0;
+
+  // Record a creation backtrace for one in every backtraceSampleRate handles,
+  // zero disables backtraces altogether.
+  uint64_t backtraceSampleRate = 1;
+  std::atomic<uint64_t> backtraceSampleCounter = 0;
+
+  Shard &getShard(void *ptr) {
+    return shards[(reinterpret_cast<uintptr_t>(ptr) >> 4) % numShards];
+  }
+
+  BacktraceFrames sampleBacktrace() {
+    if (backtraceSampleRate == 0 ||
+        backtraceSampleCounter++ % backtraceSampleRate != 0) {
+      return {};
+    }
+    return captureBacktrace();
+  }
 
   template <typename T>
   void updateRefCount(T handle, enum RefCountUpdateType type,
                       bool isAdapterHandle = false) {
-    std::unique_lock<std::mutex> ulock(mutex);
-
     void *ptr = static_cast<void *>(handle);
-    auto it = counts.find(ptr);
-
-    switch (type) {
-    case REFCOUNT_CREATE_OR_INCREASE:
-      if (it == counts.end()) {
-        std::tie(it, std::ignore) = counts.emplace(
-            ptr, RefRuntimeInfo{1, std::type_index(typeid(handle)),
-                                getCurrentBacktrace()});
-        if (isAdapterHandle) {
-          adapterCount++;
+    auto &shard = getShard(ptr);
+
+    {
+      std::unique_lock<std::mutex> ulock(shard.mutex);
+
+      auto &counts = shard.counts;
+      auto it = counts.find(ptr);
+
+      switch (type) {
+      case REFCOUNT_CREATE_OR_INCREASE:
+        if (it == counts.end()) {
+          std::tie(it, std::ignore) = counts.emplace(
+              ptr, RefRuntimeInfo{1, std::type_index(typeid(handle)),
+                                  sampleBacktrace()});
+          if (isAdapterHandle) {
+            adapterCount++;
+          }
+        } else {
+          it->second.refCount++;
+        }
+        break;
+      case REFCOUNT_CREATE:
+        if (it == counts.end()) {
+          std::tie(it, std::ignore) = counts.emplace(
+              ptr, RefRuntimeInfo{1, std::type_index(typeid(handle)),
+                                  sampleBacktrace()});
+        } else {
+          getContext()->logger.error("Handle {} already exists", ptr);
+          return;
+        }
+        break;
+      case REFCOUNT_INCREASE:
+        if (it == counts.end()) {
+          getContext()->logger.error(
+              "Attempting to retain nonexistent handle {}", ptr);
+          return;
+        } else {
+          it->second.refCount++;
+        }
+        break;
+      case REFCOUNT_DECREASE:
+        if (it == counts.end()) {
+          std::tie(it, std::ignore) = counts.emplace(
+              ptr, RefRuntimeInfo{-1, std::type_index(typeid(handle)),
+                                  sampleBacktrace()});
+        } else {
+          it->second.refCount--;
         }
-      } else {
-        it->second.refCount++;
-      }
-      break;
-    case REFCOUNT_CREATE:
-      if (it == counts.end()) {
-        std::tie(it, std::ignore) = counts.emplace(
-            ptr, RefRuntimeInfo{1, std::type_index(typeid(handle)),
-                                getCurrentBacktrace()});
-      } else {
-        getContext()->logger.error("Handle {} already exists", ptr);
-        return;
-      }
-      break;
-    case REFCOUNT_INCREASE:
-      if (it == counts.end()) {
-        getContext()->logger.error("Attempting to retain nonexistent handle {}",
-                                   ptr);
-        return;
-      } else {
-        it->second.refCount++;
-      }
-      break;
-    case REFCOUNT_DECREASE:
-      if (it == counts.end()) {
-        std::tie(it, std::ignore) = counts.emplace(
-            ptr, RefRuntimeInfo{-1, std::type_index(typeid(handle)),
-                                getCurrentBacktrace()});
-      } else {
-        it->second.refCount--;
-      }
 
-      if (it->second.refCount < 0) {
-        getContext()->logger.error(
-            "Attempting to release nonexistent handle {}", ptr);
-      } else if (it->second.refCount == 0 && isAdapterHandle) {
-        adapterCount--;
+        if (it->second.refCount < 0) {
+          getContext()->logger.error(
+              "Attempting to release nonexistent handle {}", ptr);
+        } else if (it->second.refCount == 0 && isAdapterHandle) {
+          adapterCount--;
+        }
+        break;
       }
-      break;
-    }
 
-    getContext()->logger.debug("Reference count for handle {} changed to {}",
-                               ptr, it->second.refCount);
+      getContext()->logger.debug("Reference count for handle {} changed to {}",
+                                 ptr, it->second.refCount);
 
-    if (it->second.refCount == 0) {
-      counts.erase(ptr);
+      if (it->second.refCount == 0) {
+        counts.erase(it);
+      }
     }
 
     // No more active adapters, so any references still held are leaked
     if (adapterCount == 0) {
-      logInvalidReferences();
-      counts.clear();
+      logReferences(takeReferences(true));
+    }
+  }
+
+  using ReferenceList = std::vector<std::pair<void *, RefRuntimeInfo>>;
+
+  // Moves every recorded reference out with all shards locked at once, so
+  // that threads still retaining or releasing handles either land before
+  // the snapshot or after it. If noAdapters is set, nothing is taken when an
+  // adapter was retained again in the meantime.
+  ReferenceList takeReferences(bool noAdapters) {
+    std::array<std::unique_lock<std::mutex>, numShards> locks;
+    for (size_t i = 0; i < numShards; i++) {
+      locks[i] = std::unique_lock<std::mutex>(shards[i].mutex);
+    }
+
+    ReferenceList references;
+    if (noAdapters && adapterCount != 0) {
+      return references;
+    }
+    for (auto &shard : shards) {
+      for (auto &[ptr, refRuntimeInfo] : shard.counts) {
+        references.emplace_back(ptr, std::move(refRuntimeInfo));
+      }
+      shard.counts.clear();
+    }
+    return references;
+  }
+
+  // Symbolizing backtraces is slow, so this runs without holding any lock.
+  void logReferences(const ReferenceList &references) {
+    for (auto &[ptr, refRuntimeInfo] : references) {
+      getContext()->logger.error("Retained {} reference(s) to handle {}",
+                                 refRuntimeInfo.refCount, ptr);
+      if (refRuntimeInfo.backtrace.empty()) {
+        getContext()->logger.error(
+            "Handle {} was recorded without a backtrace (see "
+            "UR_LEAK_CHECK_BACKTRACE_SAMPLE_RATE)",
+            ptr);
+        continue;
+      }
+
+      getContext()->logger.error("Handle {} was recorded for first time here:",
+                                 ptr);
+      auto backtrace = symbolizeBacktrace(refRuntimeInfo.backtrace);
+      for (size_t i = 0; i < backtrace.size(); i++) {
+        getContext()->logger.error("#{} {}", i, backtrace[i].c_str());
+      }
     }
   }
 
 public:
+  RefCountContext() {
+    if (auto rate = getenv_to_unsigned("UR_LEAK_CHECK_BACKTRACE_SAMPLE_RATE")) {
+      backtraceSampleRate = *rate;
+    }
+  }
+
   template <typename T> void createRefCount(T handle) {
     updateRefCount<T>(handle, REFCOUNT_CREATE);
   }
@@ -134,27 +217,19 @@ public:
   }
 
   template <typename T> bool isReferenceValid(T handle) {
-    std::unique_lock<std::mutex> lock(mutex);
-    auto it = counts.find(static_cast<void *>(handle));
-    if (it == counts.end() || it->second.refCount < 1) {
+    void *ptr = static_cast<void *>(handle);
+    auto &shard = getShard(ptr);
+
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    auto it = shard.counts.find(ptr);
+    if (it == shard.counts.end() || it->second.refCount < 1) {
       return false;
     }
 
     return (it->second.type == std::type_index(typeid(handle)));
   }
 
-  void logInvalidReferences() {
-    for (auto &[ptr, refRuntimeInfo] : counts) {
-      getContext()->logger.error("Retained {} reference(s) to handle {}",
-                                 refRuntimeInfo.refCount, ptr);
-      getContext()->logger.error("Handle {} was recorded for first time here:",
-                                 ptr);
-      for (size_t i = 0; i < refRuntimeInfo.backtrace.size(); i++) {
-        getContext()->logger.error("#{} {}", i,
-                                   refRuntimeInfo.backtrace[i].c_str());
-      }
-    }
-  }
+  void logInvalidReferences() { logReferences(takeReferences(false)); }
 
   void logInvalidReference(void *ptr) {
     getContext()->logger.error("There are no valid references to handle {}",
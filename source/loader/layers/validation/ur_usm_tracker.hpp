@@ -0,0 +1,138 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#ifndef UR_USM_TRACKER_H
+#define UR_USM_TRACKER_H 1
+
+#include "ur_api.h"
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace ur_validation_layer {
+
+// Tracks live USM allocations per context and the context of every queue seen
+// by the layer, so that bounds checks on USM pointers can be answered without
+// calling into the adapter.
+struct UsmAllocTracker {
+  struct AllocRange {
+    uintptr_t base;
+    size_t size;
+  };
+
+  void insertAlloc(ur_context_handle_t hContext, const void *ptr, size_t size) {
+    std::unique_lock<std::shared_mutex> lock(allocMutex);
+    allocs[hContext][reinterpret_cast<uintptr_t>(ptr)] = size;
+  }
+
+  void eraseAlloc(ur_context_handle_t hContext, const void *ptr) {
+    std::unique_lock<std::shared_mutex> lock(allocMutex);
+    auto it = allocs.find(hContext);
+    if (it == allocs.end()) {
+      return;
+    }
+    it->second.erase(reinterpret_cast<uintptr_t>(ptr));
+    if (it->second.empty()) {
+      allocs.erase(it);
+    }
+  }
+
+  // Counts the references to hContext handed out through the layer, from its
+  // creation or another urContextCreateWithNativeHandle or urContextRetain.
+  void retainContext(ur_context_handle_t hContext) {
+    std::unique_lock<std::shared_mutex> lock(allocMutex);
+    contextRefs[hContext]++;
+  }
+
+  // Drops a reference to hContext, forgetting it once the last one goes.
+  void releaseContext(ur_context_handle_t hContext) {
+    {
+      std::unique_lock<std::shared_mutex> lock(allocMutex);
+      auto it = contextRefs.find(hContext);
+      if (it == contextRefs.end() || --it->second) {
+        return;
+      }
+      contextRefs.erase(it);
+    }
+    eraseContext(hContext);
+  }
+
+  // Forgets the allocations of hContext and the queues created in it, so that
+  // a context or queue later created at the same address starts out clean.
+  void eraseContext(ur_context_handle_t hContext) {
+    {
+      std::unique_lock<std::shared_mutex> lock(allocMutex);
+      allocs.erase(hContext);
+    }
+    std::unique_lock<std::shared_mutex> lock(queueMutex);
+    for (auto it = queueContexts.begin(); it != queueContexts.end();) {
+      it = it->second == hContext ? queueContexts.erase(it) : std::next(it);
+    }
+  }
+
+  // Returns the allocation of hContext containing ptr, if there is one.
+  std::optional<AllocRange> findAlloc(ur_context_handle_t hContext,
+                                      const void *ptr) {
+    auto addr = reinterpret_cast<uintptr_t>(ptr);
+
+    std::shared_lock<std::shared_mutex> lock(allocMutex);
+    auto ctxIt = allocs.find(hContext);
+    if (ctxIt == allocs.end()) {
+      return std::nullopt;
+    }
+
+    // Allocations never overlap, so the only candidate is the last one
+    // starting at or below addr.
+    auto &ranges = ctxIt->second;
+    auto it = ranges.upper_bound(addr);
+    if (it == ranges.begin()) {
+      return std::nullopt;
+    }
+    --it;
+    if (addr - it->first >= it->second) {
+      return std::nullopt;
+    }
+    return AllocRange{it->first, it->second};
+  }
+
+  void insertQueue(ur_queue_handle_t hQueue, ur_context_handle_t hContext) {
+    std::unique_lock<std::shared_mutex> lock(queueMutex);
+    queueContexts[hQueue] = hContext;
+  }
+
+  // The queue may still be alive if it was retained, in which case its
+  // context is simply looked up again on the next bounds check.
+  void eraseQueue(ur_queue_handle_t hQueue) {
+    std::unique_lock<std::shared_mutex> lock(queueMutex);
+    queueContexts.erase(hQueue);
+  }
+
+  std::optional<ur_context_handle_t>
+  findQueueContext(ur_queue_handle_t hQueue) {
+    std::shared_lock<std::shared_mutex> lock(queueMutex);
+    auto it = queueContexts.find(hQueue);
+    if (it == queueContexts.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+private:
+  std::shared_mutex allocMutex;
+  std::unordered_map<ur_context_handle_t, std::map<uintptr_t, size_t>> allocs;
+  std::unordered_map<ur_context_handle_t, uint32_t> contextRefs;
+
+  std::shared_mutex queueMutex;
+  std::unordered_map<ur_queue_handle_t, ur_context_handle_t> queueContexts;
+};
+
+} // namespace ur_validation_layer
+
+#endif /* UR_USM_TRACKER_H */
@@ -12,6 +12,7 @@
  *
  */
 #include "ur_leak_check.hpp"
+#include "ur_usm_tracker.hpp"
 #include "ur_validation_layer.hpp"
 
 namespace ur_validation_layer {
@@ -795,6 +796,10 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     getContext()->refCountContext->createRefCount(*phContext);
   }
 
+  if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+    getContext()->usmAllocTracker->retainContext(*phContext);
+  }
+
   return result;
 }
 
@@ -820,6 +825,10 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
     getContext()->refCountContext->incrementRefCount(hContext, false);
   }
 
+  if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+    getContext()->usmAllocTracker->retainContext(hContext);
+  }
+
   return result;
 }
 
@@ -843,6 +852,10 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
     getContext()->refCountContext->decrementRefCount(hContext, false);
   }
 
+  if (getContext()->enableBoundsChecking) {
+    getContext()->usmAllocTracker->releaseContext(hContext);
+  }
+
   ur_result_t result = pfnRelease(hContext);
 
   return result;
@@ -975,6 +988,10 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     getContext()->refCountContext->createRefCount(*phContext);
   }
 
+  if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+    getContext()->usmAllocTracker->retainContext(*phContext);
+  }
+
   return result;
 }
 
@@ -1754,6 +1771,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
 
   ur_result_t result = pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
 
+  if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+    getContext()->usmAllocTracker->insertAlloc(hContext, *ppMem, size);
+  }
+
   return result;
 }
 
@@ -1817,6 +1838,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
   ur_result_t result =
       pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
 
+  if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+    getContext()->usmAllocTracker->insertAlloc(hContext, *ppMem, size);
+  }
+
   return result;
 }
 
@@ -1880,6 +1905,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
   ur_result_t result =
       pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
 
+  if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+    getContext()->usmAllocTracker->insertAlloc(hContext, *ppMem, size);
+  }
+
   return result;
 }
 
@@ -1909,6 +1938,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
     getContext()->refCountContext->logInvalidReference(hContext);
   }
 
+  if (getContext()->enableBoundsChecking) {
+    getContext()->usmAllocTracker->eraseAlloc(hContext, pMem);
+  }
+
   ur_result_t result = pfnFree(hContext, pMem);
 
   return result;
@@ -3925,6 +3958,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
     getContext()->refCountContext->createRefCount(*phQueue);
   }
 
+  if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+    getContext()->usmAllocTracker->insertQueue(*phQueue, hContext);
+  }
+
   return result;
 }
 
@@ -3973,6 +4010,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
     getContext()->refCountContext->decrementRefCount(hQueue, false);
   }
 
+  if (getContext()->enableBoundsChecking) {
+    getContext()->usmAllocTracker->eraseQueue(hQueue);
+  }
+
   ur_result_t result = pfnRelease(hQueue);
 
   return result;
@@ -4056,6 +4097,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     getContext()->refCountContext->createRefCount(*phQueue);
   }
 
+  if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+    getContext()->usmAllocTracker->insertQueue(*phQueue, hContext);
+  }
+
   return result;
 }
 
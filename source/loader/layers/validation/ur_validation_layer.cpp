@@ -12,6 +12,7 @@
  */
 #include "ur_validation_layer.hpp"
 #include "ur_leak_check.hpp"
+#include "ur_usm_tracker.hpp"
 
 #include <cassert>
 
@@ -21,7 +22,8 @@ context_t *getContext() { return context_t::get_direct(); }
 ///////////////////////////////////////////////////////////////////////////////
 context_t::context_t()
     : logger(logger::create_logger("validation")),
-      refCountContext(new RefCountContext()) {}
+      refCountContext(new RefCountContext()),
+      usmAllocTracker(new UsmAllocTracker()) {}
 
 ///////////////////////////////////////////////////////////////////////////////
 context_t::~context_t() {}
@@ -77,30 +79,60 @@ ur_result_t bounds(ur_mem_handle_t buffer, ur_rect_offset_t offset,
 
 ur_result_t bounds(ur_queue_handle_t queue, const void *ptr, size_t offset,
                    size_t size) {
-  auto pfnQueueGetInfo = getContext()->urDdiTable.Queue.pfnGetInfo;
-  auto pfnUSMGetMemAllocInfo = getContext()->urDdiTable.USM.pfnGetMemAllocInfo;
+  auto &tracker = getContext()->usmAllocTracker;
 
   ur_context_handle_t urContext = nullptr;
-  RETURN_ON_FAILURE(pfnQueueGetInfo(queue, UR_QUEUE_INFO_CONTEXT,
-                                    sizeof(ur_context_handle_t), &urContext,
-                                    nullptr));
-  ur_usm_type_t usmType = UR_USM_TYPE_UNKNOWN;
-  RETURN_ON_FAILURE(pfnUSMGetMemAllocInfo(urContext, ptr,
-                                          UR_USM_ALLOC_INFO_TYPE,
-                                          sizeof(usmType), &usmType, nullptr));
-
-  // We can't reliably get size info about pointers that didn't come from the
-  // USM alloc entry points.
-  if (usmType == UR_USM_TYPE_UNKNOWN) {
-    return UR_RESULT_SUCCESS;
+  if (auto cachedContext = tracker->findQueueContext(queue)) {
+    urContext = *cachedContext;
+  } else {
+    auto pfnQueueGetInfo = getContext()->urDdiTable.Queue.pfnGetInfo;
+    RETURN_ON_FAILURE(pfnQueueGetInfo(queue, UR_QUEUE_INFO_CONTEXT,
+                                      sizeof(ur_context_handle_t), &urContext,
+                                      nullptr));
+    tracker->insertQueue(queue, urContext);
   }
 
+  // Allocations made through the layer are answered from the tracker, the
+  // adapter is only queried for pointers it has not seen (e.g. imported ones).
+  uintptr_t allocBase = 0;
   size_t allocSize = 0;
-  RETURN_ON_FAILURE(
-      pfnUSMGetMemAllocInfo(urContext, ptr, UR_USM_ALLOC_INFO_SIZE,
-                            sizeof(allocSize), &allocSize, nullptr));
+  if (auto alloc = tracker->findAlloc(urContext, ptr)) {
+    allocBase = alloc->base;
+    allocSize = alloc->size;
+  } else {
+    auto pfnUSMGetMemAllocInfo =
+        getContext()->urDdiTable.USM.pfnGetMemAllocInfo;
+
+    ur_usm_type_t usmType = UR_USM_TYPE_UNKNOWN;
+    RETURN_ON_FAILURE(
+        pfnUSMGetMemAllocInfo(urContext, ptr, UR_USM_ALLOC_INFO_TYPE,
+                              sizeof(usmType), &usmType, nullptr));
+
+    // We can't reliably get size info about pointers that didn't come from
+    // the USM alloc entry points.
+    if (usmType == UR_USM_TYPE_UNKNOWN) {
+      return UR_RESULT_SUCCESS;
+    }
+
+    // Adapters that can't tell where the allocation starts are given the
+    // benefit of the doubt and ptr is taken to be its start.
+    void *basePtr = nullptr;
+    if (pfnUSMGetMemAllocInfo(urContext, ptr, UR_USM_ALLOC_INFO_BASE_PTR,
+                              sizeof(basePtr), &basePtr,
+                              nullptr) != UR_RESULT_SUCCESS ||
+        !basePtr) {
+      basePtr = const_cast<void *>(ptr);
+    }
+    RETURN_ON_FAILURE(
+        pfnUSMGetMemAllocInfo(urContext, ptr, UR_USM_ALLOC_INFO_SIZE,
+                              sizeof(allocSize), &allocSize, nullptr));
+    allocBase = reinterpret_cast<uintptr_t>(basePtr);
+  }
 
-  if (size + offset > allocSize) {
+  // ptr may point into the middle of the allocation, only what's left of it
+  // past ptr is available.
+  size_t allocOffset = reinterpret_cast<uintptr_t>(ptr) - allocBase;
+  if (allocOffset > allocSize || size + offset > allocSize - allocOffset) {
     return UR_RESULT_ERROR_INVALID_SIZE;
   }
 
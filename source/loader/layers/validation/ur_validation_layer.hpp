@@ -19,6 +19,7 @@
 namespace ur_validation_layer {
 
 struct RefCountContext;
+struct UsmAllocTracker;
 
 ///////////////////////////////////////////////////////////////////////////////
 class __urdlllocal context_t : public proxy_layer_context_t,
@@ -45,6 +46,7 @@ public:
   ur_result_t tearDown() override;
 
   std::unique_ptr<RefCountContext> refCountContext;
+  std::unique_ptr<UsmAllocTracker> usmAllocTracker;
 
 private:
   inline static const std::string nameFullValidation =
@@ -25,6 +25,8 @@
 #include "ur_loader.hpp"
 
 #include <cstring> // for std::memcpy
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <stdlib.h>
 
@@ -246,71 +248,38 @@ urLoaderConfigSetMockingEnabled(ur_loader_config_handle_t hLoaderConfig,
   return UR_RESULT_SUCCESS;
 }
 
-ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
-                                ur_device_type_t DeviceType,
-                                uint32_t NumEntries,
-                                ur_device_handle_t *phDevices,
-                                uint32_t *pNumDevices) {
+namespace {
 
-  if (!hPlatform) {
-    return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
-  }
-  if (NumEntries > 0 && !phDevices) {
-    return UR_RESULT_ERROR_INVALID_NULL_POINTER;
-  }
-  // pNumDevices is the actual number of device handles added to phDevices by
-  // this function
-  if (NumEntries == 0 && !pNumDevices) {
-    return UR_RESULT_ERROR_INVALID_SIZE;
-  }
+using DeviceHardwareType = ur_device_type_t;
 
-  switch (DeviceType) {
-  case UR_DEVICE_TYPE_ALL:
-  case UR_DEVICE_TYPE_GPU:
-  case UR_DEVICE_TYPE_DEFAULT:
-  case UR_DEVICE_TYPE_CPU:
-  case UR_DEVICE_TYPE_FPGA:
-  case UR_DEVICE_TYPE_MCA:
-    break;
-  default:
-    return UR_RESULT_ERROR_INVALID_ENUMERATION;
-    // urPrint("Unknown device type");
-    break;
-  }
-  // plan:
-  // 0. basic validation of argument values (see code above)
-  // 1. conversion of argument values into useful data items
-  // 2. retrieval and parsing of environment variable string
-  // 3. conversion of term map to accept and discard filters
-  // 4. inserting a default "*:*" accept filter, if required
-  // 5. symbolic consolidation of accept and discard filters
-  // 6. querying the platform handles for all 'root' devices
-  // 7. partioning via platform root devices into subdevices
-  // 8. partioning via platform subdevices into subsubdevices
-  // 9. short-listing devices to accept using accept filters
-  // A. de-listing devices to discard using discard filters
+enum class DevicePartLevel { ROOT, SUB, SUBSUB };
 
-  // possible symbolic short-circuit special cases exist:
-  // * if there are no terms,     select all   root devices
-  // * if any discard is "*",     select no    root devices
-  // * if any discard is "*.*",   select no     sub-devices
-  // * if any discard is "*.*.*", select no sub-sub-devices
-  // *
-  //
-  // detail for step 5 of above plan:
-  // * combine all accept filters into a single accept list
-  // * combine all discard filters into single discard list
-  // then invert it to make the initial/default accept list
-  // (needs knowledge of the valid range from the platform)
-  // "!level_zero:1,2" -> "level_zero:0,3,...,max"
-  // * finally subtract the discard set from the accept set
+using DeviceIdType = unsigned long;
+constexpr DeviceIdType DeviceIdTypeALL =
+    -1; // ULONG_MAX but without #include <climits>
 
-  // accept  "2,*" != "*,2"
-  // because "2,*" == "2,0,1,3"
-  // whereas "*,2" == "0,1,2,3"
-  // however
-  // discard "2,*" == "*,2"
+struct DeviceSpec {
+  DevicePartLevel level;
+  DeviceHardwareType hwType = ::UR_DEVICE_TYPE_ALL;
+  DeviceIdType rootId = DeviceIdTypeALL;
+  DeviceIdType subId = DeviceIdTypeALL;
+  DeviceIdType subsubId = DeviceIdTypeALL;
+  ur_device_handle_t urDeviceHandle;
+};
+
+/// A term of ONEAPI_DEVICE_SELECTOR, split up into device filters
+struct DeviceSelectorTerm {
+  std::string backend;
+  bool discard;
+  // Malformed terms are only reported once they are applied to a platform, in
+  // the same order as if the string was parsed for every platform
+  const char *error;
+  std::vector<DeviceSpec> filters;
+};
 
+using DeviceSelector = std::vector<DeviceSelectorTerm>;
+
+DeviceSelector compileDeviceSelector() {
   // The std::map is sorted by its key, so this method of parsing the ODS env
   // var alters the ordering of the terms, which makes it impossible to check
   // whether all discard terms appear after all accept terms and to preserve the
@@ -374,59 +343,6 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
       ")$",
       std::regex_constants::icase);
 
-  ur_platform_backend_t platformBackend;
-  if (UR_RESULT_SUCCESS !=
-      urPlatformGetInfo(hPlatform, UR_PLATFORM_INFO_BACKEND,
-                        sizeof(ur_platform_backend_t), &platformBackend, 0)) {
-    return UR_RESULT_ERROR_INVALID_PLATFORM;
-  }
-  const std::string platformBackendName = // hPlatform->get_backend_name();
-      [&platformBackend]() constexpr {
-        switch (platformBackend) {
-        case UR_PLATFORM_BACKEND_UNKNOWN:
-          return "*"; // the only ODS string that matches
-          break;
-        case UR_PLATFORM_BACKEND_LEVEL_ZERO:
-          return "level_zero";
-          break;
-        case UR_PLATFORM_BACKEND_OPENCL:
-          return "opencl";
-          break;
-        case UR_PLATFORM_BACKEND_CUDA:
-          return "cuda";
-          break;
-        case UR_PLATFORM_BACKEND_HIP:
-          return "hip";
-          break;
-        case UR_PLATFORM_BACKEND_NATIVE_CPU:
-          return "*"; // the only ODS string that matches
-          break;
-        case UR_PLATFORM_BACKEND_FORCE_UINT32:
-          return ""; // no ODS string matches this
-          break;
-        default:
-          return ""; // no ODS string matches this
-          break;
-        }
-      }();
-
-  using DeviceHardwareType = ur_device_type_t;
-
-  enum class DevicePartLevel { ROOT, SUB, SUBSUB };
-
-  using DeviceIdType = unsigned long;
-  constexpr DeviceIdType DeviceIdTypeALL =
-      -1; // ULONG_MAX but without #include <climits>
-
-  struct DeviceSpec {
-    DevicePartLevel level;
-    DeviceHardwareType hwType = ::UR_DEVICE_TYPE_ALL;
-    DeviceIdType rootId = DeviceIdTypeALL;
-    DeviceIdType subId = DeviceIdTypeALL;
-    DeviceIdType subsubId = DeviceIdTypeALL;
-    ur_device_handle_t urDeviceHandle;
-  };
-
   auto getRootHardwareType =
       [](const std::string &input) -> DeviceHardwareType {
     std::string lowerInput(input);
@@ -451,8 +367,7 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
     return DeviceIdTypeALL;
   };
 
-  std::vector<DeviceSpec> acceptDeviceList;
-  std::vector<DeviceSpec> discardDeviceList;
+  DeviceSelector selector;
 
   for (auto &termPair : mapODS) {
     std::string backend = termPair.first;
@@ -472,34 +387,18 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
     logger::debug(
         "termType is {}",
         (termType != AcceptFilter ? "DiscardFilter" : "AcceptFilter"));
-    auto &deviceList =
-        (termType != AcceptFilter) ? discardDeviceList : acceptDeviceList;
     if (termType != AcceptFilter) {
       logger::debug("DEBUG: backend was '{}'", backend);
       backend.erase(backend.cbegin());
       logger::debug("DEBUG: backend now '{}'", backend);
     }
-    // Note the hPlatform -> platformBackend -> platformBackendName conversion
-    // above guarantees minimal sanity for the comparison with backend from the
-    // ODS string
-    if (backend.front() != '*' &&
-        !std::equal(platformBackendName.cbegin(), platformBackendName.cend(),
-                    backend.cbegin(), backend.cend(),
-                    [](const auto &a, const auto &b) {
-                      // case-insensitive comparison by converting both tolower
-                      return std::tolower(static_cast<unsigned char>(a)) ==
-                             std::tolower(static_cast<unsigned char>(b));
-                    })) {
-      // irrelevant term for current request: different backend -- silently
-      // ignore
-      logger::error("unrecognised backend '{}'", backend);
-      return UR_RESULT_ERROR_INVALID_VALUE;
-    }
+    DeviceSelectorTerm term{backend, termType != AcceptFilter, nullptr, {}};
     if (termPair.second.size() == 0) {
       // malformed term: missing filterStrings -- output ERROR
-      logger::error("missing filterStrings, format of filter = "
-                    "'[!]backend:filterStrings'");
-      return UR_RESULT_ERROR_INVALID_VALUE;
+      term.error = "missing filterStrings, format of filter = "
+                   "'[!]backend:filterStrings'";
+      selector.push_back(std::move(term));
+      continue;
     }
     if (std::find_if(termPair.second.cbegin(), termPair.second.cend(),
                      [](const auto &s) { return s.empty(); }) !=
@@ -508,6 +407,7 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
       // malformed term: missing filterString -- output warning, then continue
       logger::warning("WARNING: empty filterString, format of filterStrings "
                       "= 'filterString[,filterString[,...]]'");
+      selector.push_back(std::move(term));
       continue;
     }
     if (std::find_if(termPair.second.cbegin(), termPair.second.cend(),
@@ -515,9 +415,10 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                        return std::count(s.cbegin(), s.cend(), '.') > 2;
                      }) != termPair.second.cend()) {
       // malformed term: too many dots in filterString
-      logger::error("too many dots in filterString, format of "
-                    "filterString = 'root[.sub[.subsub]]'");
-      return UR_RESULT_ERROR_INVALID_VALUE;
+      term.error = "too many dots in filterString, format of "
+                   "filterString = 'root[.sub[.subsub]]'";
+      selector.push_back(std::move(term));
+      continue;
     }
     if (std::find_if(termPair.second.cbegin(), termPair.second.cend(),
                      [](const auto &s) {
@@ -537,13 +438,15 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                        return false; // no BAD things, so must be okay
                      }) != termPair.second.cend()) {
       // malformed term: star dot no-star in filterString
-      logger::error("invalid wildcard in filterString, '*.' => '*.*'");
-      return UR_RESULT_ERROR_INVALID_VALUE;
+      term.error = "invalid wildcard in filterString, '*.' => '*.*'";
+      selector.push_back(std::move(term));
+      continue;
     }
 
     // TODO -- use regex validation_pattern to catch all other syntax errors in
     // the ODS string
 
+    auto &deviceList = term.filters;
     for (auto &filterString : termPair.second) {
       std::string::size_type locationDot1 = filterString.find('.');
       if (locationDot1 != std::string::npos) {
@@ -579,6 +482,98 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                                         firstDeviceId, 0, 0, nullptr});
       }
     }
+    selector.push_back(std::move(term));
+  }
+
+  return selector;
+}
+
+/// Returns ONEAPI_DEVICE_SELECTOR compiled for the given value of the
+/// variable, compiling it only when the value changes
+std::shared_ptr<const DeviceSelector>
+getDeviceSelector(const std::optional<std::string> &env) {
+  static std::mutex mutex;
+  static std::optional<std::string> compiledEnv;
+  static std::shared_ptr<const DeviceSelector> compiled;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!compiled || compiledEnv != env) {
+    compiled = std::make_shared<const DeviceSelector>(compileDeviceSelector());
+    compiledEnv = env;
+  }
+  return compiled;
+}
+
+ur_result_t selectDevices(const DeviceSelector &selector,
+                          ur_platform_handle_t hPlatform,
+                          ur_device_type_t DeviceType,
+                          std::vector<ur_device_handle_t> &selectedDevices,
+                          bool &partitioned) {
+  ur_platform_backend_t platformBackend;
+  if (UR_RESULT_SUCCESS !=
+      urPlatformGetInfo(hPlatform, UR_PLATFORM_INFO_BACKEND,
+                        sizeof(ur_platform_backend_t), &platformBackend, 0)) {
+    return UR_RESULT_ERROR_INVALID_PLATFORM;
+  }
+  const std::string platformBackendName = // hPlatform->get_backend_name();
+      [&platformBackend]() constexpr {
+    switch (platformBackend) {
+    case UR_PLATFORM_BACKEND_UNKNOWN:
+      return "*"; // the only ODS string that matches
+      break;
+    case UR_PLATFORM_BACKEND_LEVEL_ZERO:
+      return "level_zero";
+      break;
+    case UR_PLATFORM_BACKEND_OPENCL:
+      return "opencl";
+      break;
+    case UR_PLATFORM_BACKEND_CUDA:
+      return "cuda";
+      break;
+    case UR_PLATFORM_BACKEND_HIP:
+      return "hip";
+      break;
+    case UR_PLATFORM_BACKEND_NATIVE_CPU:
+      return "*"; // the only ODS string that matches
+      break;
+    case UR_PLATFORM_BACKEND_FORCE_UINT32:
+      return ""; // no ODS string matches this
+      break;
+    default:
+      return ""; // no ODS string matches this
+      break;
+    }
+  }
+  ();
+
+  std::vector<DeviceSpec> acceptDeviceList;
+  std::vector<DeviceSpec> discardDeviceList;
+
+  for (auto &term : selector) {
+    const auto &backend = term.backend;
+    // Note the hPlatform -> platformBackend -> platformBackendName conversion
+    // above guarantees minimal sanity for the comparison with backend from the
+    // ODS string
+    if ((backend.empty() || backend.front() != '*') &&
+        !std::equal(platformBackendName.cbegin(), platformBackendName.cend(),
+                    backend.cbegin(), backend.cend(),
+                    [](const auto &a, const auto &b) {
+                      // case-insensitive comparison by converting both tolower
+                      return std::tolower(static_cast<unsigned char>(a)) ==
+                             std::tolower(static_cast<unsigned char>(b));
+                    })) {
+      // irrelevant term for current request: different backend -- silently
+      // ignore
+      logger::error("unrecognised backend '{}'", backend);
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    if (term.error) {
+      logger::error("{}", term.error);
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    auto &deviceList = term.discard ? discardDeviceList : acceptDeviceList;
+    deviceList.insert(deviceList.end(), term.filters.cbegin(),
+                      term.filters.cend());
   }
 
   if (acceptDeviceList.size() == 0 && discardDeviceList.size() == 0) {
@@ -601,6 +596,22 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
   logger::debug("DEBUG: size of discardDeviceList = {}",
                 discardDeviceList.size());
 
+  // Partitioning devices is expensive and only needed to apply sub-device and
+  // sub-sub-device terms, so skip it when there are none
+  auto hasFilterAtLevel = [&](DevicePartLevel level) {
+    auto isAtLevel = [level](const DeviceSpec &filter) {
+      return filter.level == level;
+    };
+    return std::any_of(acceptDeviceList.cbegin(), acceptDeviceList.cend(),
+                       isAtLevel) ||
+           std::any_of(discardDeviceList.cbegin(), discardDeviceList.cend(),
+                       isAtLevel);
+  };
+  const bool needSubSubDevices = hasFilterAtLevel(DevicePartLevel::SUBSUB);
+  const bool needSubDevices =
+      needSubSubDevices || hasFilterAtLevel(DevicePartLevel::SUB);
+  partitioned = needSubDevices;
+
   std::vector<DeviceSpec> rootDevices;
   std::vector<DeviceSpec> subDevices;
   std::vector<DeviceSpec> subSubDevices;
@@ -652,70 +663,76 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
   }
 
   // To support sub-device terms:
-  std::for_each(
-      rootDevices.cbegin(), rootDevices.cend(), [&](DeviceSpec device) {
-        ur_device_partition_property_t propNextPart{
-            UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN,
-            {UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE}};
-        ur_device_partition_properties_t partitionProperties{
-            UR_STRUCTURE_TYPE_DEVICE_PARTITION_PROPERTIES, nullptr,
-            &propNextPart, 1};
-        uint32_t numSubdevices = 0;
-        if (UR_RESULT_SUCCESS != urDevicePartition(device.urDeviceHandle,
-                                                   &partitionProperties, 0,
-                                                   nullptr, &numSubdevices)) {
-          return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
-        }
-        std::vector<ur_device_handle_t> subDeviceHandles(numSubdevices);
-        auto pSubDevices = subDeviceHandles.data();
-        if (UR_RESULT_SUCCESS !=
-            urDevicePartition(device.urDeviceHandle, &partitionProperties,
-                              numSubdevices, pSubDevices, 0)) {
-          return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
-        }
-        DeviceIdType subDeviceCount = 0;
-        std::transform(subDeviceHandles.cbegin(), subDeviceHandles.cend(),
-                       std::back_inserter(subDevices),
-                       [&](ur_device_handle_t urDeviceHandle) {
-                         return DeviceSpec{
-                             DevicePartLevel::SUB, device.hwType,
-                             device.rootId,        subDeviceCount++,
-                             DeviceIdTypeALL,      urDeviceHandle};
-                       });
-        return UR_RESULT_SUCCESS;
-      });
+  if (needSubDevices) {
+    std::for_each(
+        rootDevices.cbegin(), rootDevices.cend(), [&](DeviceSpec device) {
+          ur_device_partition_property_t propNextPart{
+              UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN,
+              {UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE}};
+          ur_device_partition_properties_t partitionProperties{
+              UR_STRUCTURE_TYPE_DEVICE_PARTITION_PROPERTIES, nullptr,
+              &propNextPart, 1};
+          uint32_t numSubdevices = 0;
+          if (UR_RESULT_SUCCESS != urDevicePartition(device.urDeviceHandle,
+                                                     &partitionProperties, 0,
+                                                     nullptr, &numSubdevices)) {
+            return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
+          }
+          std::vector<ur_device_handle_t> subDeviceHandles(numSubdevices);
+          auto pSubDevices = subDeviceHandles.data();
+          if (UR_RESULT_SUCCESS !=
+              urDevicePartition(device.urDeviceHandle, &partitionProperties,
+                                numSubdevices, pSubDevices, 0)) {
+            return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
+          }
+          DeviceIdType subDeviceCount = 0;
+          std::transform(subDeviceHandles.cbegin(), subDeviceHandles.cend(),
+                         std::back_inserter(subDevices),
+                         [&](ur_device_handle_t urDeviceHandle) {
+                           return DeviceSpec{
+                               DevicePartLevel::SUB, device.hwType,
+                               device.rootId,        subDeviceCount++,
+                               DeviceIdTypeALL,      urDeviceHandle};
+                         });
+          return UR_RESULT_SUCCESS;
+        });
+  }
 
   // To support sub-sub-device terms:
-  std::for_each(subDevices.cbegin(), subDevices.cend(), [&](DeviceSpec device) {
-    ur_device_partition_property_t propNextPart{
-        UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN,
-        {UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE}};
-    ur_device_partition_properties_t partitionProperties{
-        UR_STRUCTURE_TYPE_DEVICE_PARTITION_PROPERTIES, nullptr, &propNextPart,
-        1};
-    uint32_t numSubSubdevices = 0;
-    if (UR_RESULT_SUCCESS != urDevicePartition(device.urDeviceHandle,
-                                               &partitionProperties, 0, nullptr,
-                                               &numSubSubdevices)) {
-      return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
-    }
-    std::vector<ur_device_handle_t> subSubDeviceHandles(numSubSubdevices);
-    auto pSubSubDevices = subSubDeviceHandles.data();
-    if (UR_RESULT_SUCCESS !=
-        urDevicePartition(device.urDeviceHandle, &partitionProperties,
-                          numSubSubdevices, pSubSubDevices, 0)) {
-      return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
-    }
-    DeviceIdType subSubDeviceCount = 0;
-    std::transform(subSubDeviceHandles.cbegin(), subSubDeviceHandles.cend(),
-                   std::back_inserter(subSubDevices),
-                   [&](ur_device_handle_t urDeviceHandle) {
-                     return DeviceSpec{DevicePartLevel::SUBSUB, device.hwType,
-                                       device.rootId,           device.subId,
-                                       subSubDeviceCount++,     urDeviceHandle};
-                   });
-    return UR_RESULT_SUCCESS;
-  });
+  if (needSubSubDevices) {
+    std::for_each(
+        subDevices.cbegin(), subDevices.cend(), [&](DeviceSpec device) {
+          ur_device_partition_property_t propNextPart{
+              UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN,
+              {UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE}};
+          ur_device_partition_properties_t partitionProperties{
+              UR_STRUCTURE_TYPE_DEVICE_PARTITION_PROPERTIES, nullptr,
+              &propNextPart, 1};
+          uint32_t numSubSubdevices = 0;
+          if (UR_RESULT_SUCCESS !=
+              urDevicePartition(device.urDeviceHandle, &partitionProperties, 0,
+                                nullptr, &numSubSubdevices)) {
+            return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
+          }
+          std::vector<ur_device_handle_t> subSubDeviceHandles(numSubSubdevices);
+          auto pSubSubDevices = subSubDeviceHandles.data();
+          if (UR_RESULT_SUCCESS !=
+              urDevicePartition(device.urDeviceHandle, &partitionProperties,
+                                numSubSubdevices, pSubSubDevices, 0)) {
+            return UR_RESULT_ERROR_DEVICE_PARTITION_FAILED;
+          }
+          DeviceIdType subSubDeviceCount = 0;
+          std::transform(
+              subSubDeviceHandles.cbegin(), subSubDeviceHandles.cend(),
+              std::back_inserter(subSubDevices),
+              [&](ur_device_handle_t urDeviceHandle) {
+                return DeviceSpec{DevicePartLevel::SUBSUB, device.hwType,
+                                  device.rootId,           device.subId,
+                                  subSubDeviceCount++,     urDeviceHandle};
+              });
+          return UR_RESULT_SUCCESS;
+        });
+  }
 
   auto ApplyFilter = [&](DeviceSpec &filter, DeviceSpec &device) -> bool {
     bool matches = false;
@@ -798,8 +815,6 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
     }
   }
 
-  std::vector<ur_device_handle_t> selectedDevices;
-
   // apply each accept filter in turn by removing all matching elements
   // from the appropriate device handle vector returned by the platform
   // but using a predicate with a side-effect that takes a copy of each
@@ -839,6 +854,117 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
     }
   }
 
+  return UR_RESULT_SUCCESS;
+}
+
+} // namespace
+
+ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
+                                ur_device_type_t DeviceType,
+                                uint32_t NumEntries,
+                                ur_device_handle_t *phDevices,
+                                uint32_t *pNumDevices) {
+
+  if (!hPlatform) {
+    return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+  }
+  if (NumEntries > 0 && !phDevices) {
+    return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+  }
+  // pNumDevices is the actual number of device handles added to phDevices by
+  // this function
+  if (NumEntries == 0 && !pNumDevices) {
+    return UR_RESULT_ERROR_INVALID_SIZE;
+  }
+
+  switch (DeviceType) {
+  case UR_DEVICE_TYPE_ALL:
+  case UR_DEVICE_TYPE_GPU:
+  case UR_DEVICE_TYPE_DEFAULT:
+  case UR_DEVICE_TYPE_CPU:
+  case UR_DEVICE_TYPE_FPGA:
+  case UR_DEVICE_TYPE_MCA:
+    break;
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    // urPrint("Unknown device type");
+    break;
+  }
+  // plan:
+  // 0. basic validation of argument values (see code above)
+  // 1. conversion of argument values into useful data items
+  // 2. retrieval and parsing of environment variable string
+  // 3. conversion of term map to accept and discard filters
+  // 4. inserting a default "*:*" accept filter, if required
+  // 5. symbolic consolidation of accept and discard filters
+  // 6. querying the platform handles for all 'root' devices
+  // 7. partioning via platform root devices into subdevices
+  // 8. partioning via platform subdevices into subsubdevices
+  // 9. short-listing devices to accept using accept filters
+  // A. de-listing devices to discard using discard filters
+  //
+  // steps 2 and 3 are only done again when the env var changes, and steps 4
+  // to A once per platform and device type for as long as it doesn't
+
+  // possible symbolic short-circuit special cases exist:
+  // * if there are no terms,     select all   root devices
+  // * if any discard is "*",     select no    root devices
+  // * if any discard is "*.*",   select no     sub-devices
+  // * if any discard is "*.*.*", select no sub-sub-devices
+  // *
+  //
+  // detail for step 5 of above plan:
+  // * combine all accept filters into a single accept list
+  // * combine all discard filters into single discard list
+  // then invert it to make the initial/default accept list
+  // (needs knowledge of the valid range from the platform)
+  // "!level_zero:1,2" -> "level_zero:0,3,...,max"
+  // * finally subtract the discard set from the accept set
+
+  // accept  "2,*" != "*,2"
+  // because "2,*" == "2,0,1,3"
+  // whereas "*,2" == "0,1,2,3"
+  // however
+  // discard "2,*" == "*,2"
+
+  auto env = ur_getenv("ONEAPI_DEVICE_SELECTOR");
+  auto &cache = getContext()->selectedDevices;
+  const auto key = std::make_pair(hPlatform, DeviceType);
+
+  std::vector<ur_device_handle_t> selectedDevices;
+  bool cached = false;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.selector != env) {
+      cache.devices.clear();
+      cache.selector = env;
+    }
+    if (auto it = cache.devices.find(key); it != cache.devices.end()) {
+      selectedDevices = it->second;
+      cached = true;
+    }
+  }
+
+  // The lock isn't held while selecting, so that platforms can be queried in
+  // parallel; should two threads race on the same platform, the first result
+  // is kept and the loser's is equivalent. Sub-devices are created anew by
+  // every partitioning and belong to the caller, who may release them, so
+  // only selections of root devices are cached.
+  if (!cached) {
+    auto selector = getDeviceSelector(env);
+    bool partitioned = false;
+    auto result = selectDevices(*selector, hPlatform, DeviceType,
+                                selectedDevices, partitioned);
+    if (result != UR_RESULT_SUCCESS) {
+      return result;
+    }
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (!partitioned && cache.selector == env) {
+      selectedDevices =
+          cache.devices.emplace(key, std::move(selectedDevices)).first->second;
+    }
+  }
+
   // selectedDevices is now a vector containing all the right device handles
 
   // should we return the size of the vector or the content of the vector?
@@ -29,8 +29,12 @@
 #endif
 
 #include <atomic>
+#include <map>
 #include <mutex>
+#include <optional>
 #include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 struct ur_loader_config_handle_t_ {
@@ -112,6 +116,17 @@ public:
 
   codeloc_data codelocData;
 
+  /// Root devices urDeviceGetSelected picked per platform and device type,
+  /// valid as long as ONEAPI_DEVICE_SELECTOR keeps the value they were picked
+  /// for. Selections including sub-devices aren't cached.
+  struct selected_devices_t {
+    std::mutex mutex;
+    std::optional<std::string> selector;
+    std::map<std::pair<ur_platform_handle_t, ur_device_type_t>,
+             std::vector<ur_device_handle_t>>
+        devices;
+  } selectedDevices;
+
   void parseEnvEnabledLayers();
   void initLayers();
   void tearDownLayers() const;
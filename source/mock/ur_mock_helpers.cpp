@@ -13,9 +13,79 @@
 
 #include "ur_mock_helpers.hpp"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 namespace mock {
 static callbacks_t callbacks = {};
 
 callbacks_t &getCallbacks() { return callbacks; }
 
+ur_function_t getFunctionId(std::string_view name) {
+  static const std::unordered_map<std::string_view, ur_function_t> ids = {
+#define _UR_API_WITH_ID(api, id) {#api, id},
+#include "ur_api_funcs.def"
+#undef _UR_API_WITH_ID
+  };
+
+  auto id = ids.find(name);
+  if (id != ids.end()) {
+    return id->second;
+  }
+  return UR_FUNCTION_FORCE_UINT32;
+}
+
+namespace {
+// Hands out dummy handles from slabs, released handles are kept on a free list
+// to be reused by the next one created.
+class dummy_handle_pool_t {
+public:
+  void *allocate() {
+    std::scoped_lock<std::mutex> Guard(Mutex);
+    if (!FreeList) {
+      auto Slab = std::make_unique<slot_t[]>(SlabSize);
+      for (size_t I = 0; I < SlabSize; I++) {
+        Slab[I].Next = FreeList;
+        FreeList = &Slab[I];
+      }
+      Slabs.emplace_back(std::move(Slab));
+    }
+    slot_t *Slot = FreeList;
+    FreeList = Slot->Next;
+    return Slot->Storage;
+  }
+
+  void free(void *Ptr) {
+    auto Slot = reinterpret_cast<slot_t *>(Ptr);
+    std::scoped_lock<std::mutex> Guard(Mutex);
+    Slot->Next = FreeList;
+    FreeList = Slot;
+  }
+
+private:
+  union slot_t {
+    slot_t *Next;
+    alignas(dummy_handle_t_) unsigned char Storage[sizeof(dummy_handle_t_)];
+  };
+
+  static constexpr size_t SlabSize = 256;
+
+  std::mutex Mutex;
+  slot_t *FreeList = nullptr;
+  std::vector<std::unique_ptr<slot_t[]>> Slabs;
+};
+
+// Handles may still be released by static destructors of the application,
+// so the pool is never destroyed.
+dummy_handle_pool_t &getDummyHandlePool() {
+  static auto *Pool = new dummy_handle_pool_t();
+  return *Pool;
+}
+} // namespace
+
+void *allocDummyHandle() { return getDummyHandlePool().allocate(); }
+
+void freeDummyHandle(void *Ptr) { getDummyHandlePool().free(Ptr); }
+
 } // namespace mock
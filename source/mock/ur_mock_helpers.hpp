@@ -15,11 +15,14 @@
 
 #include "ur_api.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <new>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
 // This is the callback function we accept to override or instrument
@@ -52,11 +55,20 @@ struct dummy_handle_t_ {
 
 using dummy_handle_t = dummy_handle_t_ *;
 
+// Returns uninitialized storage for a dummy handle from a slab pool, dummy
+// handles are created and released by most entry points so they don't go
+// through the heap one by one.
+UR_DLLEXPORT void *allocDummyHandle();
+
+// Returns the storage of a destroyed dummy handle to the slab pool
+UR_DLLEXPORT void freeDummyHandle(void *Ptr);
+
 // Allocates a dummy handle of type T with support of reference counting.
 // Takes optional 'Size' parameter which can be used to allocate additional
 // memory. The handle has to be deallocated using 'releaseDummyHandle'.
 template <class T> inline T createDummyHandle(size_t Size = 0) {
-  dummy_handle_t DummyHandlePtr = new dummy_handle_t_(Size);
+  dummy_handle_t DummyHandlePtr =
+      new (allocDummyHandle()) dummy_handle_t_(Size);
   return reinterpret_cast<T>(DummyHandlePtr);
 }
 
@@ -64,7 +76,7 @@ template <class T> inline T createDummyHandle(size_t Size = 0) {
 // and associates it with the provided Data.
 template <class T>
 inline T createDummyHandleWithData(unsigned char *Data, size_t Size) {
-  auto DummyHandlePtr = new dummy_handle_t_(Data, Size);
+  auto DummyHandlePtr = new (allocDummyHandle()) dummy_handle_t_(Data, Size);
   return reinterpret_cast<T>(DummyHandlePtr);
 }
 
@@ -74,7 +86,8 @@ template <class T> inline void releaseDummyHandle(T Handle) {
   auto DummyHandlePtr = reinterpret_cast<dummy_handle_t>(Handle);
   const size_t NewValue = --DummyHandlePtr->MRefCounter;
   if (NewValue == 0) {
-    delete DummyHandlePtr;
+    DummyHandlePtr->~dummy_handle_t_();
+    freeDummyHandle(DummyHandlePtr);
   }
 }
 
@@ -84,56 +97,119 @@ template <class T> inline void retainDummyHandle(T Handle) {
   ++DummyHandlePtr->MRefCounter;
 }
 
+// One past the largest function id of the API, callbacks can be set for any
+// function id below it
+constexpr size_t MaxFunctions = [] {
+  size_t Count = 0;
+#define _UR_API_WITH_ID(api, id) Count = std::max<size_t>(Count, id + 1);
+#include "ur_api_funcs.def"
+#undef _UR_API_WITH_ID
+  return Count;
+}();
+
+// Returns the function id of the entry point called name, or
+// UR_FUNCTION_FORCE_UINT32 if there is none.
+UR_DLLEXPORT ur_function_t getFunctionId(std::string_view name);
+
+// Callbacks are kept in a fixed table indexed by function id, which the
+// generated entry points look up without building any strings. Looking up a
+// callback of an entry point that has none set only loads its flags.
 struct callbacks_t {
   void set_before_callback(std::string name, ur_mock_callback_t callback) {
-    beforeCallbacks[name] = callback;
+    set_before_callback(getFunctionId(name), callback);
+  }
+
+  void set_before_callback(ur_function_t function,
+                           ur_mock_callback_t callback) {
+    setCallback(function, BEFORE, callback);
   }
 
   ur_mock_callback_t get_before_callback(std::string name) const {
-    auto callback = beforeCallbacks.find(name);
+    return get_before_callback(getFunctionId(name));
+  }
 
-    if (callback != beforeCallbacks.end()) {
-      return callback->second;
-    }
-    return nullptr;
+  ur_mock_callback_t get_before_callback(ur_function_t function) const {
+    return getCallback(function, BEFORE);
   }
 
   void set_replace_callback(std::string name, ur_mock_callback_t callback) {
-    replaceCallbacks[name] = callback;
+    set_replace_callback(getFunctionId(name), callback);
+  }
+
+  void set_replace_callback(ur_function_t function,
+                            ur_mock_callback_t callback) {
+    setCallback(function, REPLACE, callback);
   }
 
   ur_mock_callback_t get_replace_callback(std::string name) const {
-    auto callback = replaceCallbacks.find(name);
+    return get_replace_callback(getFunctionId(name));
+  }
 
-    if (callback != replaceCallbacks.end()) {
-      return callback->second;
-    }
-    return nullptr;
+  ur_mock_callback_t get_replace_callback(ur_function_t function) const {
+    return getCallback(function, REPLACE);
   }
 
   void set_after_callback(std::string name, ur_mock_callback_t callback) {
-    afterCallbacks[name] = callback;
+    set_after_callback(getFunctionId(name), callback);
+  }
+
+  void set_after_callback(ur_function_t function, ur_mock_callback_t callback) {
+    setCallback(function, AFTER, callback);
   }
 
   ur_mock_callback_t get_after_callback(std::string name) const {
-    auto callback = afterCallbacks.find(name);
+    return get_after_callback(getFunctionId(name));
+  }
 
-    if (callback != afterCallbacks.end()) {
-      return callback->second;
-    }
-    return nullptr;
+  ur_mock_callback_t get_after_callback(ur_function_t function) const {
+    return getCallback(function, AFTER);
   }
 
   void resetCallbacks() {
-    beforeCallbacks.clear();
-    replaceCallbacks.clear();
-    afterCallbacks.clear();
+    for (auto &Entry : functions) {
+      Entry.registered.store(0, std::memory_order_relaxed);
+      for (auto &Callback : Entry.callbacks) {
+        Callback.store(nullptr, std::memory_order_relaxed);
+      }
+    }
   }
 
 private:
-  std::unordered_map<std::string, ur_mock_callback_t> beforeCallbacks;
-  std::unordered_map<std::string, ur_mock_callback_t> replaceCallbacks;
-  std::unordered_map<std::string, ur_mock_callback_t> afterCallbacks;
+  enum slot_t { BEFORE, REPLACE, AFTER, NUM_SLOTS };
+
+  struct entry_t {
+    // Bit i is set if callbacks[i] is set
+    std::atomic<uint8_t> registered = 0;
+    std::atomic<ur_mock_callback_t> callbacks[NUM_SLOTS] = {};
+  };
+
+  void setCallback(ur_function_t function, slot_t slot,
+                   ur_mock_callback_t callback) {
+    if (static_cast<size_t>(function) >= MaxFunctions) {
+      return;
+    }
+    auto &Entry = functions[function];
+    Entry.callbacks[slot].store(callback, std::memory_order_relaxed);
+    const uint8_t Bit = uint8_t(1) << slot;
+    if (callback) {
+      Entry.registered.fetch_or(Bit, std::memory_order_release);
+    } else {
+      Entry.registered.fetch_and(uint8_t(~Bit), std::memory_order_release);
+    }
+  }
+
+  ur_mock_callback_t getCallback(ur_function_t function, slot_t slot) const {
+    if (static_cast<size_t>(function) >= MaxFunctions) {
+      return nullptr;
+    }
+    auto &Entry = functions[function];
+    if (!(Entry.registered.load(std::memory_order_acquire) & (1 << slot))) {
+      return nullptr;
+    }
+    return Entry.callbacks[slot].load(std::memory_order_relaxed);
+  }
+
+  entry_t functions[MaxFunctions];
 };
 
 UR_DLLEXPORT callbacks_t &getCallbacks();
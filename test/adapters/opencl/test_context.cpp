@@ -0,0 +1,66 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+#include <uur/raii.h>
+
+using urOpenCLContextTest = uur::urDeviceTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE(urOpenCLContextTest);
+
+// Memory objects keep the OpenCL context alive, and with it the context
+// handle they report
+TEST_P(urOpenCLContextTest, OutlivedByBuffer) {
+  ur_context_handle_t context = nullptr;
+  ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, &context));
+
+  uur::raii::Mem buffer = nullptr;
+  ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, 1024,
+                                   nullptr, buffer.ptr()));
+  ASSERT_SUCCESS(urContextRelease(context));
+
+  ur_context_handle_t buffer_context = nullptr;
+  ASSERT_SUCCESS(urMemGetInfo(buffer, UR_MEM_INFO_CONTEXT,
+                              sizeof(buffer_context), &buffer_context,
+                              nullptr));
+  ASSERT_EQ(buffer_context, context);
+
+  // The handle may be used again once retained
+  ASSERT_SUCCESS(urContextRetain(buffer_context));
+  uur::raii::Context retained{buffer_context};
+  uur::raii::Queue queue = nullptr;
+  ASSERT_SUCCESS(urQueueCreate(retained, device, nullptr, queue.ptr()));
+
+  ur_context_handle_t queue_context = nullptr;
+  ASSERT_SUCCESS(urQueueGetInfo(queue, UR_QUEUE_INFO_CONTEXT,
+                                sizeof(queue_context), &queue_context,
+                                nullptr));
+  ASSERT_EQ(queue_context, context);
+}
+
+TEST_P(urOpenCLContextTest, NativeHandleRoundTrip) {
+  uur::raii::Context context = nullptr;
+  ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, context.ptr()));
+
+  ur_native_handle_t native_context = 0;
+  ASSERT_SUCCESS(urContextGetNativeHandle(context, &native_context));
+
+  ur_context_native_properties_t properties = {
+      UR_STRUCTURE_TYPE_CONTEXT_NATIVE_PROPERTIES, nullptr, false};
+  ur_context_handle_t shared = nullptr;
+  ASSERT_SUCCESS(urContextCreateWithNativeHandle(
+      native_context, nullptr, 1, &device, &properties, &shared));
+  ASSERT_EQ(shared, context);
+
+  uint32_t ref_count = 0;
+  ASSERT_SUCCESS(urContextGetInfo(context, UR_CONTEXT_INFO_REFERENCE_COUNT,
+                                  sizeof(ref_count), &ref_count, nullptr));
+  ASSERT_EQ(ref_count, 2u);
+  ASSERT_SUCCESS(urContextRelease(shared));
+
+  ur_native_handle_t native_shared = 0;
+  ASSERT_SUCCESS(urContextGetNativeHandle(context, &native_shared));
+  ASSERT_EQ(native_shared, native_context);
+}
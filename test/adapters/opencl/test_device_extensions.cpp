@@ -0,0 +1,62 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "device_extensions.hpp"
+
+#include <gtest/gtest.h>
+
+using cl_adapter::DeviceExtension;
+using cl_adapter::parseExtensions;
+
+namespace {
+bool has(const cl_adapter::DeviceExtensionSet &Set, DeviceExtension Ext) {
+  return Set.test(static_cast<size_t>(Ext));
+}
+} // namespace
+
+TEST(urOpenCLParseExtensionsTest, Empty) {
+  ASSERT_TRUE(parseExtensions("", false).none());
+  ASSERT_TRUE(parseExtensions(" ", false).none());
+}
+
+TEST(urOpenCLParseExtensionsTest, KnownAndUnknown) {
+  auto Set = parseExtensions("cl_khr_fp16 cl_vendor_unknown cl_khr_il_program ",
+                             false);
+  ASSERT_EQ(Set.count(), 2u);
+  ASSERT_TRUE(has(Set, DeviceExtension::KhrFP16));
+  ASSERT_TRUE(has(Set, DeviceExtension::KhrILProgram));
+}
+
+// Names sharing a prefix only match as a whole
+TEST(urOpenCLParseExtensionsTest, CommandBufferPrefix) {
+  auto Mutable =
+      parseExtensions("cl_khr_command_buffer_mutable_dispatch", false);
+  ASSERT_TRUE(has(Mutable, DeviceExtension::KhrCommandBufferMutableDispatch));
+  ASSERT_FALSE(has(Mutable, DeviceExtension::KhrCommandBuffer));
+
+  auto Base = parseExtensions("cl_khr_command_buffer", false);
+  ASSERT_TRUE(has(Base, DeviceExtension::KhrCommandBuffer));
+  ASSERT_FALSE(has(Base, DeviceExtension::KhrCommandBufferMutableDispatch));
+
+  auto Both = parseExtensions(
+      "cl_khr_command_buffer_mutable_dispatch cl_khr_command_buffer", false);
+  ASSERT_TRUE(has(Both, DeviceExtension::KhrCommandBuffer));
+  ASSERT_TRUE(has(Both, DeviceExtension::KhrCommandBufferMutableDispatch));
+
+  ASSERT_TRUE(
+      parseExtensions("cl_khr_command_buf cl_khr_command_buffer_", false)
+          .none());
+}
+
+TEST(urOpenCLParseExtensionsTest, FPGAEmulator) {
+  auto Set = parseExtensions("cl_khr_fp16", true);
+  ASSERT_TRUE(has(Set, DeviceExtension::KhrFP16));
+  ASSERT_TRUE(has(Set, DeviceExtension::IntelDeviceAttributeQuery));
+  ASSERT_TRUE(has(Set, DeviceExtension::IntelRequiredSubgroupSize));
+  ASSERT_TRUE(has(Set, DeviceExtension::KhrSubgroups));
+  ASSERT_FALSE(parseExtensions("cl_khr_fp16", false)
+                   .test(static_cast<size_t>(DeviceExtension::KhrSubgroups)));
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+#include <uur/raii.h>
+
+using urOpenCLProgramTest = uur::urProgramTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE(urOpenCLProgramTest);
+
+// Programs keep the OpenCL context alive, kernels created from them once the
+// context was released report the context the program was created with
+TEST_P(urOpenCLProgramTest, KernelCreateAfterContextRelease) {
+  ur_context_handle_t program_context = nullptr;
+  ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, &program_context));
+  ur_program_handle_t context_program = nullptr;
+  ASSERT_SUCCESS(uur::KernelsEnvironment::instance->CreateProgram(
+      platform, program_context, device, *il_binary, nullptr,
+      &context_program));
+  ASSERT_SUCCESS(urProgramBuild(program_context, context_program, nullptr));
+  ASSERT_SUCCESS(urContextRelease(program_context));
+
+  auto kernel_name =
+      uur::KernelsEnvironment::instance->GetEntryPointNames(program_name)[0];
+  ur_kernel_handle_t kernel = nullptr;
+  ASSERT_SUCCESS(urKernelCreate(context_program, kernel_name.data(), &kernel));
+
+  ur_context_handle_t kernel_context = nullptr;
+  ASSERT_SUCCESS(urKernelGetInfo(kernel, UR_KERNEL_INFO_CONTEXT,
+                                 sizeof(kernel_context), &kernel_context,
+                                 nullptr));
+  ASSERT_EQ(kernel_context, program_context);
+
+  ASSERT_SUCCESS(urKernelRelease(kernel));
+  ASSERT_SUCCESS(urProgramRelease(context_program));
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+#include <uur/raii.h>
+
+using urOpenCLQueueTest = uur::urContextTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE(urOpenCLQueueTest);
+
+// Events keep their OpenCL queue and context alive, and with them the handles
+// they report
+TEST_P(urOpenCLQueueTest, OutlivedByEvent) {
+  ur_context_handle_t event_context = nullptr;
+  ASSERT_SUCCESS(urContextCreate(1, &device, nullptr, &event_context));
+  ur_queue_handle_t queue = nullptr;
+  ASSERT_SUCCESS(urQueueCreate(event_context, device, nullptr, &queue));
+
+  uur::raii::Event event = nullptr;
+  ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, event.ptr()));
+  ASSERT_SUCCESS(urQueueFinish(queue));
+  ASSERT_SUCCESS(urQueueRelease(queue));
+  ASSERT_SUCCESS(urContextRelease(event_context));
+
+  ur_queue_handle_t info_queue = nullptr;
+  ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_QUEUE,
+                                sizeof(info_queue), &info_queue, nullptr));
+  ASSERT_EQ(info_queue, queue);
+
+  ur_context_handle_t info_context = nullptr;
+  ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_CONTEXT,
+                                sizeof(info_context), &info_context, nullptr));
+  ASSERT_EQ(info_context, event_context);
+
+  ASSERT_SUCCESS(urQueueRetain(info_queue));
+  uur::raii::Queue retained{info_queue};
+  ASSERT_SUCCESS(urEnqueueEventsWait(retained, 0, nullptr, nullptr));
+  ASSERT_SUCCESS(urQueueFinish(retained));
+}
+
+TEST_P(urOpenCLQueueTest, NativeHandleRoundTrip) {
+  uur::raii::Queue queue = nullptr;
+  ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, queue.ptr()));
+
+  ur_native_handle_t native_queue = 0;
+  ASSERT_SUCCESS(urQueueGetNativeHandle(queue, nullptr, &native_queue));
+
+  ur_queue_native_properties_t properties = {
+      UR_STRUCTURE_TYPE_QUEUE_NATIVE_PROPERTIES, nullptr, false};
+  ur_queue_handle_t shared = nullptr;
+  ASSERT_SUCCESS(urQueueCreateWithNativeHandle(native_queue, context, device,
+                                               &properties, &shared));
+  ASSERT_EQ(shared, queue);
+
+  uint32_t ref_count = 0;
+  ASSERT_SUCCESS(urQueueGetInfo(queue, UR_QUEUE_INFO_REFERENCE_COUNT,
+                                sizeof(ref_count), &ref_count, nullptr));
+  ASSERT_EQ(ref_count, 2u);
+  ASSERT_SUCCESS(urQueueRelease(shared));
+}
@@ -0,0 +1,311 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file api_overhead.cpp
+ *
+ * Measures the cost of individual entry points on adapters that don't need a
+ * GPU, for every loader layer on its own and with the loader intercept
+ * enabled and disabled. Every benchmark is named
+ * <adapter>/<layer>/<intercept>/<entry point>.
+ *
+ * The mock adapter does next to nothing, so on it this is the overhead the
+ * loader and layers add to every call.
+ *
+ * The loader intercepts all calls once more than one adapter is loaded, the
+ * benchmarks with the intercept disabled are skipped then.
+ *
+ * In addition to the Google Benchmark flags, --adapter=<name> selects the
+ * adapters measured instead of mock and native_cpu, and may be passed more
+ * than once.
+ *
+ */
+
+#include "helpers.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ur_bench;
+
+namespace {
+
+struct Config {
+  const AdapterName *Adapter;
+  // Empty if no layer is enabled
+  std::string Layer;
+  bool Intercept = false;
+
+  bool operator==(const Config &Other) const {
+    return Adapter == Other.Adapter && Layer == Other.Layer &&
+           Intercept == Other.Intercept;
+  }
+
+  std::string name() const {
+    return std::string(Adapter->Name) + "/" +
+           (Layer.empty() ? "no_layers" : Layer) + "/" +
+           (Intercept ? "intercept_on" : "intercept_off");
+  }
+};
+
+void setIntercept(bool Enabled) {
+#if defined(_WIN32)
+  _putenv_s("UR_ENABLE_LOADER_INTERCEPT", Enabled ? "1" : "0");
+#else
+  setenv("UR_ENABLE_LOADER_INTERCEPT", Enabled ? "1" : "0", 1);
+#endif
+}
+
+/// The loader and the objects the benchmarks run on, initialized for one
+/// configuration at a time. Benchmarks are registered grouped by
+/// configuration, so the loader is only set up again when moving on to the
+/// next group.
+class Environment {
+public:
+  /// Returns an error message if the configuration can't be set up
+  const char *setUp(const Config &NewConfig) {
+    if (Current && *Current == NewConfig) {
+      return Error;
+    }
+    tearDown();
+    Current = std::make_unique<Config>(NewConfig);
+    Error = init();
+    return Error;
+  }
+
+  void tearDown() {
+    if (!Current) {
+      return;
+    }
+    if (Kernel) {
+      urKernelRelease(Kernel);
+    }
+    if (Program) {
+      urProgramRelease(Program);
+    }
+    for (void *Ptr : {Src, Dst}) {
+      if (Ptr) {
+        urUSMFree(Context, Ptr);
+      }
+    }
+    if (Queue) {
+      urQueueRelease(Queue);
+    }
+    if (Context) {
+      urContextRelease(Context);
+    }
+    if (Device) {
+      urDeviceRelease(Device);
+    }
+    AdapterLoader.tearDown();
+    *this = {};
+  }
+
+  ur_device_handle_t Device = nullptr;
+  ur_context_handle_t Context = nullptr;
+  ur_queue_handle_t Queue = nullptr;
+  ur_program_handle_t Program = nullptr;
+  ur_kernel_handle_t Kernel = nullptr;
+  void *Src = nullptr;
+  void *Dst = nullptr;
+
+  static constexpr size_t CopySize = 64;
+
+private:
+  const char *init() {
+    setIntercept(Current->Intercept);
+    if (const char *Error = AdapterLoader.init(
+            *Current->Adapter,
+            Current->Layer.empty() ? nullptr : Current->Layer.c_str())) {
+      return Error;
+    }
+    // Measuring the intercept disabled would measure it enabled all the same
+    if (!Current->Intercept && AdapterLoader.isInterceptForced()) {
+      return "more than one adapter loaded, the loader intercept can't be "
+             "disabled";
+    }
+    if (const char *Error = AdapterLoader.getDevice(Device)) {
+      return Error;
+    }
+    if (urContextCreate(1, &Device, nullptr, &Context) != UR_RESULT_SUCCESS ||
+        urQueueCreate(Context, Device, nullptr, &Queue) != UR_RESULT_SUCCESS ||
+        urUSMHostAlloc(Context, nullptr, nullptr, CopySize, &Src) !=
+            UR_RESULT_SUCCESS ||
+        urUSMHostAlloc(Context, nullptr, nullptr, CopySize, &Dst) !=
+            UR_RESULT_SUCCESS) {
+      return "failed to create a context and queue";
+    }
+
+    // There is no IL every adapter accepts, benchmarks of kernels are skipped
+    // where it can't be used
+    const uint32_t IL[] = {0x07230203};
+    if (urProgramCreateWithIL(Context, IL, sizeof(IL), nullptr, &Program) ==
+        UR_RESULT_SUCCESS) {
+      urKernelCreate(Program, "kernel", &Kernel);
+    }
+    return nullptr;
+  }
+
+  std::unique_ptr<Config> Current;
+  const char *Error = nullptr;
+  Loader AdapterLoader;
+};
+
+Environment Env;
+
+void EnqueueEventsWait(benchmark::State &State) {
+  for (auto _ : State) {
+    SKIP_ON_ERROR(State, urEnqueueEventsWait(Env.Queue, 0, nullptr, nullptr));
+  }
+}
+
+void EnqueueUSMMemcpy(benchmark::State &State) {
+  for (auto _ : State) {
+    SKIP_ON_ERROR(State, urEnqueueUSMMemcpy(Env.Queue, false, Env.Dst, Env.Src,
+                                            Env.CopySize, 0, nullptr, nullptr));
+  }
+}
+
+void EventCreateRelease(benchmark::State &State) {
+  for (auto _ : State) {
+    ur_event_handle_t Event = nullptr;
+    SKIP_ON_ERROR(State, urEnqueueEventsWait(Env.Queue, 0, nullptr, &Event));
+    SKIP_ON_ERROR(State, urEventRelease(Event));
+  }
+}
+
+void USMHostAllocFree(benchmark::State &State) {
+  for (auto _ : State) {
+    void *Ptr = nullptr;
+    SKIP_ON_ERROR(State, urUSMHostAlloc(Env.Context, nullptr, nullptr,
+                                        Env.CopySize, &Ptr));
+    SKIP_ON_ERROR(State, urUSMFree(Env.Context, Ptr));
+  }
+}
+
+void USMDeviceAllocFree(benchmark::State &State) {
+  for (auto _ : State) {
+    void *Ptr = nullptr;
+    SKIP_ON_ERROR(State, urUSMDeviceAlloc(Env.Context, Env.Device, nullptr,
+                                          nullptr, Env.CopySize, &Ptr));
+    SKIP_ON_ERROR(State, urUSMFree(Env.Context, Ptr));
+  }
+}
+
+void KernelSetArgValue(benchmark::State &State) {
+  if (!Env.Kernel) {
+    State.SkipWithError("no kernel available");
+    return;
+  }
+  for (auto _ : State) {
+    uint32_t Value = 42;
+    SKIP_ON_ERROR(State, urKernelSetArgValue(Env.Kernel, 0, sizeof(Value),
+                                             nullptr, &Value));
+  }
+}
+
+void EnqueueKernelLaunch(benchmark::State &State) {
+  if (!Env.Kernel) {
+    State.SkipWithError("no kernel available");
+    return;
+  }
+  const size_t Offset = 0;
+  const size_t Size = 1024;
+  for (auto _ : State) {
+    SKIP_ON_ERROR(State,
+                  urEnqueueKernelLaunch(Env.Queue, Env.Kernel, 1, &Offset,
+                                        &Size, nullptr, 0, nullptr, nullptr));
+  }
+}
+
+void QueueFinish(benchmark::State &State) {
+  for (auto _ : State) {
+    SKIP_ON_ERROR(State, urQueueFinish(Env.Queue));
+  }
+}
+
+/// Layers measured besides running without any, sanitizers are left out as
+/// they need a real device to set up their shadow memory
+std::vector<std::string> getLayers() {
+  std::vector<std::string> Layers = {""};
+
+  ur_loader_config_handle_t LoaderConfig = nullptr;
+  if (urLoaderConfigCreate(&LoaderConfig) != UR_RESULT_SUCCESS) {
+    return Layers;
+  }
+  size_t Size = 0;
+  urLoaderConfigGetInfo(LoaderConfig, UR_LOADER_CONFIG_INFO_AVAILABLE_LAYERS, 0,
+                        nullptr, &Size);
+  std::string Available(Size, '\0');
+  if (Size && urLoaderConfigGetInfo(
+                  LoaderConfig, UR_LOADER_CONFIG_INFO_AVAILABLE_LAYERS, Size,
+                  Available.data(), nullptr) == UR_RESULT_SUCCESS) {
+    std::stringstream Stream(Available.c_str());
+    std::string Layer;
+    while (std::getline(Stream, Layer, ';')) {
+      if (!Layer.empty() && Layer.find("SAN") == std::string::npos) {
+        Layers.push_back(Layer);
+      }
+    }
+  }
+  urLoaderConfigRelease(LoaderConfig);
+  return Layers;
+}
+
+void registerBenchmarks(const Config &Config) {
+  using BenchmarkFn = void (*)(benchmark::State &);
+  const std::pair<const char *, BenchmarkFn> Benchmarks[] = {
+      {"EnqueueEventsWait", EnqueueEventsWait},
+      {"EnqueueUSMMemcpy", EnqueueUSMMemcpy},
+      {"EventCreateRelease", EventCreateRelease},
+      {"USMHostAllocFree", USMHostAllocFree},
+      {"USMDeviceAllocFree", USMDeviceAllocFree},
+      {"KernelSetArgValue", KernelSetArgValue},
+      {"EnqueueKernelLaunch", EnqueueKernelLaunch},
+      {"QueueFinish", QueueFinish},
+  };
+
+  for (auto &[Name, Fn] : Benchmarks) {
+    benchmark::RegisterBenchmark((Config.name() + "/" + Name).c_str(),
+                                 [Config, Fn = Fn](benchmark::State &State) {
+                                   if (const char *Error = Env.setUp(Config)) {
+                                     State.SkipWithError(Error);
+                                     return;
+                                   }
+                                   Fn(State);
+                                 });
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  benchmark::Initialize(&argc, argv);
+
+  std::vector<const AdapterName *> Adapters;
+  if (!parseAdapterArgs(argc, argv, Adapters, {"mock", "native_cpu"})) {
+    return EXIT_FAILURE;
+  }
+
+  for (auto *Adapter : Adapters) {
+    for (auto &Layer : getLayers()) {
+      for (bool Intercept : {false, true}) {
+        registerBenchmarks(Config{Adapter, Layer, Intercept});
+      }
+    }
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  Env.tearDown();
+  benchmark::Shutdown();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,232 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file device_startup.cpp
+ *
+ * Measures what a runtime pays at startup to discover devices: initializing
+ * the loader, enumerating the platforms and devices of an adapter and asking
+ * every device for the properties a SYCL runtime looks at. Benchmarks are
+ * named <adapter>/Startup/<queries per property> for the whole sequence and
+ * <adapter>/DeviceGetInfo/<property> for repeated queries on a device that
+ * has already been set up.
+ *
+ * In addition to the Google Benchmark flags,
+ * --adapter=<mock|opencl|level_zero|cuda|hip|native_cpu> limits the adapters
+ * measured and may be passed more than once.
+ *
+ */
+
+#include "helpers.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ur_bench;
+
+namespace {
+
+/// Properties a SYCL runtime asks every device for while setting up its
+/// devices and checking their aspects
+constexpr std::pair<const char *, ur_device_info_t> StartupQueries[] = {
+    {"TYPE", UR_DEVICE_INFO_TYPE},
+    {"PLATFORM", UR_DEVICE_INFO_PLATFORM},
+    {"PARENT_DEVICE", UR_DEVICE_INFO_PARENT_DEVICE},
+    {"NAME", UR_DEVICE_INFO_NAME},
+    {"VENDOR", UR_DEVICE_INFO_VENDOR},
+    {"VENDOR_ID", UR_DEVICE_INFO_VENDOR_ID},
+    {"DRIVER_VERSION", UR_DEVICE_INFO_DRIVER_VERSION},
+    {"VERSION", UR_DEVICE_INFO_VERSION},
+    {"BACKEND_RUNTIME_VERSION", UR_DEVICE_INFO_BACKEND_RUNTIME_VERSION},
+    {"EXTENSIONS", UR_DEVICE_INFO_EXTENSIONS},
+    {"IL_VERSION", UR_DEVICE_INFO_IL_VERSION},
+    {"DEVICE_ID", UR_DEVICE_INFO_DEVICE_ID},
+    {"UUID", UR_DEVICE_INFO_UUID},
+    {"PCI_ADDRESS", UR_DEVICE_INFO_PCI_ADDRESS},
+    {"MAX_COMPUTE_UNITS", UR_DEVICE_INFO_MAX_COMPUTE_UNITS},
+    {"MAX_WORK_GROUP_SIZE", UR_DEVICE_INFO_MAX_WORK_GROUP_SIZE},
+    {"MAX_WORK_ITEM_SIZES", UR_DEVICE_INFO_MAX_WORK_ITEM_SIZES},
+    {"SUB_GROUP_SIZES_INTEL", UR_DEVICE_INFO_SUB_GROUP_SIZES_INTEL},
+    {"HALF_FP_CONFIG", UR_DEVICE_INFO_HALF_FP_CONFIG},
+    {"DOUBLE_FP_CONFIG", UR_DEVICE_INFO_DOUBLE_FP_CONFIG},
+    {"ATOMIC_64", UR_DEVICE_INFO_ATOMIC_64},
+    {"ATOMIC_MEMORY_ORDER_CAPABILITIES",
+     UR_DEVICE_INFO_ATOMIC_MEMORY_ORDER_CAPABILITIES},
+    {"ATOMIC_MEMORY_SCOPE_CAPABILITIES",
+     UR_DEVICE_INFO_ATOMIC_MEMORY_SCOPE_CAPABILITIES},
+    {"IMAGE_SUPPORTED", UR_DEVICE_INFO_IMAGE_SUPPORTED},
+    {"USM_HOST_SUPPORT", UR_DEVICE_INFO_USM_HOST_SUPPORT},
+    {"USM_DEVICE_SUPPORT", UR_DEVICE_INFO_USM_DEVICE_SUPPORT},
+    {"USM_SINGLE_SHARED_SUPPORT", UR_DEVICE_INFO_USM_SINGLE_SHARED_SUPPORT},
+    {"USM_SYSTEM_SHARED_SUPPORT", UR_DEVICE_INFO_USM_SYSTEM_SHARED_SUPPORT},
+    {"MEM_CHANNEL_SUPPORT", UR_DEVICE_INFO_MEM_CHANNEL_SUPPORT},
+    {"ESIMD_SUPPORT", UR_DEVICE_INFO_ESIMD_SUPPORT},
+    {"GLOBAL_VARIABLE_SUPPORT", UR_DEVICE_INFO_GLOBAL_VARIABLE_SUPPORT},
+    {"HOST_PIPE_READ_WRITE_SUPPORTED",
+     UR_DEVICE_INFO_HOST_PIPE_READ_WRITE_SUPPORTED},
+    {"COMMAND_BUFFER_SUPPORT_EXP", UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP},
+};
+
+/// Queries the size of a property and then its value, like runtimes do for
+/// properties they don't know the size of up front. Unsupported properties
+/// are expected and not an error.
+void queryDeviceInfo(ur_device_handle_t Device, ur_device_info_t Info,
+                     std::vector<char> &Buffer) {
+  size_t Size = 0;
+  if (urDeviceGetInfo(Device, Info, 0, nullptr, &Size) != UR_RESULT_SUCCESS ||
+      !Size) {
+    return;
+  }
+  if (Buffer.size() < Size) {
+    Buffer.resize(Size);
+  }
+  urDeviceGetInfo(Device, Info, Size, Buffer.data(), nullptr);
+  benchmark::DoNotOptimize(Buffer.data());
+}
+
+/// A loader initialized for one adapter along with its devices
+class Startup {
+public:
+  /// Returns an error message if the adapter isn't available
+  const char *init(const AdapterName &Adapter) {
+    if (const char *Error = AdapterLoader.init(Adapter)) {
+      return Error;
+    }
+
+    uint32_t NumPlatforms = 0;
+    urPlatformGet(&AdapterLoader.Adapter, 1, 0, nullptr, &NumPlatforms);
+    std::vector<ur_platform_handle_t> Platforms(NumPlatforms);
+    if (NumPlatforms &&
+        urPlatformGet(&AdapterLoader.Adapter, 1, NumPlatforms, Platforms.data(),
+                      nullptr) != UR_RESULT_SUCCESS) {
+      return "failed to get the platforms";
+    }
+    for (auto Platform : Platforms) {
+      uint32_t NumDevices = 0;
+      if (urDeviceGet(Platform, UR_DEVICE_TYPE_ALL, 0, nullptr, &NumDevices) !=
+              UR_RESULT_SUCCESS ||
+          !NumDevices) {
+        continue;
+      }
+      size_t Offset = Devices.size();
+      Devices.resize(Offset + NumDevices);
+      if (urDeviceGet(Platform, UR_DEVICE_TYPE_ALL, NumDevices,
+                      Devices.data() + Offset, nullptr) != UR_RESULT_SUCCESS) {
+        Devices.resize(Offset);
+      }
+    }
+    if (Devices.empty()) {
+      return "no device available";
+    }
+    return nullptr;
+  }
+
+  void tearDown() {
+    for (auto Device : Devices) {
+      urDeviceRelease(Device);
+    }
+    AdapterLoader.tearDown();
+    *this = {};
+  }
+
+  std::vector<ur_device_handle_t> Devices;
+
+private:
+  Loader AdapterLoader;
+};
+
+/// Set up once per adapter for the DeviceGetInfo benchmarks, so that they
+/// measure queries on devices that have been queried before
+struct {
+  const AdapterName *Adapter = nullptr;
+  const char *Error = nullptr;
+  Startup State;
+} Warm;
+
+const char *setUpWarm(const AdapterName &Adapter) {
+  if (Warm.Adapter != &Adapter) {
+    Warm.State.tearDown();
+    Warm.Adapter = &Adapter;
+    Warm.Error = Warm.State.init(Adapter);
+  }
+  return Warm.Error;
+}
+
+void tearDownWarm() {
+  Warm.State.tearDown();
+  Warm.Adapter = nullptr;
+}
+
+void StartupBenchmark(benchmark::State &State, const AdapterName &Adapter) {
+  // Initializing the loader again would find the one set up for the warm
+  // benchmarks
+  tearDownWarm();
+
+  const auto QueriesPerProperty = static_cast<size_t>(State.range(0));
+  std::vector<char> Buffer;
+  for (auto _ : State) {
+    Startup Run;
+    if (const char *Error = Run.init(Adapter)) {
+      Run.tearDown();
+      State.SkipWithError(Error);
+      break;
+    }
+    for (auto Device : Run.Devices) {
+      for (size_t I = 0; I < QueriesPerProperty; I++) {
+        for (auto &Query : StartupQueries) {
+          queryDeviceInfo(Device, Query.second, Buffer);
+        }
+      }
+    }
+    Run.tearDown();
+  }
+}
+
+void DeviceGetInfoBenchmark(benchmark::State &State, const AdapterName &Adapter,
+                            ur_device_info_t Info) {
+  if (const char *Error = setUpWarm(Adapter)) {
+    State.SkipWithError(Error);
+    return;
+  }
+  ur_device_handle_t Device = Warm.State.Devices.front();
+  std::vector<char> Buffer;
+  for (auto _ : State) {
+    queryDeviceInfo(Device, Info, Buffer);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  benchmark::Initialize(&argc, argv);
+
+  std::vector<const AdapterName *> Selected;
+  if (!parseAdapterArgs(argc, argv, Selected)) {
+    return EXIT_FAILURE;
+  }
+
+  for (auto *Adapter : Selected) {
+    const std::string Prefix = std::string(Adapter->Name) + "/";
+    benchmark::RegisterBenchmark((Prefix + "Startup").c_str(), StartupBenchmark,
+                                 *Adapter)
+        ->Arg(1)
+        ->Arg(100)
+        ->Unit(benchmark::kMicrosecond);
+    for (auto &[Name, Info] : StartupQueries) {
+      benchmark::RegisterBenchmark((Prefix + "DeviceGetInfo/" + Name).c_str(),
+                                   DeviceGetInfoBenchmark, *Adapter, Info);
+    }
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  tearDownWarm();
+  benchmark::Shutdown();
+  return EXIT_SUCCESS;
+}
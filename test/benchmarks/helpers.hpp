@@ -0,0 +1,178 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file helpers.hpp
+ *
+ * Selecting and setting up the adapters measured, shared by the benchmarks.
+ *
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <ur_api.h>
+
+#include <cstring>
+#include <vector>
+
+namespace ur_bench {
+
+struct AdapterName {
+  const char *Name;
+  ur_adapter_backend_t Backend;
+
+  /// The mock adapter hands out handles rather than memory, nothing may be
+  /// written through them
+  bool isMock() const { return Backend == UR_ADAPTER_BACKEND_UNKNOWN; }
+};
+
+// The mock adapter is the only one loaded once mocking is enabled
+inline constexpr AdapterName AdapterNames[] = {
+    {"mock", UR_ADAPTER_BACKEND_UNKNOWN},
+    {"opencl", UR_ADAPTER_BACKEND_OPENCL},
+    {"level_zero", UR_ADAPTER_BACKEND_LEVEL_ZERO},
+    {"cuda", UR_ADAPTER_BACKEND_CUDA},
+    {"hip", UR_ADAPTER_BACKEND_HIP},
+    {"native_cpu", UR_ADAPTER_BACKEND_NATIVE_CPU},
+};
+
+inline const AdapterName *findAdapter(const char *Name) {
+  for (auto &Adapter : AdapterNames) {
+    if (!std::strcmp(Name, Adapter.Name)) {
+      return &Adapter;
+    }
+  }
+  return nullptr;
+}
+
+/// Parses the --adapter=<name> flags left over by benchmark::Initialize. If
+/// none are passed, Selected is set to Defaults, or to all adapters if there
+/// are none. Returns false after reporting anything else.
+inline bool parseAdapterArgs(int argc, char **argv,
+                             std::vector<const AdapterName *> &Selected,
+                             std::vector<const char *> Defaults = {}) {
+  for (int I = 1; I < argc; I++) {
+    const AdapterName *Found = nullptr;
+    if (!std::strncmp(argv[I], "--adapter=", 10)) {
+      Found = findAdapter(argv[I] + 10);
+    }
+    if (!Found) {
+      benchmark::ReportUnrecognizedArguments(argc, argv);
+      return false;
+    }
+    Selected.push_back(Found);
+  }
+  if (!Selected.empty()) {
+    return true;
+  }
+  if (Defaults.empty()) {
+    for (auto &Adapter : AdapterNames) {
+      Selected.push_back(&Adapter);
+    }
+  }
+  for (const char *Name : Defaults) {
+    if (auto *Adapter = findAdapter(Name)) {
+      Selected.push_back(Adapter);
+    }
+  }
+  return true;
+}
+
+/// The loader initialized for a single adapter, optionally with a layer
+class Loader {
+public:
+  /// Returns an error message if the adapter isn't available
+  const char *init(const AdapterName &Name, const char *Layer = nullptr) {
+    Initialized = true;
+    if (urLoaderConfigCreate(&LoaderConfig) != UR_RESULT_SUCCESS) {
+      return "failed to create the loader config";
+    }
+    if (Name.isMock() && urLoaderConfigSetMockingEnabled(LoaderConfig, true) !=
+                             UR_RESULT_SUCCESS) {
+      return "failed to enable mocking";
+    }
+    if (Layer &&
+        urLoaderConfigEnableLayer(LoaderConfig, Layer) != UR_RESULT_SUCCESS) {
+      return "failed to enable the layer";
+    }
+    if (urLoaderInit(0, LoaderConfig) != UR_RESULT_SUCCESS) {
+      return "failed to initialize the loader";
+    }
+
+    uint32_t NumAdapters = 0;
+    urAdapterGet(0, nullptr, &NumAdapters);
+    Adapters.resize(NumAdapters);
+    if (!NumAdapters || urAdapterGet(NumAdapters, Adapters.data(), nullptr) !=
+                            UR_RESULT_SUCCESS) {
+      Adapters.clear();
+      return "no adapters available";
+    }
+
+    Adapter = Name.isMock() ? Adapters.front() : nullptr;
+    for (auto Candidate : Adapters) {
+      ur_adapter_backend_t Backend = UR_ADAPTER_BACKEND_UNKNOWN;
+      urAdapterGetInfo(Candidate, UR_ADAPTER_INFO_BACKEND, sizeof(Backend),
+                       &Backend, nullptr);
+      if (!Name.isMock() && Backend == Name.Backend) {
+        Adapter = Candidate;
+      }
+    }
+    if (!Adapter) {
+      return "adapter not available";
+    }
+    return nullptr;
+  }
+
+  /// Gets the first device of the first platform of the adapter, which the
+  /// caller has to release
+  const char *getDevice(ur_device_handle_t &Device) {
+    ur_platform_handle_t Platform = nullptr;
+    if (urPlatformGet(&Adapter, 1, 1, &Platform, nullptr) !=
+            UR_RESULT_SUCCESS ||
+        urDeviceGet(Platform, UR_DEVICE_TYPE_ALL, 1, &Device, nullptr) !=
+            UR_RESULT_SUCCESS) {
+      return "no device available";
+    }
+    return nullptr;
+  }
+
+  void tearDown() {
+    if (!Initialized) {
+      return;
+    }
+    for (auto Adapter : Adapters) {
+      urAdapterRelease(Adapter);
+    }
+    urLoaderTearDown();
+    if (LoaderConfig) {
+      urLoaderConfigRelease(LoaderConfig);
+    }
+    *this = {};
+  }
+
+  /// Whether the loader intercepts calls even if UR_ENABLE_LOADER_INTERCEPT
+  /// is off, which it does once more than one adapter is loaded
+  bool isInterceptForced() const { return Adapters.size() > 1; }
+
+  /// The adapter selected, or null if it isn't available
+  ur_adapter_handle_t Adapter = nullptr;
+
+private:
+  bool Initialized = false;
+  ur_loader_config_handle_t LoaderConfig = nullptr;
+  std::vector<ur_adapter_handle_t> Adapters;
+};
+
+} // namespace ur_bench
+
+#define SKIP_ON_ERROR(State, Call)                                             \
+  if ((Call) != UR_RESULT_SUCCESS) {                                           \
+    State.SkipWithError(#Call " failed");                                      \
+    break;                                                                     \
+  }
@@ -0,0 +1,199 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file usm_alloc.cpp
+ *
+ * Measures the rate of USM allocations, which adapters pooling their
+ * allocations serve by looking up the pool of the allocation's device and
+ * type:
+ *
+ *  - AllocFree frees every allocation right away, so pools keep reusing the
+ *    same memory
+ *  - AllocBatch makes a batch of allocations before freeing any of them
+ *
+ * Both run with the default pool of the context and with a pool created by
+ * urUSMPoolCreate. Benchmarks are named
+ * <adapter>/<pattern>/<host|device|shared>/<default_pool|pool>/<size>, and
+ * report allocations per second.
+ *
+ * In addition to the Google Benchmark flags, --adapter=<mock|opencl|
+ * level_zero|cuda|hip|native_cpu> selects the adapters measured and may be
+ * passed more than once.
+ *
+ */
+
+#include "helpers.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ur_bench;
+
+namespace {
+
+constexpr size_t BatchSize = 256;
+
+/// The loader, a context and a pool, set up for one adapter at a time
+class Environment {
+public:
+  /// Returns an error message if the adapter can't be set up
+  const char *setUp(const AdapterName &NewAdapter) {
+    if (Adapter == &NewAdapter) {
+      return Error;
+    }
+    tearDown();
+    Adapter = &NewAdapter;
+    Error = init();
+    return Error;
+  }
+
+  void tearDown() {
+    if (!Adapter) {
+      return;
+    }
+    if (Pool) {
+      urUSMPoolRelease(Pool);
+    }
+    if (Context) {
+      urContextRelease(Context);
+    }
+    if (Device) {
+      urDeviceRelease(Device);
+    }
+    AdapterLoader.tearDown();
+    *this = {};
+  }
+
+  ur_device_handle_t Device = nullptr;
+  ur_context_handle_t Context = nullptr;
+  ur_usm_pool_handle_t Pool = nullptr;
+
+private:
+  const char *init() {
+    if (const char *Error = AdapterLoader.init(*Adapter)) {
+      return Error;
+    }
+    if (const char *Error = AdapterLoader.getDevice(Device)) {
+      return Error;
+    }
+    if (urContextCreate(1, &Device, nullptr, &Context) != UR_RESULT_SUCCESS) {
+      return "failed to create a context";
+    }
+    // Benchmarks of pools are skipped on adapters without them
+    ur_usm_pool_desc_t PoolDesc = {UR_STRUCTURE_TYPE_USM_POOL_DESC, nullptr, 0};
+    if (urUSMPoolCreate(Context, &PoolDesc, &Pool) != UR_RESULT_SUCCESS) {
+      Pool = nullptr;
+    }
+    return nullptr;
+  }
+
+  const AdapterName *Adapter = nullptr;
+  const char *Error = nullptr;
+  Loader AdapterLoader;
+};
+
+Environment Env;
+
+ur_result_t allocate(ur_usm_type_t Type, ur_usm_pool_handle_t Pool, size_t Size,
+                     void **Ptr) {
+  switch (Type) {
+  case UR_USM_TYPE_HOST:
+    return urUSMHostAlloc(Env.Context, nullptr, Pool, Size, Ptr);
+  case UR_USM_TYPE_DEVICE:
+    return urUSMDeviceAlloc(Env.Context, Env.Device, nullptr, Pool, Size, Ptr);
+  default:
+    return urUSMSharedAlloc(Env.Context, Env.Device, nullptr, Pool, Size, Ptr);
+  }
+}
+
+void AllocFree(benchmark::State &State, ur_usm_type_t Type,
+               ur_usm_pool_handle_t Pool, size_t Size) {
+  for (auto _ : State) {
+    void *Ptr = nullptr;
+    SKIP_ON_ERROR(State, allocate(Type, Pool, Size, &Ptr));
+    SKIP_ON_ERROR(State, urUSMFree(Env.Context, Ptr));
+  }
+  State.SetItemsProcessed(static_cast<int64_t>(State.iterations()));
+}
+
+void AllocBatch(benchmark::State &State, ur_usm_type_t Type,
+                ur_usm_pool_handle_t Pool, size_t Size) {
+  std::vector<void *> Ptrs(BatchSize);
+  for (auto _ : State) {
+    size_t Allocated = 0;
+    for (; Allocated < BatchSize; Allocated++) {
+      SKIP_ON_ERROR(State, allocate(Type, Pool, Size, &Ptrs[Allocated]));
+    }
+    for (size_t I = 0; I < Allocated; I++) {
+      urUSMFree(Env.Context, Ptrs[I]);
+    }
+    if (Allocated < BatchSize) {
+      break;
+    }
+  }
+  State.SetItemsProcessed(static_cast<int64_t>(State.iterations() * BatchSize));
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  benchmark::Initialize(&argc, argv);
+
+  std::vector<const AdapterName *> Selected;
+  if (!parseAdapterArgs(argc, argv, Selected)) {
+    return EXIT_FAILURE;
+  }
+
+  using PatternFn =
+      void (*)(benchmark::State &, ur_usm_type_t, ur_usm_pool_handle_t, size_t);
+  const std::pair<const char *, PatternFn> Patterns[] = {
+      {"AllocFree", AllocFree},
+      {"AllocBatch", AllocBatch},
+  };
+  const std::pair<const char *, ur_usm_type_t> Types[] = {
+      {"host", UR_USM_TYPE_HOST},
+      {"device", UR_USM_TYPE_DEVICE},
+      {"shared", UR_USM_TYPE_SHARED},
+  };
+
+  for (auto *Adapter : Selected) {
+    for (auto &[PatternName, Fn] : Patterns) {
+      for (auto &[TypeName, Type] : Types) {
+        for (bool UsePool : {false, true}) {
+          for (size_t Size : {size_t{64}, size_t{4} << 10, size_t{1} << 20}) {
+            const std::string BenchName = std::string(Adapter->Name) + "/" +
+                                          PatternName + "/" + TypeName + "/" +
+                                          (UsePool ? "pool" : "default_pool") +
+                                          "/" + std::to_string(Size);
+            benchmark::RegisterBenchmark(
+                BenchName.c_str(), [Adapter, Fn = Fn, Type = Type, UsePool,
+                                    Size](benchmark::State &State) {
+                  if (const char *Error = Env.setUp(*Adapter)) {
+                    State.SkipWithError(Error);
+                    return;
+                  }
+                  if (UsePool && !Env.Pool) {
+                    State.SkipWithError("USM pools not supported");
+                    return;
+                  }
+                  Fn(State, Type, UsePool ? Env.Pool : nullptr, Size);
+                });
+          }
+        }
+      }
+    }
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  Env.tearDown();
+  benchmark::Shutdown();
+  return EXIT_SUCCESS;
+}
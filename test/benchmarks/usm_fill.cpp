@@ -0,0 +1,235 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file usm_fill.cpp
+ *
+ * Compares strategies for USM fills with patterns adapters can't fill
+ * natively, e.g. those that aren't a power of two in size:
+ *
+ *  - HostBuffer fills a host allocation as large as the fill and copies it
+ *    to the device in one go
+ *  - Doubling copies a chunk of patterns to the start of the allocation and
+ *    then doubles the filled part with copies from itself
+ *  - EnqueueUSMFill is whatever urEnqueueUSMFill of the adapter does
+ *
+ * Benchmarks are named <adapter>/<strategy>/<fill size>/<pattern size>, and
+ * report the temporary host memory a strategy needs as TempBytes.
+ *
+ * In addition to the Google Benchmark flags, --adapter=<mock|opencl|
+ * level_zero|cuda|hip|native_cpu> selects the adapters measured and may be
+ * passed more than once.
+ *
+ */
+
+#include "helpers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ur_bench;
+
+namespace {
+
+constexpr size_t MaxFillSize = size_t{64} << 20;
+
+/// The loader, a queue and a device allocation to fill, set up for one
+/// adapter at a time
+class Environment {
+public:
+  /// Returns an error message if the adapter can't be set up
+  const char *setUp(const AdapterName &NewAdapter) {
+    if (Adapter == &NewAdapter) {
+      return Error;
+    }
+    tearDown();
+    Adapter = &NewAdapter;
+    Error = init();
+    return Error;
+  }
+
+  void tearDown() {
+    if (!Adapter) {
+      return;
+    }
+    if (Dst) {
+      urUSMFree(Context, Dst);
+    }
+    if (Queue) {
+      urQueueRelease(Queue);
+    }
+    if (Context) {
+      urContextRelease(Context);
+    }
+    if (Device) {
+      urDeviceRelease(Device);
+    }
+    AdapterLoader.tearDown();
+    *this = {};
+  }
+
+  bool isMock() const { return Adapter->isMock(); }
+
+  ur_context_handle_t Context = nullptr;
+  ur_queue_handle_t Queue = nullptr;
+  void *Dst = nullptr;
+
+private:
+  const char *init() {
+    if (const char *Error = AdapterLoader.init(*Adapter)) {
+      return Error;
+    }
+    if (const char *Error = AdapterLoader.getDevice(Device)) {
+      return Error;
+    }
+    if (urContextCreate(1, &Device, nullptr, &Context) != UR_RESULT_SUCCESS ||
+        urQueueCreate(Context, Device, nullptr, &Queue) != UR_RESULT_SUCCESS) {
+      return "failed to create a context and queue";
+    }
+    if (urUSMDeviceAlloc(Context, Device, nullptr, nullptr, MaxFillSize,
+                         &Dst) != UR_RESULT_SUCCESS) {
+      return "failed to allocate device memory";
+    }
+    return nullptr;
+  }
+
+  const AdapterName *Adapter = nullptr;
+  const char *Error = nullptr;
+  ur_device_handle_t Device = nullptr;
+  Loader AdapterLoader;
+};
+
+Environment Env;
+
+void fillHost(void *Ptr, size_t Size, const std::vector<uint8_t> &Pattern) {
+  if (Env.isMock()) {
+    return;
+  }
+  auto *Bytes = static_cast<uint8_t *>(Ptr);
+  for (size_t Offset = 0; Offset < Size; Offset += Pattern.size()) {
+    std::memcpy(Bytes + Offset, Pattern.data(),
+                std::min(Pattern.size(), Size - Offset));
+  }
+}
+
+void HostBuffer(benchmark::State &State, size_t Size,
+                const std::vector<uint8_t> &Pattern) {
+  for (auto _ : State) {
+    void *Host = nullptr;
+    SKIP_ON_ERROR(State,
+                  urUSMHostAlloc(Env.Context, nullptr, nullptr, Size, &Host));
+    fillHost(Host, Size, Pattern);
+    SKIP_ON_ERROR(State, urEnqueueUSMMemcpy(Env.Queue, false, Env.Dst, Host,
+                                            Size, 0, nullptr, nullptr));
+    SKIP_ON_ERROR(State, urQueueFinish(Env.Queue));
+    SKIP_ON_ERROR(State, urUSMFree(Env.Context, Host));
+  }
+  State.counters["TempBytes"] = static_cast<double>(Size);
+}
+
+void Doubling(benchmark::State &State, size_t Size,
+              const std::vector<uint8_t> &Pattern) {
+  const size_t ChunkSize =
+      std::min(Size, std::lcm(Pattern.size(), size_t{128}));
+  auto *Dst = static_cast<uint8_t *>(Env.Dst);
+  for (auto _ : State) {
+    void *Chunk = nullptr;
+    SKIP_ON_ERROR(State, urUSMHostAlloc(Env.Context, nullptr, nullptr,
+                                        ChunkSize, &Chunk));
+    fillHost(Chunk, ChunkSize, Pattern);
+    ur_event_handle_t LastEvent = nullptr;
+    SKIP_ON_ERROR(State, urEnqueueUSMMemcpy(Env.Queue, false, Dst, Chunk,
+                                            ChunkSize, 0, nullptr, &LastEvent));
+    for (size_t Filled = ChunkSize; Filled < Size; Filled *= 2) {
+      ur_event_handle_t CopyEvent = nullptr;
+      ur_result_t Result = urEnqueueUSMMemcpy(
+          Env.Queue, false, Dst + Filled, Dst, std::min(Filled, Size - Filled),
+          1, &LastEvent, &CopyEvent);
+      urEventRelease(LastEvent);
+      LastEvent = Result == UR_RESULT_SUCCESS ? CopyEvent : nullptr;
+      if (!LastEvent) {
+        break;
+      }
+    }
+    SKIP_ON_ERROR(State, LastEvent ? urEventWait(1, &LastEvent)
+                                   : UR_RESULT_ERROR_UNKNOWN);
+    urEventRelease(LastEvent);
+    SKIP_ON_ERROR(State, urUSMFree(Env.Context, Chunk));
+  }
+  State.counters["TempBytes"] = static_cast<double>(ChunkSize);
+}
+
+void EnqueueUSMFill(benchmark::State &State, size_t Size,
+                    const std::vector<uint8_t> &Pattern) {
+  for (auto _ : State) {
+    SKIP_ON_ERROR(State,
+                  urEnqueueUSMFill(Env.Queue, Env.Dst, Pattern.size(),
+                                   Pattern.data(), Size, 0, nullptr, nullptr));
+    SKIP_ON_ERROR(State, urQueueFinish(Env.Queue));
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  benchmark::Initialize(&argc, argv);
+
+  std::vector<const AdapterName *> Selected;
+  if (!parseAdapterArgs(argc, argv, Selected)) {
+    return EXIT_FAILURE;
+  }
+
+  using StrategyFn =
+      void (*)(benchmark::State &, size_t, const std::vector<uint8_t> &);
+  const std::pair<const char *, StrategyFn> Strategies[] = {
+      {"HostBuffer", HostBuffer},
+      {"Doubling", Doubling},
+      {"EnqueueUSMFill", EnqueueUSMFill},
+  };
+
+  for (auto *Adapter : Selected) {
+    for (auto &[Name, Fn] : Strategies) {
+      for (size_t Size : {size_t{1} << 20, MaxFillSize}) {
+        for (size_t PatternSize : {3, 24, 256}) {
+          // Fills have to be a multiple of the pattern size
+          const size_t FillSize = Size / PatternSize * PatternSize;
+          std::vector<uint8_t> Pattern(PatternSize);
+          std::iota(Pattern.begin(), Pattern.end(), uint8_t{1});
+
+          const std::string BenchName = std::string(Adapter->Name) + "/" +
+                                        Name + "/" + std::to_string(FillSize) +
+                                        "/" + std::to_string(PatternSize);
+          benchmark::RegisterBenchmark(
+              BenchName.c_str(),
+              [Adapter, Fn = Fn, FillSize, Pattern](benchmark::State &State) {
+                if (const char *Error = Env.setUp(*Adapter)) {
+                  State.SkipWithError(Error);
+                  return;
+                }
+                Fn(State, FillSize, Pattern);
+                State.SetBytesProcessed(
+                    static_cast<int64_t>(State.iterations() * FillSize));
+              })
+              ->Unit(benchmark::kMillisecond)
+              ->UseRealTime();
+        }
+      }
+    }
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  Env.tearDown();
+  benchmark::Shutdown();
+  return EXIT_SUCCESS;
+}
@@ -133,6 +133,70 @@ TEST_P(urDeviceGetSelectedTest,
   }
 }
 
+TEST_P(urDeviceGetSelectedTest, SuccessRepeated) {
+  setenv("ONEAPI_DEVICE_SELECTOR", "*:*", 1);
+  uint32_t count = 0;
+  ASSERT_SUCCESS(
+      urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, 0, nullptr, &count));
+  ASSERT_NE(count, 0);
+  std::vector<ur_device_handle_t> devices(count);
+  ASSERT_SUCCESS(urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, count,
+                                     devices.data(), nullptr));
+
+  uint32_t countAgain = 0;
+  ASSERT_SUCCESS(urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, 0, nullptr,
+                                     &countAgain));
+  ASSERT_EQ(countAgain, count);
+  std::vector<ur_device_handle_t> devicesAgain(countAgain);
+  ASSERT_SUCCESS(urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, countAgain,
+                                     devicesAgain.data(), nullptr));
+  ASSERT_EQ(devicesAgain, devices);
+}
+
+TEST_P(urDeviceGetSelectedTest, SuccessSelectorChanged) {
+  setenv("ONEAPI_DEVICE_SELECTOR", "*:*", 1);
+  uint32_t count = 0;
+  ASSERT_SUCCESS(
+      urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, 0, nullptr, &count));
+  ASSERT_NE(count, 0);
+
+  setenv("ONEAPI_DEVICE_SELECTOR", "!*:*", 1);
+  uint32_t countDiscarded = 0;
+  ASSERT_SUCCESS(urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, 0, nullptr,
+                                     &countDiscarded));
+  ASSERT_EQ(countDiscarded, 0);
+
+  setenv("ONEAPI_DEVICE_SELECTOR", "*:*", 1);
+  uint32_t countRestored = 0;
+  ASSERT_SUCCESS(urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, 0, nullptr,
+                                     &countRestored));
+  ASSERT_EQ(countRestored, count);
+}
+
+TEST_P(urDeviceGetSelectedTest, SuccessSubDevicesReleased) {
+  setenv("ONEAPI_DEVICE_SELECTOR", "*:*.*", 1);
+  uint32_t count = 0;
+  ASSERT_SUCCESS(
+      urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, 0, nullptr, &count));
+  if (count == 0) {
+    GTEST_SKIP() << "There are no sub-devices to select";
+  }
+
+  // Sub-devices belong to the caller, releasing them mustn't invalidate the
+  // ones handed out by later calls
+  for (int i = 0; i < 2; i++) {
+    std::vector<ur_device_handle_t> devices(count);
+    ASSERT_SUCCESS(urDeviceGetSelected(platform, UR_DEVICE_TYPE_ALL, count,
+                                       devices.data(), nullptr));
+    for (auto device : devices) {
+      ur_device_type_t type;
+      ASSERT_SUCCESS(urDeviceGetInfo(device, UR_DEVICE_INFO_TYPE, sizeof(type),
+                                     &type, nullptr));
+      ASSERT_SUCCESS(urDeviceRelease(device));
+    }
+  }
+}
+
 TEST_P(urDeviceGetSelectedTest, InvalidNullHandlePlatform) {
   unsetenv("ONEAPI_DEVICE_SELECTOR");
   uint32_t count = 0;
@@ -92,7 +92,11 @@ static std::vector<testParametersFill> test_cases{
     {256, 4},
     {256, 8},
     {256, 16},
-    {256, 32}};
+    {256, 32},
+    /* fills of patterns adapters can't fill natively that are many times as
+       large as the pattern, with a size that is a multiple of it */
+    {(size_t{1} << 20) / 3 * 3, 3},
+    {129 * 1024, 129}};
 
 UUR_DEVICE_TEST_SUITE_WITH_PARAM(
     urEnqueueUSMFillTestWithParam, testing::ValuesIn(test_cases),
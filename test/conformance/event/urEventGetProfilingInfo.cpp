@@ -11,7 +11,7 @@ using urEventGetProfilingInfoTest = uur::event::urEventTest;
 UUR_INSTANTIATE_DEVICE_TEST_SUITE(urEventGetProfilingInfoTest);
 
 TEST_P(urEventGetProfilingInfoTest, SuccessCommandQueued) {
-  UUR_KNOWN_FAILURE_ON(uur::LevelZero{}, uur::LevelZeroV2{}, uur::NativeCPU{});
+  UUR_KNOWN_FAILURE_ON(uur::LevelZero{}, uur::LevelZeroV2{});
 
   const ur_profiling_info_t property_name = UR_PROFILING_INFO_COMMAND_QUEUED;
   size_t property_size = 0;
@@ -29,7 +29,7 @@ TEST_P(urEventGetProfilingInfoTest, SuccessCommandQueued) {
 }
 
 TEST_P(urEventGetProfilingInfoTest, SuccessCommandSubmit) {
-  UUR_KNOWN_FAILURE_ON(uur::LevelZero{}, uur::LevelZeroV2{}, uur::NativeCPU{});
+  UUR_KNOWN_FAILURE_ON(uur::LevelZero{}, uur::LevelZeroV2{});
 
   const ur_profiling_info_t property_name = UR_PROFILING_INFO_COMMAND_SUBMIT;
   size_t property_size = 0;
@@ -79,8 +79,7 @@ TEST_P(urEventGetProfilingInfoTest, SuccessCommandEnd) {
 }
 
 TEST_P(urEventGetProfilingInfoTest, SuccessCommandComplete) {
-  UUR_KNOWN_FAILURE_ON(uur::CUDA{}, uur::HIP{}, uur::LevelZero{},
-                       uur::NativeCPU{});
+  UUR_KNOWN_FAILURE_ON(uur::CUDA{}, uur::HIP{}, uur::LevelZero{});
 
   const ur_profiling_info_t property_name = UR_PROFILING_INFO_COMMAND_COMPLETE;
   size_t property_size = 0;
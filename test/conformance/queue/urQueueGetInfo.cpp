@@ -10,8 +10,6 @@ using urQueueGetInfoTest = uur::urQueueTest;
 UUR_INSTANTIATE_DEVICE_TEST_SUITE(urQueueGetInfoTest);
 
 TEST_P(urQueueGetInfoTest, SuccessContext) {
-  UUR_KNOWN_FAILURE_ON(uur::NativeCPU{});
-
   size_t property_size = 0;
   const ur_queue_info_t property_name = UR_QUEUE_INFO_CONTEXT;
 
@@ -28,8 +26,6 @@ TEST_P(urQueueGetInfoTest, SuccessContext) {
 }
 
 TEST_P(urQueueGetInfoTest, SuccessDevice) {
-  UUR_KNOWN_FAILURE_ON(uur::NativeCPU{});
-
   size_t property_size = 0;
   const ur_queue_info_t property_name = UR_QUEUE_INFO_DEVICE;
 
@@ -64,8 +60,6 @@ TEST_P(urQueueGetInfoTest, SuccessFlags) {
 }
 
 TEST_P(urQueueGetInfoTest, SuccessReferenceCount) {
-  UUR_KNOWN_FAILURE_ON(uur::NativeCPU{});
-
   size_t property_size = 0;
   const ur_queue_info_t property_name = UR_QUEUE_INFO_REFERENCE_COUNT;
 
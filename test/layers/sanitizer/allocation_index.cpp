@@ -0,0 +1,236 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file allocation_index.cpp
+ *
+ */
+
+#include "sanitizer_common/sanitizer_allocation_index.hpp"
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+struct FakeAllocInfo {
+  uptr AllocBegin;
+  size_t AllocSize;
+  ur_context_handle_t Context;
+};
+
+using Index = AllocationIndex<FakeAllocInfo>;
+using AllocPtr = Index::AllocInfoPtr;
+
+const auto ContextA = reinterpret_cast<ur_context_handle_t>(0x10);
+const auto ContextB = reinterpret_cast<ur_context_handle_t>(0x20);
+
+AllocPtr makeAlloc(uptr Begin, size_t Size,
+                   ur_context_handle_t Context = ContextA) {
+  return std::make_shared<FakeAllocInfo>(FakeAllocInfo{Begin, Size, Context});
+}
+
+// Every byte of the allocation maps to it, the bytes around it don't.
+void expectBounds(Index &Index, const AllocPtr &AI) {
+  auto Last = AI->AllocBegin + AI->AllocSize - 1;
+  EXPECT_EQ(Index.find(AI->AllocBegin), AI);
+  EXPECT_EQ(Index.find(AI->AllocBegin + AI->AllocSize / 2), AI);
+  EXPECT_EQ(Index.find(Last), AI);
+  EXPECT_NE(Index.find(AI->AllocBegin - 1), AI);
+  EXPECT_NE(Index.find(Last + 1), AI);
+}
+
+} // namespace
+
+TEST(AllocationIndex, FindsSmallAllocation) {
+  Index Index;
+  auto AI = makeAlloc(0x7f0000001000, 0x40);
+  Index.insert(AI);
+
+  expectBounds(Index, AI);
+  EXPECT_EQ(Index.find(0x7f0000001000 - 1), nullptr);
+  EXPECT_EQ(Index.find(0x7f0000001040), nullptr);
+  EXPECT_EQ(Index.find(0), nullptr);
+}
+
+// Allocations spanning many granules are indexed on coarser levels and have
+// to be found from anywhere inside them, including granule boundaries.
+TEST(AllocationIndex, FindsAllocationsOnEveryLevel) {
+  Index Index;
+  std::vector<AllocPtr> Allocs = {
+      makeAlloc(0x100000000, 1ULL << 16),        // Single granule
+      makeAlloc(0x200000000 - 8, 16),            // Straddles two granules
+      makeAlloc(0x300000000, 1ULL << 22),        // Finest level, 64 granules
+      makeAlloc(0x500000000 + 0x10, 1ULL << 30), // Coarser levels
+      makeAlloc(0x20000000000, 1ULL << 40),      // Coarsest level
+  };
+  for (auto &AI : Allocs) {
+    Index.insert(AI);
+  }
+
+  for (auto &AI : Allocs) {
+    expectBounds(Index, AI);
+    // Every granule boundary inside the allocation
+    auto Last = AI->AllocBegin + AI->AllocSize - 1;
+    for (uptr Address = (AI->AllocBegin | 0xffff) + 1;
+         Address <= Last && Address < AI->AllocBegin + (1ULL << 24);
+         Address += 1ULL << 16) {
+      EXPECT_EQ(Index.find(Address), AI);
+      EXPECT_EQ(Index.find(Address - 1), AI);
+    }
+  }
+}
+
+TEST(AllocationIndex, AdjacentAllocations) {
+  Index Index;
+  auto First = makeAlloc(0x10000, 0x100);
+  auto Second = makeAlloc(0x10100, 0x100);
+  auto Third = makeAlloc(0x10200, 0x10000);
+  Index.insert(First);
+  Index.insert(Second);
+  Index.insert(Third);
+
+  EXPECT_EQ(Index.find(0x100ff), First);
+  EXPECT_EQ(Index.find(0x10100), Second);
+  EXPECT_EQ(Index.find(0x101ff), Second);
+  EXPECT_EQ(Index.find(0x10200), Third);
+  EXPECT_EQ(Index.find(0x201ff), Third);
+  EXPECT_EQ(Index.find(0x20200), nullptr);
+
+  ASSERT_TRUE(Index.erase(Second));
+  EXPECT_EQ(Index.find(0x10100), nullptr);
+  EXPECT_EQ(Index.find(0x100ff), First);
+  EXPECT_EQ(Index.find(0x10200), Third);
+}
+
+TEST(AllocationIndex, EraseOnlyOnce) {
+  Index Index;
+  auto AI = makeAlloc(0x40000000, 1ULL << 26);
+  Index.insert(AI);
+
+  // Another allocation at the same address isn't the indexed one
+  auto Other = makeAlloc(0x40000000, 1ULL << 26);
+  EXPECT_FALSE(Index.erase(Other));
+  EXPECT_EQ(Index.find(0x40000000), AI);
+
+  EXPECT_TRUE(Index.erase(AI));
+  EXPECT_FALSE(Index.erase(AI));
+  EXPECT_EQ(Index.find(0x40000000), nullptr);
+  EXPECT_EQ(Index.find(0x40000000 + (1ULL << 26) - 1), nullptr);
+  EXPECT_TRUE(Index.findByContext(ContextA).empty());
+}
+
+TEST(AllocationIndex, FindByContext) {
+  Index Index;
+  auto A1 = makeAlloc(0x10000, 0x100, ContextA);
+  auto A2 = makeAlloc(0x20000, 0x100, ContextA);
+  auto B1 = makeAlloc(0x30000, 0x100, ContextB);
+  Index.insert(A1);
+  Index.insert(A2);
+  Index.insert(B1);
+
+  auto InA = Index.findByContext(ContextA);
+  ASSERT_EQ(InA.size(), 2);
+  EXPECT_NE(std::find(InA.begin(), InA.end(), A1), InA.end());
+  EXPECT_NE(std::find(InA.begin(), InA.end(), A2), InA.end());
+  EXPECT_EQ(Index.findByContext(ContextB), std::vector<AllocPtr>{B1});
+
+  Index.clear();
+  EXPECT_TRUE(Index.findByContext(ContextA).empty());
+  EXPECT_EQ(Index.find(0x10000), nullptr);
+  EXPECT_FALSE(Index.erase(A1));
+}
+
+// Concurrent erasers of the same allocation agree on a single owner.
+TEST(AllocationIndex, ConcurrentInsertFindErase) {
+  constexpr size_t NumThreads = 8;
+  constexpr size_t NumAllocs = 1000;
+
+  Index Index;
+  std::vector<AllocPtr> Allocs;
+  for (size_t I = 0; I < NumAllocs; I++) {
+    Allocs.push_back(makeAlloc(0x100000000 + I * 0x3000, 0x2000));
+    Index.insert(Allocs.back());
+  }
+
+  std::vector<size_t> Erased(NumThreads), Misses(NumThreads);
+  std::vector<std::thread> Threads;
+  for (size_t T = 0; T < NumThreads; T++) {
+    Threads.emplace_back([&, T] {
+      // Unrelated allocations come and go meanwhile
+      auto Own = makeAlloc(0x900000000 + T * 0x100000, 0x1000);
+      for (size_t I = 0; I < NumAllocs; I++) {
+        Index.insert(Own);
+        if (Index.find(Own->AllocBegin + 0xfff) != Own) {
+          Misses[T]++;
+        }
+        auto &AI = Allocs[(I + T * 7) % NumAllocs];
+        auto Found = Index.find(AI->AllocBegin + 0x1fff);
+        if (Found && Found != AI) {
+          Misses[T]++;
+        }
+        Erased[T] += Index.erase(AI);
+        Index.erase(Own);
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  size_t TotalErased = 0;
+  for (size_t T = 0; T < NumThreads; T++) {
+    EXPECT_EQ(Misses[T], 0);
+    TotalErased += Erased[T];
+  }
+  EXPECT_EQ(TotalErased, NumAllocs);
+  EXPECT_TRUE(Index.findByContext(ContextA).empty());
+}
+
+// Contexts show up while others allocate and free, every context only ever
+// sees its own allocations.
+TEST(AllocationIndex, ConcurrentContexts) {
+  constexpr size_t NumThreads = 8;
+  constexpr size_t NumAllocs = 500;
+
+  Index Index;
+  std::vector<size_t> Misses(NumThreads);
+  std::vector<std::thread> Threads;
+  for (size_t T = 0; T < NumThreads; T++) {
+    Threads.emplace_back([&, T] {
+      auto Context = reinterpret_cast<ur_context_handle_t>(0x1000 + T);
+      std::vector<AllocPtr> Allocs;
+      for (size_t I = 0; I < NumAllocs; I++) {
+        Allocs.push_back(makeAlloc(0x100000000 + (T * NumAllocs + I) * 0x1000,
+                                   0x800, Context));
+        Index.insert(Allocs.back());
+      }
+      if (Index.findByContext(Context).size() != NumAllocs) {
+        Misses[T]++;
+      }
+      for (auto &AI : Allocs) {
+        if (!Index.erase(AI)) {
+          Misses[T]++;
+        }
+      }
+      if (!Index.findByContext(Context).empty()) {
+        Misses[T]++;
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  for (size_t T = 0; T < NumThreads; T++) {
+    EXPECT_EQ(Misses[T], 0);
+  }
+}
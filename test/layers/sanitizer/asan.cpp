@@ -11,8 +11,15 @@
  *
  */
 
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <ur_api.h>
+#include <ur_mock_helpers.hpp>
 
 TEST(DeviceAsan, Initialization) {
   ur_result_t status;
@@ -120,3 +127,165 @@ TEST(DeviceAsan, UnsupportedFeature) {
   status = urLoaderConfigRelease(loaderConfig);
   ASSERT_EQ(status, UR_RESULT_SUCCESS);
 }
+
+namespace {
+ur_context_handle_t stressContext;
+ur_device_handle_t stressDevice;
+ur_program_handle_t stressProgram;
+std::atomic<uint32_t> launchesInFlight;
+std::atomic<uint32_t> maxLaunchesInFlight;
+std::atomic<uint32_t> launchCount;
+
+template <typename T>
+ur_result_t returnInfo(T value, size_t propSize, void *pPropValue,
+                       size_t *pPropSizeRet) {
+  if (pPropValue) {
+    if (propSize < sizeof(T)) {
+      return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+    std::memcpy(pPropValue, &value, sizeof(T));
+  }
+  if (pPropSizeRet) {
+    *pPropSizeRet = sizeof(T);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t stress_urQueueGetInfo(void *pParams) {
+  auto params = *static_cast<ur_queue_get_info_params_t *>(pParams);
+  switch (*params.ppropName) {
+  case UR_QUEUE_INFO_CONTEXT:
+    return returnInfo(stressContext, *params.ppropSize, *params.ppPropValue,
+                      *params.ppPropSizeRet);
+  case UR_QUEUE_INFO_DEVICE:
+    return returnInfo(stressDevice, *params.ppropSize, *params.ppPropValue,
+                      *params.ppPropSizeRet);
+  default:
+    return UR_RESULT_SUCCESS;
+  }
+}
+
+ur_result_t stress_urKernelGetInfo(void *pParams) {
+  auto params = *static_cast<ur_kernel_get_info_params_t *>(pParams);
+  switch (*params.ppropName) {
+  case UR_KERNEL_INFO_PROGRAM:
+    return returnInfo(stressProgram, *params.ppropSize, *params.ppPropValue,
+                      *params.ppPropSizeRet);
+  case UR_KERNEL_INFO_NUM_ARGS:
+    return returnInfo(uint32_t{0}, *params.ppropSize, *params.ppPropValue,
+                      *params.ppPropSizeRet);
+  case UR_KERNEL_INFO_FUNCTION_NAME: {
+    const char name[] = "stress_kernel";
+    if (*params.ppPropValue) {
+      if (*params.ppropSize < sizeof(name)) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
+      }
+      std::memcpy(*params.ppPropValue, name, sizeof(name));
+    }
+    if (*params.ppPropSizeRet) {
+      **params.ppPropSizeRet = sizeof(name);
+    }
+    return UR_RESULT_SUCCESS;
+  }
+  default:
+    return UR_RESULT_SUCCESS;
+  }
+}
+
+// Keeps every launch in the adapter for a moment, so that launches made from
+// different threads overlap unless the layer serializes them.
+ur_result_t stress_urEnqueueKernelLaunch(void *) {
+  auto inFlight = ++launchesInFlight;
+  auto max = maxLaunchesInFlight.load();
+  while (inFlight > max &&
+         !maxLaunchesInFlight.compare_exchange_weak(max, inFlight)) {
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(500));
+  --launchesInFlight;
+  launchCount++;
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
+TEST(DeviceAsan, ConcurrentKernelLaunch) {
+  constexpr uint32_t numThreads = 8;
+  constexpr uint32_t launchesPerThread = 64;
+
+  ur_loader_config_handle_t loaderConfig;
+  ASSERT_EQ(urLoaderConfigCreate(&loaderConfig), UR_RESULT_SUCCESS);
+  ASSERT_EQ(urLoaderConfigEnableLayer(loaderConfig, "UR_LAYER_ASAN"),
+            UR_RESULT_SUCCESS);
+  ASSERT_EQ(urLoaderInit(0, loaderConfig), UR_RESULT_SUCCESS);
+
+  ur_adapter_handle_t adapter;
+  ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
+  ur_platform_handle_t platform;
+  ASSERT_EQ(urPlatformGet(&adapter, 1, 1, &platform, nullptr),
+            UR_RESULT_SUCCESS);
+  ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_DEFAULT, 1, &stressDevice,
+                        nullptr),
+            UR_RESULT_SUCCESS);
+  ASSERT_EQ(urContextCreate(1, &stressDevice, nullptr, &stressContext),
+            UR_RESULT_SUCCESS);
+
+  mock::getCallbacks().set_replace_callback("urQueueGetInfo",
+                                            &stress_urQueueGetInfo);
+  mock::getCallbacks().set_replace_callback("urKernelGetInfo",
+                                            &stress_urKernelGetInfo);
+  mock::getCallbacks().set_before_callback("urEnqueueKernelLaunch",
+                                           &stress_urEnqueueKernelLaunch);
+
+  const uint8_t il[] = {0};
+  ASSERT_EQ(urProgramCreateWithIL(stressContext, il, sizeof(il), nullptr,
+                                  &stressProgram),
+            UR_RESULT_SUCCESS);
+
+  // One queue and one kernel per thread, launches of the same kernel are
+  // still expected to be serialized.
+  std::vector<ur_queue_handle_t> queues(numThreads);
+  std::vector<ur_kernel_handle_t> kernels(numThreads);
+  for (uint32_t i = 0; i < numThreads; ++i) {
+    ASSERT_EQ(urQueueCreate(stressContext, stressDevice, nullptr, &queues[i]),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urKernelCreate(stressProgram, "stress_kernel", &kernels[i]),
+              UR_RESULT_SUCCESS);
+  }
+
+  std::atomic<uint32_t> failures = 0;
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < numThreads; ++i) {
+    threads.emplace_back([&, i] {
+      const size_t globalSize = 64;
+      const size_t localSize = 16;
+      for (uint32_t n = 0; n < launchesPerThread; ++n) {
+        if (urEnqueueKernelLaunch(queues[i], kernels[i], 1, nullptr,
+                                  &globalSize, &localSize, 0, nullptr,
+                                  nullptr) != UR_RESULT_SUCCESS) {
+          failures++;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(failures, 0);
+  EXPECT_EQ(launchCount, numThreads * launchesPerThread);
+  EXPECT_GT(maxLaunchesInFlight, 1);
+
+  mock::getCallbacks().set_replace_callback("urQueueGetInfo", nullptr);
+  mock::getCallbacks().set_replace_callback("urKernelGetInfo", nullptr);
+  mock::getCallbacks().set_before_callback("urEnqueueKernelLaunch", nullptr);
+
+  for (uint32_t i = 0; i < numThreads; ++i) {
+    ASSERT_EQ(urKernelRelease(kernels[i]), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueRelease(queues[i]), UR_RESULT_SUCCESS);
+  }
+  ASSERT_EQ(urProgramRelease(stressProgram), UR_RESULT_SUCCESS);
+  ASSERT_EQ(urContextRelease(stressContext), UR_RESULT_SUCCESS);
+  ASSERT_EQ(urDeviceRelease(stressDevice), UR_RESULT_SUCCESS);
+  ASSERT_EQ(urAdapterRelease(adapter), UR_RESULT_SUCCESS);
+  ASSERT_EQ(urLoaderTearDown(), UR_RESULT_SUCCESS);
+  ASSERT_EQ(urLoaderConfigRelease(loaderConfig), UR_RESULT_SUCCESS);
+}
@@ -0,0 +1,206 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file kernel_args.cpp
+ *
+ * Launches kernels with pointer arguments through the ASan layer, which must
+ * report invalid ones even when they were validated by an earlier launch.
+ * Run with the quarantine enabled, so released allocations stay known.
+ *
+ */
+
+#include <atomic>
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <ur_api.h>
+#include <ur_mock_helpers.hpp>
+
+namespace {
+ur_context_handle_t argsContext;
+ur_device_handle_t argsDevice;
+ur_program_handle_t argsProgram;
+std::atomic<uint32_t> launchCount;
+
+template <typename T>
+ur_result_t returnInfo(T value, size_t propSize, void *pPropValue,
+                       size_t *pPropSizeRet) {
+  if (pPropValue) {
+    if (propSize < sizeof(T)) {
+      return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+    std::memcpy(pPropValue, &value, sizeof(T));
+  }
+  if (pPropSizeRet) {
+    *pPropSizeRet = sizeof(T);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t args_urQueueGetInfo(void *pParams) {
+  auto params = *static_cast<ur_queue_get_info_params_t *>(pParams);
+  switch (*params.ppropName) {
+  case UR_QUEUE_INFO_CONTEXT:
+    return returnInfo(argsContext, *params.ppropSize, *params.ppPropValue,
+                      *params.ppPropSizeRet);
+  case UR_QUEUE_INFO_DEVICE:
+    return returnInfo(argsDevice, *params.ppropSize, *params.ppPropValue,
+                      *params.ppPropSizeRet);
+  default:
+    return UR_RESULT_SUCCESS;
+  }
+}
+
+ur_result_t args_urKernelGetInfo(void *pParams) {
+  auto params = *static_cast<ur_kernel_get_info_params_t *>(pParams);
+  switch (*params.ppropName) {
+  case UR_KERNEL_INFO_PROGRAM:
+    return returnInfo(argsProgram, *params.ppropSize, *params.ppPropValue,
+                      *params.ppPropSizeRet);
+  case UR_KERNEL_INFO_NUM_ARGS:
+    return returnInfo(uint32_t{1}, *params.ppropSize, *params.ppPropValue,
+                      *params.ppPropSizeRet);
+  case UR_KERNEL_INFO_FUNCTION_NAME: {
+    const char name[] = "args_kernel";
+    if (*params.ppPropValue) {
+      if (*params.ppropSize < sizeof(name)) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
+      }
+      std::memcpy(*params.ppPropValue, name, sizeof(name));
+    }
+    if (*params.ppPropSizeRet) {
+      **params.ppPropSizeRet = sizeof(name);
+    }
+    return UR_RESULT_SUCCESS;
+  }
+  default:
+    return UR_RESULT_SUCCESS;
+  }
+}
+
+ur_result_t args_urEnqueueKernelLaunch(void *) {
+  launchCount++;
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
+// Invalid arguments make the layer exit, which is checked in a death test.
+// They run the test again in a new process, so the whole setup lives in the
+// fixture.
+struct DeviceAsanKernelArgs : ::testing::Test {
+  void SetUp() override {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+
+    ASSERT_EQ(urLoaderConfigCreate(&loaderConfig), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urLoaderConfigEnableLayer(loaderConfig, "UR_LAYER_ASAN"),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urLoaderInit(0, loaderConfig), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
+    ur_platform_handle_t platform;
+    ASSERT_EQ(urPlatformGet(&adapter, 1, 1, &platform, nullptr),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(
+        urDeviceGet(platform, UR_DEVICE_TYPE_DEFAULT, 1, &argsDevice, nullptr),
+        UR_RESULT_SUCCESS);
+    ASSERT_EQ(urContextCreate(1, &argsDevice, nullptr, &argsContext),
+              UR_RESULT_SUCCESS);
+
+    mock::getCallbacks().set_replace_callback("urQueueGetInfo",
+                                              &args_urQueueGetInfo);
+    mock::getCallbacks().set_replace_callback("urKernelGetInfo",
+                                              &args_urKernelGetInfo);
+    mock::getCallbacks().set_before_callback("urEnqueueKernelLaunch",
+                                             &args_urEnqueueKernelLaunch);
+
+    const uint8_t il[] = {0};
+    ASSERT_EQ(urProgramCreateWithIL(argsContext, il, sizeof(il), nullptr,
+                                    &argsProgram),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueCreate(argsContext, argsDevice, nullptr, &queue),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urKernelCreate(argsProgram, "args_kernel", &kernel),
+              UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(urUSMDeviceAlloc(argsContext, argsDevice, nullptr, nullptr,
+                               allocSize, &ptr),
+              UR_RESULT_SUCCESS);
+    launchCount = 0;
+  }
+
+  void TearDown() override {
+    mock::getCallbacks().set_replace_callback("urQueueGetInfo", nullptr);
+    mock::getCallbacks().set_replace_callback("urKernelGetInfo", nullptr);
+    mock::getCallbacks().set_before_callback("urEnqueueKernelLaunch", nullptr);
+
+    if (ptr) {
+      ASSERT_EQ(urUSMFree(argsContext, ptr), UR_RESULT_SUCCESS);
+    }
+    ASSERT_EQ(urKernelRelease(kernel), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urProgramRelease(argsProgram), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urContextRelease(argsContext), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urDeviceRelease(argsDevice), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urAdapterRelease(adapter), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urLoaderTearDown(), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urLoaderConfigRelease(loaderConfig), UR_RESULT_SUCCESS);
+  }
+
+  ur_result_t launch() {
+    const size_t globalSize = 64;
+    const size_t localSize = 16;
+    return urEnqueueKernelLaunch(queue, kernel, 1, nullptr, &globalSize,
+                                 &localSize, 0, nullptr, nullptr);
+  }
+
+  static constexpr size_t allocSize = 256;
+
+  ur_loader_config_handle_t loaderConfig = nullptr;
+  ur_adapter_handle_t adapter = nullptr;
+  ur_queue_handle_t queue = nullptr;
+  ur_kernel_handle_t kernel = nullptr;
+  void *ptr = nullptr;
+};
+
+TEST_F(DeviceAsanKernelArgs, ValidArgument) {
+  ASSERT_EQ(urKernelSetArgPointer(kernel, 0, nullptr, ptr), UR_RESULT_SUCCESS);
+
+  // The second launch reuses the validation of the first one
+  ASSERT_EQ(launch(), UR_RESULT_SUCCESS);
+  ASSERT_EQ(launch(), UR_RESULT_SUCCESS);
+  EXPECT_EQ(launchCount, 2);
+}
+
+TEST_F(DeviceAsanKernelArgs, OutOfBoundsArgument) {
+  auto end = static_cast<char *>(ptr) + allocSize;
+  ASSERT_EQ(urKernelSetArgPointer(kernel, 0, nullptr, end), UR_RESULT_SUCCESS);
+  EXPECT_EXIT(launch(), ::testing::ExitedWithCode(1), "");
+}
+
+// Setting an argument again must not reuse what was validated for the
+// previous one.
+TEST_F(DeviceAsanKernelArgs, ArgumentChangedToInvalid) {
+  ASSERT_EQ(urKernelSetArgPointer(kernel, 0, nullptr, ptr), UR_RESULT_SUCCESS);
+  ASSERT_EQ(launch(), UR_RESULT_SUCCESS);
+
+  auto end = static_cast<char *>(ptr) + allocSize;
+  ASSERT_EQ(urKernelSetArgPointer(kernel, 0, nullptr, end), UR_RESULT_SUCCESS);
+  EXPECT_EXIT(launch(), ::testing::ExitedWithCode(1), "");
+}
+
+// Freeing an argument invalidates it, even though the argument wasn't set
+// again since it was validated.
+TEST_F(DeviceAsanKernelArgs, ReleasedArgument) {
+  ASSERT_EQ(urKernelSetArgPointer(kernel, 0, nullptr, ptr), UR_RESULT_SUCCESS);
+  ASSERT_EQ(launch(), UR_RESULT_SUCCESS);
+
+  ASSERT_EQ(urUSMFree(argsContext, ptr), UR_RESULT_SUCCESS);
+  ptr = nullptr;
+  EXPECT_EXIT(launch(), ::testing::ExitedWithCode(1), "");
+}
@@ -0,0 +1,230 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file quarantine.cpp
+ *
+ */
+
+#include "asan/asan_quarantine.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+using namespace ur_sanitizer_layer::asan;
+
+namespace {
+
+const auto ContextA = reinterpret_cast<ur_context_handle_t>(0x10);
+const auto ContextB = reinterpret_cast<ur_context_handle_t>(0x20);
+const auto Device = reinterpret_cast<ur_device_handle_t>(0x100);
+
+std::shared_ptr<AllocInfo> makeAlloc(size_t Size,
+                                     ur_context_handle_t Context = ContextA) {
+  auto AI = std::make_shared<AllocInfo>();
+  AI->AllocSize = Size;
+  AI->Context = Context;
+  AI->Device = Device;
+  return AI;
+}
+
+// Keeps track of what the quarantine handed back.
+struct Released {
+  Quarantine::ReleaseCallback callback() {
+    return [this](Quarantine::AllocInfoList &AllocInfos) {
+      std::scoped_lock<std::mutex> Guard(Mutex);
+      for (auto &AI : AllocInfos) {
+        Size += AI->AllocSize;
+        AllocInfos_.insert(AI.get());
+      }
+      Cv.notify_all();
+    };
+  }
+
+  bool contains(const std::shared_ptr<AllocInfo> &AI) {
+    std::scoped_lock<std::mutex> Guard(Mutex);
+    return AllocInfos_.count(AI.get());
+  }
+
+  // The evictor releases asynchronously.
+  bool waitFor(const std::shared_ptr<AllocInfo> &AI) {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    return Cv.wait_for(Lock, std::chrono::seconds(10),
+                       [&]() { return AllocInfos_.count(AI.get()) != 0; });
+  }
+
+  std::mutex Mutex;
+  std::condition_variable Cv;
+  std::set<AllocInfo *> AllocInfos_;
+  size_t Size = 0;
+};
+
+// Blocks threads until it's opened.
+struct Gate {
+  void wait() {
+    std::unique_lock<std::mutex> Lock(Mutex);
+    Cv.wait(Lock, [this]() { return Open; });
+  }
+
+  void open() {
+    {
+      std::scoped_lock<std::mutex> Guard(Mutex);
+      Open = true;
+    }
+    Cv.notify_all();
+  }
+
+  std::mutex Mutex;
+  std::condition_variable Cv;
+  bool Open = false;
+};
+
+} // namespace
+
+TEST(Quarantine, IdleThreadsStayWithinBound) {
+  constexpr size_t MaxSize = 1600;
+  constexpr size_t MaxBatchSize = MaxSize / 16;
+  constexpr size_t NumThreads = 64;
+
+  Released Released;
+  std::vector<std::shared_ptr<AllocInfo>> AllocInfos;
+  for (size_t I = 0; I < NumThreads; I++) {
+    AllocInfos.emplace_back(makeAlloc(MaxBatchSize / 2 + 10));
+  }
+
+  Quarantine Quarantine(MaxSize, Released.callback());
+  Gate Done;
+  std::vector<std::thread> Threads;
+  std::mutex PutMutex;
+  std::condition_variable PutCv;
+  size_t NumPut = 0;
+  for (size_t I = 0; I < NumThreads; I++) {
+    Threads.emplace_back([&, I]() {
+      // Each thread only frees a bit less than a batch and then idles
+      Quarantine.put(AllocInfos[I]);
+      {
+        std::scoped_lock<std::mutex> Guard(PutMutex);
+        NumPut++;
+      }
+      PutCv.notify_all();
+      Done.wait();
+    });
+  }
+  {
+    std::unique_lock<std::mutex> Lock(PutMutex);
+    PutCv.wait(Lock, [&]() { return NumPut == NumThreads; });
+  }
+
+  EXPECT_LE(Quarantine.size(), MaxSize + 2 * MaxBatchSize);
+  EXPECT_TRUE(Released.waitFor(AllocInfos.front()));
+
+  Done.open();
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+  EXPECT_LE(Quarantine.size(), MaxSize + 2 * MaxBatchSize);
+}
+
+TEST(Quarantine, EvictsBatchesOfOtherThreads) {
+  constexpr size_t MaxSize = 1600;
+  constexpr size_t MaxBatchSize = MaxSize / 16;
+
+  Released Released;
+  Quarantine Quarantine(MaxSize, Released.callback());
+  auto Idle = makeAlloc(10);
+  Gate Put, Done;
+  std::thread Thread([&]() {
+    Quarantine.put(Idle);
+    Put.open();
+    Done.wait();
+  });
+  Put.wait();
+
+  // Frees of this thread push the idle thread's batch out, and then evict it
+  for (size_t I = 0; I < 16 * MaxSize / MaxBatchSize; I++) {
+    auto AI = makeAlloc(MaxBatchSize / 4);
+    Quarantine.put(AI);
+  }
+  EXPECT_TRUE(Released.waitFor(Idle));
+
+  Done.open();
+  Thread.join();
+}
+
+TEST(Quarantine, FlushesBatchOnThreadExit) {
+  constexpr size_t MaxSize = 1600;
+
+  Released Released;
+  Quarantine Quarantine(MaxSize, Released.callback());
+  auto Exited = makeAlloc(10);
+  std::thread([&]() { Quarantine.put(Exited); }).join();
+  EXPECT_EQ(Quarantine.size(), 10);
+
+  // Batches of at least a quarantine are flushed right away, and evict what
+  // was flushed before them
+  for (int I = 0; I < 2; I++) {
+    auto AI = makeAlloc(MaxSize);
+    Quarantine.put(AI);
+  }
+  EXPECT_TRUE(Released.waitFor(Exited));
+}
+
+TEST(Quarantine, DrainReleasesContext) {
+  constexpr size_t MaxSize = 1600;
+  constexpr size_t MaxBatchSize = MaxSize / 16;
+
+  Released Released;
+  Quarantine Quarantine(MaxSize, Released.callback());
+
+  // Allocations of both contexts in the batch of an idle thread, in the
+  // device cache and on their way to the evictor
+  std::vector<std::shared_ptr<AllocInfo>> OfA, OfB;
+  Gate Put, Done;
+  std::thread Thread([&]() {
+    auto A = makeAlloc(10, ContextA);
+    auto B = makeAlloc(10, ContextB);
+    Quarantine.put(A);
+    Quarantine.put(B);
+    OfA.emplace_back(A);
+    OfB.emplace_back(B);
+    Put.open();
+    Done.wait();
+  });
+  Put.wait();
+  for (size_t I = 0; I < 2 * MaxSize / MaxBatchSize; I++) {
+    auto A = makeAlloc(MaxBatchSize, ContextA);
+    auto B = makeAlloc(MaxBatchSize, ContextB);
+    Quarantine.put(A);
+    Quarantine.put(B);
+    OfA.emplace_back(A);
+    OfB.emplace_back(B);
+  }
+
+  Quarantine.drain(ContextA);
+  for (auto &AI : OfA) {
+    EXPECT_TRUE(Released.contains(AI));
+  }
+  // Whatever is left in the quarantine belongs to the other context
+  size_t HeldOfB = 0;
+  for (auto &AI : OfB) {
+    if (!Released.contains(AI)) {
+      HeldOfB += AI->AllocSize;
+    }
+  }
+  EXPECT_GT(HeldOfB, 0);
+  EXPECT_LE(Quarantine.size(), HeldOfB);
+
+  Done.open();
+  Thread.join();
+}
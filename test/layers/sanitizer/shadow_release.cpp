@@ -0,0 +1,115 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file shadow_release.cpp
+ *
+ */
+
+#include "asan/asan_libdevice.hpp"
+#include "sanitizer_common/sanitizer_common.hpp"
+
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+constexpr uptr PageSize = 4096;
+constexpr uptr ShadowSize = 64 * 1024 * 1024;
+const u8 FreedMagic = static_cast<u8>(kUsmDeviceDeallocatedMagic);
+
+// Shadow memory as set up by the CPU shadow, with the shadow of a released
+// allocation in [Begin, Begin + Size) and live neighbours around it.
+struct ShadowReleaseTest : ::testing::Test {
+  void SetUp() override {
+    Shadow = MmapNoReserve(0, ShadowSize);
+    ASSERT_NE(Shadow, 0);
+  }
+
+  void TearDown() override { Munmap(Shadow, ShadowSize); }
+
+  void poison(uptr Begin, uptr Size, u8 Value) {
+    std::memset(reinterpret_cast<void *>(Begin), Value, Size);
+  }
+
+  // Returns the first byte in [Begin, Begin + Size) that isn't Value
+  uptr findOther(uptr Begin, uptr Size, u8 Value) {
+    for (uptr I = 0; I < Size; I++) {
+      if (reinterpret_cast<u8 *>(Begin)[I] != Value) {
+        return Begin + I;
+      }
+    }
+    return 0;
+  }
+
+  uptr Shadow = 0;
+};
+
+} // namespace
+
+// After an allocation leaves the quarantine, its shadow is released but has to
+// keep reading as deallocated, otherwise a use-after-free of it would pass the
+// shadow check unreported.
+TEST_F(ShadowReleaseTest, ReleasedShadowStaysPoisoned) {
+  const uptr Begin = Shadow + PageSize + 0x123;
+  const uptr Size = 8 * 1024 * 1024;
+  poison(Shadow, Begin - Shadow, 0);
+  poison(Begin, Size, FreedMagic);
+  poison(Begin + Size, PageSize, 0);
+
+  auto ResidentBefore = GetResidentSize(Shadow, ShadowSize);
+  auto Released = ReleasePoisonedPagesToOS(Begin, Size, FreedMagic);
+  ASSERT_GT(Released, Size - 2 * PageSize);
+  ASSERT_LE(Released, Size);
+  ASSERT_LT(GetResidentSize(Shadow, ShadowSize), ResidentBefore - Released / 2);
+
+  ASSERT_EQ(findOther(Begin, Size, FreedMagic), 0);
+  ASSERT_EQ(findOther(Shadow, Begin - Shadow, 0), 0);
+  ASSERT_EQ(findOther(Begin + Size, PageSize, 0), 0);
+  ASSERT_LT(GetResidentSize(Shadow, ShadowSize), ResidentBefore - Released / 2);
+}
+
+// Once the adapter hands the memory out again, its shadow is written as usual.
+TEST_F(ShadowReleaseTest, ReleasedShadowCanBeReused) {
+  const uptr Begin = Shadow + PageSize;
+  const uptr Size = 4 * 1024 * 1024;
+  poison(Begin, Size, FreedMagic);
+  ASSERT_GT(ReleasePoisonedPagesToOS(Begin, Size, FreedMagic), 0);
+
+  const uptr Reused = Begin + Size / 4;
+  poison(Reused, PageSize, 0);
+  ASSERT_EQ(findOther(Reused, PageSize, 0), 0);
+  ASSERT_EQ(findOther(Begin, Reused - Begin, FreedMagic), 0);
+  ASSERT_EQ(findOther(Reused + PageSize, Begin + Size - Reused - PageSize,
+                      FreedMagic),
+            0);
+
+  // Released again after it was written
+  poison(Begin, Size, FreedMagic);
+  ASSERT_GT(ReleasePoisonedPagesToOS(Begin, Size, FreedMagic), 0);
+  ASSERT_EQ(findOther(Begin, Size, FreedMagic), 0);
+}
+
+// Small ranges are not worth the mappings and keep their pages.
+TEST_F(ShadowReleaseTest, SmallRangesAreKept) {
+  const uptr Begin = Shadow + PageSize;
+  const uptr Size = 4 * PageSize;
+  poison(Begin, Size, FreedMagic);
+  ASSERT_EQ(ReleasePoisonedPagesToOS(Begin, Size, FreedMagic), 0);
+  ASSERT_EQ(findOther(Begin, Size, FreedMagic), 0);
+}
+
+TEST_F(ShadowReleaseTest, ZeroedShadowIsDropped) {
+  const uptr Begin = Shadow + PageSize;
+  const uptr Size = 4 * PageSize;
+  poison(Begin, Size, 0);
+  ASSERT_EQ(ReleasePoisonedPagesToOS(Begin, Size, 0), Size);
+  ASSERT_EQ(findOther(Begin, Size, 0), 0);
+}
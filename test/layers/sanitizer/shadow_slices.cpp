@@ -0,0 +1,156 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file shadow_slices.cpp
+ *
+ */
+
+#include "asan/asan_shadow_slices.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+using namespace ur_sanitizer_layer::asan;
+
+namespace {
+
+// Stands in for the device allocations made by the shadow memory.
+struct SliceAllocator {
+  std::atomic<uptr> Next{0x1000};
+
+  uptr acquire(ShadowSliceRing &Ring, size_t Size) {
+    uptr Begin = 0;
+    if (!Ring.TryAcquire(Size, Begin)) {
+      Begin = Next.fetch_add(Size);
+      Ring.Add(Begin, Size);
+    }
+    return Begin;
+  }
+};
+
+} // namespace
+
+TEST(ShadowSliceRing, ReusesReleasedSlices) {
+  ShadowSliceRing Ring;
+  SliceAllocator Allocator;
+
+  uptr First = Allocator.acquire(Ring, 0x100);
+  uptr Second = Allocator.acquire(Ring, 0x100);
+  ASSERT_NE(First, Second);
+
+  ShadowSliceRing::Slice Evicted;
+  ASSERT_FALSE(Ring.Release(First, Evicted));
+  ASSERT_EQ(Allocator.acquire(Ring, 0x80), First);
+
+  // Slices that are too small are not handed out
+  ASSERT_FALSE(Ring.Release(First, Evicted));
+  uptr Larger = Allocator.acquire(Ring, 0x200);
+  ASSERT_NE(Larger, First);
+  ASSERT_NE(Larger, Second);
+}
+
+TEST(ShadowSliceRing, PicksSmallestFittingSlice) {
+  ShadowSliceRing Ring;
+  SliceAllocator Allocator;
+
+  uptr Large = Allocator.acquire(Ring, 0x400);
+  uptr Small = Allocator.acquire(Ring, 0x100);
+  ShadowSliceRing::Slice Evicted;
+  Ring.Release(Large, Evicted);
+  Ring.Release(Small, Evicted);
+
+  ASSERT_EQ(Allocator.acquire(Ring, 0x100), Small);
+  ASSERT_EQ(Allocator.acquire(Ring, 0x100), Large);
+}
+
+TEST(ShadowSliceRing, EvictsSmallestFreeSlice) {
+  ShadowSliceRing Ring;
+  SliceAllocator Allocator;
+
+  std::vector<uptr> Slices;
+  for (size_t I = 0; I <= ShadowSliceRing::MaxFreeSlices; I++) {
+    Slices.push_back(Allocator.acquire(Ring, 0x100 * (I + 1)));
+  }
+
+  ShadowSliceRing::Slice Evicted;
+  for (size_t I = 0; I < ShadowSliceRing::MaxFreeSlices; I++) {
+    ASSERT_FALSE(Ring.Release(Slices[I + 1], Evicted));
+  }
+  ASSERT_TRUE(Ring.Release(Slices[0], Evicted));
+  ASSERT_EQ(Evicted.Begin, Slices[0]);
+  ASSERT_EQ(Evicted.Size, 0x100);
+
+  // Unknown slices are ignored
+  ASSERT_FALSE(Ring.Release(Slices[0], Evicted));
+
+  auto Remaining = Ring.TakeAll();
+  ASSERT_EQ(Remaining.size(), ShadowSliceRing::MaxFreeSlices);
+  ASSERT_TRUE(Ring.TakeAll().empty());
+}
+
+// Launches in flight at the same time must never share a slice.
+TEST(ShadowSliceRing, ConcurrentLaunchesGetDifferentSlices) {
+  constexpr size_t NumThreads = 8;
+  constexpr size_t LaunchesPerThread = 1000;
+
+  ShadowSliceRing Ring;
+  SliceAllocator Allocator;
+  std::mutex InFlightMutex;
+  std::set<uptr> InFlight;
+  std::atomic<size_t> Overlaps = 0;
+  std::atomic<size_t> Holding = 0;
+
+  std::vector<std::thread> Threads;
+  for (size_t T = 0; T < NumThreads; T++) {
+    Threads.emplace_back([&, T] {
+      auto start = [&](uptr Begin) {
+        std::scoped_lock<std::mutex> Guard(InFlightMutex);
+        if (!InFlight.insert(Begin).second) {
+          Overlaps++;
+        }
+      };
+
+      // Every thread holds a slice at the same time once
+      uptr First = Allocator.acquire(Ring, 0x100);
+      start(First);
+      Holding++;
+      while (Holding < NumThreads) {
+        std::this_thread::yield();
+      }
+      {
+        std::scoped_lock<std::mutex> Guard(InFlightMutex);
+        InFlight.erase(First);
+      }
+      ShadowSliceRing::Slice Evicted;
+      Ring.Release(First, Evicted);
+
+      for (size_t N = 0; N < LaunchesPerThread; N++) {
+        uptr Begin = Allocator.acquire(Ring, 0x100 * (1 + (T + N) % 4));
+        start(Begin);
+        std::this_thread::yield();
+        {
+          std::scoped_lock<std::mutex> Guard(InFlightMutex);
+          InFlight.erase(Begin);
+        }
+        Ring.Release(Begin, Evicted);
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  ASSERT_EQ(Overlaps, 0);
+  ASSERT_LE(Ring.TakeAll().size(), ShadowSliceRing::MaxFreeSlices);
+}
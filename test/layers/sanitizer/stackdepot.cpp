@@ -0,0 +1,124 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file stackdepot.cpp
+ *
+ */
+
+#include "sanitizer_common/sanitizer_stackdepot.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ur_sanitizer_layer;
+
+namespace {
+
+// The depot is shared by the whole process, so every test uses frames of its
+// own, tagged by Seed, and looks at the change of the stats only.
+std::vector<BacktraceFrame> makeStack(uptr Seed, uptr Index, uptr NumFrames) {
+  std::vector<BacktraceFrame> Frames;
+  for (uptr I = 0; I < NumFrames; I++) {
+    Frames.push_back(reinterpret_cast<BacktraceFrame>((Seed << 48) |
+                                                      (Index << 16) | (I + 1)));
+  }
+  return Frames;
+}
+
+} // namespace
+
+TEST(StackDepot, EmptyStack) {
+  ASSERT_EQ(StackDepotPut(nullptr, 0), 0);
+  auto Frames = makeStack(1, 0, 4);
+  ASSERT_EQ(StackDepotPut(Frames.data(), 0), 0);
+  ASSERT_TRUE(StackDepotGet(0).empty());
+}
+
+TEST(StackDepot, Deduplicates) {
+  auto Before = StackDepotGetStats();
+
+  auto First = makeStack(2, 0, 8);
+  auto FirstCopy = First;
+  auto Second = makeStack(2, 1, 8);
+  auto Prefix = makeStack(2, 0, 7);
+
+  StackId FirstId = StackDepotPut(First.data(), First.size());
+  ASSERT_NE(FirstId, 0);
+  ASSERT_EQ(StackDepotPut(FirstCopy.data(), FirstCopy.size()), FirstId);
+
+  StackId SecondId = StackDepotPut(Second.data(), Second.size());
+  StackId PrefixId = StackDepotPut(Prefix.data(), Prefix.size());
+  ASSERT_NE(SecondId, 0);
+  ASSERT_NE(PrefixId, 0);
+  ASSERT_NE(SecondId, FirstId);
+  ASSERT_NE(PrefixId, FirstId);
+
+  ASSERT_EQ(StackDepotGet(FirstId), First);
+  ASSERT_EQ(StackDepotGet(SecondId), Second);
+  ASSERT_EQ(StackDepotGet(PrefixId), Prefix);
+
+  auto After = StackDepotGetStats();
+  ASSERT_EQ(After.NumStacks - Before.NumStacks, 3);
+  ASSERT_GT(After.AllocatedSize, Before.AllocatedSize);
+}
+
+// Threads intern the same stacks in different orders and look them up while
+// others are still inserting. Every stack has to end up with one id that
+// all threads agree on.
+TEST(StackDepot, ConcurrentPutAndGet) {
+  constexpr uptr NumThreads = 8;
+  constexpr uptr NumStacks = 2000;
+
+  std::vector<std::vector<BacktraceFrame>> Stacks;
+  for (uptr I = 0; I < NumStacks; I++) {
+    Stacks.push_back(makeStack(3, I, 1 + I % 16));
+  }
+
+  auto Before = StackDepotGetStats();
+  std::vector<std::vector<StackId>> Ids(NumThreads,
+                                        std::vector<StackId>(NumStacks));
+  std::vector<uptr> Mismatches(NumThreads);
+
+  std::vector<std::thread> Threads;
+  for (uptr T = 0; T < NumThreads; T++) {
+    Threads.emplace_back([&, T] {
+      std::vector<uptr> Order(NumStacks);
+      for (uptr I = 0; I < NumStacks; I++) {
+        Order[I] = I;
+      }
+      std::shuffle(Order.begin(), Order.end(), std::mt19937(T));
+
+      for (uptr I : Order) {
+        StackId Id = StackDepotPut(Stacks[I].data(), Stacks[I].size());
+        Ids[T][I] = Id;
+        if (StackDepotGet(Id) != Stacks[I]) {
+          Mismatches[T]++;
+        }
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  for (uptr T = 0; T < NumThreads; T++) {
+    ASSERT_EQ(Mismatches[T], 0);
+    ASSERT_EQ(Ids[T], Ids[0]);
+  }
+  std::vector<StackId> Unique = Ids[0];
+  std::sort(Unique.begin(), Unique.end());
+  ASSERT_EQ(std::unique(Unique.begin(), Unique.end()), Unique.end());
+  ASSERT_NE(Unique.front(), 0);
+
+  auto After = StackDepotGetStats();
+  ASSERT_EQ(After.NumStacks - Before.NumStacks, NumStacks);
+}
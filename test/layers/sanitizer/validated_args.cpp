@@ -0,0 +1,96 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file validated_args.cpp
+ *
+ */
+
+#include "asan/asan_interceptor.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ur_sanitizer_layer;
+using namespace ur_sanitizer_layer::asan;
+
+namespace {
+
+const auto Context = reinterpret_cast<ur_context_handle_t>(0x10);
+const auto OtherContext = reinterpret_cast<ur_context_handle_t>(0x20);
+const auto Device = reinterpret_cast<ur_device_handle_t>(0x30);
+const auto OtherDevice = reinterpret_cast<ur_device_handle_t>(0x40);
+
+std::shared_ptr<AllocInfo> makeAlloc(uptr Begin) {
+  auto AI = std::make_shared<AllocInfo>();
+  AI->AllocBegin = Begin;
+  AI->UserBegin = Begin;
+  AI->UserEnd = Begin + 0x100;
+  AI->AllocSize = 0x100;
+  AI->Type = AllocType::DEVICE_USM;
+  AI->Context = Context;
+  AI->Device = Device;
+  return AI;
+}
+
+// Records the arguments as validated, the way the interceptor does after all
+// pointer arguments of a launch passed.
+void cache(KernelInfo::ValidatedArgsInfo &Validated, uint64_t ArgsVersion,
+           std::vector<std::shared_ptr<AllocInfo>> AllocInfos) {
+  Validated.ArgsVersion = ArgsVersion;
+  Validated.Context = Context;
+  Validated.Device = Device;
+  Validated.AllocInfos = std::move(AllocInfos);
+}
+
+} // namespace
+
+TEST(ValidatedArgs, NothingCachedInitially) {
+  KernelInfo::ValidatedArgsInfo Validated;
+  ASSERT_FALSE(Validated.isValid(0, Context, Device));
+}
+
+TEST(ValidatedArgs, ReusedWhileUnchanged) {
+  KernelInfo::ValidatedArgsInfo Validated;
+  cache(Validated, 3, {makeAlloc(0x1000), makeAlloc(0x2000)});
+  ASSERT_TRUE(Validated.isValid(3, Context, Device));
+  ASSERT_TRUE(Validated.isValid(3, Context, Device));
+}
+
+// Setting any argument again bumps the version of the kernel's arguments,
+// the new argument has to be validated before the next launch.
+TEST(ValidatedArgs, InvalidatedBySettingArguments) {
+  KernelInfo::ValidatedArgsInfo Validated;
+  cache(Validated, 3, {makeAlloc(0x1000)});
+  ASSERT_FALSE(Validated.isValid(4, Context, Device));
+
+  cache(Validated, 4, {makeAlloc(0x3000)});
+  ASSERT_TRUE(Validated.isValid(4, Context, Device));
+  ASSERT_FALSE(Validated.isValid(3, Context, Device));
+}
+
+// An argument whose allocation was freed since must be reported, even though
+// the argument itself didn't change.
+TEST(ValidatedArgs, InvalidatedByFreeingArguments) {
+  KernelInfo::ValidatedArgsInfo Validated;
+  auto Kept = makeAlloc(0x1000);
+  auto Freed = makeAlloc(0x2000);
+  cache(Validated, 1, {Kept, Freed});
+  ASSERT_TRUE(Validated.isValid(1, Context, Device));
+
+  Freed->IsReleased = true;
+  ASSERT_FALSE(Validated.isValid(1, Context, Device));
+}
+
+// Arguments are only valid for the context and device they were validated on.
+TEST(ValidatedArgs, InvalidatedByLaunchingElsewhere) {
+  KernelInfo::ValidatedArgsInfo Validated;
+  cache(Validated, 1, {makeAlloc(0x1000)});
+  ASSERT_FALSE(Validated.isValid(1, OtherContext, Device));
+  ASSERT_FALSE(Validated.isValid(1, Context, OtherDevice));
+  ASSERT_TRUE(Validated.isValid(1, Context, Device));
+}
@@ -0,0 +1,251 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file binary_trace.cpp
+ *
+ */
+
+#include "ur_tracing_binary.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ur_tracing_layer;
+
+namespace {
+
+struct BinaryTrace {
+  binary_trace_header_t header;
+  std::vector<char> data;
+
+  std::string name(uint32_t functionId) const {
+    const char *name = data.data() + header.nameTableOffset +
+                       functionId * BINARY_TRACE_NAME_SIZE;
+    return std::string(name, strnlen(name, BINARY_TRACE_NAME_SIZE));
+  }
+
+  std::vector<binary_trace_record_t> records() const {
+    std::vector<binary_trace_record_t> records;
+    for (uint64_t i = 0; i < header.recordCount; i++) {
+      binary_trace_record_t record;
+      std::memcpy(&record,
+                  data.data() + header.recordsOffset + i * sizeof(record),
+                  sizeof(record));
+      if (record.functionId != 0) {
+        records.push_back(record);
+      }
+    }
+    return records;
+  }
+};
+
+BinaryTrace readTrace(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  BinaryTrace trace{};
+  trace.data.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+  if (trace.data.size() >= sizeof(trace.header)) {
+    std::memcpy(&trace.header, trace.data.data(), sizeof(trace.header));
+  }
+  return trace;
+}
+
+struct BinaryTraceTest : ::testing::Test {
+  void SetUp() override {
+    path =
+        std::string(
+            ::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+        ".urtrace";
+  }
+
+  void TearDown() override { std::remove(path.c_str()); }
+
+  void call(BinaryTraceWriter &writer, uint32_t functionId, const char *name,
+            uint64_t handle) {
+    writer.begin(functionId, name);
+    writer.handles({reinterpret_cast<const void *>(handle)});
+    writer.end(UR_RESULT_SUCCESS);
+  }
+
+  std::string path;
+};
+
+} // namespace
+
+TEST_F(BinaryTraceTest, RecordsCalls) {
+  {
+    auto writer = BinaryTraceWriter::create(path, 1024);
+    ASSERT_NE(writer, nullptr);
+    call(*writer, 1, "urFirst", 0x10);
+    call(*writer, 2, "urSecond", 0x20);
+  }
+
+  auto trace = readTrace(path);
+  ASSERT_EQ(std::memcmp(trace.header.magic, BINARY_TRACE_MAGIC,
+                        sizeof(BINARY_TRACE_MAGIC)),
+            0);
+  ASSERT_EQ(trace.header.version, BINARY_TRACE_VERSION);
+  ASSERT_EQ(trace.header.overwrittenCount, 0);
+  ASSERT_EQ(trace.name(1), "urFirst");
+  ASSERT_EQ(trace.name(2), "urSecond");
+
+  auto records = trace.records();
+  ASSERT_EQ(records.size(), 2);
+  ASSERT_EQ(records[0].functionId, 1);
+  ASSERT_EQ(records[0].numHandles, 1);
+  ASSERT_EQ(records[0].handles[0], 0x10);
+  ASSERT_GE(records[0].end, records[0].begin);
+  ASSERT_EQ(records[1].functionId, 2);
+  ASSERT_LE(records[0].end, records[1].begin);
+}
+
+// The file has to be decodable while the writer is still open, in case the
+// traced process never gets to tear the layer down.
+TEST_F(BinaryTraceTest, DecodableBeforeTeardown) {
+  auto writer = BinaryTraceWriter::create(path, 1024);
+  ASSERT_NE(writer, nullptr);
+  call(*writer, 3, "urInFlight", 0x30);
+
+  auto trace = readTrace(path);
+  ASSERT_EQ(std::memcmp(trace.header.magic, BINARY_TRACE_MAGIC,
+                        sizeof(BINARY_TRACE_MAGIC)),
+            0);
+  ASSERT_EQ(trace.name(3), "urInFlight");
+  auto records = trace.records();
+  ASSERT_EQ(records.size(), 1);
+  ASSERT_EQ(records[0].handles[0], 0x30);
+}
+
+TEST_F(BinaryTraceTest, WrapsAround) {
+  constexpr uint64_t calls = 1000;
+  {
+    auto writer = BinaryTraceWriter::create(path, 1);
+    ASSERT_NE(writer, nullptr);
+    for (uint64_t i = 0; i < calls; i++) {
+      call(*writer, 1, "urCall", i);
+    }
+    ASSERT_EQ(writer->lostCount(), calls - writer->regionSize());
+  }
+
+  auto trace = readTrace(path);
+  ASSERT_GT(trace.header.overwrittenCount, 0);
+  auto records = trace.records();
+  ASSERT_EQ(records.size(), trace.header.recordCount);
+  ASSERT_LT(records.size(), calls);
+
+  // Only the most recent calls are kept
+  bool hasLast = false;
+  for (auto &record : records) {
+    ASSERT_GE(record.handles[0], calls - records.size());
+    hasLast |= record.handles[0] == calls - 1;
+  }
+  ASSERT_TRUE(hasLast);
+}
+
+TEST_F(BinaryTraceTest, ReopenWhileStillOpen) {
+#ifdef _WIN32
+  GTEST_SKIP() << "a mapped file can't be replaced on Windows, the layer only "
+                  "opens a new trace once the previous one was closed";
+#endif
+  auto first = BinaryTraceWriter::create(path, 1024);
+  ASSERT_NE(first, nullptr);
+  call(*first, 1, "urFirst", 0x10);
+
+  // Threads may still be recording into a writer that was replaced
+  auto second = BinaryTraceWriter::create(path, 1024);
+  ASSERT_NE(second, nullptr);
+  call(*first, 1, "urFirst", 0x10);
+  call(*second, 2, "urSecond", 0x20);
+  first.reset();
+  second.reset();
+
+  auto records = readTrace(path).records();
+  ASSERT_EQ(records.size(), 1);
+  ASSERT_EQ(records[0].functionId, 2);
+}
+
+// Threads record into regions of their own, none of their records may be
+// written over by another thread.
+TEST_F(BinaryTraceTest, ThreadsKeepTheirRecords) {
+  constexpr uint64_t numThreads = 8;
+  constexpr uint64_t calls = 5000;
+  {
+    auto writer = BinaryTraceWriter::create(path, numThreads * 1024);
+    ASSERT_NE(writer, nullptr);
+    ASSERT_EQ(writer->regionCount(), numThreads);
+
+    // Threads that exited hand their region to the next one, all of them
+    // have to be around until the last one is done to get one each.
+    std::atomic<uint64_t> done = 0;
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < numThreads; t++) {
+      threads.emplace_back([&, t] {
+        for (uint64_t i = 0; i < calls; i++) {
+          writer->begin(1, "urOuter");
+          call(*writer, 2, "urInner", (t << 32) | i);
+          writer->handles({reinterpret_cast<const void *>((t << 32) | i)});
+          writer->end(UR_RESULT_SUCCESS);
+        }
+        done++;
+        while (done < numThreads) {
+          std::this_thread::yield();
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(writer->lostCount(), numThreads * (2 * calls - 1024));
+  }
+
+  auto records = readTrace(path).records();
+  ASSERT_EQ(records.size(), numThreads * 1024);
+  std::map<uint32_t, uint64_t> threadOfId;
+  for (auto &record : records) {
+    ASSERT_EQ(record.numHandles, 1);
+    uint64_t thread = record.handles[0] >> 32;
+    ASSERT_EQ(threadOfId.emplace(record.threadId, thread).first->second,
+              thread);
+    ASSERT_GE(record.end, record.begin);
+    ASSERT_EQ(record.result, UR_RESULT_SUCCESS);
+    // Only the most recent calls of every thread are kept
+    ASSERT_GE(record.handles[0] & UINT32_MAX, calls - 1024 / 2 - 1);
+  }
+  ASSERT_EQ(threadOfId.size(), numThreads);
+}
+
+TEST_F(BinaryTraceTest, RegionsOfExitedThreadsAreReused) {
+  auto writer = BinaryTraceWriter::create(path, 1024);
+  ASSERT_NE(writer, nullptr);
+  ASSERT_EQ(writer->regionCount(), 1);
+
+  std::thread([&] { call(*writer, 1, "urFirst", 0x10); }).join();
+  std::thread([&] { call(*writer, 2, "urSecond", 0x20); }).join();
+  ASSERT_EQ(writer->lostCount(), 0);
+
+  // Threads past the last region are counted, not recorded
+  call(*writer, 3, "urThird", 0x30);
+  std::thread([&] { call(*writer, 4, "urFourth", 0x40); }).join();
+  ASSERT_EQ(writer->lostCount(), 1);
+  writer->flush();
+
+  auto records = readTrace(path).records();
+  ASSERT_EQ(records.size(), 3);
+  ASSERT_EQ(records[0].handles[0], 0x10);
+  ASSERT_EQ(records[1].handles[0], 0x20);
+  ASSERT_EQ(records[2].handles[0], 0x30);
+}
@@ -0,0 +1,67 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file codeloc_cache.cpp
+ *
+ */
+
+#include "ur_tracing_codeloc.hpp"
+
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace ur_tracing_layer;
+
+namespace {
+
+// Hands out a new fake event for every call, which the cache never
+// dereferences.
+uintptr_t eventsMade = 0;
+
+xpti_td *makeEvent(const char *, const char *, uint32_t, uint32_t) {
+  return reinterpret_cast<xpti_td *>(++eventsMade);
+}
+
+ur_code_location_t codeloc(const char *functionName, uint32_t lineNumber) {
+  return {functionName, "file.cpp", lineNumber, 1};
+}
+
+} // namespace
+
+TEST(CodelocEventCache, SameLocationReusesEvent) {
+  CodelocEventCache cache(makeEvent);
+  auto event = cache.get(codeloc("foo", 1));
+  ASSERT_EQ(cache.get(codeloc("foo", 1)), event);
+  ASSERT_NE(cache.get(codeloc("foo", 2)), event);
+  ASSERT_NE(cache.get(codeloc("bar", 1)), event);
+  ASSERT_EQ(cache.get(codeloc("foo", 1)), event);
+}
+
+// Callbacks may return their strings in a buffer they reuse.
+TEST(CodelocEventCache, ReusedBuffer) {
+  CodelocEventCache cache(makeEvent);
+  char name[8] = "foo";
+  auto first = cache.get(codeloc(name, 1));
+  std::strcpy(name, "bar");
+  auto second = cache.get(codeloc(name, 1));
+  ASSERT_NE(first, second);
+  ASSERT_EQ(cache.get(codeloc(name, 1)), second);
+}
+
+TEST(CodelocEventCache, EvictsLeastRecentlyUsed) {
+  CodelocEventCache cache(makeEvent, 2);
+  auto first = cache.get(codeloc("foo", 1));
+  auto second = cache.get(codeloc("foo", 2));
+  ASSERT_EQ(cache.get(codeloc("foo", 1)), first);
+
+  cache.get(codeloc("foo", 3));
+  ASSERT_EQ(cache.size(), 2u);
+  ASSERT_EQ(cache.get(codeloc("foo", 1)), first);
+  ASSERT_NE(cache.get(codeloc("foo", 2)), second);
+}
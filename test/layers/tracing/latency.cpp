@@ -0,0 +1,148 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file latency.cpp
+ *
+ */
+
+#include "ur_tracing_latency.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ur_tracing_layer;
+
+namespace {
+
+constexpr uint32_t firstId = 1;
+constexpr uint32_t secondId = 2;
+
+void call(FunctionLatencyTracker &tracker, uint32_t functionId,
+          const char *name) {
+  tracker.begin();
+  tracker.end(functionId, name);
+}
+
+int64_t countOf(FunctionLatencyTracker &tracker, const char *name) {
+  for (auto &[histogramName, histogram] : tracker.snapshot()) {
+    if (!std::strcmp(histogramName, name)) {
+      return histogram->total_count;
+    }
+  }
+  return 0;
+}
+
+} // namespace
+
+TEST(FunctionLatencyTracker, RecordsPerFunction) {
+  FunctionLatencyTracker tracker;
+  call(tracker, firstId, "urFirst");
+  call(tracker, firstId, "urFirst");
+  call(tracker, secondId, "urSecond");
+
+  ASSERT_EQ(countOf(tracker, "urFirst"), 2);
+  ASSERT_EQ(countOf(tracker, "urSecond"), 1);
+}
+
+TEST(FunctionLatencyTracker, NestedCalls) {
+  FunctionLatencyTracker tracker;
+  tracker.begin();
+  call(tracker, secondId, "urSecond");
+  tracker.end(firstId, "urFirst");
+
+  ASSERT_EQ(countOf(tracker, "urFirst"), 1);
+  ASSERT_EQ(countOf(tracker, "urSecond"), 1);
+}
+
+// Threads record into histograms of their own, and keep recording while
+// snapshots merge them and after the tracker was published.
+TEST(FunctionLatencyTracker, ConcurrentThreads) {
+  constexpr int numThreads = 8;
+  constexpr int callsPerThread = 10000;
+
+  FunctionLatencyTracker tracker;
+  std::atomic<bool> published = false;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numThreads; t++) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < callsPerThread; i++) {
+        call(tracker, firstId, "urFirst");
+      }
+    });
+  }
+  while (!published) {
+    tracker.snapshot();
+    if (countOf(tracker, "urFirst") > callsPerThread) {
+      tracker.publish();
+      published = true;
+    }
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(countOf(tracker, "urFirst"), numThreads * callsPerThread);
+}
+
+TEST(FunctionLatencyTracker, Query) {
+  FunctionLatencyTracker tracker;
+  ASSERT_FALSE(tracker.query("urFirst"));
+
+  call(tracker, firstId, "urFirst");
+  call(tracker, firstId, "urFirst");
+
+  auto values = tracker.query("urFirst");
+  ASSERT_TRUE(values);
+  ASSERT_EQ(values->count, 2);
+  ASSERT_LE(values->min, values->max);
+  ASSERT_FALSE(tracker.query("urSecond"));
+}
+
+// What threads recorded is kept after they exit.
+TEST(FunctionLatencyTracker, ExitedThreads) {
+  constexpr int numThreads = 4;
+
+  FunctionLatencyTracker tracker;
+  for (int t = 0; t < numThreads; t++) {
+    std::thread([&] { call(tracker, firstId, "urFirst"); }).join();
+  }
+  call(tracker, firstId, "urFirst");
+
+  ASSERT_EQ(countOf(tracker, "urFirst"), numThreads + 1);
+}
+
+// Threads may outlive the tracker they recorded for, and record into the
+// next one.
+TEST(FunctionLatencyTracker, ThreadOutlivesTracker) {
+  std::atomic<int> step = 0;
+  auto first = std::make_unique<FunctionLatencyTracker>();
+  FunctionLatencyTracker second;
+  std::thread thread([&] {
+    call(*first, firstId, "urFirst");
+    step = 1;
+    while (step != 2) {
+      std::this_thread::yield();
+    }
+    call(second, firstId, "urFirst");
+  });
+
+  while (step != 1) {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ(countOf(*first, "urFirst"), 1);
+  first.reset();
+  step = 2;
+  thread.join();
+
+  ASSERT_EQ(countOf(second, "urFirst"), 1);
+}
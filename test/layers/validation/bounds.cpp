@@ -0,0 +1,184 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.hpp"
+
+#include <chrono>
+#include <iostream>
+
+static std::atomic_size_t adapterQueryCount = 0;
+
+inline ur_result_t countingCallback(void *) {
+  adapterQueryCount++;
+  return UR_RESULT_SUCCESS;
+}
+
+// Reports every pointer as pointing into a device allocation of
+// untrackedAllocSize bytes starting at untrackedBase, to exercise the path
+// where the layer has to ask the adapter.
+static constexpr size_t untrackedAllocSize = 1024;
+static void *untrackedBase = nullptr;
+inline ur_result_t fakeUSM_urUSMGetMemAllocInfo(void *pParams) {
+  adapterQueryCount++;
+  const auto &params =
+      *static_cast<ur_usm_get_mem_alloc_info_params_t *>(pParams);
+  if (*params.ppropName == UR_USM_ALLOC_INFO_TYPE) {
+    *static_cast<ur_usm_type_t *>(*params.ppPropValue) = UR_USM_TYPE_DEVICE;
+  } else if (*params.ppropName == UR_USM_ALLOC_INFO_SIZE) {
+    *static_cast<size_t *>(*params.ppPropValue) = untrackedAllocSize;
+  } else if (*params.ppropName == UR_USM_ALLOC_INFO_BASE_PTR) {
+    *static_cast<void **>(*params.ppPropValue) = untrackedBase;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+struct valBoundsTest : valDeviceTest {
+  void SetUp() override {
+    valDeviceTest::SetUp();
+    ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+              UR_RESULT_SUCCESS);
+
+    mock::getCallbacks().set_before_callback("urQueueGetInfo",
+                                             &countingCallback);
+    mock::getCallbacks().set_before_callback("urUSMGetMemAllocInfo",
+                                             &countingCallback);
+    adapterQueryCount = 0;
+  }
+
+  void TearDown() override {
+    ASSERT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+    valDeviceTest::TearDown();
+  }
+
+  ur_result_t fill(void *ptr, size_t size) {
+    uint8_t pattern = 0;
+    return urEnqueueUSMFill(queue, ptr, sizeof(pattern), &pattern, size, 0,
+                            nullptr, nullptr);
+  }
+
+  ur_context_handle_t context = nullptr;
+  ur_queue_handle_t queue = nullptr;
+};
+
+TEST_F(valBoundsTest, testUSMFillTrackedAllocation) {
+  constexpr size_t allocSize = 256;
+  void *ptr = nullptr;
+  ASSERT_EQ(
+      urUSMDeviceAlloc(context, device, nullptr, nullptr, allocSize, &ptr),
+      UR_RESULT_SUCCESS);
+
+  auto interior = static_cast<uint8_t *>(ptr) + 64;
+  ASSERT_EQ(fill(ptr, allocSize), UR_RESULT_SUCCESS);
+  ASSERT_EQ(fill(ptr, allocSize + 1), UR_RESULT_ERROR_INVALID_SIZE);
+  ASSERT_EQ(fill(interior, allocSize - 64), UR_RESULT_SUCCESS);
+  ASSERT_EQ(fill(interior, allocSize - 63), UR_RESULT_ERROR_INVALID_SIZE);
+
+  // Neither the queue's context nor the allocation were looked up downstream.
+  ASSERT_EQ(adapterQueryCount, 0);
+
+  ASSERT_EQ(urUSMFree(context, ptr), UR_RESULT_SUCCESS);
+}
+
+TEST_F(valBoundsTest, testUSMFillUntrackedPointer) {
+  mock::getCallbacks().set_replace_callback("urUSMGetMemAllocInfo",
+                                            &fakeUSM_urUSMGetMemAllocInfo);
+
+  uint8_t buffer[untrackedAllocSize];
+  untrackedBase = buffer;
+  ASSERT_EQ(fill(buffer, untrackedAllocSize), UR_RESULT_SUCCESS);
+  ASSERT_EQ(fill(buffer, untrackedAllocSize + 1), UR_RESULT_ERROR_INVALID_SIZE);
+  ASSERT_GT(adapterQueryCount, 0);
+
+  // Interior pointers are checked against the rest of the allocation, the
+  // same as for tracked ones.
+  ASSERT_EQ(fill(buffer + 64, untrackedAllocSize - 64), UR_RESULT_SUCCESS);
+  ASSERT_EQ(fill(buffer + 64, untrackedAllocSize - 63),
+            UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+// Compares the cost of a bounds checked enqueue on an allocation known to the
+// layer with one that has to be resolved through the adapter, which is what
+// every USM pointer used to cost.
+TEST_F(valBoundsTest, benchmarkBoundsCheck) {
+  constexpr size_t iterations = 100000;
+  mock::getCallbacks().set_replace_callback("urUSMGetMemAllocInfo",
+                                            &fakeUSM_urUSMGetMemAllocInfo);
+
+  void *tracked = nullptr;
+  ASSERT_EQ(urUSMDeviceAlloc(context, device, nullptr, nullptr,
+                             untrackedAllocSize, &tracked),
+            UR_RESULT_SUCCESS);
+  uint8_t untracked[untrackedAllocSize];
+  untrackedBase = untracked;
+
+  auto measure = [&](void *ptr) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+      EXPECT_EQ(fill(ptr, untrackedAllocSize), UR_RESULT_SUCCESS);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           iterations;
+  };
+
+  double adapterQueryNs = measure(untracked);
+  double trackedNs = measure(tracked);
+  std::cout << "urEnqueueUSMFill with bounds checking: " << adapterQueryNs
+            << " ns/call querying the adapter, " << trackedNs
+            << " ns/call using tracked allocations\n";
+
+  ASSERT_EQ(urUSMFree(context, tracked), UR_RESULT_SUCCESS);
+}
+
+// Hands out reusedContext again, as adapters may do for the handle of a
+// released context, and keeps it alive across the releases in between.
+static ur_context_handle_t reusedContext = nullptr;
+inline ur_result_t reuseContext_urContextCreate(void *pParams) {
+  const auto &params = *static_cast<ur_context_create_params_t *>(pParams);
+  **params.pphContext = reusedContext;
+  return UR_RESULT_SUCCESS;
+}
+
+inline ur_result_t keepContext_urContextRelease(void *) {
+  return UR_RESULT_SUCCESS;
+}
+
+TEST_F(valBoundsTest, testReleasedQueueAndContextAreForgotten) {
+  constexpr size_t allocSize = 256;
+  void *ptr = nullptr;
+  ASSERT_EQ(
+      urUSMDeviceAlloc(context, device, nullptr, nullptr, allocSize, &ptr),
+      UR_RESULT_SUCCESS);
+
+  // The context is only forgotten once the last reference goes
+  ASSERT_EQ(urContextRetain(context), UR_RESULT_SUCCESS);
+  ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+  ASSERT_EQ(fill(ptr, allocSize), UR_RESULT_SUCCESS);
+  ASSERT_EQ(adapterQueryCount, 0);
+
+  reusedContext = context;
+  mock::getCallbacks().set_replace_callback("urContextRelease",
+                                            &keepContext_urContextRelease);
+  mock::getCallbacks().set_replace_callback("urContextCreate",
+                                            &reuseContext_urContextCreate);
+  ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+  ur_context_handle_t newContext = nullptr;
+  ASSERT_EQ(urContextCreate(1, &device, nullptr, &newContext),
+            UR_RESULT_SUCCESS);
+  ASSERT_EQ(newContext, context);
+  mock::getCallbacks().set_replace_callback("urContextRelease", nullptr);
+  mock::getCallbacks().set_replace_callback("urContextCreate", nullptr);
+
+  // Neither the allocation nor the queue of the released context may be
+  // taken for ones of the new context at the same address
+  ASSERT_EQ(fill(ptr, allocSize), UR_RESULT_SUCCESS);
+  ASSERT_GT(adapterQueryCount, 0);
+
+  ASSERT_EQ(urUSMFree(context, ptr), UR_RESULT_SUCCESS);
+}
@@ -102,3 +102,26 @@ TEST(Mock, Callbacks) {
       reinterpret_cast<ur_adapter_handle_t>(uintptr_t(0xF00DCAFE));
   ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
 }
+
+ur_result_t replaceUrQueueFinish(void *) { return UR_RESULT_SUCCESS; }
+
+TEST(Mock, CallbacksByFunctionId) {
+  auto &callbacks = mock::getCallbacks();
+  ASSERT_EQ(callbacks.get_replace_callback(UR_FUNCTION_QUEUE_FINISH), nullptr);
+
+  // Callbacks set by name and by function id end up in the same slot
+  callbacks.set_replace_callback("urQueueFinish", &replaceUrQueueFinish);
+  ASSERT_EQ(callbacks.get_replace_callback(UR_FUNCTION_QUEUE_FINISH),
+            &replaceUrQueueFinish);
+  ASSERT_EQ(callbacks.get_before_callback(UR_FUNCTION_QUEUE_FINISH), nullptr);
+  ASSERT_EQ(callbacks.get_after_callback(UR_FUNCTION_QUEUE_FINISH), nullptr);
+
+  callbacks.set_replace_callback(UR_FUNCTION_QUEUE_FINISH, nullptr);
+  ASSERT_EQ(callbacks.get_replace_callback("urQueueFinish"), nullptr);
+
+  // Entry points the mock adapter doesn't implement can't have callbacks
+  callbacks.set_replace_callback("urQueueFinishNotAFunction",
+                                 &replaceUrQueueFinish);
+  ASSERT_EQ(callbacks.get_replace_callback("urQueueFinishNotAFunction"),
+            nullptr);
+}
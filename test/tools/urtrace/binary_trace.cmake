@@ -0,0 +1,28 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#
+# binary_trace.cmake -- records a binary trace of a program with urtrace and
+# matches what `urtrace --decode` makes of it.
+#
+
+find_package(Python3 COMPONENTS Interpreter)
+
+set(TRACE_FILE ${CMAKE_CURRENT_BINARY_DIR}/binary_trace.urtrace)
+file(REMOVE ${TRACE_FILE})
+
+execute_process(
+    COMMAND ${Python3_EXECUTABLE} ${URTRACE} --libpath ${MOCK_DIR} --mock --binary-output ${TRACE_FILE} ${TEST_PROGRAM}
+    OUTPUT_QUIET
+    RESULT_VARIABLE RECORD_RESULT
+)
+if(RECORD_RESULT OR NOT EXISTS ${TRACE_FILE})
+    message(FATAL_ERROR "Failed: recording a binary trace of '${TEST_PROGRAM}' returned ${RECORD_RESULT}")
+endif()
+
+set(MODE stdout)
+set(TEST_FILE ${Python3_EXECUTABLE})
+set(TEST_ARGS "${URTRACE} --stdout --decode ${TRACE_FILE}")
+include(${CMAKE_CURRENT_LIST_DIR}/../../../cmake/match.cmake)
@@ -0,0 +1,71 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+ * Exceptions. See LICENSE.TXT
+ *
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file hello_enqueue.cpp
+ *
+ * Enqueues a fill without an event and a copy with one on the first device,
+ * for testing what urtrace captures of commands that run on the device.
+ *
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#include "ur_api.h"
+
+#define CHECK(Call)                                                            \
+  do {                                                                         \
+    ur_result_t Result = Call;                                                 \
+    if (Result != UR_RESULT_SUCCESS) {                                         \
+      std::cout << #Call << " failed with return code: " << Result             \
+                << std::endl;                                                  \
+      return EXIT_FAILURE;                                                     \
+    }                                                                          \
+  } while (0)
+
+int main() {
+  CHECK(urLoaderInit(0, nullptr));
+
+  ur_adapter_handle_t Adapter = nullptr;
+  ur_platform_handle_t Platform = nullptr;
+  ur_device_handle_t Device = nullptr;
+  ur_context_handle_t Context = nullptr;
+  ur_queue_handle_t Queue = nullptr;
+  CHECK(urAdapterGet(1, &Adapter, nullptr));
+  CHECK(urPlatformGet(&Adapter, 1, 1, &Platform, nullptr));
+  CHECK(urDeviceGet(Platform, UR_DEVICE_TYPE_ALL, 1, &Device, nullptr));
+  CHECK(urContextCreate(1, &Device, nullptr, &Context));
+  CHECK(urQueueCreate(Context, Device, nullptr, &Queue));
+
+  constexpr size_t Size = 1024;
+  void *Src = nullptr;
+  void *Dst = nullptr;
+  CHECK(urUSMHostAlloc(Context, nullptr, nullptr, Size, &Src));
+  CHECK(urUSMHostAlloc(Context, nullptr, nullptr, Size, &Dst));
+
+  const uint32_t Pattern = 42;
+  CHECK(urEnqueueUSMFill(Queue, Src, sizeof(Pattern), &Pattern, Size, 0,
+                         nullptr, nullptr));
+  ur_event_handle_t Event = nullptr;
+  CHECK(urEnqueueUSMMemcpy(Queue, false, Dst, Src, Size, 0, nullptr, &Event));
+  CHECK(urEventWait(1, &Event));
+  CHECK(urEventRelease(Event));
+  CHECK(urQueueFinish(Queue));
+
+  std::cout << "Copied " << *static_cast<uint32_t *>(Dst) << ".\n";
+
+  CHECK(urUSMFree(Context, Dst));
+  CHECK(urUSMFree(Context, Src));
+  CHECK(urQueueRelease(Queue));
+  CHECK(urContextRelease(Context));
+  CHECK(urAdapterRelease(Adapter));
+  CHECK(urLoaderTearDown());
+
+  return EXIT_SUCCESS;
+}
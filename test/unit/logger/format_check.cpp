@@ -0,0 +1,18 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Built as C++20, where format strings of log sites are checked during
+// compilation. With UR_FORMAT_MISMATCH defined, this must fail to compile.
+
+#include "logger/ur_logger_details.hpp"
+
+void logWithFormat(logger::Logger &logger) {
+  logger.error("{} {}", "Test", 42);
+  logger.debug("{{ {} }}", 42);
+#ifdef UR_FORMAT_MISMATCH
+  logger.debug("{} {}", 42);
+#endif
+}
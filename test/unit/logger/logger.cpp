@@ -51,6 +51,59 @@ TEST_F(DefaultLoggerWithFileSink, NoBraces) {
   test_msg << test_msg_prefix << "[ERROR]:  Test: 42\n";
 }
 
+TEST_F(DefaultLoggerWithFileSink, RuntimeFormatString) {
+  std::string fmt = "{{ {} }}: {}";
+  logger->error(fmt.c_str(), "Test", 42);
+  test_msg << test_msg_prefix << "[ERROR]: { Test }: 42\n";
+}
+
+TEST_F(DefaultLoggerWithFileSink, LegacyMessage) {
+  logger->error(logger::LegacyMessage("Legacy: {}"), "Test: {}", 42);
+  test_msg << test_msg_prefix << "[ERROR]: Test: 42\n";
+}
+
+TEST(FormatString, ParsedAtCompileTime) {
+  constexpr auto fmt =
+      logger::FormatString<const char *, int>("{{ {}: {}}} x").parse();
+  static_assert(fmt.isParsed());
+  // "{", " ", arg, ": ", arg, "}", " x"
+  static_assert(fmt.size() == 7);
+  static_assert(fmt[0].offset == 0 && fmt[0].length == 1);
+  static_assert(fmt[2].is_arg && fmt[4].is_arg);
+  static_assert(fmt[3].offset == 5 && fmt[3].length == 2);
+  static_assert(fmt[5].offset == 9 && fmt[5].length == 1);
+  static_assert(fmt[6].offset == 11 && fmt[6].length == 2);
+
+  constexpr auto no_args = logger::FormatString<>("No arguments").parse();
+  static_assert(no_args.isParsed() && no_args.size() == 1);
+
+  // Log sites only hold on to the string until the message is written
+  static_assert(sizeof(logger::FormatString<int, int, int>) <=
+                2 * sizeof(void *));
+
+  const char *runtime = "{}";
+  EXPECT_FALSE(logger::FormatString<int>(runtime).parse().isParsed());
+}
+
+// Log sites are only parsed once per thread, whichever other log sites are
+// written in between
+TEST(FormatString, ParsedOncePerThread) {
+  for (int i = 0; i < 3; i++) {
+    auto first = logger::FormatString<int>("first: {}").parsed();
+    auto second = logger::FormatString<int>("second {{ {} }}").parsed();
+    ASSERT_TRUE(first.isParsed());
+    ASSERT_TRUE(second.isParsed());
+    EXPECT_EQ(first.size(), 2);
+    // "second {", " ", arg, " }"
+    EXPECT_EQ(second.size(), 4);
+    EXPECT_TRUE(second[2].is_arg);
+    EXPECT_EQ(second[3].offset, 12);
+  }
+
+  const char *runtime = "{}";
+  EXPECT_FALSE(logger::FormatString<int>(runtime).parsed().isParsed());
+}
+
 TEST_F(DefaultLoggerWithFileSink, SetLevelDebug) {
   auto level = logger::Level::DEBUG;
   logger->setLevel(level);
@@ -113,6 +166,37 @@ TEST_F(UniquePtrLoggerWithFilesink, NestedFilePath) {
   test_msg << test_msg_prefix << "[WARNING]: Test message: success\n";
 }
 
+TEST_F(UniquePtrLoggerWithFilesink, AsyncFileSink) {
+  logger = std::make_unique<logger::Logger>(
+      logger::Level::DEBUG,
+      std::make_unique<logger::AsyncFileSink>(logger_name, file_path));
+
+  std::string str = "success";
+  logger->debug("Test message: {}", str);
+  logger->info("Deferred message: {} {} {}", 42, 3.8, 'c');
+  logger->error("Test message: {}", "success");
+  logger->warning("No arguments");
+
+  test_msg << test_msg_prefix << "[DEBUG]: Test message: success\n"
+           << test_msg_prefix << "[INFO]: Deferred message: 42 3.8 c\n"
+           << test_msg_prefix << "[ERROR]: Test message: success\n"
+           << test_msg_prefix << "[WARNING]: No arguments\n";
+}
+
+// A format string only known at runtime may be gone by the time the message
+// is written, so the message is formatted right away.
+TEST_F(UniquePtrLoggerWithFilesink, AsyncFileSinkRuntimeFormatString) {
+  logger = std::make_unique<logger::Logger>(
+      logger::Level::DEBUG,
+      std::make_unique<logger::AsyncFileSink>(logger_name, file_path));
+
+  std::string fmt = "Runtime message: {} {}";
+  logger->info(fmt.c_str(), 42, 3.8);
+  fmt.assign(fmt.size(), 'x');
+
+  test_msg << test_msg_prefix << "[INFO]: Runtime message: 42 3.8\n";
+}
+
 TEST_F(UniquePtrLoggerWithFilesinkFail, NullSink) {
   logger = std::make_unique<logger::Logger>(logger::Level::INFO, nullptr);
   logger->info("This should not be printed: {}", 42);
@@ -167,6 +251,50 @@ TEST_P(FileSinkLoggerMultipleThreads, Multithreaded) {
   }
 }
 
+//////////////////////////////////////////////////////////////////////////////
+TEST_P(FileSinkLoggerMultipleThreads, AsyncMultithreaded) {
+  std::vector<std::thread> threads;
+  auto local_logger = logger::Logger(
+      logger::Level::WARN,
+      std::make_unique<logger::AsyncFileSink>(logger_name, file_path, true));
+  constexpr int message_count = 50;
+
+  // Messages below the flush level, written by the background thread
+  for (int i = 0; i < thread_count; i++) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < message_count; ++j) {
+        local_logger.warn("Test message: {}", "it's a success");
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  threads.clear();
+
+  // Messages at the flush level, which wait until they are written. They must
+  // not overtake the messages of other threads logged before.
+  for (int i = 0; i < thread_count; i++) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < message_count; ++j) {
+        local_logger.error("Flushed test message: {}", "it's a success");
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 0; i < thread_count * message_count; ++i) {
+    test_msg << "Test message: it's a success\n";
+  }
+  for (int i = 0; i < thread_count * message_count; ++i) {
+    test_msg << "Flushed test message: it's a success\n";
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 INSTANTIATE_TEST_SUITE_P(
     ThreadCount, CommonLoggerWithMultipleThreads,
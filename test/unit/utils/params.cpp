@@ -9,8 +9,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <memory>
+#include <vector>
 
 #include "print.h"
+#include "ur_params_codec.hpp"
 #include "ur_print.hpp"
 
 TYPED_TEST(ParamsTest, Print) {
@@ -42,3 +44,128 @@ TEST(PrintBool, True) {
   out << value;
   EXPECT_STREQ(out.str().data(), "true");
 }
+
+template <typename T>
+void checkEncodedParams(ur_function_t function, T &params) {
+  std::ostringstream expected;
+  ASSERT_EQ(
+      ur::extras::printFunctionParams(expected, function, params.get_struct()),
+      UR_RESULT_SUCCESS);
+
+  std::vector<uint8_t> record;
+  ASSERT_EQ(
+      ur::extras::encodeFunctionParams(record, function, params.get_struct()),
+      UR_RESULT_SUCCESS);
+
+  std::ostringstream out;
+  ur_function_t decoded_function;
+  size_t record_size = 0;
+  ASSERT_EQ(ur::extras::decodeFunctionParams(out, record.data(), record.size(),
+                                             &decoded_function, &record_size),
+            UR_RESULT_SUCCESS);
+  EXPECT_EQ(decoded_function, function);
+  EXPECT_EQ(record_size, record.size());
+  EXPECT_EQ(out.str(), expected.str());
+}
+
+TEST(EncodeParams, Flags) {
+  UrLoaderInitParamsInvalidFlags params;
+  checkEncodedParams(UR_FUNCTION_LOADER_INIT, params);
+}
+
+TEST(EncodeParams, Ranges) {
+  UrPlatformGetTwoPlatforms params;
+  checkEncodedParams(UR_FUNCTION_PLATFORM_GET, params);
+}
+
+TEST(EncodeParams, EmptyRanges) {
+  UrPlatformGetEmptyArray params;
+  checkEncodedParams(UR_FUNCTION_PLATFORM_GET, params);
+}
+
+TEST(EncodeParams, Descriptors) {
+  UrUsmHostAllocParamsHostDesc params;
+  checkEncodedParams(UR_FUNCTION_USM_HOST_ALLOC, params);
+}
+
+TEST(EncodeParams, TaggedValue) {
+  UrDeviceGetInfoParamsName params;
+  checkEncodedParams(UR_FUNCTION_DEVICE_GET_INFO, params);
+}
+
+TEST(EncodeParams, String) {
+  struct {
+    ur_program_get_function_pointer_params_t params;
+    ur_device_handle_t device = (ur_device_handle_t)0xDEAFBEEFull;
+    ur_program_handle_t program = nullptr;
+    const char *name = "foo";
+    void *ptr = nullptr;
+    void **pptr = &ptr;
+    ur_program_get_function_pointer_params_t *get_struct() {
+      params.phDevice = &device;
+      params.phProgram = &program;
+      params.ppFunctionName = &name;
+      params.pppFunctionPointer = &pptr;
+      return &params;
+    }
+  } params;
+  std::ostringstream expected;
+  ur::extras::printFunctionParams(
+      expected, UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, params.get_struct());
+  EXPECT_THAT(expected.str(),
+              MatchesRegex(".*\\.pFunctionName = .+ \\(foo\\).*"));
+
+  std::vector<uint8_t> record;
+  ASSERT_EQ(ur::extras::encodeFunctionParams(
+                record, UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER,
+                params.get_struct()),
+            UR_RESULT_SUCCESS);
+  std::ostringstream out;
+  ASSERT_EQ(ur::extras::decodeFunctionParams(out, record.data(), record.size(),
+                                             nullptr, nullptr),
+            UR_RESULT_SUCCESS);
+  EXPECT_EQ(out.str(), expected.str());
+}
+
+TEST(EncodeParams, Truncated) {
+  UrPlatformGetTwoPlatforms params;
+  std::vector<uint8_t> record;
+  ASSERT_EQ(ur::extras::encodeFunctionParams(record, UR_FUNCTION_PLATFORM_GET,
+                                             params.get_struct()),
+            UR_RESULT_SUCCESS);
+
+  std::ostringstream out;
+  EXPECT_EQ(ur::extras::decodeFunctionParams(
+                out, record.data(), record.size() - 1, nullptr, nullptr),
+            UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST(EncodeParams, MultipleRecords) {
+  UrPlatformGetTwoPlatforms platform_get;
+  UrDeviceGetInfoParamsQueueFlag device_get_info;
+  std::vector<uint8_t> records;
+  ASSERT_EQ(ur::extras::encodeFunctionParams(records, UR_FUNCTION_PLATFORM_GET,
+                                             platform_get.get_struct()),
+            UR_RESULT_SUCCESS);
+  auto first_size = records.size();
+  ASSERT_EQ(ur::extras::encodeFunctionParams(records,
+                                             UR_FUNCTION_DEVICE_GET_INFO,
+                                             device_get_info.get_struct()),
+            UR_RESULT_SUCCESS);
+
+  std::ostringstream out;
+  ur_function_t function;
+  size_t record_size = 0;
+  ASSERT_EQ(ur::extras::decodeFunctionParams(
+                out, records.data(), records.size(), &function, &record_size),
+            UR_RESULT_SUCCESS);
+  EXPECT_EQ(function, UR_FUNCTION_PLATFORM_GET);
+  EXPECT_EQ(record_size, first_size);
+
+  ASSERT_EQ(ur::extras::decodeFunctionParams(out, records.data() + record_size,
+                                             records.size() - record_size,
+                                             &function, &record_size),
+            UR_RESULT_SUCCESS);
+  EXPECT_EQ(function, UR_FUNCTION_DEVICE_GET_INFO);
+  EXPECT_EQ(first_size + record_size, records.size());
+}
@@ -9,6 +9,8 @@
 
 #include <uur/fixtures.h>
 
+#include <ur_mock_helpers.hpp>
+
 using urUsmPoolDescriptorTest = uur::urMultiDeviceContextTest;
 
 UUR_INSTANTIATE_PLATFORM_TEST_SUITE(urUsmPoolDescriptorTest);
@@ -132,6 +134,51 @@ TEST_P(urUsmPoolManagerTest, poolManagerGetNonexistant) {
   }
 }
 
+static size_t nativeHandleQueryCount = 0;
+
+static ur_result_t countNativeHandleQueries(void *) {
+  nativeHandleQueryCount++;
+  return UR_RESULT_SUCCESS;
+}
+
+// Pool lookups happen on every USM allocation, for descriptors built from the
+// allocation's arguments rather than the ones returned by create().
+static usm::pool_descriptor allocationDescriptor(ur_context_handle_t hContext,
+                                                 ur_device_handle_t hDevice,
+                                                 ur_usm_type_t type,
+                                                 bool deviceReadOnly) {
+  usm::pool_descriptor desc{};
+  desc.hContext = hContext;
+  desc.hDevice = type == UR_USM_TYPE_HOST ? nullptr : hDevice;
+  desc.type = type;
+  desc.deviceReadOnly = deviceReadOnly;
+  return desc;
+}
+
+TEST_P(urUsmPoolManagerTest, poolManagerLookupDoesNotQueryAdapter) {
+  auto [ret, manager] = usm::pool_manager<usm::pool_descriptor>::create();
+  ASSERT_EQ(ret, UR_RESULT_SUCCESS);
+
+  for (auto &desc : poolDescriptors) {
+    ret = manager.addPool(desc, createMockPoolHandle());
+    ASSERT_EQ(ret, UR_RESULT_SUCCESS);
+  }
+
+  nativeHandleQueryCount = 0;
+  mock::getCallbacks().set_after_callback("urDeviceGetNativeHandle",
+                                          &countNativeHandleQueries);
+
+  for (auto &desc : poolDescriptors) {
+    auto hPoolOpt = manager.getPool(allocationDescriptor(
+        context, device, desc.type, desc.deviceReadOnly));
+    ASSERT_TRUE(hPoolOpt.has_value());
+    ASSERT_EQ(hPoolOpt.value(), manager.getPool(desc).value());
+  }
+
+  mock::getCallbacks().set_after_callback("urDeviceGetNativeHandle", nullptr);
+  ASSERT_EQ(nativeHandleQueryCount, 0);
+}
+
 TEST_P(urUsmPoolManagerTest, config) {
   // Check default config
   usm::DisjointPoolAllConfigs def;
@@ -6,6 +6,7 @@
 
 #include "urinfo.hpp"
 #include <cstdlib>
+#include <future>
 #include <iostream>
 #include <string>
 #include <string_view>
@@ -17,6 +18,8 @@ struct app {
   bool verbose = false;
   bool linear_ids = true;
   bool ignore_device_selector = false;
+  bool validation = true;
+  bool json = false;
   ur_loader_config_handle_t loaderConfig = nullptr;
   std::vector<ur_adapter_handle_t> adapters;
   std::unordered_map<ur_adapter_handle_t, std::vector<ur_platform_handle_t>>
@@ -37,14 +40,16 @@ struct app {
       }
     }
     UR_CHECK(urLoaderConfigCreate(&loaderConfig));
-    UR_CHECK(
-        urLoaderConfigEnableLayer(loaderConfig, "UR_LAYER_FULL_VALIDATION"));
+    if (validation) {
+      UR_CHECK(
+          urLoaderConfigEnableLayer(loaderConfig, "UR_LAYER_FULL_VALIDATION"));
+    }
     UR_CHECK(urLoaderInit(0, loaderConfig));
     enumerateDevices();
   }
 
   void parseArgs(int argc, const char **argv) {
-    static const char *usage = R"(usage: %s [-h] [-v] [-V]
+    static const char *usage = R"(usage: %s [-h] [-v] [-V] [--json]
 
 This tool enumerates Unified Runtime layers, adapters, platforms, and
 devices which are currently visible in the local execution environment.
@@ -57,6 +62,9 @@ options:
   --ignore-device-selector
                         do not use ONEAPI_DEVICE_SELECTOR to filter list of
                         devices
+  --no-validation       do not enable the validation layer, which is faster
+  --json                print adapters, platforms and devices as JSON instead,
+                        ignoring --verbose and --no-linear-ids
 )";
     for (int argi = 1; argi < argc; argi++) {
       std::string_view arg{argv[argi]};
@@ -72,6 +80,10 @@ options:
         linear_ids = false;
       } else if (arg == "--ignore-device-selector") {
         ignore_device_selector = true;
+      } else if (arg == "--no-validation") {
+        validation = false;
+      } else if (arg == "--json") {
+        json = true;
       } else {
         std::fprintf(stderr, "error: invalid argument: %s\n", argv[argi]);
         std::fprintf(stderr, usage, argv[0]);
@@ -85,6 +97,9 @@ options:
     uint32_t numAdapters = 0;
     UR_CHECK(urAdapterGet(0, nullptr, &numAdapters));
     if (numAdapters == 0) {
+      if (json) {
+        return;
+      }
       std::exit(0);
     }
     adapters.resize(numAdapters);
@@ -93,33 +108,85 @@ options:
     auto urDeviceGetFn =
         ignore_device_selector ? urDeviceGet : urDeviceGetSelected;
 
-    for (size_t adapterIndex = 0; adapterIndex < adapters.size();
-         adapterIndex++) {
-      auto adapter = adapters[adapterIndex];
+    // Adapters are independent of each other, and each can take a while to
+    // bring up its platforms and devices, so enumerate them in parallel.
+    // Workers mustn't exit the process, so failures are handed back to be
+    // reported once all of them are done.
+    struct adapterDevices {
+      std::vector<ur_platform_handle_t> platforms;
+      std::vector<std::vector<ur_device_handle_t>> devices;
+      const char *failedAction = nullptr;
+      ur_result_t error = UR_RESULT_SUCCESS;
+    };
+#define UR_CHECK_ADAPTER(ACTION)                                               \
+  if (auto error = ACTION) {                                                   \
+    result.failedAction = #ACTION;                                             \
+    result.error = error;                                                      \
+    return result;                                                             \
+  }                                                                            \
+  (void)0
+    auto enumerateAdapter = [urDeviceGetFn](ur_adapter_handle_t adapter) {
+      adapterDevices result;
       // Enumerate platforms
       uint32_t numPlatforms = 0;
-      UR_CHECK(urPlatformGet(&adapter, 1, 0, nullptr, &numPlatforms));
+      UR_CHECK_ADAPTER(urPlatformGet(&adapter, 1, 0, nullptr, &numPlatforms));
       if (numPlatforms == 0) {
-        continue;
+        return result;
       }
-      adapterPlatformsMap[adapter].resize(numPlatforms);
-      UR_CHECK(urPlatformGet(&adapter, 1, numPlatforms,
-                             adapterPlatformsMap[adapter].data(), nullptr));
+      result.platforms.resize(numPlatforms);
+      UR_CHECK_ADAPTER(urPlatformGet(&adapter, 1, numPlatforms,
+                                     result.platforms.data(), nullptr));
 
+      result.devices.resize(numPlatforms);
       for (size_t platformIndex = 0; platformIndex < numPlatforms;
            platformIndex++) {
-        auto platform = adapterPlatformsMap[adapter][platformIndex];
+        auto platform = result.platforms[platformIndex];
+        auto &devices = result.devices[platformIndex];
         // Enumerate devices
         uint32_t numDevices = 0;
-        UR_CHECK(urDeviceGetFn(platform, UR_DEVICE_TYPE_ALL, 0, nullptr,
-                               &numDevices));
+        UR_CHECK_ADAPTER(urDeviceGetFn(platform, UR_DEVICE_TYPE_ALL, 0, nullptr,
+                                       &numDevices));
         if (numDevices == 0) {
           continue;
         }
-        platformDevicesMap[platform].resize(numDevices);
-        UR_CHECK(urDeviceGetFn(platform, UR_DEVICE_TYPE_ALL, numDevices,
-                               platformDevicesMap[platform].data(), nullptr));
+        devices.resize(numDevices);
+        UR_CHECK_ADAPTER(urDeviceGetFn(platform, UR_DEVICE_TYPE_ALL, numDevices,
+                                       devices.data(), nullptr));
       }
+      return result;
+    };
+#undef UR_CHECK_ADAPTER
+
+    std::vector<std::future<adapterDevices>> futures;
+    for (auto adapter : adapters) {
+      futures.push_back(
+          std::async(std::launch::async, enumerateAdapter, adapter));
+    }
+    std::vector<adapterDevices> results;
+    for (auto &future : futures) {
+      results.push_back(future.get());
+    }
+
+    for (size_t adapterIndex = 0; adapterIndex < adapters.size();
+         adapterIndex++) {
+      auto &result = results[adapterIndex];
+      if (result.error) {
+        std::cerr << "error: " << result.failedAction
+                  << " failed: " << result.error << "\n";
+        std::exit(1);
+      }
+      if (result.platforms.empty()) {
+        continue;
+      }
+      for (size_t platformIndex = 0; platformIndex < result.platforms.size();
+           platformIndex++) {
+        auto &devices = result.devices[platformIndex];
+        if (!devices.empty()) {
+          platformDevicesMap[result.platforms[platformIndex]] =
+              std::move(devices);
+        }
+      }
+      adapterPlatformsMap[adapters[adapterIndex]] = std::move(result.platforms);
     }
   }
 
@@ -161,6 +228,46 @@ options:
     }
   }
 
+  void printJson() {
+    std::cout << "{\n  \"adapters\": [";
+    for (size_t adapterIndex = 0; adapterIndex < adapters.size();
+         adapterIndex++) {
+      auto adapter = adapters[adapterIndex];
+      auto &platforms = adapterPlatformsMap[adapter];
+      std::cout << (adapterIndex ? "," : "") << "\n    {\n"
+                << "      \"backend\": "
+                << urinfo::jsonString(urinfo::getAdapterBackend(adapter))
+                << ",\n      \"platforms\": [";
+      for (size_t platformIndex = 0; platformIndex < platforms.size();
+           platformIndex++) {
+        auto platform = platforms[platformIndex];
+        auto &devices = platformDevicesMap[platform];
+        std::cout << (platformIndex ? "," : "") << "\n        {\n"
+                  << "          \"name\": "
+                  << urinfo::jsonString(urinfo::getPlatformName(platform))
+                  << ",\n          \"devices\": [";
+        for (size_t deviceIndex = 0; deviceIndex < devices.size();
+             deviceIndex++) {
+          auto device = devices[deviceIndex];
+          std::cout << (deviceIndex ? "," : "") << "\n            {"
+                    << "\"type\": "
+                    << urinfo::jsonString(urinfo::getDeviceType(device))
+                    << ", \"name\": "
+                    << urinfo::jsonString(urinfo::getDeviceName(device))
+                    << ", \"version\": "
+                    << urinfo::jsonString(urinfo::getDeviceVersion(device))
+                    << ", \"driver_version\": "
+                    << urinfo::jsonString(
+                           urinfo::getDeviceDriverVersion(device))
+                    << "}";
+        }
+        std::cout << (devices.empty() ? "" : "\n          ") << "]\n        }";
+      }
+      std::cout << (platforms.empty() ? "" : "\n      ") << "]\n    }";
+    }
+    std::cout << (adapters.empty() ? "" : "\n  ") << "]\n}\n";
+  }
+
   void printDetail() {
     std::cout << "\n"
               << "[loader]:"
@@ -208,6 +315,10 @@ options:
 
 int main(int argc, const char **argv) {
   auto app = urinfo::app{argc, argv};
+  if (app.json) {
+    app.printJson();
+    return 0;
+  }
   app.printSummary();
   if (app.verbose) {
     app.printDetail();
@@ -9,6 +9,7 @@
 #include "ur_api.h"
 #include "ur_print.hpp"
 #include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
@@ -42,7 +43,7 @@ inline std::string stripPrefix(std::string_view value,
 }
 
 inline std::string getAdapterBackend(ur_adapter_handle_t adapter) {
-  ur_adapter_backend_t adapterBackend;
+  ur_adapter_backend_t adapterBackend = UR_ADAPTER_BACKEND_UNKNOWN;
   UR_CHECK(urAdapterGetInfo(adapter, UR_ADAPTER_INFO_BACKEND,
                             sizeof(ur_adapter_backend_t), &adapterBackend,
                             nullptr));
@@ -74,6 +75,9 @@ inline std::string getPlatformName(ur_platform_handle_t platform) {
   size_t nameSize = 0;
   UR_CHECK(urPlatformGetInfo(platform, UR_PLATFORM_INFO_NAME, 0, nullptr,
                              &nameSize));
+  if (nameSize == 0) {
+    return {};
+  }
   std::string name(nameSize, '\0');
   UR_CHECK(urPlatformGetInfo(platform, UR_PLATFORM_INFO_NAME, nameSize,
                              name.data(), &nameSize));
@@ -85,6 +89,9 @@ inline std::string getPlatformName(ur_platform_handle_t platform) {
 inline std::string getDeviceName(ur_device_handle_t device) {
   size_t nameSize = 0;
   UR_CHECK(urDeviceGetInfo(device, UR_DEVICE_INFO_NAME, 0, nullptr, &nameSize));
+  if (nameSize == 0) {
+    return {};
+  }
   std::string name(nameSize, '\0');
   UR_CHECK(urDeviceGetInfo(device, UR_DEVICE_INFO_NAME, nameSize, name.data(),
                            &nameSize));
@@ -97,6 +104,9 @@ inline std::string getDeviceVersion(ur_device_handle_t device) {
   size_t versionSize = 0;
   UR_CHECK(urDeviceGetInfo(device, UR_DEVICE_INFO_VERSION, 0, nullptr,
                            &versionSize));
+  if (versionSize == 0) {
+    return {};
+  }
   std::string name(versionSize, '\0');
   UR_CHECK(urDeviceGetInfo(device, UR_DEVICE_INFO_VERSION, versionSize,
                            name.data(), &versionSize));
@@ -109,6 +119,9 @@ inline std::string getDeviceDriverVersion(ur_device_handle_t device) {
   size_t driverVersionSize = 0;
   UR_CHECK(urDeviceGetInfo(device, UR_DEVICE_INFO_DRIVER_VERSION, 0, nullptr,
                            &driverVersionSize));
+  if (driverVersionSize == 0) {
+    return {};
+  }
   std::string name(driverVersionSize, '\0');
   UR_CHECK(urDeviceGetInfo(device, UR_DEVICE_INFO_DRIVER_VERSION,
                            driverVersionSize, name.data(), &driverVersionSize));
@@ -117,6 +130,23 @@ inline std::string getDeviceDriverVersion(ur_device_handle_t device) {
   return name;
 }
 
+inline std::string jsonString(std::string_view value) {
+  std::string quoted = "\"";
+  for (unsigned char c : value) {
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+      quoted += c;
+    } else if (c < 0x20) {
+      char escaped[7];
+      std::snprintf(escaped, sizeof(escaped), "\\u%.4x", c);
+      quoted += escaped;
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + "\"";
+}
+
 inline std::string getLoaderConfigInfoName(ur_loader_config_info_t info) {
   std::stringstream stream;
   stream << info;
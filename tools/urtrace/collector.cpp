@@ -13,22 +13,32 @@
  * function execution time.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <bitset>
 #include <cassert>
 #include <chrono>
+#include <iomanip>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <regex>
+#include <shared_mutex>
 #include <sstream>
-#include <stack>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include <hdr/hdr_histogram.h>
+
 #include "logger/ur_logger.hpp"
 #include "ur_api.h"
+#include "ur_params_codec.hpp"
 #include "ur_print.hpp"
 #include "ur_util.hpp"
 #include "xpti/xpti_trace_framework.h"
@@ -102,6 +112,15 @@ enum output_format {
 
 const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json"};
 
+enum summary_by {
+  SUMMARY_BY_FUNCTION,
+  SUMMARY_BY_QUEUE,
+  SUMMARY_BY_KERNEL,
+  MAX_SUMMARY_BY,
+};
+
+const char *summary_by_str[MAX_SUMMARY_BY] = {"function", "queue", "kernel"};
+
 /*
  * Since this is a library that gets loaded alongside the traced program, it
  * can't just accept arguments from the trace CLI tool directly. Instead, the
@@ -114,6 +133,11 @@ const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json"};
  * - "time_unit:<auto,ns, ...>"
  * - "filter:<regex>"
  * - "json"
+ * - "buffered"
+ * - "summary"
+ * - "summary_by:<function,queue,kernel>"
+ * - "summary_interval:<seconds>"
+ * - "timeline"
  */
 static class cli_args {
   std::optional<std::string>
@@ -138,12 +162,23 @@ public:
     filter = std::nullopt;
     filter_str = std::nullopt;
     output_format = OUTPUT_HUMAN_READABLE;
+    buffered = false;
+    summary = false;
+    summary_by = SUMMARY_BY_FUNCTION;
+    summary_interval = std::chrono::seconds(0);
+    timeline = false;
     if (auto args = getenv_to_map(ARGS_ENV, false)) {
       for (auto [arg_name, arg_values] : *args) {
         if (arg_name == "print_begin") {
           print_begin = true;
         } else if (arg_name == "json") {
           output_format = OUTPUT_JSON;
+        } else if (arg_name == "buffered") {
+          buffered = true;
+        } else if (arg_name == "summary") {
+          summary = true;
+        } else if (arg_name == "timeline") {
+          timeline = true;
         } else if (arg_name == "profiling") {
           profiling = true;
         } else if (arg_name == "no_args") {
@@ -156,6 +191,21 @@ public:
               break;
             }
           }
+        } else if (auto by =
+                       arg_with_value("summary_by", arg_name, arg_values)) {
+          for (int i = 0; i < MAX_SUMMARY_BY; ++i) {
+            if (summary_by_str[i] == by) {
+              summary_by = (enum summary_by)i;
+              break;
+            }
+          }
+        } else if (auto interval = arg_with_value("summary_interval", arg_name,
+                                                  arg_values)) {
+          try {
+            summary_interval = std::chrono::seconds(std::stoul(*interval));
+          } catch (const std::exception &) {
+            out.warn("invalid summary interval {}", *interval);
+          }
         } else if (auto filter_str =
                        arg_with_value("filter", arg_name, arg_values)) {
           try {
@@ -169,10 +219,13 @@ public:
       }
     }
     out.debug("collector args (.print_begin = {}, .profiling = {}, "
-              ".time_unit = {}, .filter = {}, .output_format = {})",
+              ".time_unit = {}, .filter = {}, .output_format = {}, "
+              ".buffered = {}, .summary = {}, .summary_by = {}, "
+              ".summary_interval = {}s, .timeline = {})",
               print_begin, profiling, time_unit_str[time_unit],
               filter_str.has_value() ? *filter_str : "none",
-              output_format_str[output_format]);
+              output_format_str[output_format], buffered, summary,
+              summary_by_str[summary_by], summary_interval.count(), timeline);
   }
 
   enum time_unit time_unit;
@@ -180,6 +233,12 @@ public:
   bool profiling;
   bool no_args;
   enum output_format output_format;
+  bool buffered;
+  bool summary;
+  enum summary_by summary_by;
+  // Zero if only the summary of the whole run is printed at exit
+  std::chrono::seconds summary_interval;
+  bool timeline;
   std::optional<std::string>
       filter_str; // the filter_str is kept primarily for printing.
   std::optional<std::regex> filter;
@@ -188,38 +247,337 @@ public:
 typedef std::chrono::steady_clock Clock;
 typedef std::chrono::time_point<Clock> Timepoint;
 
+// Deepest nesting of traced calls on a single thread, calls nested any deeper
+// are not traced
+constexpr size_t MAX_CALL_DEPTH = 64;
+
+// Buffered output of a thread is written out once it grows beyond this size
+constexpr size_t MAX_BUFFERED_OUTPUT = 4 * 1024 * 1024;
+
+struct fn_context {
+  uint64_t instance;
+  Timepoint start;
+};
+
+// Buffered lines with a record of their arguments have them decoded and
+// inserted at args_at once they are written out
+constexpr size_t NO_RECORD = ~size_t{0};
+
+struct buffered_line {
+  Timepoint tp;
+  size_t offset;
+  size_t size;
+  size_t args_at;
+  size_t record;
+};
+
+using histogram_ptr =
+    std::unique_ptr<struct hdr_histogram, decltype(&hdr_close)>;
+
+/*
+ * What calls are aggregated by in the summary: the function and, depending on
+ * summary_by, the queue handle or the interned name of the launched kernel.
+ */
+struct summary_key {
+  uint32_t function_id;
+  const char *function_name;
+  const void *object;
+
+  bool operator==(const summary_key &other) const {
+    return function_id == other.function_id && object == other.object;
+  }
+};
+
+struct summary_key_hash {
+  size_t operator()(const summary_key &key) const {
+    return std::hash<const void *>()(key.object) * 31 + key.function_id;
+  }
+};
+
+/*
+ * Durations of the calls with the same key. The count, total and extremes are
+ * kept exactly, the histogram is only used for the percentiles.
+ */
+struct summary_entry {
+  histogram_ptr histogram{nullptr, &hdr_close};
+  uint64_t count = 0;
+  uint64_t total = 0;
+  uint64_t min = std::numeric_limits<uint64_t>::max();
+  uint64_t max = 0;
+
+  // Calls are expected to take between a nanosecond and 100 seconds, two
+  // significant figures keep a histogram at a few tens of KiB
+  static constexpr int64_t MAX_TRACKABLE_NS = 100'000'000'000;
+  static constexpr int SIGNIFICANT_FIGURES = 2;
+
+  bool init() {
+    struct hdr_histogram *h = nullptr;
+    if (hdr_init(1, MAX_TRACKABLE_NS, SIGNIFICANT_FIGURES, &h) != 0) {
+      return false;
+    }
+    histogram.reset(h);
+    return true;
+  }
+
+  void record(uint64_t ns) {
+    count++;
+    total += ns;
+    min = std::min(min, ns);
+    max = std::max(max, ns);
+    hdr_record_value(
+        histogram.get(),
+        std::clamp<int64_t>(static_cast<int64_t>(ns), 1, MAX_TRACKABLE_NS));
+  }
+
+  void add(const summary_entry &other) {
+    count += other.count;
+    total += other.total;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    hdr_add(histogram.get(), other.histogram.get());
+  }
+
+  void reset() {
+    count = 0;
+    total = 0;
+    min = std::numeric_limits<uint64_t>::max();
+    max = 0;
+    hdr_reset(histogram.get());
+  }
+};
+
+using summary_map =
+    std::unordered_map<summary_key, summary_entry, summary_key_hash>;
+
+/*
+ * Calls aggregated on a thread since the last summary. The mutex is only ever
+ * contended while an interval summary is collected.
+ */
+struct thread_summary {
+  std::mutex mutex;
+  summary_map entries;
+};
+
+/*
+ * Everything the callbacks need on a thread. States are owned by the
+ * collector rather than the thread, so that the output buffered by threads
+ * that already finished is still written out at exit.
+ */
+struct thread_state {
+  fn_context call_stack[MAX_CALL_DEPTH];
+  size_t depth = 0;
+  // Calls that were not traced because they were nested too deep
+  size_t skipped_depth = 0;
+  // Reused for formatting the output of every call
+  std::ostringstream line;
+  // Record of the arguments of the line being formatted, and where in the
+  // line they go, NO_RECORD if they were formatted already
+  std::vector<uint8_t> record;
+  size_t args_at = NO_RECORD;
+  // Output buffered by the thread, and the records of the arguments of the
+  // lines. The mutex is only ever contended while the output of all threads
+  // is written out.
+  std::mutex buffer_mutex;
+  std::string buffer;
+  std::vector<buffered_line> lines;
+  std::vector<uint8_t> records;
+  // Time spent in the collector callbacks, only ever updated by the thread
+  // but read by any
+  std::atomic<uint64_t> overhead_ns = 0;
+  std::atomic<uint64_t> calls = 0;
+
+  void add_overhead(std::chrono::nanoseconds overhead) {
+    overhead_ns.store(overhead_ns.load(std::memory_order_relaxed) +
+                          overhead.count(),
+                      std::memory_order_relaxed);
+  }
+  thread_summary summary;
+  // Storage for what the timeline passes to calls in place of the arguments
+  // of the application
+  ur_queue_properties_t queue_props;
+  ur_event_handle_t event = nullptr;
+  ur_event_handle_t *app_event = nullptr;
+};
+
+static std::mutex thread_states_mutex;
+static std::vector<std::unique_ptr<thread_state>> thread_states;
+
+static thread_state &get_thread_state() {
+  static thread_local thread_state *state = [] {
+    auto new_state = std::make_unique<thread_state>();
+    auto ptr = new_state.get();
+    std::scoped_lock<std::mutex> lock(thread_states_mutex);
+    thread_states.emplace_back(std::move(new_state));
+    return ptr;
+  }();
+  return *state;
+}
+
+/*
+ * Result of the filter regex for every function of the API, worked out once
+ * at startup so that calls only need a lookup.
+ */
+static class function_filter {
+  static constexpr size_t MAX_FUNCTION_ID = [] {
+    size_t count = 0;
+#define _UR_API_WITH_ID(api, id) count = std::max<size_t>(count, id + 1);
+#include "ur_api_funcs.def"
+#undef _UR_API_WITH_ID
+    return count;
+  }();
+  std::bitset<MAX_FUNCTION_ID> matching;
+
+public:
+  function_filter() {
+    if (!cli_args.filter) {
+      return;
+    }
+#define _UR_API_WITH_ID(api, id)                                               \
+  matching[id] = std::regex_match(#api, *cli_args.filter);
+#include "ur_api_funcs.def"
+#undef _UR_API_WITH_ID
+  }
+
+  bool matches(uint32_t function_id, const char *function_name) {
+    if (!cli_args.filter) {
+      return true;
+    }
+    if (function_id >= MAX_FUNCTION_ID) {
+      return std::regex_match(function_name, *cli_args.filter);
+    }
+    return matching[function_id];
+  }
+} function_filter;
+
+static void write_line(thread_state &state, Timepoint tp,
+                       std::string_view line);
+
+/*
+ * Writes the arguments of a call into the line. Buffered lines only keep a
+ * binary record of them instead, which is decoded when the line is written
+ * out, so that they are not formatted while the application runs.
+ */
+static void write_args(thread_state &state, std::ostream &line,
+                       const xpti::function_with_args_t *args) {
+  if (cli_args.no_args) {
+    line << "...";
+    return;
+  }
+  auto function = (enum ur_function_t)args->function_id;
+  if (cli_args.buffered && state.args_at == NO_RECORD) {
+    state.record.clear();
+    if (ur::extras::encodeFunctionParams(
+            state.record, function, args->args_data) == UR_RESULT_SUCCESS) {
+      state.args_at = static_cast<size_t>(line.tellp());
+      return;
+    }
+  }
+  ur::extras::printFunctionParams(line, function, args->args_data);
+}
+
+/*
+ * A command as it ran on the device, with its timestamps converted to
+ * nanoseconds since the epoch of Clock.
+ */
+struct device_span {
+  const char *function_name;
+  ur_queue_handle_t queue;
+  uint64_t queued;
+  uint64_t submit;
+  uint64_t start;
+  uint64_t end;
+};
+
 class TraceWriter {
 public:
   virtual ~TraceWriter() {}
   virtual void prologue() {}
   virtual void epilogue() {}
-  virtual void begin(uint64_t id, const char *fname, std::string args) = 0;
-  virtual void end(uint64_t id, const char *fname, std::string args,
-                   Timepoint tp, Timepoint start_tp,
-                   const ur_result_t *resultp) = 0;
+  virtual void begin(thread_state &state, uint64_t id,
+                     const xpti::function_with_args_t *fn, Timepoint tp) = 0;
+  virtual void end(thread_state &state, uint64_t id,
+                   const xpti::function_with_args_t *fn, Timepoint tp,
+                   Timepoint start_tp) = 0;
+  virtual void device(thread_state &, const device_span &) {}
+
+protected:
+  std::chrono::nanoseconds total_overhead(uint64_t &calls) {
+    std::chrono::nanoseconds overhead{0};
+    calls = 0;
+    std::scoped_lock<std::mutex> lock(thread_states_mutex);
+    for (auto &state : thread_states) {
+      overhead += std::chrono::nanoseconds(
+          state->overhead_ns.load(std::memory_order_relaxed));
+      calls += state->calls.load(std::memory_order_relaxed);
+    }
+    return overhead;
+  }
+
+  void print_overhead() {
+    uint64_t calls = 0;
+    auto overhead = total_overhead(calls);
+    out.info("collector overhead: {} in {} calls ({} per call)",
+             time_to_str(overhead, cli_args.time_unit), calls,
+             time_to_str(overhead / std::max<uint64_t>(calls, 1),
+                         cli_args.time_unit));
+  }
 };
 
 class HumanReadable : public TraceWriter {
-  void begin(uint64_t id, const char *fname, std::string args) override {
+public:
+  ~HumanReadable() override {
+    // Same workaround for xptiTraceFinish as in JsonWriter
+    try {
+      epilogue();
+    } catch (...) {
+    }
+  }
+  void epilogue() override {
+    if (cli_args.profiling) {
+      print_overhead();
+    }
+  }
+  void begin(thread_state &state, uint64_t id,
+             const xpti::function_with_args_t *fn, Timepoint tp) override {
     if (cli_args.print_begin) {
-      out.info("begin({}) - {}({});", id, fname, args);
+      auto &line = state.line;
+      line.str({});
+      line << "begin(" << id << ") - " << fn->function_name << "(";
+      write_args(state, line, fn);
+      line << ");";
+      write_line(state, tp, line.str());
     }
   }
-  void end(uint64_t id, const char *fname, std::string args, Timepoint tp,
-           Timepoint start_tp, const ur_result_t *resultp) override {
-    std::ostringstream prefix_str;
+  void end(thread_state &state, uint64_t id,
+           const xpti::function_with_args_t *fn, Timepoint tp,
+           Timepoint start_tp) override {
+    auto resultp = static_cast<const ur_result_t *>(fn->ret_data);
+    auto &line = state.line;
+    line.str({});
     if (cli_args.print_begin) {
-      prefix_str << "end(" << id << ") - ";
+      line << "end(" << id << ") - ";
     }
-
-    std::ostringstream profile_str;
+    line << fn->function_name << "(";
+    write_args(state, line, fn);
+    line << ") -> " << *resultp << ";";
     if (cli_args.profiling) {
       auto dur =
           std::chrono::duration_cast<std::chrono::nanoseconds>(tp - start_tp);
-      profile_str << " (" << time_to_str(dur, cli_args.time_unit) << ")";
+      line << " (" << time_to_str(dur, cli_args.time_unit) << ")";
     }
-    out.info("{}{}({}) -> {};{}", prefix_str.str(), fname, args, *resultp,
-             profile_str.str());
+    write_line(state, tp, line.str());
+  }
+  void device(thread_state &state, const device_span &span) override {
+    auto time = [](uint64_t ns) {
+      return time_to_str(std::chrono::nanoseconds(ns), cli_args.time_unit);
+    };
+    auto &line = state.line;
+    line.str({});
+    line << "device: " << span.function_name << "(.hQueue = " << span.queue
+         << ") queued for " << time(span.start - span.queued) << ", ran for "
+         << time(span.end - span.start) << ";";
+    write_line(state, Timepoint(std::chrono::nanoseconds(span.start)),
+               line.str());
   }
 };
 
@@ -242,43 +600,469 @@ public:
     // logic and printing commas at the front. Not worth it probably.
     out.info("{{\"name\": \"\", \"cat\": \"\", \"ph\": \"\", \"pid\": \"\", "
              "\"tid\": \"\", \"ts\": \"\"}}");
-    out.info("]\n}}");
+    uint64_t calls = 0;
+    auto overhead = total_overhead(calls);
+    out.info("],\n \"otherData\": {{\"collector_overhead_ns\": {}, "
+             "\"collector_calls\": {}}}\n}}",
+             overhead.count(), calls);
   }
-  void begin(uint64_t, const char *, std::string) override {}
+  void begin(thread_state &, uint64_t, const xpti::function_with_args_t *,
+             Timepoint) override {}
 
-  void end(uint64_t, const char *fname, std::string args, Timepoint tp,
-           Timepoint start_tp, const ur_result_t *) override {
+  void end(thread_state &state, uint64_t, const xpti::function_with_args_t *fn,
+           Timepoint tp, Timepoint start_tp) override {
     auto dur = tp - start_tp;
     auto ts_us = std::chrono::duration_cast<std::chrono::microseconds>(
-                     tp.time_since_epoch())
+                     start_tp.time_since_epoch())
                      .count();
     auto dur_us =
         std::chrono::duration_cast<std::chrono::microseconds>(dur).count();
-    out.info("{{\
-            \"cat\": \"UR\", \
-            \"ph\": \"X\",\
-            \"pid\": {},\
-            \"tid\": {},\
-            \"ts\": {},\
-            \"dur\": {},\
-            \"name\": \"{}\",\
-            \"args\": \"({})\"\
-        }},",
-             ur_getpid(), std::this_thread::get_id(), ts_us, dur_us, fname,
-             args);
+    auto &line = state.line;
+    line.str({});
+    line << "{            \"cat\": \"UR\",             \"ph\": \"X\","
+         << "            \"pid\": " << ur_getpid() << ","
+         << "            \"tid\": " << std::this_thread::get_id() << ","
+         << "            \"ts\": " << ts_us << ","
+         << "            \"dur\": " << dur_us << ","
+         << "            \"name\": \"" << fn->function_name << "\","
+         << "            \"args\": \"(";
+    write_args(state, line, fn);
+    line << ")\"        },";
+    write_line(state, tp, line.str());
+  }
+
+  // Device spans of a queue go on a track of their own, named after it. Only
+  // called by one thread at a time.
+  void device(thread_state &state, const device_span &span) override {
+    auto tid = reinterpret_cast<uintptr_t>(span.queue);
+    auto &line = state.line;
+    auto tp = Timepoint(std::chrono::nanoseconds(span.start));
+    if (queues.insert(tid).second) {
+      line.str({});
+      line << "{            \"name\": \"thread_name\",             \"ph\": "
+              "\"M\","
+           << "            \"pid\": " << ur_getpid() << ","
+           << "            \"tid\": " << tid << ","
+           << "            \"args\": {\"name\": \"queue " << span.queue
+           << "\"}        },";
+      write_line(state, tp, line.str());
+    }
+    line.str({});
+    line << std::fixed << std::setprecision(3)
+         << "{            \"cat\": \"UR device\",             \"ph\": \"X\","
+         << "            \"pid\": " << ur_getpid() << ","
+         << "            \"tid\": " << tid << ","
+         << "            \"ts\": " << span.start / 1000.0 << ","
+         << "            \"dur\": " << (span.end - span.start) / 1000.0 << ","
+         << "            \"name\": \"" << span.function_name << "\","
+         << "            \"args\": {\"queued\": " << span.queued / 1000.0
+         << ", \"submit\": " << span.submit / 1000.0 << "}        },";
+    line.unsetf(std::ios::floatfield);
+    line.precision(6);
+    write_line(state, tp, line.str());
+  }
+
+private:
+  std::unordered_set<uintptr_t> queues;
+};
+
+/*
+ * Writes out what all threads buffered, in the order the lines were written
+ * across threads. Must be called with thread_states_mutex held.
+ */
+static void flush_buffered_lines() {
+  std::vector<std::unique_lock<std::mutex>> locks;
+  std::vector<std::pair<thread_state *, buffered_line>> lines;
+  for (auto &state : thread_states) {
+    locks.emplace_back(state->buffer_mutex);
+    for (auto &line : state->lines) {
+      lines.emplace_back(state.get(), line);
+    }
+  }
+  std::stable_sort(lines.begin(), lines.end(), [](auto &lhs, auto &rhs) {
+    return lhs.second.tp < rhs.second.tp;
+  });
+  std::ostringstream args;
+  for (auto &[state, line] : lines) {
+    auto text = std::string_view(state->buffer).substr(line.offset, line.size);
+    if (line.record == NO_RECORD) {
+      out.info("{}", text);
+      continue;
+    }
+    args.str({});
+    ur_function_t function;
+    ur::extras::decodeFunctionParams(args, state->records.data() + line.record,
+                                     state->records.size() - line.record,
+                                     &function, nullptr);
+    out.info("{}{}{}", text.substr(0, line.args_at), args.str(),
+             text.substr(line.args_at));
+  }
+  for (auto &state : thread_states) {
+    state->buffer.clear();
+    state->lines.clear();
+    state->records.clear();
+  }
+}
+
+static void write_line(thread_state &state, Timepoint tp,
+                       std::string_view line) {
+  if (!cli_args.buffered) {
+    out.info("{}", line);
+    return;
+  }
+  size_t buffered = 0;
+  {
+    std::scoped_lock<std::mutex> lock(state.buffer_mutex);
+    size_t record = NO_RECORD;
+    if (state.args_at != NO_RECORD) {
+      record = state.records.size();
+      state.records.insert(state.records.end(), state.record.begin(),
+                           state.record.end());
+    }
+    state.lines.push_back(
+        {tp, state.buffer.size(), line.size(), state.args_at, record});
+    state.buffer.append(line);
+    buffered = state.buffer.size() + state.records.size();
+  }
+  state.args_at = NO_RECORD;
+  // Lines of other threads may come before the ones of this thread, so all
+  // of them are written out together
+  if (buffered > MAX_BUFFERED_OUTPUT) {
+    std::scoped_lock<std::mutex> lock(thread_states_mutex);
+    flush_buffered_lines();
+  }
+}
+
+/*
+ * Writes out whatever is still buffered before the epilogue, once the static
+ * writer is destroyed at exit.
+ */
+class BufferedWriter : public TraceWriter {
+public:
+  BufferedWriter(std::unique_ptr<TraceWriter> writer)
+      : writer(std::move(writer)) {}
+  ~BufferedWriter() override {
+    try {
+      std::scoped_lock<std::mutex> lock(thread_states_mutex);
+      flush_buffered_lines();
+    } catch (...) {
+    }
+  }
+  void prologue() override { writer->prologue(); }
+  void epilogue() override { writer->epilogue(); }
+  void begin(thread_state &state, uint64_t id,
+             const xpti::function_with_args_t *fn, Timepoint tp) override {
+    writer->begin(state, id, fn, tp);
+  }
+  void end(thread_state &state, uint64_t id,
+           const xpti::function_with_args_t *fn, Timepoint tp,
+           Timepoint start_tp) override {
+    writer->end(state, id, fn, tp, start_tp);
+  }
+  void device(thread_state &state, const device_span &span) override {
+    writer->device(state, span);
+  }
+
+private:
+  std::unique_ptr<TraceWriter> writer;
+};
+
+/*
+ * Aggregates the durations of calls instead of printing them, and prints a
+ * table with the count, total, mean, min, max and percentiles of every
+ * function at exit, as well as every summary_interval seconds if it is set.
+ */
+class SummaryWriter : public TraceWriter {
+public:
+  SummaryWriter() {
+    if (cli_args.summary_interval.count()) {
+      next_interval =
+          (Clock::now() + cli_args.summary_interval).time_since_epoch().count();
+    }
+  }
+  ~SummaryWriter() override {
+    // Same workaround for xptiTraceFinish as in JsonWriter
+    try {
+      epilogue();
+    } catch (...) {
+    }
+  }
+  void epilogue() override {
+    std::scoped_lock<std::mutex> lock(summary_mutex);
+    collect(total);
+    print("summary", total);
+    print_overhead();
+  }
+  void begin(thread_state &, uint64_t, const xpti::function_with_args_t *,
+             Timepoint) override {}
+  void end(thread_state &state, uint64_t, const xpti::function_with_args_t *fn,
+           Timepoint tp, Timepoint start_tp) override {
+    if (cli_args.summary_by == SUMMARY_BY_KERNEL) {
+      track_kernel_name(fn);
+    }
+
+    summary_key key{fn->function_id, fn->function_name, get_object(fn)};
+    auto ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(tp - start_tp)
+            .count());
+    {
+      std::scoped_lock<std::mutex> lock(state.summary.mutex);
+      auto [it, inserted] = state.summary.entries.try_emplace(key);
+      if (inserted && !it->second.init()) {
+        out.error("failed to initialize the histogram of {}",
+                  fn->function_name);
+        state.summary.entries.erase(it);
+        return;
+      }
+      it->second.record(ns);
+    }
+
+    if (cli_args.summary_interval.count()) {
+      auto now = tp.time_since_epoch().count();
+      auto next = next_interval.load(std::memory_order_relaxed);
+      if (now >= next &&
+          next_interval.compare_exchange_strong(
+              next, (tp + cli_args.summary_interval).time_since_epoch().count(),
+              std::memory_order_relaxed)) {
+        print_interval();
+      }
+    }
+  }
+
+private:
+  // Calls of every thread merged, guarded by summary_mutex
+  std::mutex summary_mutex;
+  summary_map total;
+  summary_map interval;
+  std::atomic<Timepoint::rep> next_interval{0};
+
+  // Kernel names interned, so that launches can be keyed by their name.
+  // Kernels are forgotten once they are released as often as they were
+  // created and retained, as their handles may be reused by other kernels.
+  struct kernel_name {
+    const std::string *name;
+    uint32_t refs;
+  };
+  std::shared_mutex kernel_names_mutex;
+  std::unordered_map<ur_kernel_handle_t, kernel_name> kernel_names;
+  std::unordered_set<std::string> interned_names;
+
+  void track_kernel_name(const xpti::function_with_args_t *fn) {
+    auto resultp = static_cast<const ur_result_t *>(fn->ret_data);
+    if (*resultp != UR_RESULT_SUCCESS) {
+      return;
+    }
+    switch (fn->function_id) {
+    case UR_FUNCTION_KERNEL_CREATE: {
+      auto params =
+          static_cast<const ur_kernel_create_params_t *>(fn->args_data);
+      if (!*params->ppKernelName || !*params->pphKernel) {
+        return;
+      }
+      std::unique_lock<std::shared_mutex> lock(kernel_names_mutex);
+      auto name = &*interned_names.emplace(*params->ppKernelName).first;
+      kernel_names[**params->pphKernel] = {name, 1};
+      break;
+    }
+    case UR_FUNCTION_KERNEL_RETAIN: {
+      auto params =
+          static_cast<const ur_kernel_retain_params_t *>(fn->args_data);
+      std::unique_lock<std::shared_mutex> lock(kernel_names_mutex);
+      auto it = kernel_names.find(*params->phKernel);
+      if (it != kernel_names.end()) {
+        it->second.refs++;
+      }
+      break;
+    }
+    case UR_FUNCTION_KERNEL_RELEASE: {
+      auto params =
+          static_cast<const ur_kernel_release_params_t *>(fn->args_data);
+      std::unique_lock<std::shared_mutex> lock(kernel_names_mutex);
+      auto it = kernel_names.find(*params->phKernel);
+      if (it != kernel_names.end() && --it->second.refs == 0) {
+        kernel_names.erase(it);
+      }
+      break;
+    }
+    default:
+      break;
+    }
+  }
+
+  const void *get_object(const xpti::function_with_args_t *fn) {
+    switch (cli_args.summary_by) {
+    case SUMMARY_BY_QUEUE: {
+      // All of these take the queue as their first parameter
+      std::string_view name = fn->function_name;
+      bool has_queue =
+          name.rfind("urEnqueue", 0) == 0 ||
+          (name.rfind("urQueue", 0) == 0 && name.rfind("urQueueCreate", 0));
+      if (has_queue) {
+        return **static_cast<ur_queue_handle_t *const *>(fn->args_data);
+      }
+      return nullptr;
+    }
+    case SUMMARY_BY_KERNEL: {
+      ur_kernel_handle_t kernel = nullptr;
+      switch (fn->function_id) {
+      case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH:
+        kernel = *static_cast<const ur_enqueue_kernel_launch_params_t *>(
+                      fn->args_data)
+                      ->phKernel;
+        break;
+      case UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP:
+        kernel =
+            *static_cast<
+                 const ur_enqueue_cooperative_kernel_launch_exp_params_t *>(
+                 fn->args_data)
+                 ->phKernel;
+        break;
+      case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP:
+        kernel =
+            *static_cast<const ur_enqueue_kernel_launch_custom_exp_params_t *>(
+                 fn->args_data)
+                 ->phKernel;
+        break;
+      default:
+        return nullptr;
+      }
+      std::shared_lock<std::shared_mutex> lock(kernel_names_mutex);
+      auto it = kernel_names.find(kernel);
+      return it != kernel_names.end() ? it->second.name : nullptr;
+    }
+    default:
+      return nullptr;
+    }
+  }
+
+  // Moves what threads aggregated since the last call into merged. Must be
+  // called with summary_mutex held.
+  void collect(summary_map &merged) {
+    std::scoped_lock<std::mutex> lock(thread_states_mutex);
+    for (auto &state : thread_states) {
+      std::scoped_lock<std::mutex> state_lock(state->summary.mutex);
+      for (auto &[key, entry] : state->summary.entries) {
+        if (!entry.count) {
+          continue;
+        }
+        auto [it, inserted] = merged.try_emplace(key);
+        if (inserted && !it->second.init()) {
+          merged.erase(it);
+          continue;
+        }
+        it->second.add(entry);
+        entry.reset();
+      }
+    }
+  }
+
+  void print_interval() {
+    std::scoped_lock<std::mutex> lock(summary_mutex);
+    collect(interval);
+    std::ostringstream title;
+    title << "summary of the last " << cli_args.summary_interval.count() << "s";
+    print(title.str(), interval);
+    for (auto &[key, entry] : interval) {
+      if (!entry.count) {
+        continue;
+      }
+      auto [it, inserted] = total.try_emplace(key);
+      if (inserted && !it->second.init()) {
+        total.erase(it);
+        continue;
+      }
+      it->second.add(entry);
+      entry.reset();
+    }
+  }
+
+  static std::string label(const summary_key &key) {
+    std::ostringstream label;
+    label << key.function_name;
+    if (key.object) {
+      if (cli_args.summary_by == SUMMARY_BY_KERNEL) {
+        label << " [" << *static_cast<const std::string *>(key.object) << "]";
+      } else {
+        label << " [" << key.object << "]";
+      }
+    }
+    return label.str();
+  }
+
+  static void print(std::string_view title, const summary_map &entries) {
+    std::vector<std::pair<std::string, const summary_entry *>> rows;
+    uint64_t calls = 0;
+    size_t width = std::string_view("function").size();
+    for (auto &[key, entry] : entries) {
+      if (!entry.count) {
+        continue;
+      }
+      rows.emplace_back(label(key), &entry);
+      width = std::max(width, rows.back().first.size());
+      calls += entry.count;
+    }
+    // Where the time went comes first
+    std::sort(rows.begin(), rows.end(), [](auto &lhs, auto &rhs) {
+      if (lhs.second->total != rhs.second->total) {
+        return lhs.second->total > rhs.second->total;
+      }
+      return lhs.first < rhs.first;
+    });
+
+    out.info("{} ({} calls):", title, calls);
+
+    constexpr int col = 12;
+    std::ostringstream line;
+    line << std::left << std::setw(width) << "function" << std::right;
+    for (auto name :
+         {"count", "total", "mean", "min", "p50", "p90", "p99", "max"}) {
+      line << std::setw(col) << name;
+    }
+    out.info("{}", line.str());
+
+    auto time = [](uint64_t ns) {
+      return time_to_str(std::chrono::nanoseconds(ns), cli_args.time_unit);
+    };
+    for (auto &[name, entry] : rows) {
+      // The histogram rounds values up to its precision
+      auto percentile = [&](double p) {
+        auto value = static_cast<uint64_t>(
+            hdr_value_at_percentile(entry->histogram.get(), p));
+        return time(std::clamp(value, entry->min, entry->max));
+      };
+      line.str({});
+      line << std::left << std::setw(width) << name << std::right
+           << std::setw(col) << entry->count << std::setw(col)
+           << time(entry->total) << std::setw(col)
+           << time(entry->total / entry->count) << std::setw(col)
+           << time(entry->min) << std::setw(col) << percentile(50.0)
+           << std::setw(col) << percentile(90.0) << std::setw(col)
+           << percentile(99.0) << std::setw(col) << time(entry->max);
+      out.info("{}", line.str());
+    }
   }
 };
 
 std::unique_ptr<TraceWriter> create_writer() {
+  if (cli_args.summary) {
+    return std::make_unique<SummaryWriter>();
+  }
+
+  std::unique_ptr<TraceWriter> writer;
   switch (cli_args.output_format) {
   case OUTPUT_HUMAN_READABLE:
-    return std::make_unique<HumanReadable>();
+    writer = std::make_unique<HumanReadable>();
+    break;
   case OUTPUT_JSON:
-    return std::make_unique<JsonWriter>();
+    writer = std::make_unique<JsonWriter>();
+    break;
   default:
     ur::unreachable();
   }
-  return nullptr;
+  if (cli_args.buffered) {
+    return std::make_unique<BufferedWriter>(std::move(writer));
+  }
+  return writer;
 }
 
 static std::unique_ptr<TraceWriter> &writer() {
@@ -287,70 +1071,317 @@ static std::unique_ptr<TraceWriter> &writer() {
   return writer;
 }
 
-struct fn_context {
-  uint64_t instance;
-  std::optional<Timepoint> start;
+// Set while the collector makes calls of its own, which are not traced
+static thread_local bool in_collector = false;
+
+struct collector_call_guard {
+  collector_call_guard() { in_collector = true; }
+  ~collector_call_guard() { in_collector = false; }
 };
 
-static thread_local std::stack<fn_context> instance_data;
+/*
+ * Captures when enqueued commands ran on the device. Queues are created with
+ * profiling enabled, and the events of enqueued commands are kept, asking
+ * adapters for one if the application didn't. Once the application waits for
+ * them, their profiling info is queried and written out as device spans.
+ */
+static class timeline {
+  // Commands keep their queue and event retained until they are written out,
+  // the application may release them before
+  struct command {
+    const char *function_name;
+    ur_queue_handle_t queue;
+    ur_event_handle_t event;
+  };
 
-fn_context *push_instance_data(uint64_t instance) {
-  instance_data.push(fn_context{instance, std::nullopt});
-  return &instance_data.top();
-}
+  // Commands kept before completed ones are written out without waiting
+  static constexpr size_t MAX_PENDING = 1024;
+
+  std::mutex mutex;
+  std::vector<command> pending;
+  // Commands that don't complete would otherwise make every enqueue query
+  // them all again, so the next flush waits until enough more were added
+  size_t flush_at = MAX_PENDING;
+  std::unordered_map<ur_device_handle_t, int64_t> device_offsets;
+  bool warned = false;
+
+  struct enqueue_params {
+    ur_queue_handle_t *phQueue;
+    ur_event_handle_t **pphEvent;
+  };
+
+  // All urEnqueue functions take the queue first and return the event last
+  static std::optional<enqueue_params>
+  get_enqueue_params(const xpti::function_with_args_t *fn) {
+#define ENQUEUE_PARAMS(NAME, name)                                             \
+  case UR_FUNCTION_ENQUEUE_##NAME: {                                           \
+    auto params = static_cast<ur_enqueue_##name##_params_t *>(fn->args_data);  \
+    return enqueue_params{params->phQueue, params->pphEvent};                  \
+  }
+    switch (fn->function_id) {
+      ENQUEUE_PARAMS(KERNEL_LAUNCH, kernel_launch)
+      ENQUEUE_PARAMS(EVENTS_WAIT, events_wait)
+      ENQUEUE_PARAMS(EVENTS_WAIT_WITH_BARRIER, events_wait_with_barrier)
+      ENQUEUE_PARAMS(MEM_BUFFER_READ, mem_buffer_read)
+      ENQUEUE_PARAMS(MEM_BUFFER_WRITE, mem_buffer_write)
+      ENQUEUE_PARAMS(MEM_BUFFER_READ_RECT, mem_buffer_read_rect)
+      ENQUEUE_PARAMS(MEM_BUFFER_WRITE_RECT, mem_buffer_write_rect)
+      ENQUEUE_PARAMS(MEM_BUFFER_COPY, mem_buffer_copy)
+      ENQUEUE_PARAMS(MEM_BUFFER_COPY_RECT, mem_buffer_copy_rect)
+      ENQUEUE_PARAMS(MEM_BUFFER_FILL, mem_buffer_fill)
+      ENQUEUE_PARAMS(MEM_IMAGE_READ, mem_image_read)
+      ENQUEUE_PARAMS(MEM_IMAGE_WRITE, mem_image_write)
+      ENQUEUE_PARAMS(MEM_IMAGE_COPY, mem_image_copy)
+      ENQUEUE_PARAMS(MEM_BUFFER_MAP, mem_buffer_map)
+      ENQUEUE_PARAMS(MEM_UNMAP, mem_unmap)
+      ENQUEUE_PARAMS(USM_FILL, usm_fill)
+      ENQUEUE_PARAMS(USM_MEMCPY, usm_memcpy)
+      ENQUEUE_PARAMS(USM_PREFETCH, usm_prefetch)
+      ENQUEUE_PARAMS(USM_ADVISE, usm_advise)
+      ENQUEUE_PARAMS(USM_FILL_2D, usm_fill_2d)
+      ENQUEUE_PARAMS(USM_MEMCPY_2D, usm_memcpy_2d)
+      ENQUEUE_PARAMS(DEVICE_GLOBAL_VARIABLE_WRITE, device_global_variable_write)
+      ENQUEUE_PARAMS(DEVICE_GLOBAL_VARIABLE_READ, device_global_variable_read)
+      ENQUEUE_PARAMS(READ_HOST_PIPE, read_host_pipe)
+      ENQUEUE_PARAMS(WRITE_HOST_PIPE, write_host_pipe)
+      ENQUEUE_PARAMS(KERNEL_LAUNCH_CUSTOM_EXP, kernel_launch_custom_exp)
+      ENQUEUE_PARAMS(EVENTS_WAIT_WITH_BARRIER_EXT, events_wait_with_barrier_ext)
+      ENQUEUE_PARAMS(COOPERATIVE_KERNEL_LAUNCH_EXP,
+                     cooperative_kernel_launch_exp)
+      ENQUEUE_PARAMS(TIMESTAMP_RECORDING_EXP, timestamp_recording_exp)
+      ENQUEUE_PARAMS(NATIVE_COMMAND_EXP, native_command_exp)
+    default:
+      return std::nullopt;
+    }
+#undef ENQUEUE_PARAMS
+  }
 
-std::optional<fn_context> pop_instance_data(uint64_t instance) {
-  if (instance_data.empty()) {
-    return std::nullopt;
+  void warn_once(const char *function_name, ur_result_t result) {
+    if (!warned) {
+      warned = true;
+      out.warn("failed to query when {} ran on the device ({}), commands "
+               "without profiling info are left out of the timeline",
+               function_name, result);
+    }
   }
-  auto data = instance_data.top();
-  if (data.instance != instance) {
-    return std::nullopt;
+
+  // Difference between the device timer and Clock, to put device spans on the
+  // same time axis as the calls
+  int64_t device_offset(ur_queue_handle_t queue) {
+    ur_device_handle_t device = nullptr;
+    if (urQueueGetInfo(queue, UR_QUEUE_INFO_DEVICE, sizeof(device), &device,
+                       nullptr) != UR_RESULT_SUCCESS) {
+      return 0;
+    }
+    auto [it, inserted] = device_offsets.try_emplace(device, 0);
+    if (inserted) {
+      uint64_t device_ts = 0;
+      auto before = Clock::now();
+      auto result = urDeviceGetGlobalTimestamps(device, &device_ts, nullptr);
+      auto after = Clock::now();
+      if (result == UR_RESULT_SUCCESS) {
+        auto host_ts = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           (before + (after - before) / 2).time_since_epoch())
+                           .count();
+        it->second = host_ts - static_cast<int64_t>(device_ts);
+      }
+    }
+    return it->second;
   }
-  instance_data.pop();
-  return data;
-}
+
+  std::optional<device_span> query(const command &cmd) {
+    uint64_t ts[4] = {};
+    const ur_profiling_info_t props[4] = {
+        UR_PROFILING_INFO_COMMAND_QUEUED, UR_PROFILING_INFO_COMMAND_SUBMIT,
+        UR_PROFILING_INFO_COMMAND_START, UR_PROFILING_INFO_COMMAND_END};
+    for (int i = 3; i >= 0; --i) {
+      auto result = urEventGetProfilingInfo(cmd.event, props[i], sizeof(ts[i]),
+                                            &ts[i], nullptr);
+      if (result == UR_RESULT_SUCCESS) {
+        continue;
+      }
+      // Not every adapter knows when commands were queued or submitted
+      if (props[i] == UR_PROFILING_INFO_COMMAND_START ||
+          props[i] == UR_PROFILING_INFO_COMMAND_END) {
+        warn_once(cmd.function_name, result);
+        return std::nullopt;
+      }
+      ts[i] = ts[i + 1];
+    }
+    auto offset = device_offset(cmd.queue);
+    auto host = [&](uint64_t device_ts) {
+      return static_cast<uint64_t>(static_cast<int64_t>(device_ts) + offset);
+    };
+    return device_span{cmd.function_name, cmd.queue,   host(ts[0]),
+                       host(ts[1]),       host(ts[2]), host(ts[3])};
+  }
+
+public:
+  void begin(thread_state &state, const xpti::function_with_args_t *fn) {
+    if (fn->function_id == UR_FUNCTION_ADAPTER_RELEASE) {
+      // Events and queues can't outlive the adapter
+      flush(state, true);
+      return;
+    }
+    if (fn->function_id == UR_FUNCTION_QUEUE_CREATE) {
+      auto params = static_cast<ur_queue_create_params_t *>(fn->args_data);
+      if (*params->ppProperties) {
+        state.queue_props = **params->ppProperties;
+      } else {
+        state.queue_props = {UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, nullptr, 0};
+      }
+      state.queue_props.flags |= UR_QUEUE_FLAG_PROFILING_ENABLE;
+      *params->ppProperties = &state.queue_props;
+      return;
+    }
+
+    auto params = get_enqueue_params(fn);
+    if (!params) {
+      return;
+    }
+    state.event = nullptr;
+    state.app_event = *params->pphEvent;
+    *params->pphEvent = &state.event;
+  }
+
+  void end(thread_state &state, const xpti::function_with_args_t *fn,
+           bool traced) {
+    auto resultp = static_cast<const ur_result_t *>(fn->ret_data);
+    switch (fn->function_id) {
+    case UR_FUNCTION_QUEUE_FINISH:
+    case UR_FUNCTION_EVENT_WAIT:
+      flush(state, false);
+      return;
+    default:
+      break;
+    }
+
+    auto params = get_enqueue_params(fn);
+    if (!params) {
+      return;
+    }
+    *params->pphEvent = state.app_event;
+    if (*resultp != UR_RESULT_SUCCESS || !state.event) {
+      return;
+    }
+    // Hand the event to the application, if it asked for it
+    if (state.app_event) {
+      *state.app_event = state.event;
+    }
+
+    auto queue = *params->phQueue;
+    {
+      collector_call_guard guard;
+      if (state.app_event && urEventRetain(state.event) != UR_RESULT_SUCCESS) {
+        return;
+      }
+      if (!traced || urQueueRetain(queue) != UR_RESULT_SUCCESS) {
+        urEventRelease(state.event);
+        return;
+      }
+    }
+    bool full = false;
+    {
+      std::scoped_lock<std::mutex> lock(mutex);
+      pending.push_back({fn->function_name, queue, state.event});
+      full = pending.size() >= flush_at;
+    }
+    if (full) {
+      flush(state, false);
+    }
+  }
+
+  // Writes out the commands that completed, or all of them if wait is set
+  void flush(thread_state &state, bool wait) {
+    collector_call_guard guard;
+    std::scoped_lock<std::mutex> lock(mutex);
+    auto it =
+        std::stable_partition(pending.begin(), pending.end(), [&](auto &cmd) {
+          if (wait) {
+            urEventWait(1, &cmd.event);
+            return false;
+          }
+          ur_event_status_t status = UR_EVENT_STATUS_QUEUED;
+          urEventGetInfo(cmd.event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                         sizeof(status), &status, nullptr);
+          return status != UR_EVENT_STATUS_COMPLETE;
+        });
+    for (auto cmd = it; cmd != pending.end(); ++cmd) {
+      if (auto span = query(*cmd)) {
+        writer()->device(state, *span);
+      }
+      urEventRelease(cmd->event);
+      urQueueRelease(cmd->queue);
+    }
+    pending.erase(it, pending.end());
+    // Doubling what's left keeps the queries per enqueue constant on average
+    auto left = pending.size();
+    flush_at = std::max(MAX_PENDING, left + std::max(MAX_PENDING / 2, left));
+  }
+} timeline;
 
 XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
                                 xpti::trace_event_data_t *, uint64_t instance,
                                 const void *user_data) {
+  if (in_collector) {
+    return;
+  }
   // stop the the clock as the very first thing, only used for TRACE_FN_END
   auto time_for_end = Clock::now();
   auto *args = static_cast<const xpti::function_with_args_t *>(user_data);
 
-  if (auto regex = cli_args.filter) {
-    if (!std::regex_match(args->function_name, *regex)) {
-      out.debug("function {} does not match regex filter, skipping...",
-                args->function_name);
-      return;
+  bool traced = function_filter.matches(args->function_id, args->function_name);
+  if (cli_args.timeline) {
+    // Queues need profiling enabled and commands their events, whether they
+    // are traced or not
+    auto &state = get_thread_state();
+    if (trace_type == TRACE_FN_BEGIN) {
+      timeline.begin(state, args);
+    } else if (trace_type == TRACE_FN_END) {
+      timeline.end(state, args, traced);
     }
   }
-
-  std::ostringstream args_str;
-  if (cli_args.no_args) {
-    args_str << "...";
-  } else {
-    ur::extras::printFunctionParams(
-        args_str, (enum ur_function_t)args->function_id, args->args_data);
+  if (!traced) {
+    return;
   }
 
+  auto &state = get_thread_state();
   if (trace_type == TRACE_FN_BEGIN) {
-    auto ctx = push_instance_data(instance);
-    ctx->start = std::optional(Clock::now());
+    if (state.depth == MAX_CALL_DEPTH) {
+      if (state.skipped_depth++ == 0) {
+        out.warn("Calls nested deeper than {} are not traced, skipping {}...",
+                 MAX_CALL_DEPTH, args->function_name);
+      }
+      return;
+    }
+    auto &ctx = state.call_stack[state.depth++];
+    ctx.instance = instance;
 
-    writer()->begin(instance, args->function_name, args_str.str());
+    writer()->begin(state, instance, args, time_for_end);
+
+    // Start the clock of the call as the very last thing, so that the time
+    // spent in the collector isn't part of the duration of the call
+    ctx.start = Clock::now();
+    state.add_overhead(ctx.start - time_for_end);
   } else if (trace_type == TRACE_FN_END) {
-    auto ctx = pop_instance_data(instance);
-    if (!ctx) {
+    if (state.skipped_depth) {
+      state.skipped_depth--;
+      return;
+    }
+    if (state.depth == 0 ||
+        state.call_stack[state.depth - 1].instance != instance) {
       out.error("Received TRACE_FN_END without corresponding "
                 "TRACE_FN_BEGIN, instance {}. Skipping...",
                 instance);
       return;
     }
-    auto resultp = static_cast<const ur_result_t *>(args->ret_data);
+    auto &ctx = state.call_stack[--state.depth];
+
+    writer()->end(state, instance, args, time_for_end, ctx.start);
 
-    writer()->end(instance, args->function_name, args_str.str(), time_for_end,
-                  *ctx->start, resultp);
+    state.calls.store(state.calls.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    state.add_overhead(Clock::now() - time_for_end);
   } else {
     out.warn("unsupported trace type");
   }
@@ -5,6 +5,8 @@
 # See LICENSE.TXT
 # SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 import argparse
+import json
+import struct
 import subprocess  # nosec B404
 import os
 import sys
@@ -31,6 +33,74 @@ def get_dynamic_library_name(name):
     else:
         sys.exit("Unsupported platform: {}".format(sys.platform))
 
+# Layout of the files written by the tracing layer when UR_TRACING_BINARY_OUTPUT
+# is set, see source/loader/layers/tracing/ur_tracing_binary.hpp.
+BINARY_TRACE_MAGIC = b"URTRACE\0"
+BINARY_TRACE_VERSION = 2
+BINARY_TRACE_HEADER = struct.Struct("<8sIIQQQQ16x")
+BINARY_TRACE_RECORD = struct.Struct("<QQIIiI4Q")
+BINARY_TRACE_MAX_FUNCTIONS = 512
+BINARY_TRACE_NAME_SIZE = 64
+
+def read_binary_trace(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < BINARY_TRACE_HEADER.size:
+        sys.exit("{} is not a supported binary trace".format(path))
+    magic, version, record_size, record_count, overwritten, name_table_offset, records_offset = BINARY_TRACE_HEADER.unpack_from(data, 0)
+    if magic != BINARY_TRACE_MAGIC or version != BINARY_TRACE_VERSION or record_size != BINARY_TRACE_RECORD.size:
+        sys.exit("{} is not a supported binary trace".format(path))
+
+    names = {}
+    for function_id in range(BINARY_TRACE_MAX_FUNCTIONS):
+        offset = name_table_offset + function_id * BINARY_TRACE_NAME_SIZE
+        name = data[offset:offset + BINARY_TRACE_NAME_SIZE].split(b"\0", 1)[0]
+        if name:
+            names[function_id] = name.decode()
+
+    # Every slot of every thread's region is scanned, a process that crashed
+    # leaves a file with the header as of the last flush.
+    record_count = min(record_count, (len(data) - records_offset) // record_size)
+    records = []
+    for begin, end, function_id, thread_id, result, num_handles, *handles in BINARY_TRACE_RECORD.iter_unpack(
+            data[records_offset:records_offset + record_count * record_size]):
+        # slots never written, or calls still in flight
+        if function_id == 0 or end == 0:
+            continue
+        records.append({
+            "begin": begin,
+            "end": end,
+            "name": names.get(function_id, "function_{}".format(function_id)),
+            "tid": thread_id,
+            "result": result,
+            "handles": handles[:num_handles],
+        })
+    records.sort(key=lambda r: r["begin"])
+    return records, overwritten
+
+def decode_binary_trace(path, as_json, out):
+    records, overwritten = read_binary_trace(path)
+    if as_json:
+        events = [{
+            "cat": "UR",
+            "ph": "X",
+            "pid": 0,
+            "tid": r["tid"],
+            "ts": r["begin"] / 1000,
+            "dur": (r["end"] - r["begin"]) / 1000,
+            "name": r["name"],
+            "args": {"handles": [hex(h) for h in r["handles"]], "result": r["result"]},
+        } for r in records]
+        json.dump({"traceEvents": events}, out)
+        out.write("\n")
+    else:
+        for r in records:
+            handles = ", ".join(hex(h) for h in r["handles"])
+            out.write("[{}] {}({}) -> {}; ({}ns)\n".format(
+                r["tid"], r["name"], handles, r["result"], r["end"] - r["begin"]))
+    if overwritten:
+        print("warning: the {} oldest records were overwritten while tracing".format(overwritten), file=sys.stderr)
+
 parser = argparse.ArgumentParser(
     description = """Unified Runtime tracing tool.
     %(prog)s is a program that runs the specified command until its exit,
@@ -41,7 +111,10 @@ parser = argparse.ArgumentParser(
 
     %(prog)s ./myapp --myapp-arg
     %(prog)s --mock --profiling --filter ".*(Device|Platform).*" ./hello_world
-    %(prog)s --adapter libur_adapter_cuda.so --begin ./sycl_app''',
+    %(prog)s --adapter libur_adapter_cuda.so --begin ./sycl_app
+    %(prog)s --summary --summary-by kernel ./sycl_app
+    %(prog)s --timeline --json --file sycl_app.json ./sycl_app
+    %(prog)s --binary-output app.urtrace ./myapp && %(prog)s --decode app.urtrace --json''',
     formatter_class=argparse.RawDescriptionHelpFormatter)
 parser.add_argument("command", help="Command to run, including arguments.", nargs=argparse.REMAINDER)
 parser.add_argument("--profiling", help="Measure function execution time.", action="store_true")
@@ -54,10 +127,17 @@ group.add_argument("--file", help="Write trace output to a file with the given n
 group.add_argument("--stdout", help="Write trace output to stdout instead of stderr.", action="store_true")
 parser.add_argument("--no-args", help="Don't pretty print traced functions arguments.", action="store_true")
 parser.add_argument("--print-begin", help="Print on function begin.", action="store_true")
+parser.add_argument("--buffered", help="Buffer the output of every thread and write it out at exit, ordered by time.", action="store_true")
+parser.add_argument("--summary", help="Instead of tracing every call, print a table with the count, total, mean, min, max and percentiles of the duration of every function at exit.", action="store_true")
+parser.add_argument("--summary-by", choices=['function', 'queue', 'kernel'], default='function', help="Break down the summary by the queue calls were made on, or by the name of launched kernels.")
+parser.add_argument("--summary-interval", type=int, metavar="SECONDS", help="Also print a summary of the calls made in every interval of the given number of seconds.")
+parser.add_argument("--timeline", help="Also record when enqueued commands ran on the device, using event profiling. Queues are created with profiling enabled.", action="store_true")
 parser.add_argument("--time-unit", choices=['ns', 'us', 'ms', 's', 'auto'], default='auto', help="Use a specific unit of time for profiling.")
 parser.add_argument("--libpath", default=['.', '../lib/', '/lib/', '/usr/local/lib/', '/usr/lib/'], action="append", help="Search path for adapters and xpti libraries.")
 parser.add_argument("--recursive", help="Use recursive library search.", action="store_true")
 parser.add_argument("--debug", help="Print tool debug information.", action="store_true")
+parser.add_argument("--binary-output", help="Record calls into a binary trace file instead of using the collector.")
+parser.add_argument("--decode", help="Decode a binary trace file recorded with --binary-output and exit.")
 parser.add_argument("--flush", choices=['debug', 'info', 'warning', 'error'], default='error', help="Set the flushing level of messages.", )
 args = parser.parse_args()
 config = vars(args)
@@ -65,6 +145,14 @@ if args.debug:
     print(config)
 env = os.environ.copy()
 
+if args.decode:
+    if args.file:
+        with open(args.file, "w") as out:
+            decode_binary_trace(args.decode, args.json, out)
+    else:
+        decode_binary_trace(args.decode, args.json, sys.stdout if args.stdout else sys.stderr)
+    sys.exit(0)
+
 collector_args = ""
 if args.print_begin:
     collector_args += "print_begin;"
@@ -78,6 +166,15 @@ if args.no_args:
     collector_args += "no_args;"
 if args.json:
     collector_args += "json;"
+if args.buffered:
+    collector_args += "buffered;"
+if args.timeline:
+    collector_args += "timeline;"
+if args.summary:
+    collector_args += "summary;"
+    collector_args += "summary_by:" + args.summary_by + ";"
+    if args.summary_interval:
+        collector_args += "summary_interval:" + str(args.summary_interval) + ";"
 env['UR_COLLECTOR_ARGS'] = collector_args
 
 log_collector = ""
@@ -94,22 +191,25 @@ else:
     log_collector += "output:stderr"
 env['UR_LOG_COLLECTOR'] = log_collector
 
-env['XPTI_TRACE_ENABLE'] = "1"
-
 env['UR_ENABLE_LAYERS'] = "UR_LAYER_TRACING"
 
-xptifw_lib = get_dynamic_library_name("xptifw")
-xptifw = find_library(args.libpath, xptifw_lib, args.recursive)
-if xptifw is None:
-    sys.exit("unable to find xptifw library - " + xptifw_lib)
-env['XPTI_FRAMEWORK_DISPATCHER'] = xptifw
+if args.binary_output:
+    env['UR_TRACING_BINARY_OUTPUT'] = os.path.abspath(args.binary_output)
+else:
+    env['XPTI_TRACE_ENABLE'] = "1"
+
+    xptifw_lib = get_dynamic_library_name("xptifw")
+    xptifw = find_library(args.libpath, xptifw_lib, args.recursive)
+    if xptifw is None:
+        sys.exit("unable to find xptifw library - " + xptifw_lib)
+    env['XPTI_FRAMEWORK_DISPATCHER'] = xptifw
 
-collector_lib = get_dynamic_library_name("ur_collector")
+    collector_lib = get_dynamic_library_name("ur_collector")
 
-collector = find_library(args.libpath, collector_lib, args.recursive)
-if collector is None:
-    sys.exit("unable to find collector library - " + collector_lib)
-env['XPTI_SUBSCRIBERS'] = collector
+    collector = find_library(args.libpath, collector_lib, args.recursive)
+    if collector is None:
+        sys.exit("unable to find collector library - " + collector_lib)
+    env['XPTI_SUBSCRIBERS'] = collector
 
 force_load = None
 